@@ -36,13 +36,23 @@ void apply_fcn_gate_library(pybind11::module& m, const std::string& lib_name)
 
     m.def(fmt::format("apply_{}_library", lib_name).c_str(),
           &fiction::apply_gate_library<py_cartesian_technology_cell_layout, GateLibrary, GateLyt>, py::arg("layout"),
-          DOC(fiction_apply_gate_library));
+          py::arg("params") = fiction::apply_gate_library_params{}, DOC(fiction_apply_gate_library));
 }
 
 }  // namespace detail
 
 inline void apply_gate_library(pybind11::module& m)
 {
+    namespace py = pybind11;
+
+    py::class_<fiction::apply_gate_library_params>(m, "apply_gate_library_params",
+                                                   DOC(fiction_apply_gate_library_params))
+        .def(py::init<>())
+        .def_readwrite("num_threads", &fiction::apply_gate_library_params::num_threads,
+                       DOC(fiction_apply_gate_library_params_num_threads))
+
+        ;
+
     detail::apply_fcn_gate_library<fiction::qca_one_library, py_cartesian_gate_layout>(m, "qca_one");
     detail::apply_fcn_gate_library<fiction::inml_topolinano_library, py_shifted_cartesian_gate_layout>(m, "topolinano");
     detail::apply_fcn_gate_library<fiction::sidb_bestagon_library, py_hexagonal_gate_layout>(m, "bestagon");
@@ -6,11 +6,17 @@
 #define PYFICTION_DESIGN_SIDB_GATES_HPP
 
 #include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
 
 #include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
 #include <fiction/types.hpp>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstddef>
+#include <vector>
 
 namespace pyfiction
 {
@@ -25,7 +31,20 @@ void design_sidb_gates(pybind11::module& m)
 
     m.def("design_sidb_gates", &fiction::design_sidb_gates<Lyt, py_tt>, py::arg("skeleton"), py::arg("spec"),
           py::arg("params") = fiction::design_sidb_gates_params<fiction::cell<Lyt>>{}, py::arg("stats") = nullptr,
-          DOC(fiction_design_sidb_gates));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_design_sidb_gates));
+
+    m.def(
+        "design_sidb_gates_batch",
+        [](const std::vector<Lyt>& skeletons, const std::vector<py_tt>& spec,
+           const fiction::design_sidb_gates_params<fiction::cell<Lyt>>& params, const std::size_t num_threads)
+        {
+            return batch_apply(
+                skeletons, [&spec, &params](const Lyt& skeleton)
+                { return fiction::design_sidb_gates(skeleton, spec, params); }, num_threads);
+        },
+        py::arg("skeletons"), py::arg("spec"),
+        py::arg("params") = fiction::design_sidb_gates_params<fiction::cell<Lyt>>{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_design_sidb_gates_batch));
 }
 
 }  // namespace detail
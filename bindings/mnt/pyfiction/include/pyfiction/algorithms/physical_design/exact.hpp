@@ -35,6 +35,13 @@ inline void exact(pybind11::module& m)
 
         ;
 
+    py::enum_<fiction::exact_physical_design_backend>(m, "exact_physical_design_backend",
+                                                      DOC(fiction_exact_physical_design_backend))
+        .value("SMT", fiction::exact_physical_design_backend::SMT, DOC(fiction_exact_physical_design_backend_SMT))
+        .value("SAT", fiction::exact_physical_design_backend::SAT, DOC(fiction_exact_physical_design_backend_SAT))
+
+        ;
+
     py::class_<fiction::exact_physical_design_params>(m, "exact_params", DOC(fiction_exact_physical_design_params))
         .def(py::init<>())
         .def_readwrite("scheme", &fiction::exact_physical_design_params::scheme,
@@ -63,6 +70,8 @@ inline void exact(pybind11::module& m)
                        DOC(fiction_exact_physical_design_params_timeout))
         .def_readwrite("technology_specifics", &fiction::exact_physical_design_params::technology_specifics,
                        DOC(fiction_exact_physical_design_params_technology_specifics))
+        .def_readwrite("backend", &fiction::exact_physical_design_params::backend,
+                       DOC(fiction_exact_physical_design_params_backend))
 
         ;
 
@@ -90,20 +99,24 @@ inline void exact(pybind11::module& m)
                       DOC(fiction_exact_physical_design_stats_num_crossings))
         .def_readonly("num_aspect_ratios", &fiction::exact_physical_design_stats::num_aspect_ratios,
                       DOC(fiction_exact_physical_design_stats_num_aspect_ratios))
+        .def_readonly("num_sat_checks", &fiction::exact_physical_design_stats::num_sat_checks,
+                      DOC(fiction_exact_physical_design_stats_num_sat_checks))
+        .def_readonly("num_sat_fallbacks", &fiction::exact_physical_design_stats::num_sat_fallbacks,
+                      DOC(fiction_exact_physical_design_stats_num_sat_fallbacks))
 
         ;
 
     m.def("exact_cartesian", &fiction::exact<py_cartesian_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::exact_physical_design_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_exact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_exact));
 
     m.def("exact_shifted_cartesian", &fiction::exact<py_shifted_cartesian_gate_layout, py_logic_network>,
           py::arg("network"), py::arg("parameters") = fiction::exact_physical_design_params{},
-          py::arg("statistics") = nullptr);
+          py::arg("statistics") = nullptr, py::call_guard<py::gil_scoped_release>());
 
     m.def("exact_hexagonal", &fiction::exact<py_hexagonal_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::exact_physical_design_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_exact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_exact));
 }
 
 }  // namespace pyfiction
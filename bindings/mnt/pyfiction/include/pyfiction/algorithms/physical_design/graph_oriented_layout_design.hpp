@@ -111,7 +111,8 @@ inline void graph_oriented_layout_design(pybind11::module& m)
     m.def("graph_oriented_layout_design",
           &fiction::graph_oriented_layout_design<py_cartesian_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::graph_oriented_layout_design_params{}, py::arg("statistics") = nullptr,
-          py::arg("custom_cost_objective") = nullptr, DOC(fiction_graph_oriented_layout_design));
+          py::arg("custom_cost_objective") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_graph_oriented_layout_design));
 }
 
 }  // namespace pyfiction
@@ -13,9 +13,12 @@
 #include <fiction/algorithms/simulation/sidb/clustercomplete.hpp>
 #include <fiction/layouts/coordinates.hpp>
 
+#include <pybind11/chrono.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <sstream>
+
 namespace pyfiction
 {
 
@@ -28,7 +31,8 @@ void clustercomplete(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("clustercomplete", &fiction::clustercomplete<Lyt>, py::arg("lyt"),
-          py::arg("params") = fiction::clustercomplete_params<>{}, DOC(fiction_clustercomplete));
+          py::arg("params") = fiction::clustercomplete_params<>{}, py::arg("stats") = nullptr,
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_clustercomplete));
 }
 
 }  // namespace detail
@@ -66,9 +70,31 @@ inline void clustercomplete(pybind11::module& m)
                        DOC(fiction_clustercomplete_params_num_overlapping_witnesses_limit_gss))
         .def_readwrite("available_threads", &fiction::clustercomplete_params<>::available_threads,
                        DOC(fiction_clustercomplete_params_available_threads))
+        .def_readwrite("work_splitting_threshold", &fiction::clustercomplete_params<>::work_splitting_threshold,
+                       DOC(fiction_clustercomplete_params_work_splitting_threshold))
         .def_readwrite("report_gss_stats", &fiction::clustercomplete_params<>::report_gss_stats,
                        DOC(fiction_clustercomplete_params_report_gss_stats));
 
+    /**
+     * ClusterComplete statistics.
+     */
+    py::class_<fiction::clustercomplete_stats>(m, "clustercomplete_stats", DOC(fiction_clustercomplete_stats))
+        .def(py::init<>())
+        .def("__repr__",
+             [](const fiction::clustercomplete_stats& stats)
+             {
+                 std::stringstream stream{};
+                 stats.report(stream);
+                 return stream.str();
+             })
+        .def("report", &fiction::clustercomplete_stats::report, DOC(fiction_clustercomplete_stats_report))
+        .def_readonly("time_total", &fiction::clustercomplete_stats::time_total,
+                      DOC(fiction_clustercomplete_stats_time_total))
+        .def_readonly("time_ground_state_space", &fiction::clustercomplete_stats::time_ground_state_space,
+                      DOC(fiction_clustercomplete_stats_time_ground_state_space))
+        .def_readonly("time_unfolding", &fiction::clustercomplete_stats::time_unfolding,
+                      DOC(fiction_clustercomplete_stats_time_unfolding));
+
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
     detail::clustercomplete<py_sidb_100_lattice>(m);
@@ -7,13 +7,16 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
 
 #include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace pyfiction
 {
@@ -28,11 +31,24 @@ void critical_temperature(pybind11::module& m)
 
     m.def("critical_temperature_gate_based", &fiction::critical_temperature_gate_based<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_gate_based));
+
+    m.def(
+        "critical_temperature_gate_based_batch",
+        [](const std::vector<Lyt>& layouts, const std::vector<py_tt>& spec,
+           const fiction::critical_temperature_params& params, const std::size_t num_threads)
+        {
+            return batch_apply(
+                layouts, [&spec, &params](const Lyt& lyt)
+                { return fiction::critical_temperature_gate_based(lyt, spec, params); }, num_threads);
+        },
+        py::arg("layouts"), py::arg("spec"), py::arg("params") = fiction::critical_temperature_params{},
+        py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+        DOC(pyfiction_critical_temperature_gate_based_batch));
 
     m.def("critical_temperature_non_gate_based", &fiction::critical_temperature_non_gate_based<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_non_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_non_gate_based));
 }
 
 }  // namespace detail
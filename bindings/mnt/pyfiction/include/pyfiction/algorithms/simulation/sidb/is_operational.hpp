@@ -7,6 +7,7 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
 
 #include <fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp>
 #include <fiction/algorithms/simulation/sidb/is_operational.hpp>
@@ -14,6 +15,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
 #include <optional>
 #include <vector>
 
@@ -32,14 +34,27 @@ void is_operational(pybind11::module& m)
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
               &fiction::is_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
-          DOC(fiction_is_operational));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_is_operational));
 
     m.def("is_operational",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&,
                             const std::vector<fiction::bdl_wire<Lyt>>&, const std::vector<fiction::bdl_wire<Lyt>>&,
                             const std::optional<Lyt>&>(&fiction::is_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params"), py::arg("input_bdl_wire"), py::arg("output_bdl_wire"),
-          py::arg("canvas_lyt") = std::nullopt, DOC(fiction_is_operational_2));
+          py::arg("canvas_lyt") = std::nullopt, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_is_operational_2));
+
+    m.def(
+        "is_operational_batch",
+        [](const std::vector<Lyt>& layouts, const std::vector<py_tt>& spec,
+           const fiction::is_operational_params& params, const std::size_t num_threads)
+        {
+            return batch_apply(
+                layouts, [&spec, &params](const Lyt& lyt) { return fiction::is_operational(lyt, spec, params); },
+                num_threads);
+        },
+        py::arg("layouts"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
+        py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_is_operational_batch));
 
     m.def("operational_input_patterns",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
@@ -7,14 +7,26 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
+#include "pyfiction/utils/buffer_view.hpp"
 
 #include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/technology/constants.hpp>
 
 #include <fmt/format.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace pyfiction
@@ -30,19 +42,83 @@ void operational_domain(pybind11::module& m)
 
     m.def("operational_domain_grid_search", &fiction::operational_domain_grid_search<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_operational_domain_grid_search));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_grid_search));
 
     m.def("operational_domain_random_sampling", &fiction::operational_domain_random_sampling<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_random_sampling));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_random_sampling));
 
     m.def("operational_domain_flood_fill", &fiction::operational_domain_flood_fill<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_flood_fill));
 
     m.def("operational_domain_contour_tracing", &fiction::operational_domain_contour_tracing<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_contour_tracing));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_contour_tracing));
+
+    m.def("operational_domain_adaptive_refinement", &fiction::operational_domain_adaptive_refinement<Lyt, py_tt>,
+          py::arg("lyt"), py::arg("spec"), py::arg("initial_cell_size"),
+          py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_adaptive_refinement));
+}
+
+/**
+ * Rasterizes a simulation domain onto the dense grid that is spanned by the given sweep dimensions. The grid's axes are
+ * the values returned by `fiction::sweep_dimension_values`, i.e., exactly the parameter values that a grid search with
+ * the same sweep dimensions samples. Parameter points that do not lie on the grid are ignored.
+ *
+ * @tparam Domain Simulation domain type.
+ * @tparam Fn Functor type that is called with the row-major grid index and the value of each point on the grid.
+ * @param domain The simulation domain to rasterize.
+ * @param sweep_dimensions The sweep dimensions that span the grid, one for each of the domain's dimensions.
+ * @param fn Functor to call for each parameter point that lies on the grid.
+ * @return The grid's axes and shape.
+ */
+template <typename Domain, typename Fn>
+std::pair<std::vector<std::vector<double>>, std::vector<pybind11::ssize_t>>
+rasterize_domain(const Domain& domain, const std::vector<fiction::operational_domain_value_range>& sweep_dimensions,
+                 Fn&& fn)
+{
+    if (sweep_dimensions.size() != domain.get_number_of_dimensions())
+    {
+        throw pybind11::value_error("the number of sweep dimensions does not match the domain's dimensions");
+    }
+
+    std::vector<std::vector<double>> axes{};
+    std::vector<pybind11::ssize_t>   shape{};
+
+    for (const auto& range : sweep_dimensions)
+    {
+        axes.push_back(fiction::sweep_dimension_values(range));
+        shape.push_back(static_cast<pybind11::ssize_t>(axes.back().size()));
+    }
+
+    domain.for_each(
+        [&axes, &fn](const fiction::parameter_point& pp, const auto& value)
+        {
+            std::size_t index = 0;
+
+            for (std::size_t d = 0; d < axes.size(); ++d)
+            {
+                const auto v  = pp.get_parameters()[d];
+                const auto it = std::lower_bound(axes[d].cbegin(), axes[d].cend(),
+                                                 v - fiction::constants::ERROR_MARGIN);
+
+                if (it == axes[d].cend() || std::fabs(*it - v) >= fiction::constants::ERROR_MARGIN)
+                {
+                    return;
+                }
+
+                index = index * axes[d].size() + static_cast<std::size_t>(std::distance(axes[d].cbegin(), it));
+            }
+
+            fn(index, value);
+        });
+
+    return {std::move(axes), std::move(shape)};
 }
 
 template <typename Lyt>
@@ -52,21 +128,29 @@ void critical_temperature_domain(pybind11::module& m)
 
     m.def("critical_temperature_domain_grid_search", &fiction::critical_temperature_domain_grid_search<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_grid_search));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_grid_search));
 
     m.def("critical_temperature_domain_random_sampling",
           &fiction::critical_temperature_domain_random_sampling<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_random_sampling));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_random_sampling));
 
     m.def("critical_temperature_domain_flood_fill", &fiction::critical_temperature_domain_flood_fill<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_flood_fill));
 
     m.def("critical_temperature_domain_contour_tracing",
           &fiction::critical_temperature_domain_contour_tracing<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_contour_tracing));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_contour_tracing));
+
+    m.def("critical_temperature_domain_adaptive_refinement",
+          &fiction::critical_temperature_domain_adaptive_refinement<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
+          py::arg("initial_cell_size"), py::arg("params") = fiction::operational_domain_params{},
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_adaptive_refinement));
 }
 
 }  // namespace detail
@@ -163,6 +247,32 @@ inline void operational_domain(pybind11::module& m)
                  self.for_each([&items](const auto& key, const auto& value) { items.emplace_back(key, value); });
                  return items;
              })
+        .def(
+            "to_dense_grid",
+            [](const fiction::critical_temperature_domain&                 self,
+               const std::vector<fiction::operational_domain_value_range>& sweep_dimensions)
+            {
+                std::size_t num_points = 1;
+                for (const auto& range : sweep_dimensions)
+                {
+                    num_points *= fiction::sweep_dimension_values(range).size();
+                }
+
+                auto status = std::make_shared<std::vector<int8_t>>(num_points, int8_t{-1});
+                auto ct = std::make_shared<std::vector<double>>(num_points, std::numeric_limits<double>::quiet_NaN());
+
+                auto [axes, shape] =
+                    detail::rasterize_domain(self, sweep_dimensions,
+                                             [&status, &ct](const std::size_t i, const auto& value)
+                                             {
+                                                 (*status)[i] = static_cast<int8_t>(std::get<0>(value));
+                                                 (*ct)[i]     = std::get<1>(value);
+                                             });
+
+                return py::make_tuple(axes, buffer_view::of<int8_t>(std::move(status), shape),
+                                      buffer_view::of<double>(std::move(ct), shape));
+            },
+            py::arg("sweep_dimensions"), DOC(pyfiction_critical_temperature_domain_to_dense_grid))
 
         ;
 
@@ -229,6 +339,26 @@ inline void operational_domain(pybind11::module& m)
                                { items.emplace_back(key, std::get<0>(value)); });
                  return items;
              })
+        .def(
+            "to_dense_grid",
+            [](const fiction::operational_domain&                          self,
+               const std::vector<fiction::operational_domain_value_range>& sweep_dimensions)
+            {
+                std::size_t num_points = 1;
+                for (const auto& range : sweep_dimensions)
+                {
+                    num_points *= fiction::sweep_dimension_values(range).size();
+                }
+
+                auto status = std::make_shared<std::vector<int8_t>>(num_points, int8_t{-1});
+
+                auto [axes, shape] =
+                    detail::rasterize_domain(self, sweep_dimensions, [&status](const std::size_t i, const auto& value)
+                                             { (*status)[i] = static_cast<int8_t>(std::get<0>(value)); });
+
+                return py::make_tuple(axes, buffer_view::of<int8_t>(std::move(status), shape));
+            },
+            py::arg("sweep_dimensions"), DOC(pyfiction_operational_domain_to_dense_grid))
 
         ;
 
@@ -254,7 +384,11 @@ inline void operational_domain(pybind11::module& m)
         .def_readwrite("operational_params", &fiction::operational_domain_params::operational_params,
                        DOC(fiction_operational_domain_params_operational_params))
         .def_readwrite("sweep_dimensions", &fiction::operational_domain_params::sweep_dimensions,
-                       DOC(fiction_operational_domain_params_sweep_dimensions));
+                       DOC(fiction_operational_domain_params_sweep_dimensions))
+        .def_readwrite("checkpoint_file", &fiction::operational_domain_params::checkpoint_file,
+                       DOC(fiction_operational_domain_params_checkpoint_file))
+        .def_readwrite("checkpoint_interval", &fiction::operational_domain_params::checkpoint_interval,
+                       DOC(fiction_operational_domain_params_checkpoint_interval));
 
     py::class_<fiction::operational_domain_stats>(m, "operational_domain_stats", DOC(fiction_operational_domain_stats))
         .def(py::init<>())
@@ -273,6 +407,11 @@ inline void operational_domain(pybind11::module& m)
                       DOC(fiction_operational_domain_stats_num_non_operational_parameter_combinations))
         .def_readonly("num_total_parameter_points", &fiction::operational_domain_stats::num_total_parameter_points,
                       DOC(fiction_operational_domain_stats_num_total_parameter_points))
+        .def_readonly("num_restored_parameter_points",
+                      &fiction::operational_domain_stats::num_restored_parameter_points,
+                      DOC(fiction_operational_domain_stats_num_restored_parameter_points))
+        .def_readonly("num_checkpoints", &fiction::operational_domain_stats::num_checkpoints,
+                      DOC(fiction_operational_domain_stats_num_checkpoints))
 
         ;
 
@@ -0,0 +1,140 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef PYFICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
+#define PYFICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain_worker_pool.hpp>
+
+#include <fmt/format.h>
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+void operational_domain_worker_pool(pybind11::module& m, const std::string& lattice = "")
+{
+    namespace py = pybind11;
+
+    py::class_<fiction::local_operational_domain_worker_pool<Lyt, py_tt>, fiction::operational_domain_worker_pool>(
+        m, fmt::format("local_operational_domain_worker_pool_{}", lattice).c_str(),
+        DOC(fiction_local_operational_domain_worker_pool))
+        .def(py::init<const Lyt&, const std::vector<py_tt>&, const fiction::operational_domain_params&,
+                      const std::size_t>(),
+             py::arg("lyt"), py::arg("spec"), py::arg("params"),
+             py::arg("num_workers") = std::thread::hardware_concurrency(),
+             // the pool references the layout
+             py::keep_alive<1, 2>(),
+             DOC(fiction_local_operational_domain_worker_pool_local_operational_domain_worker_pool))
+
+        ;
+
+    m.def("operational_domain_worker", &fiction::operational_domain_worker<Lyt, py_tt>, py::arg("lyt"),
+          py::arg("spec"), py::arg("params"), py::arg("directory"),
+          py::arg("worker_params") = fiction::operational_domain_worker_params{},
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_worker));
+
+    m.def("operational_domain_distributed", &fiction::operational_domain_distributed<Lyt, py_tt>, py::arg("lyt"),
+          py::arg("spec"), py::arg("pool"), py::arg("params") = fiction::distributed_operational_domain_params{},
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_distributed));
+}
+
+}  // namespace detail
+
+inline void operational_domain_worker_pool(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::enum_<fiction::distributed_sweep_algorithm>(m, "distributed_sweep_algorithm",
+                                                    DOC(fiction_distributed_sweep_algorithm))
+        .value("GRID_SEARCH", fiction::distributed_sweep_algorithm::GRID_SEARCH,
+               DOC(fiction_distributed_sweep_algorithm_GRID_SEARCH))
+        .value("RANDOM_SAMPLING", fiction::distributed_sweep_algorithm::RANDOM_SAMPLING,
+               DOC(fiction_distributed_sweep_algorithm_RANDOM_SAMPLING))
+        .value("FLOOD_FILL", fiction::distributed_sweep_algorithm::FLOOD_FILL,
+               DOC(fiction_distributed_sweep_algorithm_FLOOD_FILL))
+        .value("CONTOUR_TRACING", fiction::distributed_sweep_algorithm::CONTOUR_TRACING,
+               DOC(fiction_distributed_sweep_algorithm_CONTOUR_TRACING))
+
+        ;
+
+    py::class_<fiction::distributed_operational_domain_params>(m, "distributed_operational_domain_params",
+                                                               DOC(fiction_distributed_operational_domain_params))
+        .def(py::init<>())
+        .def_readwrite("domain_params", &fiction::distributed_operational_domain_params::domain_params,
+                       DOC(fiction_distributed_operational_domain_params_domain_params))
+        .def_readwrite("algorithm", &fiction::distributed_operational_domain_params::algorithm,
+                       DOC(fiction_distributed_operational_domain_params_algorithm))
+        .def_readwrite("samples", &fiction::distributed_operational_domain_params::samples,
+                       DOC(fiction_distributed_operational_domain_params_samples))
+        .def_readwrite("batch_size", &fiction::distributed_operational_domain_params::batch_size,
+                       DOC(fiction_distributed_operational_domain_params_batch_size))
+
+        ;
+
+    py::class_<fiction::operational_domain_worker_params>(m, "operational_domain_worker_params",
+                                                          DOC(fiction_operational_domain_worker_params))
+        .def(py::init<>())
+        .def_readwrite("poll_interval", &fiction::operational_domain_worker_params::poll_interval,
+                       DOC(fiction_operational_domain_worker_params_poll_interval))
+
+        ;
+
+    py::class_<fiction::shared_directory_worker_pool_params>(m, "shared_directory_worker_pool_params",
+                                                             DOC(fiction_shared_directory_worker_pool_params))
+        .def(py::init<>())
+        .def_readwrite("capacity", &fiction::shared_directory_worker_pool_params::capacity,
+                       DOC(fiction_shared_directory_worker_pool_params_capacity))
+        .def_readwrite("poll_interval", &fiction::shared_directory_worker_pool_params::poll_interval,
+                       DOC(fiction_shared_directory_worker_pool_params_poll_interval))
+        .def_readwrite("resubmission_timeout", &fiction::shared_directory_worker_pool_params::resubmission_timeout,
+                       DOC(fiction_shared_directory_worker_pool_params_resubmission_timeout))
+
+        ;
+
+    py::class_<fiction::operational_domain_worker_pool>(m, "operational_domain_worker_pool",
+                                                        DOC(fiction_operational_domain_worker_pool))
+        .def("capacity", &fiction::operational_domain_worker_pool::capacity,
+             DOC(fiction_operational_domain_worker_pool_capacity))
+
+        ;
+
+    py::class_<fiction::shared_directory_operational_domain_worker_pool, fiction::operational_domain_worker_pool>(
+        m, "shared_directory_operational_domain_worker_pool",
+        DOC(fiction_shared_directory_operational_domain_worker_pool))
+        .def(py::init<std::filesystem::path, fiction::shared_directory_worker_pool_params>(), py::arg("directory"),
+             py::arg("params") = fiction::shared_directory_worker_pool_params{},
+             DOC(fiction_shared_directory_operational_domain_worker_pool_shared_directory_operational_domain_worker_pool))
+        .def("finish", &fiction::shared_directory_operational_domain_worker_pool::finish,
+             DOC(fiction_shared_directory_operational_domain_worker_pool_finish))
+
+        ;
+
+    // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
+
+    detail::operational_domain_worker_pool<py_sidb_100_lattice>(m, "100");
+    detail::operational_domain_worker_pool<py_sidb_111_lattice>(m, "111");
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
@@ -7,6 +7,7 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
 
 #include <fiction/algorithms/simulation/sidb/quickexact.hpp>
 #include <fiction/layouts/coordinates.hpp>
@@ -14,6 +15,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
+#include <vector>
+
 namespace pyfiction
 {
 
@@ -26,7 +30,29 @@ void quickexact(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quickexact", &fiction::quickexact<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quickexact_params<>{},
-          DOC(fiction_quickexact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quickexact));
+
+    m.def(
+        "quickexact_batch",
+        [](const std::vector<Lyt>& layouts, const fiction::quickexact_params<fiction::cell<Lyt>>& params,
+           const std::size_t num_threads)
+        {
+            return batch_apply(
+                layouts, [&params](const Lyt& lyt) { return fiction::quickexact(lyt, params); }, num_threads);
+        },
+        py::arg("layouts"), py::arg("params") = fiction::quickexact_params<>{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_quickexact_batch));
+
+    m.def(
+        "quickexact_batch",
+        [](const Lyt& lyt, const std::vector<fiction::quickexact_params<fiction::cell<Lyt>>>& params,
+           const std::size_t num_threads)
+        {
+            return batch_apply(
+                params, [&lyt](const auto& p) { return fiction::quickexact(lyt, p); }, num_threads);
+        },
+        py::arg("lyt"), py::arg("params"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+        DOC(pyfiction_quickexact_batch_params));
 }
 
 }  // namespace detail
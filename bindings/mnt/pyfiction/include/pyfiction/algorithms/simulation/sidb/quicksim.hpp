@@ -7,12 +7,16 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/batch_utils.hpp"
 
 #include <fiction/algorithms/simulation/sidb/quicksim.hpp>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
+#include <vector>
+
 namespace pyfiction
 {
 
@@ -25,7 +29,17 @@ void quicksim(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quicksim", &fiction::quicksim<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quicksim_params{},
-          DOC(fiction_quicksim));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quicksim));
+
+    m.def(
+        "quicksim_batch",
+        [](const std::vector<Lyt>& layouts, const fiction::quicksim_params& params, const std::size_t num_threads)
+        {
+            return batch_apply(
+                layouts, [&params](const Lyt& lyt) { return fiction::quicksim(lyt, params); }, num_threads);
+        },
+        py::arg("layouts"), py::arg("params") = fiction::quicksim_params{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_quicksim_batch));
 }
 
 }  // namespace detail
@@ -92,4 +92,298 @@ empty layout coordinates.
 Returns:
     The minimum  and maximum enclosing coordinate in the associated layout.)doc";
 
+static const char* __doc_pyfiction_quickexact_batch =
+    R"doc(Simulates multiple SiDB layouts with *QuickExact* in parallel. The GIL
+is released while the layouts are simulated such that other Python
+threads can make progress.
+
+Parameter ``layouts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    Parameters used for all simulations.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The simulation results in the order of ``layouts``.)doc";
+
+static const char* __doc_pyfiction_quickexact_batch_params =
+    R"doc(Simulates a single SiDB layout with *QuickExact* under multiple
+parameter sets in parallel, e.g., to sweep physical parameters. The GIL
+is released while the layout is simulated such that other Python
+threads can make progress.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``params``:
+    The parameter sets to simulate the layout with.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The simulation results in the order of ``params``.)doc";
+
+static const char* __doc_pyfiction_quicksim_batch =
+    R"doc(Simulates multiple SiDB layouts with *QuickSim* in parallel. The GIL
+is released while the layouts are simulated such that other Python
+threads can make progress.
+
+Parameter ``layouts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    Parameters used for all simulations.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The simulation results in the order of ``layouts``. An entry is
+    ``None`` if *QuickSim* did not find a valid charge distribution for
+    the respective layout.)doc";
+
+static const char* __doc_pyfiction_is_operational_batch =
+    R"doc(Determines the operational status of multiple SiDB gate layouts in
+parallel. The GIL is released during the evaluation such that other
+Python threads can make progress.
+
+Parameter ``layouts``:
+    The gate layouts to evaluate.
+
+Parameter ``spec``:
+    Expected Boolean function of all layouts given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Parameters used for all evaluations.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    A pair of operational status and number of evaluated input
+    combinations for each layout in the order of ``layouts``.)doc";
+
+static const char* __doc_pyfiction_critical_temperature_gate_based_batch =
+    R"doc(Computes the critical temperature of multiple SiDB gate layouts in
+parallel. The GIL is released during the computation such that other
+Python threads can make progress.
+
+Parameter ``layouts``:
+    The gate layouts to evaluate.
+
+Parameter ``spec``:
+    Expected Boolean function of all layouts given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Parameters used for all computations.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The critical temperature (in K) of each layout in the order of
+    ``layouts``.)doc";
+
+static const char* __doc_pyfiction_operational_domain_grid_search_batch =
+    R"doc(Computes the operational domains of multiple SiDB gate layouts via
+grid search in parallel. The GIL is released during the computation
+such that other Python threads can make progress.
+
+Parameter ``layouts``:
+    The gate layouts to evaluate.
+
+Parameter ``spec``:
+    Expected Boolean function of all layouts given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Operational domain computation parameters used for all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The operational domain of each layout in the order of ``layouts``.)doc";
+
+static const char* __doc_pyfiction_design_sidb_gates_batch =
+    R"doc(Designs SiDB gates for multiple skeletons in parallel. The GIL is
+released during the design process such that other Python threads can
+make progress.
+
+Parameter ``skeletons``:
+    The skeleton layouts to design gates for.
+
+Parameter ``spec``:
+    Expected Boolean function of all gates given as a multi-output truth
+    table.
+
+Parameter ``params``:
+    Parameters used for all designs.
+
+Parameter ``num_threads``:
+    Number of threads to use. If 0, the number of hardware threads is
+    used.
+
+Returns:
+    The designed gate layouts for each skeleton in the order of
+    ``skeletons``.)doc";
+
+static const char* __doc_pyfiction_buffer_view =
+    R"doc(A read-only view of contiguous data owned by a C++ object that
+implements Python's buffer protocol. Wrapping a view in ``memoryview``
+or ``numpy.asarray`` accesses the data without copying it.
+
+The view keeps the data alive independently of the object it was
+obtained from. Buffers requested after the data was modified reflect
+its current contents. If the number of elements changed, requesting a
+buffer raises a ``BufferError``.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_charge_state_view =
+    R"doc(Returns a one-dimensional ``int8`` buffer view of the SiDBs' charge
+states (-1 for negative, 0 for neutral, and 1 for positive) in SiDB
+index order without copying them.
+
+The view reflects subsequent charge state and potential updates of the
+surface. ``assign_cell_type`` re-initializes the surface, after which
+the view keeps referring to the previous state and a new view has to
+be obtained. The same applies to the other views.
+
+Returns:
+    A buffer view of the charge states.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_local_internal_potential_view =
+    R"doc(Returns a one-dimensional ``float64`` buffer view of the local internal
+electrostatic potentials (unit: V) at each SiDB in SiDB index order
+without copying them.
+
+Returns:
+    A buffer view of the local internal potentials.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_local_external_potential_view =
+    R"doc(Returns a one-dimensional ``float64`` buffer view of the local external
+electrostatic potentials (unit: V) at each SiDB in SiDB index order
+without copying them.
+
+Returns:
+    A buffer view of the local external potentials.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_chargeless_potential_matrix_view =
+    R"doc(Returns a two-dimensional ``float64`` buffer view of the chargeless
+electrostatic potentials (unit: V) between all pairs of SiDBs without
+copying them. Entry ``[i, j]`` holds the potential between the SiDBs
+at indices ``i`` and ``j``.
+
+Returns:
+    A buffer view of the potential matrix.)doc";
+
+static const char* __doc_pyfiction_operational_domain_to_dense_grid =
+    R"doc(Rasterizes the operational domain onto the dense grid spanned by the
+given sweep dimensions, which are typically the ones that were used to
+compute the domain.
+
+Parameter ``sweep_dimensions``:
+    One value range for each of the domain's dimensions.
+
+Returns:
+    A tuple of the grid's axes, i.e., one list of parameter values per
+    dimension, and an ``int8`` buffer view of the grid's operational
+    status. Each entry is 0 if the layout is operational at the
+    respective parameter point, 1 if it is non-operational, and -1 if
+    the point was not sampled.)doc";
+
+static const char* __doc_pyfiction_critical_temperature_domain_to_dense_grid =
+    R"doc(Rasterizes the critical temperature domain onto the dense grid spanned
+by the given sweep dimensions, which are typically the ones that were
+used to compute the domain.
+
+Parameter ``sweep_dimensions``:
+    One value range for each of the domain's dimensions.
+
+Returns:
+    A tuple of the grid's axes, an ``int8`` buffer view of the grid's
+    operational status (0 for operational, 1 for non-operational, and
+    -1 for points that were not sampled), and a ``float64`` buffer view
+    of the critical temperatures (unit: K), which are NaN for points
+    that were not sampled.)doc";
+
+static const char* __doc_pyfiction_write_binary_operational_domain =
+    R"doc(Writes a domain to the specified file in a compact binary columnar
+format that can be memory-mapped, e.g., via ``numpy.memmap``, and read
+back via the respective ``read_binary_*`` and ``merge_binary_*``
+functions. Samples are stored as step indices on the grid spanned by
+the given sweep dimensions.
+
+Parameter ``opdom``:
+    The domain to be written.
+
+Parameter ``sweep_dimensions``:
+    The sweep dimensions that were used to compute ``opdom``. They
+    have to match the dimensions of ``opdom`` in number and order.
+
+Parameter ``filename``:
+    The filename where the binary representation of the domain is
+    written to.
+
+Throws:
+    ValueError if the sweep dimensions do not match the domain's
+    dimensions or if a sample does not lie on the step grid.)doc";
+
+static const char* __doc_pyfiction_read_binary_operational_domain =
+    R"doc(Reads a domain from a binary file as written by the respective
+``write_binary_*`` function.
+
+Parameter ``filename``:
+    The name of the file to read from.
+
+Returns:
+    The domain stored in the file.)doc";
+
+static const char* __doc_pyfiction_merge_binary_operational_domain =
+    R"doc(Reads the samples of a binary domain file and merges them into the
+given domain. Samples that are already contained in ``opdom`` take
+precedence. This allows to merge partial sweeps over the same step grid
+and to resume interrupted sweeps. The entire file is validated before
+any sample is merged, i.e., ``opdom`` remains unchanged on errors.
+
+Parameter ``opdom``:
+    The domain to merge the samples into. If it has no dimensions yet,
+    the dimensions of the file are added to it. Otherwise, the file must
+    have the same dimensions and all samples of ``opdom`` must lie on
+    the file's step grid.
+
+Parameter ``filename``:
+    The name of the file to read from.
+
+Returns:
+    The header of the file, which contains the step grid of the sweep.)doc";
+
+static const char* __doc_pyfiction_read_binary_operational_domain_header =
+    R"doc(Reads the header of a binary domain file without reading its samples.
+
+Parameter ``filename``:
+    The name of the file to read from.
+
+Returns:
+    The header of the file.)doc";
+
+static const char* __doc_pyfiction_binary_operational_domain_header =
+    R"doc(Meta data stored in the header of a binary domain file, i.e., the
+kind of the stored domain, the sweep dimensions that define the step
+grid of its samples, and the number of samples.)doc";
+
+static const char* __doc_pyfiction_binary_operational_domain_kind =
+    R"doc(Kind of domain stored in a binary domain file.)doc";
+
 #endif  // PYFICTION_DOCSTRINGS_HPP
@@ -0,0 +1,81 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef PYFICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
+#define PYFICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
+
+#include "pyfiction/documentation.hpp"
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/read_binary_operational_domain.hpp>
+#include <fiction/io/write_binary_operational_domain.hpp>
+
+#include <fmt/format.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <string_view>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename OpDomain>
+void read_binary_operational_domain(pybind11::module& m, const std::string& type)
+{
+    namespace py = pybind11;
+
+    OpDomain (*read_binary_operational_domain_pointer)(const std::string_view&) =
+        &fiction::read_binary_operational_domain<OpDomain>;
+    fiction::binary_operational_domain_header (*merge_binary_operational_domain_pointer)(
+        OpDomain&, const std::string_view&) = &fiction::read_binary_operational_domain<OpDomain>;
+
+    m.def(fmt::format("read_binary_{}", type).c_str(), read_binary_operational_domain_pointer, py::arg("filename"),
+          py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_read_binary_operational_domain));
+    m.def(fmt::format("merge_binary_{}", type).c_str(), merge_binary_operational_domain_pointer, py::arg("opdom"),
+          py::arg("filename"), py::call_guard<py::gil_scoped_release>(),
+          DOC(pyfiction_merge_binary_operational_domain));
+}
+
+}  // namespace detail
+
+inline void read_binary_operational_domain(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::register_exception<fiction::binary_operational_domain_parsing_error>(
+        m, "binary_operational_domain_parsing_error", PyExc_RuntimeError);
+
+    py::enum_<fiction::binary_operational_domain_kind>(m, "binary_operational_domain_kind",
+                                                       DOC(pyfiction_binary_operational_domain_kind))
+        .value("OPERATIONAL_DOMAIN", fiction::binary_operational_domain_kind::OPERATIONAL_DOMAIN)
+        .value("CRITICAL_TEMPERATURE_DOMAIN", fiction::binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN)
+
+        ;
+
+    py::class_<fiction::binary_operational_domain_header>(m, "binary_operational_domain_header",
+                                                          DOC(pyfiction_binary_operational_domain_header))
+        .def(py::init<>())
+        .def_readwrite("kind", &fiction::binary_operational_domain_header::kind)
+        .def_readwrite("sweep_dimensions", &fiction::binary_operational_domain_header::sweep_dimensions)
+        .def_readwrite("num_samples", &fiction::binary_operational_domain_header::num_samples)
+
+        ;
+
+    fiction::binary_operational_domain_header (*read_header_pointer)(const std::string_view&) =
+        &fiction::read_binary_operational_domain_header;
+
+    m.def("read_binary_operational_domain_header", read_header_pointer, py::arg("filename"),
+          DOC(pyfiction_read_binary_operational_domain_header));
+
+    detail::read_binary_operational_domain<fiction::operational_domain>(m, "operational_domain");
+    detail::read_binary_operational_domain<fiction::critical_temperature_domain>(m, "critical_temperature_domain");
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
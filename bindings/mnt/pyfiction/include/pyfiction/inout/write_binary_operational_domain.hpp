@@ -0,0 +1,52 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef PYFICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
+#define PYFICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
+
+#include "pyfiction/documentation.hpp"
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/write_binary_operational_domain.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename OpDomain>
+void write_binary_operational_domain(pybind11::module& m, const std::string& name)
+{
+    namespace py = pybind11;
+
+    void (*write_binary_operational_domain_pointer)(const OpDomain&,
+                                                    const std::vector<fiction::operational_domain_value_range>&,
+                                                    const std::string_view&) =
+        &fiction::write_binary_operational_domain;
+
+    m.def(name.c_str(), write_binary_operational_domain_pointer, py::arg("opdom"), py::arg("sweep_dimensions"),
+          py::arg("filename"), py::call_guard<py::gil_scoped_release>(),
+          DOC(pyfiction_write_binary_operational_domain));
+}
+
+}  // namespace detail
+
+inline void write_binary_operational_domain(pybind11::module& m)
+{
+    detail::write_binary_operational_domain<fiction::operational_domain>(m, "write_binary_operational_domain");
+    detail::write_binary_operational_domain<fiction::critical_temperature_domain>(
+        m, "write_binary_critical_temperature_domain");
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
@@ -261,10 +261,22 @@ Template parameter ``GateLyt``:
 Parameter ``lyt``:
     The gate-level layout.
 
+Parameter ``ps``:
+    Parameters.
+
 Returns:
     A cell-level layout that implements `lyt`'s gate types with
     building blocks defined in `GateLibrary`.)doc";
 
+static const char *__doc_fiction_apply_gate_library_params = R"doc(Parameters for the application of static gate libraries.)doc";
+
+static const char *__doc_fiction_apply_gate_library_params_num_threads =
+R"doc(Number of threads to use for setting up the gate implementations. Each
+thread collects the cells of its share of tiles in a local buffer and
+all buffers are assigned to the cell-level layout in bulk afterward.
+The result is identical to the single-threaded application. For small
+layouts, fewer threads are used.)doc";
+
 static const char *__doc_fiction_apply_gate_library_to_defective_surface =
 R"doc(Applies a gate library to a given gate-level layout and maps the SiDB
 and defect locations onto a defect surface. The gate library type
@@ -289,6 +301,12 @@ Template parameter ``GateLyt``:
 Parameter ``lyt``:
     The gate-level layout.
 
+Parameter ``defect_surface``:
+    Defect surface onto which the layout is mapped.
+
+Parameter ``ps``:
+    Parameters.
+
 Returns:
     A cell-level layout that implements `lyt`'s gate types with
     building blocks defined in `GateLibrary`.)doc";
@@ -2266,6 +2284,16 @@ Parameter ``c``:
 Parameter ``ct``:
     Cell type to assign to `c`.)doc";
 
+static const char *__doc_fiction_cell_level_layout_assign_cell_types =
+R"doc(Assigns cell types to multiple cell positions at once. The storage is
+reserved only once for all given cells, which avoids repeated
+rehashing when large amounts of cells are placed, e.g., when applying
+a gate library. The semantics are equivalent to calling
+`assign_cell_type` for each pair in the given order.
+
+Parameter ``cells``:
+    Pairs of cell positions and the cell types to assign to them.)doc";
+
 static const char *__doc_fiction_cell_level_layout_cell_level_layout =
 R"doc(Standard constructor. Creates a named cell-level layout of the given
 aspect ratio. To this end, it calls `ClockedLayout`'s standard
@@ -2606,6 +2634,14 @@ static const char *__doc_fiction_charge_distribution_surface_4 = R"doc()doc";
 
 static const char *__doc_fiction_charge_distribution_surface_5 = R"doc()doc";
 
+static const char *__doc_fiction_charge_distribution_surface_assign_cell_types =
+R"doc(This function assigns cell types to multiple cells of the underlying
+cell-level layout at once. The charge distribution surface is
+initialized only once after all cells have been assigned.
+
+Parameter ``cells``:
+    Pairs of cells and the cell types which are assigned to them.)doc";
+
 static const char *__doc_fiction_charge_distribution_surface_charge_distribution_surface = R"doc()doc";
 
 static const char *__doc_fiction_charge_index_mode =
@@ -3071,6 +3107,10 @@ Parameter ``params``:
     Parameter required for both the invocation of *Ground State
     Space*, and the simulation following.
 
+Parameter ``pst``:
+    Statistics. They separate the runtime of the *Ground State Space*
+    construction from that of the unfolding.
+
 Returns:
     Simulation results.)doc";
 
@@ -3079,8 +3119,8 @@ R"doc(The struct containing the parameters both passed on to pre-simulator
 Ground State Space, and used during simulation.)doc";
 
 static const char *__doc_fiction_clustercomplete_params_available_threads =
-R"doc(Number of threads to make available to *ClusterComplete* for the
-unfolding stage.)doc";
+R"doc(Number of threads to make available to *ClusterComplete* for both the
+*Ground State Space* construction and the unfolding stage.)doc";
 
 static const char *__doc_fiction_clustercomplete_params_global_potential =
 R"doc(Global external electrostatic potential. Value is applied on each cell
@@ -3130,6 +3170,36 @@ required witnesses for each respective charge state is satisfied. If
 no such partition exists, the multiset charge configuration associated
 with the requirements may be rejected.)doc";
 
+static const char *__doc_fiction_clustercomplete_params_work_splitting_threshold =
+R"doc(Projected number of charge distributions below which a clustering
+state is unfolded entirely by the thread that holds it instead of
+making its compositions available to other threads. The projection is
+given by the simulation base raised to the number of SiDBs that are
+not yet resolved into singleton clusters. Lower values provide more
+opportunities for work stealing at the cost of synchronization
+overhead. Only applies to multithreaded unfolding.)doc";
+
+static const char *__doc_fiction_clustercomplete_stats =
+R"doc(Statistics of a *ClusterComplete* simulation, which separate the
+runtimes of its two phases.)doc";
+
+static const char *__doc_fiction_clustercomplete_stats_report =
+R"doc(Reports the statistics to the given output stream.
+
+Parameter ``out``:
+    Output stream.)doc";
+
+static const char *__doc_fiction_clustercomplete_stats_time_ground_state_space =
+R"doc(The runtime of the *Ground State Space* construction.)doc";
+
+static const char *__doc_fiction_clustercomplete_stats_time_total =
+R"doc(The total runtime of the simulation, i.e., the sum of the runtimes of
+both phases.)doc";
+
+static const char *__doc_fiction_clustercomplete_stats_time_unfolding =
+R"doc(The runtime of unfolding the *Ground State Space* construct into all
+physically valid charge distributions.)doc";
+
 static const char *__doc_fiction_color_routing =
 R"doc(A multi-path signal routing approach based on coloring of edge
 intersection graphs as originally proposed in \"Efficient Multi-Path
@@ -3802,6 +3872,62 @@ Logic Beyond Conventional Operability\" by M. Walter, J. Drewniok, and
 R. Wille in IEEE-NANO 2025
 (https://ieeexplore.ieee.org/abstract/document/11113672).)doc";
 
+static const char *__doc_fiction_critical_temperature_domain_adaptive_refinement =
+R"doc(Computes the critical temperature domain of the given SiDB cell-level
+layout. The critical temperature domain consists of all parameter
+combinations for which the layout is logically operational, along with
+the critical temperature for each specific parameter point.
+
+This algorithm uses adaptive refinement on a quadtree (2D) or octree
+(3D) of cells. It starts from a coarse grid whose cells have an edge
+length of `initial_cell_size` steps and determines the operational
+status at their corners. Only cells whose corners disagree in their
+operational status are recursively halved until the resolution given
+by the step sizes of the sweep dimensions is reached. Since uniform
+regions are only sampled at the coarse resolution, the number of
+operational checks grows with the size of the borders of the
+operational domain instead of with its volume. The result is stored
+sparsely, i.e., it only contains the evaluated cell corners.
+
+Operational or non-operational regions that lie entirely within a
+coarse cell without touching its corners remain undetected. Hence,
+`initial_cell_size` should be smaller than the smallest expected
+feature of the domain.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Template parameter ``TT``:
+    Truth table type.
+
+Parameter ``lyt``:
+    Layout to compute the operational domain for.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``initial_cell_size``:
+    Edge length of the initial cells in steps of the sweep dimensions.
+
+Parameter ``params``:
+    Operational domain computation parameters.
+
+Parameter ``stats``:
+    Operational domain computation statistics.
+
+Returns:
+    The (partial) critical temperature domain of the layout.
+
+Throws:
+    std::invalid_argument if the given sweep parameters are invalid,
+    `initial_cell_size` is 0, or the parameters do not match the
+    checkpoint file.
+
+Throws:
+    binary_operational_domain_parsing_error if the checkpoint file is
+    malformed.)doc";
+
 static const char *__doc_fiction_critical_temperature_domain_add_dimension =
 R"doc(Adds a dimension to sweep over. The first dimension is the x
 dimension, the second dimension is the y dimension, etc.
@@ -5145,6 +5271,10 @@ Returns:
 
 static const char *__doc_fiction_detail_apply_gate_library_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_MIN_NODES_PER_THREAD =
+R"doc(Minimum number of nodes that a thread has to set up to be worth
+spawning.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl_apply_gate_library_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_assign_gate =
@@ -5162,6 +5292,39 @@ Parameter ``n``:
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_cell_lyt = R"doc(Cell-level layout.)doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_clear_cells =
+R"doc(Removes all cells including their modes and names from the cell-level
+layout.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_collect_gates =
+R"doc(Sets up the gate implementations of the given range of nodes and
+collects their cells without modifying the cell-level layout. This
+function is safe to be called concurrently on disjoint ranges.
+
+Template parameter ``It``:
+    Iterator type of the node range.
+
+Parameter ``first``:
+    Begin of the node range.
+
+Parameter ``last``:
+    End of the node range.
+
+Returns:
+    The cells of all gate implementations in the given range in node
+    order.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_create_cell_layout =
+R"doc(Creates an empty cell-level layout whose dimensions, tile sizes, and
+clocking scheme are derived from the given gate-level layout.
+
+Parameter ``gate_lyt``:
+    Gate-level layout to derive the cell-level layout from.
+
+Returns:
+    An empty cell-level layout that can hold `gate_lyt`'s gate
+    implementations.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl_determine_aspect_ratio_for_cell_level_layout =
 R"doc(Computes the (inclusively) bounding coordinate for a cell-level layout
 that is derived from the dimensions of the given gate-level layout,
@@ -5175,6 +5338,35 @@ Returns:
     Aspect ratio for a cell-level layout that corresponds to the
     dimensions of the given gate-level layout.)doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_foreach_tile_row =
+R"doc(Sets up the gate implementations of the static gate library tile row
+by tile row instead of all at once. For each tile row `y` in ascending
+order, the cell-level layout contains exactly the gate implementations
+of the tile rows `y - context_rows` to `y + context_rows` when `fn` is
+invoked. If the gate library defines a post-layout optimization, it is
+applied to these cells beforehand. Afterward, all cells are removed
+again.
+
+Template parameter ``Fn``:
+    Functor type that can be invoked as `fn(const CellLyt&,
+    uint64_t)`.
+
+Parameter ``context_rows``:
+    Number of adjacent tile rows on either side whose gate
+    implementations are set up as well.
+
+Parameter ``fn``:
+    Functor that receives the partial cell-level layout and the
+    current tile row.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_gate_cells =
+R"doc(Cells of gate implementations that are yet to be assigned to the cell-
+level layout.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_gate_cells_names = R"doc(I/O cells and their names.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_gate_cells_types = R"doc(Non-empty cells and their types.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl_gate_lyt = R"doc(Gate-level layout.)doc";
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_run_parameterized_gate_library =
@@ -5207,9 +5399,13 @@ This function performs the cell layout generation process based on the
 gate library and the gate-level layout information provided by
 `GateLibrary` and `gate_lyt`. It iterates through the nodes in the
 gate-level layout and maps gates to cell implementations based on
-their corresponding positions and types. Optionally, it performs post-
-layout optimization and sets the layout name if certain conditions are
-met.
+their corresponding positions and types. The gate implementations are
+set up in parallel if the parameters allow for it and the layout is
+large enough. Optionally, it performs post-layout optimization and
+sets the layout name if certain conditions are met.
+
+Parameter ``ps``:
+    Parameters.
 
 Parameter ``defect_lyt``:
     Optional defect surface.
@@ -5538,6 +5734,9 @@ Parameter ``params``:
     Parameter required for both the invocation of *Ground State
     Space*, and the simulation following.
 
+Parameter ``st``:
+    Statistics to store the runtimes of both phases in.
+
 Returns:
     Results of the exact simulation.)doc";
 
@@ -5962,18 +6161,6 @@ static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_lyt = R"doc(Gate-level layout.)doc";
 
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info = R"doc()doc";
-
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_delay = R"doc()doc";
-
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_diff = R"doc()doc";
-
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_length = R"doc()doc";
-
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_path_info = R"doc()doc";
-
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_path_info_2 = R"doc()doc";
-
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_result = R"doc(Result storage.)doc";
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_run = R"doc()doc";
@@ -6504,16 +6691,82 @@ static const char *__doc_fiction_detail_detect_bdl_wires_impl_params = R"doc(Par
 
 static const char *__doc_fiction_detail_determine_clocking_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_determine_clocking_impl_assign_clock_numbers =
+R"doc(Assigns the given clock numbers to the layout.
+
+Parameter ``tiles``:
+    The tiles to assign clock numbers to.
+
+Parameter ``clocks``:
+    The clock numbers of `tiles`.)doc";
+
+static const char *__doc_fiction_detail_determine_clocking_impl_collect_tiles =
+R"doc(Collects all non-empty tiles of the layout.
+
+Returns:
+    The tiles of all non-constant nodes.)doc";
+
 static const char *__doc_fiction_detail_determine_clocking_impl_determine_clocking_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_determine_clocking_impl_layout = R"doc(The layout to assign clock numbers to.)doc";
 
+static const char *__doc_fiction_detail_determine_clocking_impl_number_of_clocks = R"doc(Number of clocks in layout's clocking scheme.)doc";
+
 static const char *__doc_fiction_detail_determine_clocking_impl_params = R"doc(Parameters.)doc";
 
 static const char *__doc_fiction_detail_determine_clocking_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_determine_clocking_impl_solve =
+R"doc(Constructs a SAT instance over the given tiles and solves it with the
+configured SAT engine.
+
+Parameter ``tiles``:
+    The tiles to determine clock numbers for.
+
+Returns:
+    The clock numbers of `tiles` or `std::nullopt` if no valid
+    clocking scheme exists for them.)doc";
+
+static const char *__doc_fiction_detail_determine_clocking_impl_solve_decomposed =
+R"doc(Partitions the layout into regions of consecutive rows, solves their
+SAT instances in parallel, and stitches the regions' solutions
+together.
+
+All constraints fix the difference of two clock numbers modulo the
+number of clocks. Thus, a region's solution is unique up to a rotation
+of the clock numbers in each of its connected components and any
+global solution arises from rotating them. Consequently, the regions
+can be solved without any assumptions on their boundaries and the
+stitching step determines these rotations exactly, i.e., it fails iff
+no valid clocking scheme exists.
+
+Parameter ``tiles``:
+    All non-empty tiles of the layout. They are reordered by their
+    position.
+
+Returns:
+    The clock numbers of `tiles` or `std::nullopt` if no valid
+    clocking scheme exists.)doc";
+
 static const char *__doc_fiction_detail_determine_clocking_impl_stats = R"doc(Statistics.)doc";
 
+static const char *__doc_fiction_detail_determine_clocking_impl_stitch =
+R"doc(Rotates the clock numbers of the regions' connected components such
+that all data flow connections and crossings across region boundaries
+are respected. To this end, the rotations are tracked via a union-find
+data structure whose edges are weighted with the difference of the
+rotations of their end points.
+
+Parameter ``tiles``:
+    All non-empty tiles of the layout.
+
+Parameter ``clocks``:
+    Clock numbers of `tiles` that are valid within each region.
+
+Returns:
+    The rotated clock numbers of `tiles` or `std::nullopt` if the
+    regions cannot be stitched together.)doc";
+
 static const char *__doc_fiction_detail_determine_layout_size = R"doc()doc";
 
 static const char *__doc_fiction_detail_determine_new_coord =
@@ -6646,6 +6899,26 @@ Parameter ``lyt``:
 Parameter ``status``:
     The operational status of the provided layout.)doc";
 
+static const char *__doc_fiction_detail_dominant_path_info =
+R"doc(Determines the dominant path that leads to the non-empty tile `t` from
+the dominant paths that lead to its incoming tiles.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Parameter ``lyt``:
+    Gate-level layout.
+
+Parameter ``t``:
+    Non-empty tile.
+
+Parameter ``infos``:
+    Dominant paths of the incoming tiles of `t` in the order of
+    `lyt.incoming_data_flow(t)`.
+
+Returns:
+    Dominant path that leads to `t`.)doc";
+
 static const char *__doc_fiction_detail_east_south_edge_coloring = R"doc()doc";
 
 static const char *__doc_fiction_detail_enumerate_all_paths_impl = R"doc()doc";
@@ -7687,14 +7960,6 @@ Returns:
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_all_paths =
-R"doc(Stores a collection of all annotated paths
-(labeled_layout_coordinate_lookup_path objects) computed thus far to
-find intersections with new ones. The edge intersection graph stores
-plain paths without the extra set and label. Therefore, after the
-generate_edge_intersection_graph function terminates, the extra memory
-overhead is being released again.)doc";
-
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_connect_clique =
 R"doc(Given a collection of paths belonging to the same objective, this
 function creates edges in the edge intersection graph between each
@@ -7709,17 +7974,41 @@ R"doc(Given a collection of paths belonging to the same objective, this
 function creates edges in the edge intersection graph between each
 corresponding node and all of the already existing nodes that
 represent paths that intersect with it, i.e., that share at least one
-coordinate.
+coordinate. If crossings are allowed, paths only intersect if they
+share a segment of two consecutive coordinates.
+
+Instead of comparing against each previously enumerated path, the
+intersecting paths are looked up in the inverted tile index. Thereby,
+the effort only depends on the number of paths that actually occupy
+the same coordinates.
 
 Parameter ``objective_paths``:
     Collection of paths belonging to the same objective.)doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_edge_id = R"doc()doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_enumerate_paths =
+R"doc(Enumerates all paths that satisfy the given objective or, if a path
+limit is set, only the shortest ones.
+
+Parameter ``obj``:
+    Routing objective to enumerate paths for.
+
+Returns:
+    Collection of paths satisfying `obj`.)doc";
+
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_generate_edge_intersection_graph_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_graph = R"doc(The edge intersection graph to be created.)doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_index_paths =
+R"doc(Adds a collection of paths belonging to the same objective to the
+inverted tile index such that paths of subsequent objectives can find
+their intersections with them.
+
+Parameter ``objective_paths``:
+    Collection of paths belonging to the same objective.)doc";
+
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_initiate_objective_nodes =
 R"doc(Given a collection of paths belonging to the same objective, this
 function assigns them unique labels and generates corresponding nodes
@@ -7732,58 +8021,17 @@ the statistics.
 Parameter ``objective_paths``:
     Collection of paths belonging to the same objective.)doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path =
-R"doc(Extends the layout_coordinate_path to additionally to the vector
-representation of the path also hold a set that allows fast lookup
-needed to find intersections (O(log n)). Additionally, a label is
-assigned to each path to identify it in the edge intersection graph.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_append =
-R"doc(Overwrites the append function to additionally store the given
-coordinate in a set.
-
-Parameter ``c``:
-    Coordinate to append to the path.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_has_intersection_with =
-R"doc(Given another path, this function checks if they are not disjoint,
-i.e., it looks for at least one coordinate that both paths share.
-
-If, at some point, the set approach is not to be used anymore,
-std::find_first_of offers the same functionality on any kind of range.
-
-Template parameter ``Path``:
-    Type of other path.
-
-Parameter ``other``:
-    The other path.
-
-Returns:
-    `true` iff this path and the given one are not disjoint, i.e.,
-    share at least one coordinate.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_has_overlap_with =
-R"doc(Like has_intersection_with but allows paths to share crossings, i.e.,
-single-tile intersections.
-
-Similar to has_intersection_with, this function also returns `true` if
-source and target are matching in both paths.
-
-Template parameter ``Path``:
-    Type of other path.
-
-Parameter ``other``:
-    The other path.
-
-Returns:
-    `true` iff this path and the given one are overlapping, i.e.,
-    share at least one coordinate segment of size 2.)doc";
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_path =
+R"doc(Extends the layout_coordinate_path by a label to identify it in the
+edge intersection graph.)doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_label = R"doc(Label to identify the path in the edge intersection graph.)doc";
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_path_label =
+R"doc(Label to identify the path in the edge intersection graph.)doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_path_elements =
-R"doc(Uniquely identify path elements in a set to make them searchable in
-O(1).)doc";
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_last_connected_to =
+R"doc(For each node, stores the label of the last path that was connected to
+it plus one. This deduplicates the intersection candidates found via
+multiple coordinates without clearing a set for each query.)doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_layout = R"doc(Reference to the layout.)doc";
 
@@ -7797,6 +8045,29 @@ static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_ps
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_terminal_index =
+R"doc(Maps the source of each previously enumerated path to its target and
+label. Paths with identical source and target always intersect. Paths
+are stored in ascending order of their labels.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_tile_index =
+R"doc(Inverted index that maps each coordinate to all previously enumerated
+paths that occupy it. Only coordinates that can lead to an
+intersection are indexed: without crossings, these are all but the
+source and target of a path. With crossings, these are all coordinates
+with a successor, which is stored alongside to look up shared segments
+of size 2. Paths are stored in ascending order of their labels.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_tile_occupant =
+R"doc(An entry in the inverted tile index that states that the path with the
+given label passes through a coordinate and continues at `successor`
+from there.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_tile_occupant_label = R"doc(Label of the occupying path.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_tile_occupant_successor =
+R"doc(The coordinate that follows the indexed one in the occupying path.)doc";
+
 static const char *__doc_fiction_detail_get_offset =
 R"doc(Utility function to calculate the offset that has to be subtracted
 from any x-coordinate on the hexagonal layout.
@@ -8335,7 +8606,11 @@ Parameter ``parent``:
 static const char *__doc_fiction_detail_ground_state_space_impl_construct_merged_charge_state_space =
 R"doc(This function calls the recursive function above that goes through all
 combination of charge space elements of children to form the charge
-space of their direct parent.
+space of their direct parent. The combinations are partitioned by the
+charge space element chosen for the first child, such that each part
+may be verified independently. The partial charge spaces are then
+combined in the order of the charge space of the first child, which
+yields the same compositions as a sequential construction would.
 
 Parameter ``parent``:
     The parent cluster to which charge spaces are combined.)doc";
@@ -8394,9 +8669,12 @@ Parameter ``m``:
     The dynamically combined cluster charge state (i.e., multiset
     charge configuration). A copy of `m` when it is a complete
     composition of charge space elements of the children is added to
-    the parent charge space if verification passes. After, `m` is
+    the merged charge space if verification passes. After, `m` is
     dynamically transformed to the next combination until no new
-    combination exists.)doc";
+    combination exists.
+
+Parameter ``merged_charge_space``:
+    The charge space to which verified combinations are added.)doc";
 
 static const char *__doc_fiction_detail_ground_state_space_impl_find_valid_witness_partitioning =
 R"doc(A simple brute-force algorithm that solves the validity witness
@@ -8581,6 +8859,21 @@ Returns:
     which parents all other clusters, and thereby contains the charge
     spaces of each cluster.)doc";
 
+static const char *__doc_fiction_detail_ground_state_space_impl_run_in_parallel =
+R"doc(Invokes the given function for each task index in :math:`[0, n)`. When
+multiple threads are available, the tasks are distributed dynamically
+over at most `num_threads` threads. Tasks must therefore only modify
+disjoint data.
+
+Template parameter ``Fn``:
+    Type of the function to invoke, i.e., `void(uint64_t)`.
+
+Parameter ``num_tasks``:
+    The number of tasks :math:`n`.
+
+Parameter ``fn``:
+    The function to invoke with each task index.)doc";
+
 static const char *__doc_fiction_detail_ground_state_space_impl_subtract_sibling_pot_from_received_ext_pot_bound =
 R"doc(This function derives the new externally received partial sums of
 electrostatic potential local to an SiDB contained by the child
@@ -9269,6 +9562,28 @@ static const char *__doc_fiction_detail_non_operationality_reason_POTENTIAL_POSI
 
 static const char *__doc_fiction_detail_operational_domain_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_adaptive_refinement =
+R"doc(Performs adaptive refinement to determine the operational domain. The
+parameter space is first divided into cells, i.e., squares in 2D
+(quadtree) or cubes in 3D (octree), of the given edge length. The
+operational status is determined at the corners of each cell. Cells
+whose corners all share the same operational status are assumed to be
+uniform and are not refined further. All other cells are halved along
+each dimension and their corners are evaluated in turn until the cells
+reach the resolution given by the step sizes of the sweep dimensions.
+The corners of each refinement level are evaluated in parallel.
+
+The operational domain will finally only contain the evaluated cell
+corners, i.e., a coarse sampling of uniform regions and a fine
+sampling of the borders between operational and non-operational
+regions.
+
+Parameter ``initial_cell_size``:
+    Edge length of the initial cells in steps of the sweep dimensions.
+
+Returns:
+    The (partial) operational domain of the layout.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_canvas_lyt = R"doc(This layout consists of the canvas cells of the layout.)doc";
 
 static const char *__doc_fiction_detail_operational_domain_impl_contour_tracing =
@@ -9674,6 +9989,24 @@ static const char *__doc_fiction_detail_orthogonal_impl_pst = R"doc()doc";
 
 static const char *__doc_fiction_detail_orthogonal_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_path_info =
+R"doc(Length, delay, and path length difference of the dominant path that
+leads to a tile.)doc";
+
+static const char *__doc_fiction_detail_path_info_delay = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_diff = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_length = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_operator_eq = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_operator_ne = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_path_info = R"doc()doc";
+
+static const char *__doc_fiction_detail_path_info_path_info_2 = R"doc()doc";
+
 static const char *__doc_fiction_detail_physical_population_stability_impl =
 R"doc(This class implements the simulation of the population stability for a
 given SiDB layout. It determines the minimum electrostatic potential
@@ -10436,12 +10769,6 @@ If this flag is true, the fanin signals need to be reordered.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler = R"doc()doc";
 
-static const char *__doc_fiction_detail_sat_clocking_handler_assign_clock_numbers =
-R"doc(Assigns clock numbers to the layout based on the provided model.
-
-Parameter ``model``:
-    The model to extract the clocking scheme from.)doc";
-
 static const char *__doc_fiction_detail_sat_clocking_handler_at_least_one_clock_number_per_tile =
 R"doc(Adds constraints to the solver that enforce the assignment of at least
 one clock number per tile.)doc";
@@ -10451,13 +10778,14 @@ R"doc(Adds constraints to the solver that enforce the assignment of at most
 one clock number per tile.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_determine_clocks =
-R"doc(Determines clock numbers for the layout.
+R"doc(Determines clock numbers for the tiles.
 
 Constructs a SAT instance and passes it to a solver to find a valid
 clocking scheme.
 
 Returns:
-    `true` iff a valid clocking scheme could be found.)doc";
+    The clock numbers of the tiles in the order they were given or
+    `std::nullopt` if no valid clocking scheme could be found.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_ensure_same_clock_number_on_crossing_tiles =
 R"doc(Adds constraints to the solver that ensure the assignment of the same
@@ -10467,11 +10795,39 @@ static const char *__doc_fiction_detail_sat_clocking_handler_exclude_clock_assig
 R"doc(Adds constraints to the solver that exclude the assignment of non-
 adjacently clocked tiles.)doc";
 
+static const char *__doc_fiction_detail_sat_clocking_handler_extract_clock_numbers =
+R"doc(Extracts the clock numbers of all tiles from the provided model.
+
+Parameter ``model``:
+    The model to extract the clocking scheme from.
+
+Returns:
+    The clock numbers of the tiles in the order they were given.)doc";
+
+static const char *__doc_fiction_detail_sat_clocking_handler_is_handled =
+R"doc(Checks whether tile `t` is part of the SAT instance.
+
+Parameter ``t``:
+    Tile to check.
+
+Returns:
+    `true` iff variables have been created for `t`.)doc";
+
 static const char *__doc_fiction_detail_sat_clocking_handler_layout = R"doc(The layout to clock.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_number_of_clocks = R"doc(Number of clocks in layout's clocking scheme.)doc";
 
-static const char *__doc_fiction_detail_sat_clocking_handler_sat_clocking_handler = R"doc(Default constructor.)doc";
+static const char *__doc_fiction_detail_sat_clocking_handler_sat_clocking_handler =
+R"doc(Standard constructor.
+
+Parameter ``lyt``:
+    The layout to clock.
+
+Parameter ``ts``:
+    Non-empty tiles to determine clock numbers for. If a tile on a
+    crossing layer is contained, the tile below it must be contained
+    as well. Data flow from or to tiles that are not contained is
+    disregarded.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_solver = R"doc(The solver used to find a solution to the clocking problem.)doc";
 
@@ -10479,6 +10835,8 @@ static const char *__doc_fiction_detail_sat_clocking_handler_symmetry_breaking =
 R"doc(Adds constraints to the solver that help to speed up the solving
 process by breaking symmetries in the solution space.)doc";
 
+static const char *__doc_fiction_detail_sat_clocking_handler_tiles = R"doc(The tiles to clock.)doc";
+
 static const char *__doc_fiction_detail_sat_clocking_handler_variables = R"doc(Stores all variables.)doc";
 
 static const char *__doc_fiction_detail_sat_coloring_handler = R"doc()doc";
@@ -10979,10 +11337,27 @@ static const char *__doc_fiction_detail_write_location_and_ground_state_impl_wri
 
 static const char *__doc_fiction_detail_write_qca_layout_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_close_layer = R"doc()doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_lyt = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_open_layer =
+R"doc(Writes the via layer of the cells collected in the previous layer, if
+any, and opens the design layer `z`.
+
+Parameter ``z``:
+    Layer to open.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_os = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_pending_via_cells =
+R"doc(Returns the cells that have been collected in the current layer to be
+written to the next via layer. They have to remain in the layout until
+the next call to `open_layer`.
+
+Returns:
+    Pending via cells.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_ps = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_run = R"doc()doc";
@@ -10997,18 +11372,28 @@ static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_colors
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_function = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_layers = R"doc()doc";
-
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_mode = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_name = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_write_footer = R"doc()doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_header = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_qca_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_quantum_dots = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_write_row =
+R"doc(Writes all non-empty cells of row `y` in layer `z` from west to east.
+Must be called between `open_layer(z)` and `close_layer()`.
+
+Parameter ``y``:
+    Row to write.
+
+Parameter ``z``:
+    Layer of the row.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_via_cells = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl = R"doc()doc";
@@ -11178,10 +11563,6 @@ static const char *__doc_fiction_detail_write_sidb_layout_svg_impl_write_sidb_la
 
 static const char *__doc_fiction_detail_write_sqd_layout_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_sqd_layout_impl_generate_db_blocks = R"doc()doc";
-
-static const char *__doc_fiction_detail_write_sqd_layout_impl_generate_defect_blocks = R"doc()doc";
-
 static const char *__doc_fiction_detail_write_sqd_layout_impl_get_defect_type_name = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_sqd_layout_impl_lyt = R"doc()doc";
@@ -11190,6 +11571,25 @@ static const char *__doc_fiction_detail_write_sqd_layout_impl_os = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_sqd_layout_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_sqd_layout_impl_write_db_block =
+R"doc(Writes the dot blocks of cell `c`. Must be called between
+`write_prologue` and `write_epilogue`.
+
+Parameter ``c``:
+    Non-empty cell to write.)doc";
+
+static const char *__doc_fiction_detail_write_sqd_layout_impl_write_defect_blocks = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_sqd_layout_impl_write_epilogue =
+R"doc(Writes everything following the DB layer, i.e., its closing, the
+defect layer if `Lyt` implements the defect interface, and the
+remaining design layers.)doc";
+
+static const char *__doc_fiction_detail_write_sqd_layout_impl_write_prologue =
+R"doc(Writes everything up to and including the opening of the DB layer,
+i.e., the header, the layer definitions, and the design layers
+preceding the DB layer.)doc";
+
 static const char *__doc_fiction_detail_write_sqd_layout_impl_write_sqd_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_sqd_sim_result_impl = R"doc()doc";
@@ -11366,6 +11766,12 @@ scheme.
 If no valid clock number assignment exists for `lyt`, this function
 returns `false` and does not modify `lyt`.
 
+If `params.region_size` is set, the layout is partitioned into regions
+of consecutive rows whose SAT instances are solved in parallel. Their
+solutions are stitched together afterward by rotating the clock
+numbers of each region's connected components, which succeeds iff a
+valid clock number assignment exists for the entire layout.
+
 This algorithm was proposed in \"Ending the Tyranny of the Clock: SAT-
 based Clock Number Assignment for Field-coupled Nanotechnologies\" by
 M. Walter, J. Drewniok, and R. Wille in IEEE NANO 2024
@@ -11389,12 +11795,25 @@ Returns:
 
 static const char *__doc_fiction_determine_clocking_params = R"doc(Parameters for the `determine_clocking` algorithm.)doc";
 
+static const char *__doc_fiction_determine_clocking_params_num_threads =
+R"doc(Number of threads to use for solving the region instances in the
+decomposition mode.)doc";
+
+static const char *__doc_fiction_determine_clocking_params_region_size =
+R"doc(Maximum number of tiles per region in the decomposition mode. If `0`
+or if the layout does not contain more tiles than this, a single
+monolithic SAT instance over all tiles is constructed. Otherwise, the
+layout is partitioned into regions of consecutive rows that are solved
+independently and stitched together afterward.)doc";
+
 static const char *__doc_fiction_determine_clocking_params_sat_engine = R"doc(The SAT solver to use.)doc";
 
 static const char *__doc_fiction_determine_clocking_stats = R"doc(Statistics for the `determine_clocking` algorithm.)doc";
 
 static const char *__doc_fiction_determine_clocking_stats_duration = R"doc(Total runtime.)doc";
 
+static const char *__doc_fiction_determine_clocking_stats_num_regions = R"doc(Number of SAT instances that were solved.)doc";
+
 static const char *__doc_fiction_determine_clocking_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -11733,6 +12152,48 @@ Returns:
     Distance between source and target according to the stored
     distance map.)doc";
 
+static const char *__doc_fiction_distributed_operational_domain_params =
+R"doc(Parameters for the distributed operational domain computation.)doc";
+
+static const char *__doc_fiction_distributed_operational_domain_params_algorithm =
+R"doc(Strategy to choose the parameter points to evaluate.)doc";
+
+static const char *__doc_fiction_distributed_operational_domain_params_batch_size =
+R"doc(Maximum number of parameter points per batch. Larger batches reduce
+the communication overhead, smaller ones allow the frontier of flood
+fill and contour tracing to follow the results more closely.)doc";
+
+static const char *__doc_fiction_distributed_operational_domain_params_domain_params =
+R"doc(Parameters of the operational domain computation. Workers must be
+configured with the same sweep dimensions.)doc";
+
+static const char *__doc_fiction_distributed_operational_domain_params_samples =
+R"doc(Number of random samples to start from. Ignored for
+`distributed_sweep_algorithm::GRID_SEARCH`.)doc";
+
+static const char *__doc_fiction_distributed_sweep_algorithm =
+R"doc(Strategy that a distributed operational domain computation uses to
+choose the parameter points to evaluate.)doc";
+
+static const char *__doc_fiction_distributed_sweep_algorithm_CONTOUR_TRACING =
+R"doc(Evaluate random parameter points, move outwards from operational ones
+until the border of the operational domain is found, and extend the
+frontier along that border only (cf.
+`operational_domain_contour_tracing`).)doc";
+
+static const char *__doc_fiction_distributed_sweep_algorithm_FLOOD_FILL =
+R"doc(Evaluate random parameter points and extend the frontier from all
+operational points found among the results (cf.
+`operational_domain_flood_fill`).)doc";
+
+static const char *__doc_fiction_distributed_sweep_algorithm_GRID_SEARCH =
+R"doc(Evaluate all parameter points of the sweep (cf.
+`operational_domain_grid_search`).)doc";
+
+static const char *__doc_fiction_distributed_sweep_algorithm_RANDOM_SAMPLING =
+R"doc(Evaluate a number of random parameter points (cf.
+`operational_domain_random_sampling`).)doc";
+
 static const char *__doc_fiction_edge_color_view_drawer =
 R"doc(A DOT drawer for networks with colored edges. Node colors represent
 their painted color instead of their gate type.
@@ -11999,7 +12460,8 @@ static const char *__doc_fiction_equivalence_checking_stats_eq = R"doc(Stores th
 
 static const char *__doc_fiction_equivalence_checking_stats_impl_drv_stats = R"doc()doc";
 
-static const char *__doc_fiction_equivalence_checking_stats_spec_drv_stats = R"doc(Stores DRVs.)doc";
+static const char *__doc_fiction_equivalence_checking_stats_spec_drv_stats = R"doc(Stores the numbers of DRVs and warnings. No detailed report is
+generated.)doc";
 
 static const char *__doc_fiction_equivalence_checking_stats_tp_diff = R"doc(Throughput values at which weak equivalence manifests.)doc";
 
@@ -12143,6 +12605,11 @@ necessary functions to comply with `is_network_type` and
 technology-independent but can make certain assumptions if needed, for
 instance for ToPoliNano-compliant circuits.
 
+Alternatively to Z3, the instances can be solved by a SAT solver after
+translating them to CNF. To this end, set `ps.backend` to
+`exact_physical_design_backend::SAT`. Configurations that are not
+expressible in CNF are still handled by Z3.
+
 This approach requires the Z3 SMT solver to be installed on the
 system. Due to this circumstance, it is excluded from (CLI)
 compilation by default. To enable it, pass `-DFICTION_Z3=ON` to the
@@ -12172,8 +12639,22 @@ Returns:
     circuit if one is found under the given parameters;
     `std::nullopt`, otherwise.)doc";
 
+static const char *__doc_fiction_exact_physical_design_backend = R"doc(Solver backends for the exact physical design algorithm.)doc";
+
+static const char *__doc_fiction_exact_physical_design_backend_SAT =
+R"doc(Translate the generated instances to CNF and solve them incrementally
+with a SAT solver from `bill`. Instances that contain arithmetic over
+non-Boolean variables, i.e., the ones that use synchronization
+elements, are solved by Z3 instead. If optimization criteria are
+specified, they are handled by Z3 after the SAT solver found the
+instance to be satisfiable.)doc";
+
+static const char *__doc_fiction_exact_physical_design_backend_SMT = R"doc(Solve the generated instances with the SMT solver Z3.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params = R"doc(Parameters for the exact physical design algorithm.)doc";
 
+static const char *__doc_fiction_exact_physical_design_params_backend = R"doc(Solver backend to use.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params_border_io = R"doc(Flag to indicate that I/Os should be placed at the layout's border.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_crossings = R"doc(Flag to indicate that crossings may be used.)doc";
@@ -12206,6 +12687,8 @@ R"doc(Number of threads to use for exploring the possible aspect ratios.
 
 @note This is an unstable beta feature.)doc";
 
+static const char *__doc_fiction_exact_physical_design_params_sat_engine = R"doc(The SAT solver to use if `backend` is `SAT`.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params_scheme = R"doc(Clocking scheme to be used.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_straight_inverters =
@@ -12247,6 +12730,10 @@ static const char *__doc_fiction_exact_physical_design_stats_num_crossings = R"d
 
 static const char *__doc_fiction_exact_physical_design_stats_num_gates = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_num_sat_checks = R"doc()doc";
+
+static const char *__doc_fiction_exact_physical_design_stats_num_sat_fallbacks = R"doc()doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_num_wires = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_report = R"doc()doc";
@@ -12712,6 +13199,21 @@ Returns:
 
 static const char *__doc_fiction_flat_top_hex = R"doc(\verbatim _____ / \ / \ \ / \_____/ \endverbatim)doc";
 
+static const char *__doc_fiction_fnv1a_hash =
+R"doc(Computes the 64-bit FNV-1a hash of the given data. Unlike `std::hash`,
+the result is identical across platforms and program runs, which makes
+it suitable for checksums and cache keys that are persisted in files.
+
+Parameter ``data``:
+    Data to hash.
+
+Parameter ``hash``:
+    Initial hash value, e.g., the hash of preceding data to continue
+    from.
+
+Returns:
+    Hash of `data`.)doc";
+
 static const char *__doc_fiction_foreach_edge =
 R"doc(Applies a function to all edges in a `mockturtle` network.
 
@@ -13967,16 +14469,64 @@ R"doc(Does NOT return the layout dimensions but the number of nodes
 Returns:
     Number of all nodes.)doc";
 
-static const char *__doc_fiction_gate_level_layout_strg = R"doc()doc";
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind =
+R"doc(Kinds of tiles stored in a gate-level layout snapshot. They correspond
+to the node types distinguished by `gate_level_layout`.)doc";
 
-static const char *__doc_fiction_gate_level_layout_trav_id = R"doc()doc";
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_AND = R"doc(2-input AND gate.)doc";
 
-static const char *__doc_fiction_gate_level_layout_value = R"doc()doc";
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_BUF = R"doc(Wire segment or fan-out.)doc";
 
-static const char *__doc_fiction_gate_level_layout_visited = R"doc()doc";
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_FUNCTION =
+R"doc(Gate whose function is stored as a truth table over its fanins.)doc";
 
-static const char *__doc_fiction_generate_edge_intersection_graph =
-R"doc(Creates an edge intersection graph of all paths that satisfy a given
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_GE = R"doc(2-input greater-or-equal gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_GT = R"doc(2-input greater-than gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_INV = R"doc(Inverter.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_LE = R"doc(2-input less-or-equal gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_LT = R"doc(2-input less-than gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_MAJ = R"doc(3-input majority gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_NAND = R"doc(2-input NAND gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_NOR = R"doc(2-input NOR gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_OR = R"doc(2-input OR gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_PI = R"doc(Primary input.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_PO = R"doc(Primary output.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_XNOR = R"doc(2-input XNOR gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_gate_kind_XOR = R"doc(2-input XOR gate.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_parsing_error =
+R"doc(Exception thrown when an error occurs during parsing of a gate-level
+layout snapshot file.)doc";
+
+static const char *__doc_fiction_gate_level_layout_snapshot_parsing_error_gate_level_layout_snapshot_parsing_error =
+R"doc(Constructs a `gate_level_layout_snapshot_parsing_error` object with
+the given error message.
+
+Parameter ``msg``:
+    The error message describing the parsing error.)doc";
+
+static const char *__doc_fiction_gate_level_layout_strg = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_trav_id = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_value = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_visited = R"doc()doc";
+
+static const char *__doc_fiction_generate_edge_intersection_graph =
+R"doc(Creates an edge intersection graph of all paths that satisfy a given
 list of routing objectives. That is, this function generates an
 undirected graph whose nodes represent paths in the given layout and
 whose edges represent intersections of these paths. An intersection is
@@ -14786,6 +15336,15 @@ be runtime-impairing, then limiting specifically the length of the
 input to the factorial call. As above, the defaulted value ensures no
 hindrance in runtimes.)doc";
 
+static const char *__doc_fiction_ground_state_space_params_num_threads =
+R"doc(Number of threads to use for merging clusters. The charge spaces of
+the children of the newly forming parent are combined in parallel, as
+are the potential projections of the parent onto independent SiDBs.
+The pruning of charge spaces between merges is performed sequentially,
+so the resulting hierarchy does not depend on this value. The threads
+are spawned once per construction and merge steps with little work are
+performed sequentially.)doc";
+
 static const char *__doc_fiction_ground_state_space_params_simulation_parameters =
 R"doc(The physical parameters that *Ground State Space* will use to prune
 the simulation search space.)doc";
@@ -15867,6 +16426,153 @@ static const char *__doc_fiction_horizontal_shift_cartesian =
 R"doc(\verbatim +-------+ | | | | | | +---+---+---+ | | | | | | +-------+
 \endverbatim)doc";
 
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput =
+R"doc(An incremental critical path length and throughput analysis for gate-
+level layouts. While `critical_path_length_and_throughput` computes
+the signal delays of all tiles from scratch on every call, this class
+subscribes to the layout's network events and, on each call to
+`update`, only re-evaluates tiles that have been touched by creating,
+moving, reconnecting, or removing nodes since the previous call.
+Changed delays are propagated through the fan-out cones of these
+tiles, where the propagation stops at tiles whose delays remain
+unchanged.
+
+This is beneficial in optimization loops that apply small
+modifications to large layouts and need to keep track of their
+critical path length and throughput.
+
+The result is identical to that of
+`critical_path_length_and_throughput` if all gates are in the
+transitive fan-in of a PO. Otherwise, path length differences at the
+remaining gates are taken into account for the throughput as well.
+
+The complexity of each call to `update` is :math:`\mathcal{O}(|T'|
+\cdot \log |T| + |O|)` where :math:`T'` is the set of re-evaluated
+tiles, :math:`T` is the set of all occupied tiles, and :math:`O` is
+the set of all POs in the layout.
+
+@note Modifications that do not stem from node manipulation, e.g., re-
+assigning clock numbers, are not observed. Call `invalidate` after
+such modifications to enforce a full re-evaluation.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_assign =
+R"doc(Replaces the stored signal delay of the given tile and updates
+`dependents` and `gate_diffs` accordingly.
+
+Parameter ``t``:
+    Tile whose signal delay is to be replaced.
+
+Parameter ``timing``:
+    New signal delay of `t` or `std::nullopt` if `t` is empty.
+
+Returns:
+    `true` iff the dominant path that leads to `t` changed.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_delay_of =
+R"doc(Returns the most recently evaluated signal delay of the given tile.
+
+Parameter ``t``:
+    Tile whose delay is desired.
+
+Returns:
+    Dominant path that leads to `t` or an empty path if `t` is empty.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_delete_event = R"doc(Handler for node deletions.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_dependents =
+R"doc(Inverse of the incoming tiles stored in `timings`, i.e., tiles whose
+signal delays were derived from a tile.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_full_evaluation_required =
+R"doc(Flag to indicate that all tiles need to be evaluated.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_gate_diffs =
+R"doc(Multiset of the path length differences of all gates.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_incremental_critical_path_length_and_throughput =
+R"doc(Standard constructor. Registers the event handlers on the given
+layout. The first call to `update` evaluates all tiles.
+
+Parameter ``src``:
+    Gate-level layout to observe. The layout must outlive this object.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_incremental_critical_path_length_and_throughput_2 =
+R"doc()doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_incremental_critical_path_length_and_throughput_3 =
+R"doc()doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_invalidate =
+R"doc(Enforces a full re-evaluation on the next call to `update`.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_lyt = R"doc(The observed layout.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_modified_event =
+R"doc(Handler for node modifications.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_num_known_nodes =
+R"doc(Number of nodes in the layout at the time of the last update.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_num_reevaluated =
+R"doc(Number of tiles that were re-evaluated during the last update.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_num_reevaluated_tiles =
+R"doc(Returns the number of tiles whose signal delays were re-evaluated
+during the last call to `update`.
+
+Returns:
+    Number of re-evaluated tiles.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_operator_assign = R"doc()doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_operator_assign_2 = R"doc()doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_reevaluate =
+R"doc(Re-evaluates the signal delay of the given tile after re-evaluating
+its touched incoming tiles. If the delay changed, all tiles whose
+delays were derived from it are touched and appended to `pending`.
+
+Parameter ``t``:
+    Touched tile to re-evaluate.
+
+Parameter ``pending``:
+    Tiles that remain to be re-evaluated.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_tile_timing =
+R"doc(Signal delay of a tile and the incoming tiles it was derived from.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_tile_timing_incoming =
+R"doc(Incoming tiles at the time of the evaluation.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_tile_timing_info =
+R"doc(Dominant path that leads to the tile.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_tile_timing_is_gate =
+R"doc(Flag to indicate that the tile's path length difference is considered
+for the throughput.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_timings = R"doc(Signal delays of all occupied tiles.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_touch =
+R"doc(Marks the given tile for re-evaluation.
+
+Parameter ``t``:
+    Modified tile.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_touched_tiles =
+R"doc(Tiles that need to be re-evaluated.)doc";
+
+static const char *__doc_fiction_incremental_critical_path_length_and_throughput_update =
+R"doc(Re-evaluates the signal delays of all tiles that could have been
+affected by modifications since the previous call and computes the
+critical path length and throughput of the observed layout.
+
+Returns:
+    A struct containing the CP and TP.)doc";
+
 static const char *__doc_fiction_initialize_distance_map =
 R"doc(This function fully initializes a `distance_map` for a given layout
 and distance functor. It computes the distances between all pairs of
@@ -16664,6 +17370,39 @@ Parameter ``t``:
 Returns:
     The next temperature, i.e. :math:`\texttt{t} - 10`.)doc";
 
+static const char *__doc_fiction_local_operational_domain_worker_pool =
+R"doc(A worker pool whose workers are threads of the current process. It
+serves as a local stand-in for distributed worker pools, e.g., to test
+a distributed setup on a single machine or to use all cores of the
+coordinating machine.
+
+Each worker evaluates batches with its own copy of the operational
+domain computation state. The layout is referenced and must outlive
+the pool.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Template parameter ``TT``:
+    Truth table type.)doc";
+
+static const char *__doc_fiction_local_operational_domain_worker_pool_local_operational_domain_worker_pool =
+R"doc(Standard constructor. Launches the worker threads.
+
+Parameter ``lyt``:
+    Layout to compute the operational domain for.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``ps``:
+    Operational domain computation parameters. Checkpointing is
+    disabled for the workers.
+
+Parameter ``num_workers``:
+    Number of worker threads.)doc";
+
 static const char *__doc_fiction_magcad_magnet_count =
 R"doc(Calculates the number of magnets for an iNML layout the way MagCAD
 (https://topolinano.polito.it/) would do it. That is, counting chains
@@ -16678,6 +17417,15 @@ Parameter ``lyt``:
 Returns:
     Number of magnets as counted by MagCAD.)doc";
 
+static const char *__doc_fiction_make_sat_solver =
+R"doc(Creates a SAT solver of the given engine.
+
+Parameter ``sat_engine``:
+    The SAT solver to use.
+
+Returns:
+    A pointer to the created solver.)doc";
+
 static const char *__doc_fiction_manhattan_distance =
 R"doc(The Manhattan distance :math:`D` between two layout coordinates
 :math:`(x_1, y_1)` and :math:`(x_2, y_2)` given by
@@ -17048,6 +17796,17 @@ types.
 Template parameter ``NtkPtr``:
     Pointer type to a logic network.)doc";
 
+static const char *__doc_fiction_network_reader_assign_network_name =
+R"doc(Assigns the given name to the given network if it supports names.
+
+Parameter ``ntk``:
+    The network.
+
+Parameter ``name``:
+    The name to assign.)doc";
+
+static const char *__doc_fiction_network_reader_cache_hits = R"doc(Number of networks restored from the snapshot cache.)doc";
+
 static const char *__doc_fiction_network_reader_get_networks =
 R"doc(Getter for networks generated from given files.
 
@@ -17061,31 +17820,109 @@ Returns:
 static const char *__doc_fiction_network_reader_network_reader =
 R"doc(Standard constructor. Reads and constructs logic networks. May throw.
 
+Files are read in parallel. Each file is loaded into memory in one go
+and parsed from there, which allows hashing its content to look up
+previously parsed networks in the snapshot cache if one is specified
+in `p`. The read networks as well as all status updates are reported
+in lexicographical order of the file paths regardless of the number of
+threads.
+
 Parameter ``filename``:
     Path to the file or folder of files to read.
 
 Parameter ``out``:
-    Output stream to write status updates into.)doc";
+    Output stream to write status updates into.
+
+Parameter ``p``:
+    Parameters.)doc";
 
 static const char *__doc_fiction_network_reader_networks = R"doc(Vector of logic networks read from files given at construction.)doc";
 
+static const char *__doc_fiction_network_reader_num_cache_hits =
+R"doc(Returns the number of networks that were restored from the snapshot
+cache instead of being parsed.
+
+Returns:
+    Number of cache hits.)doc";
+
 static const char *__doc_fiction_network_reader_out = R"doc(Output stream to which status updates are to be written.)doc";
 
-static const char *__doc_fiction_network_reader_read =
-R"doc(Actual read function that constructs the logic network from a file.
+static const char *__doc_fiction_network_reader_params = R"doc(Parameters for the `network_reader`.)doc";
+
+static const char *__doc_fiction_network_reader_params_cache_directory =
+R"doc(Directory in which parsed networks are cached as binary snapshots (see
+`write_network_snapshot`). Snapshots are keyed by a hash of the file
+content and the network type such that modified files are parsed
+again. If empty, no caching takes place. The directory is created if
+it does not exist yet.)doc";
+
+static const char *__doc_fiction_network_reader_params_num_threads = R"doc(Number of threads to use for reading files in parallel.)doc";
+
+static const char *__doc_fiction_network_reader_parse =
+R"doc(Actual parse function that constructs the logic network from an input
+stream.
 
 Template parameter ``Reader``:
     The functor type which constructs the network, i.e. handles the
     callbacks.
 
 Template parameter ``ReadFun``:
-    The file parser type.
+    The parser type.
+
+Parameter ``is``:
+    The input stream to parse.
+
+Parameter ``rfun``:
+    The actual parsing function.
+
+Returns:
+    The constructed logic network or `nullptr` if a parsing error
+    occurred.)doc";
+
+static const char *__doc_fiction_network_reader_ps = R"doc(Parameters.)doc";
+
+static const char *__doc_fiction_network_reader_read_file =
+R"doc(Reads, parses, and converts the logic network stored in the given
+file. If a snapshot cache is used, the network is restored from its
+snapshot if available or the snapshot is created otherwise.
 
 Parameter ``file``:
     The file name.
 
-Parameter ``rfun``:
-    The actual parsing function.)doc";
+Parameter ``msg``:
+    Output stream to write status updates of this file into.
+
+Returns:
+    The constructed logic network or `nullptr` if the file could not
+    be read.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind =
+R"doc(Kinds of gates stored in a network snapshot. They correspond to the
+gate types distinguished by `convert_network`.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_AND = R"doc(2-input AND gate.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_BUF = R"doc(Buffer, e.g., a fan-out or path balancing node.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_FUNCTION =
+R"doc(Gate whose function is stored as a truth table over its fanins.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_MAJ = R"doc(3-input majority gate.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_OR = R"doc(2-input OR gate.)doc";
+
+static const char *__doc_fiction_network_snapshot_gate_kind_XOR = R"doc(2-input XOR gate.)doc";
+
+static const char *__doc_fiction_network_snapshot_parsing_error =
+R"doc(Exception thrown when an error occurs during parsing of a network
+snapshot file.)doc";
+
+static const char *__doc_fiction_network_snapshot_parsing_error_network_snapshot_parsing_error =
+R"doc(Constructs a `network_snapshot_parsing_error` object with the given
+error message.
+
+Parameter ``msg``:
+    The error message describing the parsing error.)doc";
 
 static const char *__doc_fiction_normalize_layout_coordinates =
 R"doc(A new layout is constructed and returned that is equivalent to the
@@ -17541,6 +18378,64 @@ defined as the set of all parameter combinations for which the layout
 is operational. Different techniques for performing these sweep are
 implemented.)doc";
 
+static const char *__doc_fiction_operational_domain_adaptive_refinement =
+R"doc(Computes the operational domain of the given SiDB cell-level layout.
+The operational domain is the set of all parameter combinations for
+which the layout is logically operational. Logical operation is
+defined as the layout implementing the given truth table. The input
+BDL pairs of the layout are assumed to be in the same order as the
+inputs of the truth table.
+
+This algorithm uses adaptive refinement on a quadtree (2D) or octree
+(3D) of cells. It starts from a coarse grid whose cells have an edge
+length of `initial_cell_size` steps and determines the operational
+status at their corners. Only cells whose corners disagree in their
+operational status are recursively halved until the resolution given
+by the step sizes of the sweep dimensions is reached. Since uniform
+regions are only sampled at the coarse resolution, the number of
+operational checks grows with the size of the borders of the
+operational domain instead of with its volume. The result is stored
+sparsely, i.e., it only contains the evaluated cell corners.
+
+Operational or non-operational regions that lie entirely within a
+coarse cell without touching its corners remain undetected. Hence,
+`initial_cell_size` should be smaller than the smallest expected
+feature of the domain.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Template parameter ``TT``:
+    Truth table type.
+
+Parameter ``lyt``:
+    Layout to compute the operational domain for.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``initial_cell_size``:
+    Edge length of the initial cells in steps of the sweep dimensions.
+
+Parameter ``params``:
+    Operational domain computation parameters.
+
+Parameter ``stats``:
+    Operational domain computation statistics.
+
+Returns:
+    The (partial) operational domain of the layout.
+
+Throws:
+    std::invalid_argument if the given sweep parameters are invalid,
+    `initial_cell_size` is 0, or the parameters do not match the
+    checkpoint file.
+
+Throws:
+    binary_operational_domain_parsing_error if the checkpoint file is
+    malformed.)doc";
+
 static const char *__doc_fiction_operational_domain_add_dimension =
 R"doc(Adds a dimension to sweep over. The first dimension is the x
 dimension, the second dimension is the y dimension, etc.
@@ -17610,6 +18505,52 @@ static const char *__doc_fiction_operational_domain_dimensions =
 R"doc(The dimensions to sweep over. The first dimension is the x dimension,
 the second dimension is the y dimension, etc.)doc";
 
+static const char *__doc_fiction_operational_domain_distributed =
+R"doc(Computes the operational domain of the given SiDB cell-level layout by
+distributing the evaluation of parameter points among the workers of
+the given pool. This function acts as the coordinator: it hands out
+batches of parameter points according to the chosen algorithm and
+collects their operational statuses. Flood fill and contour tracing
+extend their frontier as results arrive, such that the workers are
+kept busy throughout the computation.
+
+Workers can be threads of the current process
+(`local_operational_domain_worker_pool`) or processes on other
+machines that share a directory with the coordinator
+(`shared_directory_operational_domain_worker_pool` and
+`operational_domain_worker`). If a checkpoint file is specified, the
+coordinator writes checkpoints and resumes from them as described in
+`operational_domain_params`.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Template parameter ``TT``:
+    Truth table type.
+
+Parameter ``lyt``:
+    Layout to compute the operational domain for.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``pool``:
+    Worker pool to evaluate the parameter points.
+
+Parameter ``params``:
+    Distributed operational domain computation parameters.
+
+Parameter ``stats``:
+    Operational domain computation statistics.
+
+Returns:
+    The (partial) operational domain of the layout.
+
+Throws:
+    std::invalid_argument if the given parameters are invalid or do
+    not match the checkpoint file.)doc";
+
 static const char *__doc_fiction_operational_domain_flood_fill =
 R"doc(Computes the operational domain of the given SiDB cell-level layout.
 The operational domain is the set of all parameter combinations for
@@ -17745,6 +18686,21 @@ static const char *__doc_fiction_operational_domain_params =
 R"doc(Parameters for the operational domain computation. The parameters are
 used across the different operational domain computation algorithms.)doc";
 
+static const char *__doc_fiction_operational_domain_params_checkpoint_file =
+R"doc(Path of a checkpoint file. If non-empty, the evaluated parameter
+points are periodically written to this file in the binary operational
+domain format (see `write_binary_operational_domain`), preceded by a
+line that holds a fingerprint of the layout, the specification, and
+all parameters (see `periodic_checkpoint`). If the file already exists
+when the computation starts, the parameter points stored in it are
+restored instead of being re-evaluated, which allows to resume
+interrupted sweeps. The checkpoint must have been created for the same
+layout, specification, and parameters.)doc";
+
+static const char *__doc_fiction_operational_domain_params_checkpoint_interval =
+R"doc(Number of evaluated parameter points after which the checkpoint file
+is updated.)doc";
+
 static const char *__doc_fiction_operational_domain_params_operational_params =
 R"doc(The parameters used to determine if a layout is operational or non-
 operational.)doc";
@@ -17850,6 +18806,8 @@ used across the different operational domain computation algorithms.)doc";
 
 static const char *__doc_fiction_operational_domain_stats_duration = R"doc(The total runtime of the operational domain computation.)doc";
 
+static const char *__doc_fiction_operational_domain_stats_num_checkpoints = R"doc(Number of checkpoints that were written.)doc";
+
 static const char *__doc_fiction_operational_domain_stats_num_evaluated_parameter_combinations = R"doc(Number of evaluated parameter combinations.)doc";
 
 static const char *__doc_fiction_operational_domain_stats_num_non_operational_parameter_combinations =
@@ -17858,6 +18816,10 @@ operational.)doc";
 
 static const char *__doc_fiction_operational_domain_stats_num_operational_parameter_combinations = R"doc(Number of parameter combinations, for which the layout is operational.)doc";
 
+static const char *__doc_fiction_operational_domain_stats_num_restored_parameter_points =
+R"doc(Number of parameter points that were restored from the checkpoint file
+instead of being evaluated.)doc";
+
 static const char *__doc_fiction_operational_domain_stats_num_simulator_invocations = R"doc(Number of simulator invocations.)doc";
 
 static const char *__doc_fiction_operational_domain_stats_num_total_parameter_points = R"doc(Total number of parameter points in the parameter space.)doc";
@@ -17874,6 +18836,69 @@ static const char *__doc_fiction_operational_domain_value_range_min = R"doc(The
 
 static const char *__doc_fiction_operational_domain_value_range_step = R"doc(The step size of the dimension sweep.)doc";
 
+static const char *__doc_fiction_operational_domain_worker =
+R"doc(Runs a worker of a distributed operational domain computation that
+communicates with its coordinator via a shared directory (see
+`shared_directory_operational_domain_worker_pool`). The worker
+repeatedly claims a batch, evaluates it, and writes its result until
+the coordinator signals that the computation has finished. Any number
+of workers, e.g., one process per node of a cluster, may serve the
+same directory.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Template parameter ``TT``:
+    Truth table type.
+
+Parameter ``lyt``:
+    Layout to compute the operational domain for.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Operational domain computation parameters. The sweep dimensions
+    must match the coordinator's.
+
+Parameter ``directory``:
+    Shared directory.
+
+Parameter ``ps``:
+    Worker parameters.
+
+Returns:
+    Number of evaluated batches.
+
+Throws:
+    std::invalid_argument if the given sweep parameters are invalid or
+    if a batch does not match them. In the latter case, the batch is
+    released for other workers.)doc";
+
+static const char *__doc_fiction_operational_domain_worker_params = R"doc(Parameters for `operational_domain_worker`.)doc";
+
+static const char *__doc_fiction_operational_domain_worker_params_poll_interval =
+R"doc(Time between two scans of the shared directory for batches.)doc";
+
+static const char *__doc_fiction_operational_domain_worker_pool =
+R"doc(Interface between the coordinator of a distributed operational domain
+computation and its workers. The coordinator submits batches of
+parameter points and collects their results in the order in which they
+become available.
+
+Implementations decide where batches are evaluated, e.g., by threads
+of the current process (see `local_operational_domain_worker_pool`) or
+by processes on other machines (see
+`shared_directory_operational_domain_worker_pool`).)doc";
+
+static const char *__doc_fiction_operational_domain_worker_pool_capacity =
+R"doc(Returns the number of batches that the coordinator should keep in
+flight to occupy all workers.
+
+Returns:
+    Number of concurrently submitted batches.)doc";
+
 static const char *__doc_fiction_operational_input_patterns =
 R"doc(This function determines the input combinations for which the layout
 is operational.
@@ -19538,6 +20563,94 @@ Parameter ``filename``:
 Parameter ``layout_name``:
     The name to give to the generated layout.)doc";
 
+static const char *__doc_fiction_read_gate_level_layout_snapshot =
+R"doc(Reads a gate-level layout from a snapshot that was written by
+`write_gate_level_layout_snapshot`. The snapshot is loaded in large
+blocks and its checksum is verified before the layout is constructed.
+Since all tiles are stored in topological order together with the
+indices of their fanins, no parsing or tile lookups are required.
+
+This overload uses an input stream to read from.
+
+Template parameter ``Lyt``:
+    Gate-level layout type to construct. Its topology has to match the
+    one stored in the snapshot.
+
+Parameter ``is``:
+    The input stream to read from. Should be opened in binary mode.
+
+Returns:
+    The layout stored in the snapshot.
+
+Throws:
+    gate_level_layout_snapshot_parsing_error if the snapshot is
+    malformed or corrupted or does not fit `Lyt`.)doc";
+
+static const char *__doc_fiction_read_gate_level_layout_snapshot_2 =
+R"doc(Reads a gate-level layout from a snapshot that was written by
+`write_gate_level_layout_snapshot`.
+
+This overload uses a file name to read from.
+
+Template parameter ``Lyt``:
+    Gate-level layout type to construct. Its topology has to match the
+    one stored in the snapshot.
+
+Parameter ``filename``:
+    The file name to read from.
+
+Returns:
+    The layout stored in the snapshot.
+
+Throws:
+    std::ifstream::failure if the file could not be opened.
+
+Throws:
+    gate_level_layout_snapshot_parsing_error if the snapshot is
+    malformed or corrupted or does not fit `Lyt`.)doc";
+
+static const char *__doc_fiction_read_network_snapshot =
+R"doc(Reads a combinational logic network from a snapshot that was written
+by `write_network_snapshot`. Since the snapshot stores the gates in
+topological order, no parsing or name resolution is required.
+
+This overload uses an input stream to read from.
+
+Template parameter ``Ntk``:
+    Logic network type to construct.
+
+Parameter ``is``:
+    The input stream to read from. Should be opened in binary mode.
+
+Returns:
+    The network stored in the snapshot.
+
+Throws:
+    network_snapshot_parsing_error if the snapshot is malformed or
+    contains gates that cannot be constructed in `Ntk`.)doc";
+
+static const char *__doc_fiction_read_network_snapshot_2 =
+R"doc(Reads a combinational logic network from a snapshot that was written
+by `write_network_snapshot`.
+
+This overload uses a file name to read from.
+
+Template parameter ``Ntk``:
+    Logic network type to construct.
+
+Parameter ``filename``:
+    The file name to read from.
+
+Returns:
+    The network stored in the snapshot.
+
+Throws:
+    std::ifstream::failure if the file could not be opened.
+
+Throws:
+    network_snapshot_parsing_error if the snapshot is malformed or
+    contains gates that cannot be constructed in `Ntk`.)doc";
+
 static const char *__doc_fiction_read_sidb_surface_defects =
 R"doc(Reads a defective SiDB surface from a text file provided as an input
 stream. The format is rudimentary and consists of a simple 2D array of
@@ -19961,6 +21074,39 @@ Parameter ``time``:
 Returns:
     The `std::tm` representation of the given time.)doc";
 
+static const char *__doc_fiction_sat_solver_interface =
+R"doc(Run-time polymorphic wrapper around the SAT solvers provided by
+`bill`, which are selected via a template parameter. This allows for
+choosing a SAT engine via a parameter struct without having to
+template all surrounding code on it.)doc";
+
+static const char *__doc_fiction_sat_solver_interface_add_clause =
+R"doc(Adds a clause, i.e., a disjunction of literals.
+
+Parameter ``clause``:
+    The literals of the clause.)doc";
+
+static const char *__doc_fiction_sat_solver_interface_add_variable =
+R"doc(Creates a new variable.
+
+Returns:
+    The new variable.)doc";
+
+static const char *__doc_fiction_sat_solver_interface_get_model =
+R"doc(Returns the model of the last satisfiable call to `solve`.
+
+Returns:
+    The model indexed by variables.)doc";
+
+static const char *__doc_fiction_sat_solver_interface_solve =
+R"doc(Solves the instance under the given assumptions.
+
+Parameter ``assumptions``:
+    Literals that are assumed to be true for this call only.
+
+Returns:
+    The result state.)doc";
+
 static const char *__doc_fiction_searchable_priority_queue =
 R"doc(An extension of `std::priority_queue` that allows searching the
 underlying container. The implementation is based on
@@ -20035,6 +21181,50 @@ Parameter ``ntk_or_lyt``:
 Parameter ``name``:
     Name to assign to given network or layout.)doc";
 
+static const char *__doc_fiction_shared_directory_operational_domain_worker_pool =
+R"doc(Coordinator side of a worker pool whose workers are separate
+processes, potentially on different machines, that communicate with
+the coordinator via a shared directory, e.g., on a network file
+system.
+
+The coordinator writes each batch to a file `batch_<id>.txt`. Workers
+(see `operational_domain_worker`) claim a batch by renaming its file,
+evaluate it, and write the result to `result_<id>.txt`, which the
+coordinator picks up. All files are first written to a temporary file
+that is then renamed such that no party ever reads a partially written
+file. Batches whose result is malformed are handed out again. Once the
+computation has finished, the coordinator creates a file `done`, upon
+which the workers terminate.)doc";
+
+static const char *__doc_fiction_shared_directory_operational_domain_worker_pool_finish =
+R"doc(Signals the workers that the computation has finished. Called
+automatically upon destruction.)doc";
+
+static const char *__doc_fiction_shared_directory_operational_domain_worker_pool_shared_directory_operational_domain_worker_pool =
+R"doc(Standard constructor. Creates the shared directory if necessary and
+removes leftovers of previous computations.
+
+Parameter ``dir``:
+    Shared directory.
+
+Parameter ``ps``:
+    Parameters.)doc";
+
+static const char *__doc_fiction_shared_directory_worker_pool_params =
+R"doc(Parameters for the `shared_directory_operational_domain_worker_pool`.)doc";
+
+static const char *__doc_fiction_shared_directory_worker_pool_params_capacity =
+R"doc(Number of batches that are kept in flight. This should be at least the
+total number of worker processes.)doc";
+
+static const char *__doc_fiction_shared_directory_worker_pool_params_poll_interval =
+R"doc(Time between two scans of the shared directory for results.)doc";
+
+static const char *__doc_fiction_shared_directory_worker_pool_params_resubmission_timeout =
+R"doc(Time after which a claimed batch whose result is still missing is
+handed out again, e.g., because the worker that claimed it crashed. A
+value of 0 disables resubmission.)doc";
+
 static const char *__doc_fiction_shifted_cartesian_layout =
 R"doc(A layout type that utilizes offset coordinates to represent a
 Cartesian layout with shifted coordinates. Its faces are organizes in
@@ -20434,9 +21624,17 @@ static const char *__doc_fiction_sidb_cluster_parent =
 R"doc(Every cluster carries a pointer to its parent. For the top cluster,
 this is `nullptr`.)doc";
 
-static const char *__doc_fiction_sidb_cluster_pot_projs = R"doc()doc";
+static const char *__doc_fiction_sidb_cluster_pot_projs =
+R"doc(The bounds on the electrostatic potential that is projected from this
+cluster for the different multiset charge configurations in the charge
+space. The potential projection orders are stored contiguously and are
+indexed by the receiving SiDB, such that the potential projections
+onto distinct SiDBs may also be modified concurrently.)doc";
 
-static const char *__doc_fiction_sidb_cluster_pot_projs_complete_store = R"doc()doc";
+static const char *__doc_fiction_sidb_cluster_pot_projs_complete_store =
+R"doc(The bounds on the electrostatic potential that is projected from this
+cluster onto each SiDB in the layout, for each multiset charge
+configuration in the (then fixed) charge space.)doc";
 
 static const char *__doc_fiction_sidb_cluster_projector_state =
 R"doc(A projector state pairs the potential projecting cluster with the
@@ -21644,6 +22842,53 @@ Template parameter ``T``:
 
 static const char *__doc_fiction_static_depth_view_static_depth_view = R"doc()doc";
 
+static const char *__doc_fiction_stream_qca_layout =
+R"doc(Applies a static gate library to a gate-level layout and writes the
+resulting cell-level layout to a qca file that is used by QCADesigner
+(https://waluslab.ece.ubc.ca/qcadesigner/) without ever holding the
+entire cell-level layout in memory.
+
+Template parameter ``CellLyt``:
+    Cell-level QCA layout type that would be returned by
+    `apply_gate_library`.
+
+Template parameter ``GateLibrary``:
+    Type of the gate library to apply.
+
+Template parameter ``GateLyt``:
+    Type of the gate-level layout to apply the library to.
+
+Parameter ``lyt``:
+    The gate-level layout.
+
+Parameter ``os``:
+    The output stream to write into.
+
+Parameter ``ps``:
+    Parameters.)doc";
+
+static const char *__doc_fiction_stream_sqd_layout =
+R"doc(Applies a static gate library to a gate-level layout and writes the
+resulting cell-level layout to an sqd file that is used by SiQAD
+(https://github.com/siqad/siqad) without ever holding the entire cell-
+level layout in memory.
+
+Template parameter ``CellLyt``:
+    Cell-level SiDB or QCA layout type that would be returned by
+    `apply_gate_library`.
+
+Template parameter ``GateLibrary``:
+    Type of the gate library to apply.
+
+Template parameter ``GateLyt``:
+    Type of the gate-level layout to apply the library to.
+
+Parameter ``lyt``:
+    The gate-level layout.
+
+Parameter ``os``:
+    The output stream to write into.)doc";
+
 static const char *__doc_fiction_sweep_parameter = R"doc(Possible sweep parameters for the operational domain computation.)doc";
 
 static const char *__doc_fiction_sweep_parameter_EPSILON_R = R"doc(The relative permittivity of the dielectric material.)doc";
@@ -23114,6 +24359,53 @@ static const char *__doc_fiction_write_fqca_layout_params = R"doc(Parameters for
 
 static const char *__doc_fiction_write_fqca_layout_params_create_inter_layer_via_cells = R"doc(Create via cells in between each layer.)doc";
 
+static const char *__doc_fiction_write_gate_level_layout_snapshot =
+R"doc(Writes a compact binary snapshot of a gate-level layout that can be
+restored via `read_gate_level_layout_snapshot` considerably faster
+than an FGL file. It is intended for caching intermediate physical
+designs between the stages of a design flow, while FGL remains the
+format of choice for exchanging layouts.
+
+The snapshot stores the layout's topology, name, aspect ratio, and
+clocking, including all clock zones if the layout is irregularly
+clocked, as well as all tiles with their types, fanins, functions,
+and, in case of PIs and POs, names. A checksum over the payload allows
+detecting corrupted files on reading. The snapshot is written in the
+native byte order, which is recorded in the header.
+
+This overload uses an output stream to write into.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Parameter ``lyt``:
+    The layout to write.
+
+Parameter ``os``:
+    The output stream to write into. Should be opened in binary mode.
+
+Throws:
+    std::invalid_argument if `lyt` contains a cycle.)doc";
+
+static const char *__doc_fiction_write_gate_level_layout_snapshot_2 =
+R"doc(Writes a compact binary snapshot of a gate-level layout that can be
+restored via `read_gate_level_layout_snapshot` considerably faster
+than an FGL file.
+
+This overload uses a file name to create and write into.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Parameter ``lyt``:
+    The layout to write.
+
+Parameter ``filename``:
+    The file name to create and write into.
+
+Throws:
+    std::invalid_argument if `lyt` contains a cycle.)doc";
+
 static const char *__doc_fiction_write_location_and_ground_state =
 R"doc(Writes the coordinates of all SiDBs of a layout together with the
 charge distribution of the ground state(s) to a file.
@@ -23144,6 +24436,53 @@ Template parameter ``sim_result``:
 Parameter ``filename``:
     The file name to create and write into.)doc";
 
+static const char *__doc_fiction_write_network_snapshot =
+R"doc(Writes a compact binary snapshot of a combinational logic network that
+can be read back via `read_network_snapshot` considerably faster than
+parsing the file the network originated from. The snapshot stores the
+network's gates in topological order together with the network, PI,
+and PO names. Thereby, all gates are distinguished in the same way as
+`convert_network` does, i.e., gates that are neither AND, OR, XOR,
+MAJ, nor buffers are stored via their truth tables.
+
+The snapshot is written in the native byte order, which is recorded in
+the header.
+
+This overload uses an output stream to write into.
+
+Template parameter ``Ntk``:
+    Logic network type.
+
+Parameter ``ntk``:
+    The network to write.
+
+Parameter ``os``:
+    The output stream to write into. Should be opened in binary mode.
+
+Throws:
+    std::invalid_argument if `ntk` contains a gate that cannot be
+    stored.)doc";
+
+static const char *__doc_fiction_write_network_snapshot_2 =
+R"doc(Writes a compact binary snapshot of a combinational logic network that
+can be read back via `read_network_snapshot` considerably faster than
+parsing the file the network originated from.
+
+This overload uses a file name to create and write into.
+
+Template parameter ``Ntk``:
+    Logic network type.
+
+Parameter ``ntk``:
+    The network to write.
+
+Parameter ``filename``:
+    The file name to create and write into.
+
+Throws:
+    std::invalid_argument if `ntk` contains a gate that cannot be
+    stored.)doc";
+
 static const char *__doc_fiction_write_operational_domain =
 R"doc(Writes a CSV representation of an operational domain to the specified
 output stream. The data are written as rows, each corresponding to one
@@ -23638,6 +24977,88 @@ static const char *__doc_fiction_yen_k_shortest_paths_params = R"doc(Parameters
 
 static const char *__doc_fiction_yen_k_shortest_paths_params_astar_params = R"doc(Parameters for the internal A* algorithm.)doc";
 
+static const char *__doc_fiction_z3_cnf_translator =
+R"doc(Translates Z3 formulas to CNF and solves them with a SAT solver from
+`bill`.
+
+The supported fragment comprises Boolean constants and connectives
+(`not`, `and`, `or`, `implies`, `xor`, `=`, `ite`), cardinality
+constraints (`atmost`, `atleast`), and (in-)equalities over linear
+integer or real terms that only consist of numerals and `ite`
+expressions with Boolean conditions, e.g., sums of `ite(x, 1, 0)`
+counters. In particular, arithmetic constants are not supported.
+
+Nested sub-formulas are Tseitin-encoded. Top-level cardinality
+constraints are encoded via sequential counters, which only need to
+enforce one direction, while cardinality constraints nested in other
+formulas are encoded via totalizers whose outputs are equivalent to
+the respective bounds on the sum. Implications at the top level are
+turned into guard literals that are added to all clauses of the
+consequent so that, e.g., `lit -> constraint` assertions that are used
+for incremental solving via assumptions do not need any auxiliary
+variable.
+
+Formulas can be added incrementally between calls to `solve`. Sub-
+formulas are cached by their AST ID, which is why all added formulas
+are kept alive.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_add =
+R"doc(Adds the given Boolean formula as a constraint.
+
+If the formula lies outside the supported fragment, it is discarded,
+the translator is marked as unsupported, and all subsequent calls to
+this function are ignored. The clauses that have been generated up to
+this point are kept in the solver but the instance must not be solved
+anymore.
+
+Parameter ``formula``:
+    Boolean formula to add.
+
+Returns:
+    `true` iff the formula and all previously added ones could be
+    translated.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_get_model =
+R"doc(Extracts a Z3 model over all Boolean constants that occurred in the
+added formulas from the model of the last satisfiable call to `solve`.
+Constants that did not occur in any formula are not part of the model.
+
+Returns:
+    A Z3 model that can be evaluated like the ones obtained from
+    `z3::solver::get_model`.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_is_supported =
+R"doc(Checks whether all formulas added so far could be translated.
+
+Returns:
+    `true` iff the instance can be solved.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_num_clauses =
+R"doc(Returns the number of clauses that have been generated so far.
+
+Returns:
+    Number of clauses.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_solve =
+R"doc(Solves the conjunction of all added formulas under the given
+assumptions. The translator must be supported.
+
+Parameter ``assumptions``:
+    Boolean formulas from the supported fragment that are assumed to
+    hold for this call only. They are usually constants.
+
+Returns:
+    The SAT solver's result state.)doc";
+
+static const char *__doc_fiction_z3_cnf_translator_z3_cnf_translator =
+R"doc(Standard constructor.
+
+Parameter ``c``:
+    The context of all formulas to translate.
+
+Parameter ``sat_engine``:
+    The SAT solver to use.)doc";
+
 static const char *__doc_fmt_formatter = R"doc()doc";
 
 static const char *__doc_fmt_formatter_2 = R"doc()doc";
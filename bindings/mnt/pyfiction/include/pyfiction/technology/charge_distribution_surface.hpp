@@ -7,6 +7,7 @@
 
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
+#include "pyfiction/utils/buffer_view.hpp"
 
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
@@ -75,6 +76,26 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
         .def("get_charge_state", &py_cds::get_charge_state, py::arg("c"))
         .def("get_charge_state_by_index", &py_cds::get_charge_state_by_index, py::arg("index"))
         .def("get_all_sidb_charges", &py_cds::get_all_sidb_charges)
+        .def(
+            "get_charge_state_view",
+            [](const py_cds& lyt) { return buffer_view::of<int8_t>(lyt.get_charge_state_vector(), {}); },
+            DOC(pyfiction_charge_distribution_surface_get_charge_state_view))
+        .def(
+            "get_local_internal_potential_view",
+            [](const py_cds& lyt) { return buffer_view::of<double>(lyt.get_local_internal_potential_vector(), {}); },
+            DOC(pyfiction_charge_distribution_surface_get_local_internal_potential_view))
+        .def(
+            "get_local_external_potential_view",
+            [](const py_cds& lyt) { return buffer_view::of<double>(lyt.get_local_external_potential_vector(), {}); },
+            DOC(pyfiction_charge_distribution_surface_get_local_external_potential_view))
+        .def(
+            "get_chargeless_potential_matrix_view",
+            [](const py_cds& lyt)
+            {
+                const auto n = static_cast<py::ssize_t>(lyt.num_cells());
+                return buffer_view::of<double>(lyt.get_chargeless_potential_matrix(), {n, n});
+            },
+            DOC(pyfiction_charge_distribution_surface_get_chargeless_potential_matrix_view))
         .def("negative_sidb_detection", &py_cds::negative_sidb_detection)
         .def("get_nm_distance_between_sidbs", &py_cds::get_nm_distance_between_sidbs, py::arg("c1"), py::arg("c2"))
         .def("get_nm_distance_by_indices", &py_cds::get_nm_distance_by_indices, py::arg("index1"), py::arg("index2"))
@@ -0,0 +1,115 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef PYFICTION_BATCH_UTILS_HPP
+#define PYFICTION_BATCH_UTILS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pyfiction
+{
+
+/**
+ * Applies the given function to each input on a pool of native threads and returns the results in input order.
+ *
+ * This function does not interact with the Python interpreter and is intended to be called from bindings that release
+ * the GIL, e.g., via `py::call_guard<py::gil_scoped_release>()`. Thereby, batches of long-running algorithms can be
+ * processed in parallel without blocking other Python threads.
+ *
+ * If the function throws for any input, no further inputs are scheduled and the first exception is rethrown after all
+ * threads have finished.
+ *
+ * @tparam Input Input type.
+ * @tparam Fn Function type that maps a `const Input&` to a result.
+ * @param inputs Inputs to process.
+ * @param fn Function to apply to each input.
+ * @param num_threads Number of threads to use. If 0, the number of hardware threads is used.
+ * @return The results of `fn` for each input in the order of `inputs`.
+ */
+template <typename Input, typename Fn>
+[[nodiscard]] auto batch_apply(const std::vector<Input>& inputs, Fn&& fn, const std::size_t num_threads = 0)
+{
+    using result_type = std::decay_t<std::invoke_result_t<Fn&, const Input&>>;
+
+    std::vector<std::optional<result_type>> results(inputs.size());
+
+    std::atomic<std::size_t> next_input{0};
+    std::atomic<bool>        failed{false};
+
+    std::exception_ptr first_exception{};
+    std::mutex         exception_mutex{};
+
+    const auto worker = [&]
+    {
+        for (auto i = next_input++; i < inputs.size() && !failed; i = next_input++)
+        {
+            try
+            {
+                results[i].emplace(fn(inputs[i]));
+            }
+            catch (...)
+            {
+                const std::lock_guard lock{exception_mutex};
+
+                if (!first_exception)
+                {
+                    first_exception = std::current_exception();
+                }
+
+                failed = true;
+            }
+        }
+    };
+
+    const auto available_threads = num_threads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : num_threads;
+    const auto thread_count      = std::min(static_cast<std::size_t>(available_threads), inputs.size());
+
+    if (thread_count <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+
+        for (std::size_t t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    if (first_exception)
+    {
+        std::rethrow_exception(first_exception);
+    }
+
+    std::vector<result_type> unwrapped{};
+    unwrapped.reserve(results.size());
+
+    for (auto& r : results)
+    {
+        unwrapped.push_back(std::move(*r));
+    }
+
+    return unwrapped;
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_BATCH_UTILS_HPP
@@ -0,0 +1,145 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef PYFICTION_BUFFER_VIEW_HPP
+#define PYFICTION_BUFFER_VIEW_HPP
+
+#include "pyfiction/documentation.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pyfiction
+{
+
+/**
+ * A read-only, multidimensional view of a contiguous C++ vector that is exposed to Python via the buffer protocol.
+ * Wrapping a view in `memoryview` or `numpy.asarray` accesses the underlying data without copying it.
+ *
+ * The view shares ownership of the vector, which is why it remains valid independent of the lifetime of the C++
+ * object it was obtained from. Since the data pointer is retrieved whenever a buffer is requested, buffers created
+ * after modifications of the vector always reflect its current contents.
+ */
+class buffer_view
+{
+  public:
+    /**
+     * Creates a view of the given vector.
+     *
+     * @tparam Repr Type by which the vector's elements are exposed to Python. Must have the same size as `T`, e.g.,
+     * the underlying type of an enumeration.
+     * @tparam T Element type of the vector.
+     * @param vec Shared pointer to the vector to view.
+     * @param shape Shape of the view in row-major order. If empty, a one-dimensional view of the entire vector is
+     * created.
+     * @return A view of `vec`.
+     */
+    template <typename Repr, typename T>
+    [[nodiscard]] static buffer_view of(std::shared_ptr<const std::vector<T>> vec, std::vector<pybind11::ssize_t> shape)
+    {
+        static_assert(sizeof(Repr) == sizeof(T), "Repr and T must have the same size");
+
+        buffer_view view{};
+
+        view.item_size = static_cast<pybind11::ssize_t>(sizeof(Repr));
+        view.format    = pybind11::format_descriptor<Repr>::format();
+        view.dims      = std::move(shape);
+        view.data      = [vec = std::move(vec)]
+        { return std::make_pair(static_cast<const void*>(vec->data()), static_cast<std::size_t>(vec->size())); };
+
+        return view;
+    }
+    /**
+     * Returns the shape of the view. An empty shape denotes a one-dimensional view of the entire vector.
+     *
+     * @return Shape of the view.
+     */
+    [[nodiscard]] std::vector<pybind11::ssize_t> shape() const
+    {
+        if (dims.empty())
+        {
+            return {static_cast<pybind11::ssize_t>(data().second)};
+        }
+
+        return dims;
+    }
+    /**
+     * Requests a buffer that describes the current contents of the viewed vector.
+     *
+     * @return A read-only buffer of the viewed vector.
+     * @throws pybind11::buffer_error if the vector's size does not match the view's shape anymore.
+     */
+    [[nodiscard]] pybind11::buffer_info buffer() const
+    {
+        const auto [ptr, size] = data();
+        const auto view_shape  = shape();
+
+        if (const auto num_elements = std::accumulate(view_shape.cbegin(), view_shape.cend(), pybind11::ssize_t{1},
+                                                      std::multiplies<>{});
+            static_cast<std::size_t>(num_elements) != size)
+        {
+            throw pybind11::buffer_error("the viewed data changed its size since the view was created");
+        }
+
+        std::vector<pybind11::ssize_t> strides(view_shape.size(), item_size);
+
+        for (auto i = static_cast<std::ptrdiff_t>(view_shape.size()) - 2; i >= 0; --i)
+        {
+            strides[static_cast<std::size_t>(i)] =
+                strides[static_cast<std::size_t>(i) + 1] * view_shape[static_cast<std::size_t>(i) + 1];
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): the buffer is flagged as read-only
+        return pybind11::buffer_info{const_cast<void*>(ptr),
+                                     item_size,
+                                     format,
+                                     static_cast<pybind11::ssize_t>(view_shape.size()),
+                                     view_shape,
+                                     strides,
+                                     true};
+    }
+
+  private:
+    /**
+     * Returns the data pointer and the number of elements of the viewed vector.
+     */
+    std::function<std::pair<const void*, std::size_t>()> data{};
+    /**
+     * Size of a single element in bytes.
+     */
+    pybind11::ssize_t item_size{0};
+    /**
+     * Python struct format string of the elements.
+     */
+    std::string format{};
+    /**
+     * Shape of the view.
+     */
+    std::vector<pybind11::ssize_t> dims{};
+};
+
+inline void buffer_views(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::class_<buffer_view>(m, "buffer_view", py::buffer_protocol(), DOC(pyfiction_buffer_view))
+        .def_buffer([](const buffer_view& view) { return view.buffer(); })
+        .def_property_readonly("shape", [](const buffer_view& view) { return view.shape(); })
+        .def_property_readonly("ndim", [](const buffer_view& view) { return view.shape().size(); })
+        .def("__len__", [](const buffer_view& view) { return view.shape().front(); })
+
+        ;
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_BUFFER_VIEW_HPP
@@ -44,6 +44,7 @@
 #include "pyfiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "pyfiction/algorithms/simulation/sidb/occupation_probability_of_excited_states.hpp"
 #include "pyfiction/algorithms/simulation/sidb/operational_domain.hpp"
+#include "pyfiction/algorithms/simulation/sidb/operational_domain_worker_pool.hpp"
 #include "pyfiction/algorithms/simulation/sidb/physical_population_stability.hpp"
 #include "pyfiction/algorithms/simulation/sidb/potential_to_distance_conversion.hpp"
 #include "pyfiction/algorithms/simulation/sidb/quickexact.hpp"
@@ -55,9 +56,11 @@
 #include "pyfiction/algorithms/simulation/sidb/time_to_solution.hpp"
 #include "pyfiction/algorithms/verification/design_rule_violations.hpp"
 #include "pyfiction/algorithms/verification/equivalence_checking.hpp"
+#include "pyfiction/inout/read_binary_operational_domain.hpp"
 #include "pyfiction/inout/read_fgl_layout.hpp"
 #include "pyfiction/inout/read_fqca_layout.hpp"
 #include "pyfiction/inout/read_sqd_layout.hpp"
+#include "pyfiction/inout/write_binary_operational_domain.hpp"
 #include "pyfiction/inout/write_dot_layout.hpp"
 #include "pyfiction/inout/write_fgl_layout.hpp"
 #include "pyfiction/inout/write_fqca_layout.hpp"
@@ -86,6 +89,7 @@
 #include "pyfiction/technology/sidb_lattice.hpp"
 #include "pyfiction/technology/sidb_nm_distance.hpp"
 #include "pyfiction/technology/sidb_nm_position.hpp"
+#include "pyfiction/utils/buffer_view.hpp"
 #include "pyfiction/utils/layout_utils.hpp"
 #include "pyfiction/utils/name_utils.hpp"
 #include "pyfiction/utils/network_utils.hpp"
@@ -137,6 +141,7 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
     pyfiction::detect_bdl_wires(m);
     pyfiction::is_operational(m);
     pyfiction::operational_domain(m);
+    pyfiction::operational_domain_worker_pool(m);
     pyfiction::exhaustive_ground_state_simulation(m);
     pyfiction::quicksim(m);
     pyfiction::quickexact(m);
@@ -215,12 +220,15 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
     pyfiction::write_sqd_sim_result(m);
     // pyfiction::write_location_and_ground_state(m);
     pyfiction::write_operational_domain(m);
+    pyfiction::write_binary_operational_domain(m);
+    pyfiction::read_binary_operational_domain(m);
     pyfiction::read_fgl_layout(m);
     pyfiction::read_fqca_layout(m);
     pyfiction::read_sqd_layout(m);
     /**
      * Utils
      */
+    pyfiction::buffer_views(m);
     pyfiction::layout_utils(m);
     pyfiction::routing_utils(m);
     pyfiction::name_utils(m);
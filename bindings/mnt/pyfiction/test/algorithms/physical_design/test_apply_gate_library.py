@@ -3,6 +3,7 @@ import unittest
 
 from mnt.pyfiction import (
     apply_bestagon_library,
+    apply_gate_library_params,
     apply_qca_one_library,
     apply_topolinano_library,
     exact_hexagonal,
@@ -23,6 +24,23 @@ class TestApplyGateLibrary(unittest.TestCase):
 
         apply_qca_one_library(layout)
 
+    def test_apply_qca_one_library_multithreaded(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+        layout = orthogonal(network)
+
+        params = apply_gate_library_params()
+        params.num_threads = 4
+
+        sequential_params = apply_gate_library_params()
+        sequential_params.num_threads = 1
+
+        parallel = apply_qca_one_library(layout, params)
+        sequential = apply_qca_one_library(layout, sequential_params)
+
+        self.assertEqual(parallel.num_cells(), sequential.num_cells())
+        self.assertEqual(parallel.num_pis(), sequential.num_pis())
+        self.assertEqual(parallel.num_pos(), sequential.num_pos())
+
     def test_apply_bestagon_library(self):
         network = read_technology_network(dir_path + "/../../resources/mux21.v")
 
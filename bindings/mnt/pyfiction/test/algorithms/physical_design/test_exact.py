@@ -7,6 +7,7 @@ from mnt.pyfiction import (
     exact_cartesian,
     exact_hexagonal,
     exact_params,
+    exact_physical_design_backend,
     exact_stats,
     read_technology_network,
 )
@@ -32,6 +33,22 @@ class TestExactCartesianPhysicalDesign(unittest.TestCase):
 
         self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
 
+    def test_exact_with_sat_backend(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        params = exact_params()
+        params.crossings = True
+        params.scheme = "2DDWave"
+        params.backend = exact_physical_design_backend.SAT
+
+        stats = exact_stats()
+
+        layout = exact_cartesian(network, params, stats)
+
+        self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+        self.assertGreater(stats.num_sat_checks, 0)
+        self.assertEqual(stats.num_sat_fallbacks, 0)
+
     def test_exact_with_stats(self):
         network = read_technology_network(dir_path + "/../../resources/mux21.v")
 
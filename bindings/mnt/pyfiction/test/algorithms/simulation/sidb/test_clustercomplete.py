@@ -6,6 +6,7 @@ from mnt.pyfiction import (
     charge_distribution_surface_111,
     clustercomplete,
     clustercomplete_params,
+    clustercomplete_stats,
     ground_state_space_reporting,
     sidb_100_lattice,
     sidb_111_lattice,
@@ -29,12 +30,14 @@ class TestClusterComplete(unittest.TestCase):
         params.validity_witness_partitioning_max_cluster_size_gss = 15
         params.num_overlapping_witnesses_limit_gss = 8
         params.available_threads = 4
+        params.work_splitting_threshold = 16
         params.report_gss_stats = ground_state_space_reporting.ON
         self.assertEqual(params.simulation_parameters.base, 2)
         self.assertEqual(params.simulation_parameters.mu_minus, -0.25)
         self.assertEqual(params.validity_witness_partitioning_max_cluster_size_gss, 15)
         self.assertEqual(params.num_overlapping_witnesses_limit_gss, 8)
         self.assertEqual(params.available_threads, 4)
+        self.assertEqual(params.work_splitting_threshold, 16)
         self.assertEqual(params.report_gss_stats, ground_state_space_reporting.ON)
 
         cds = charge_distribution_surface_100(layout)
@@ -82,6 +85,22 @@ class TestClusterComplete(unittest.TestCase):
         self.assertEqual(groundstate[0].get_charge_state((2, 0)), sidb_charge_state.NEUTRAL)
         self.assertEqual(groundstate[0].get_charge_state((3, 0)), sidb_charge_state.NEGATIVE)
 
+    def test_stats(self):
+        layout = sidb_111_lattice((4, 1))
+        layout.assign_cell_type((0, 0), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((3, 0), sidb_technology.cell_type.NORMAL)
+
+        params = clustercomplete_params()
+        params.available_threads = 2
+
+        stats = clustercomplete_stats()
+
+        result = clustercomplete(charge_distribution_surface_111(layout), params, stats)
+
+        self.assertEqual(len(result.groundstates()), 1)
+        self.assertGreaterEqual(stats.time_total, stats.time_ground_state_space)
+        self.assertGreaterEqual(stats.time_total, stats.time_unfolding)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -8,6 +8,7 @@ from mnt.pyfiction import (
     detect_bdl_wires_params,
     is_kink_induced_non_operational,
     is_operational,
+    is_operational_batch,
     is_operational_params,
     kink_induced_non_operational_input_patterns,
     operational_analysis_strategy,
@@ -83,6 +84,22 @@ class TestIsOperational(unittest.TestCase):
         )
         self.assertEqual(op_status, operational_status.NON_OPERATIONAL)
 
+    def test_is_operational_batch(self):
+        and_gate = read_sqd_layout_100(dir_path + "/../../../resources/AND_mu_032_kinks.sqd")
+        bestagon_and_gate = read_sqd_layout_100(dir_path + "/../../../resources/Bestagon_AND_mu_025_v0.sqd")
+
+        layouts = [and_gate, bestagon_and_gate, and_gate]
+
+        params = is_operational_params()
+        params.simulation_parameters = sidb_simulation_parameters(2, -0.32)
+
+        results = is_operational_batch(layouts, [create_and_tt()], params, num_threads=2)
+
+        self.assertEqual(len(results), len(layouts))
+
+        for layout, (op_status, _evaluated_input_combinations) in zip(layouts, results):
+            self.assertEqual(op_status, is_operational(layout, [create_and_tt()], params)[0])
+
     def test_and_gate_kinks(self):
         lyt = read_sqd_layout_100(dir_path + "/../../../resources/AND_mu_032_kinks.sqd")
 
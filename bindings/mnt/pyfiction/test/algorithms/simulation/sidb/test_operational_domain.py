@@ -1,4 +1,6 @@
+import math
 import os
+import tempfile
 import unittest
 
 from mnt.pyfiction import (
@@ -7,6 +9,7 @@ from mnt.pyfiction import (
     create_or_tt,
     create_xor_tt,
     critical_temperature_domain,
+    critical_temperature_domain_adaptive_refinement,
     critical_temperature_domain_contour_tracing,
     critical_temperature_domain_flood_fill,
     critical_temperature_domain_grid_search,
@@ -14,6 +17,7 @@ from mnt.pyfiction import (
     input_bdl_configuration,
     operational_condition,
     operational_domain,
+    operational_domain_adaptive_refinement,
     operational_domain_contour_tracing,
     operational_domain_flood_fill,
     operational_domain_grid_search,
@@ -84,6 +88,14 @@ class TestOperationalDomain(unittest.TestCase):
         operational_domain_contour_tracing(lyt, [create_xor_tt()], 100, params, stats_contour_tracing)
         self.assertGreater(stats_contour_tracing.num_operational_parameter_combinations, 0)
 
+        stats_adaptive_refinement = operational_domain_stats()
+        operational_domain_adaptive_refinement(lyt, [create_xor_tt()], 5, params, stats_adaptive_refinement)
+        self.assertGreater(stats_adaptive_refinement.num_operational_parameter_combinations, 0)
+        self.assertLess(
+            stats_adaptive_refinement.num_evaluated_parameter_combinations,
+            stats_grid.num_evaluated_parameter_combinations,
+        )
+
     def test_critical_temperature_domain_XOR_gate_100_lattice(self):
         lyt = read_sqd_layout_100(dir_path + "/../../../resources/hex_21_inputsdbp_xor_v1.sqd")
 
@@ -122,6 +134,14 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertGreater(ct_domain_contour[parameter_point([5.60, 5.00])][1], 30)
         self.assertGreater(stats_contour_tracing.num_operational_parameter_combinations, 0)
 
+        stats_adaptive_refinement = operational_domain_stats()
+        ct_domain_adaptive = critical_temperature_domain_adaptive_refinement(
+            lyt, [create_xor_tt()], 5, params, stats_adaptive_refinement
+        )
+        self.assertEqual(ct_domain_adaptive[parameter_point([5.60, 5.00])][0], operational_status.OPERATIONAL)
+        self.assertGreater(ct_domain_adaptive[parameter_point([5.60, 5.00])][1], 30)
+        self.assertGreater(stats_adaptive_refinement.num_operational_parameter_combinations, 0)
+
         params.sweep_dimensions = [
             operational_domain_value_range(sweep_parameter.EPSILON_R, 5.60, 5.60, 0.01),
             operational_domain_value_range(sweep_parameter.LAMBDA_TF, 5.00, 5.00, 0.01),
@@ -291,6 +311,45 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertIn((new_key, new_value), items_method)
         self.assertEqual(len(items_method), 2)
 
+    def test_dense_grid(self):
+        sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 5.0, 5.2, 0.1),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 5.0, 5.1, 0.1),
+        ]
+
+        op_domain = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        op_domain[parameter_point([5.0, 5.0])] = operational_status.OPERATIONAL
+        op_domain[parameter_point([5.2, 5.1])] = operational_status.NON_OPERATIONAL
+        # not on the grid
+        op_domain[parameter_point([7.0, 5.0])] = operational_status.OPERATIONAL
+
+        axes, status = op_domain.to_dense_grid(sweep_dimensions)
+
+        self.assertEqual(len(axes), 2)
+        self.assertEqual(len(axes[0]), 3)
+        self.assertEqual(len(axes[1]), 2)
+        self.assertAlmostEqual(axes[0][2], 5.2)
+        self.assertEqual(status.shape, [3, 2])
+
+        status_view = memoryview(status)
+        self.assertTrue(status_view.readonly)
+        self.assertEqual(status_view.format, "b")
+        self.assertEqual(status_view.tolist(), [[0, -1], [-1, -1], [-1, 1]])
+
+        temp_domain = critical_temperature_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        temp_domain[parameter_point([5.1, 5.1])] = (operational_status.OPERATIONAL, 42.0)
+
+        axes, status, temperatures = temp_domain.to_dense_grid(sweep_dimensions)
+
+        self.assertEqual(memoryview(status).tolist(), [[-1, -1], [-1, 0], [-1, -1]])
+        temperature_view = memoryview(temperatures)
+        self.assertEqual(temperature_view.format, "d")
+        self.assertEqual(temperature_view[1, 1], 42.0)
+        self.assertTrue(math.isnan(temperature_view[0, 0]))
+
+        with self.assertRaises(ValueError):
+            op_domain.to_dense_grid(sweep_dimensions[:1])
+
     def test_operational_domain_two_bdl_pair_wire(self):
         bdl_wire = sidb_100_lattice()
 
@@ -327,6 +386,44 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertEqual(stats_grid.num_operational_parameter_combinations, 0)
         self.assertEqual(stats_grid.num_non_operational_parameter_combinations, 8281)
 
+    def test_operational_domain_checkpoint(self):
+        bdl_wire = sidb_100_lattice()
+
+        bdl_wire.assign_cell_type((0, 0), sidb_technology.cell_type.INPUT)
+        bdl_wire.assign_cell_type((2, 0), sidb_technology.cell_type.INPUT)
+
+        bdl_wire.assign_cell_type((6, 0), sidb_technology.cell_type.NORMAL)
+        bdl_wire.assign_cell_type((8, 0), sidb_technology.cell_type.NORMAL)
+
+        bdl_wire.assign_cell_type((12, 0), sidb_technology.cell_type.OUTPUT)
+        bdl_wire.assign_cell_type((14, 0), sidb_technology.cell_type.OUTPUT)
+
+        bdl_wire.assign_cell_type((18, 0), sidb_technology.cell_type.NORMAL)
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            params = operational_domain_params()
+            params.operational_params.simulation_parameters.base = 2
+            params.sweep_dimensions = [
+                operational_domain_value_range(sweep_parameter.EPSILON_R, 5.0, 5.5, 0.1),
+                operational_domain_value_range(sweep_parameter.LAMBDA_TF, 5.0, 5.2, 0.1),
+            ]
+            params.checkpoint_file = os.path.join(tmp_dir, "checkpoint.bin")
+            params.checkpoint_interval = 5
+
+            first_stats = operational_domain_stats()
+            first = operational_domain_grid_search(bdl_wire, [create_id_tt()], params, first_stats)
+
+            self.assertEqual(len(first), 18)
+            self.assertEqual(first_stats.num_restored_parameter_points, 0)
+            self.assertGreaterEqual(first_stats.num_checkpoints, 1)
+
+            second_stats = operational_domain_stats()
+            second = operational_domain_grid_search(bdl_wire, [create_id_tt()], params, second_stats)
+
+            self.assertEqual(len(second), 18)
+            self.assertEqual(second_stats.num_restored_parameter_points, 18)
+            self.assertEqual(second_stats.num_evaluated_parameter_combinations, 0)
+
 
 if __name__ == "__main__":
     unittest.main()
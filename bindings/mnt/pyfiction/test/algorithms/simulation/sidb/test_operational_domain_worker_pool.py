@@ -0,0 +1,55 @@
+import unittest
+
+from mnt.pyfiction import (
+    create_id_tt,
+    distributed_operational_domain_params,
+    distributed_sweep_algorithm,
+    local_operational_domain_worker_pool_100,
+    operational_domain_distributed,
+    operational_domain_grid_search,
+    operational_domain_stats,
+    operational_domain_value_range,
+    sidb_100_lattice,
+    sidb_technology,
+    sweep_parameter,
+)
+
+
+class TestOperationalDomainWorkerPool(unittest.TestCase):
+    def test_distributed_grid_search_with_local_workers(self):
+        lyt = sidb_100_lattice()
+
+        lyt.assign_cell_type((0, 0), sidb_technology.cell_type.INPUT)
+        lyt.assign_cell_type((2, 0), sidb_technology.cell_type.INPUT)
+
+        lyt.assign_cell_type((6, 0), sidb_technology.cell_type.NORMAL)
+        lyt.assign_cell_type((8, 0), sidb_technology.cell_type.NORMAL)
+
+        lyt.assign_cell_type((12, 0), sidb_technology.cell_type.OUTPUT)
+        lyt.assign_cell_type((14, 0), sidb_technology.cell_type.OUTPUT)
+
+        lyt.assign_cell_type((18, 0), sidb_technology.cell_type.NORMAL)
+
+        params = distributed_operational_domain_params()
+        params.domain_params.operational_params.simulation_parameters.base = 2
+        params.domain_params.sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 1.0, 5.0, 1.0),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 1.0, 5.0, 1.0),
+        ]
+        params.algorithm = distributed_sweep_algorithm.GRID_SEARCH
+        params.batch_size = 4
+
+        reference = operational_domain_grid_search(lyt, [create_id_tt()], params.domain_params)
+
+        pool = local_operational_domain_worker_pool_100(lyt, [create_id_tt()], params.domain_params, 2)
+        self.assertEqual(pool.capacity(), 4)
+
+        stats = operational_domain_stats()
+        op_domain = operational_domain_distributed(lyt, [create_id_tt()], pool, params, stats)
+
+        self.assertEqual(stats.num_evaluated_parameter_combinations, 25)
+        self.assertEqual(len(op_domain), len(reference))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,4 +1,5 @@
 import os
+import threading
 import unittest
 
 from mnt.pyfiction import (
@@ -6,6 +7,7 @@ from mnt.pyfiction import (
     charge_distribution_surface_100,
     charge_distribution_surface_111,
     quickexact,
+    quickexact_batch,
     quickexact_params,
     read_sqd_layout_100,
     sidb_100_lattice,
@@ -133,6 +135,72 @@ class TestQuickExact(unittest.TestCase):
         and_gate.assign_cell_type((0, 0), sidb_technology.cell_type.INPUT)
         and_gate.assign_cell_type((26, 0), sidb_technology.cell_type.INPUT)
 
+    def test_batch(self):
+        layouts = []
+        for num_sidbs in range(1, 5):
+            layout = sidb_100_lattice((2 * num_sidbs, 1))
+            for i in range(num_sidbs):
+                layout.assign_cell_type((2 * i, 0), sidb_technology.cell_type.NORMAL)
+            layouts.append(layout)
+
+        params = quickexact_params()
+        params.simulation_parameters.base = 2
+        params.simulation_parameters.mu_minus = -0.25
+
+        results = quickexact_batch(layouts, params, num_threads=2)
+
+        self.assertEqual(len(results), len(layouts))
+
+        for layout, result in zip(layouts, results):
+            expected = quickexact(layout, params)
+            self.assertEqual(result.algorithm_name, "QuickExact")
+            self.assertEqual(len(result.charge_distributions), len(expected.charge_distributions))
+            self.assertEqual(
+                result.groundstates()[0].get_all_sidb_charges(), expected.groundstates()[0].get_all_sidb_charges()
+            )
+
+        # parameter sweep over a single layout
+        sweep = []
+        for mu_minus in (-0.1, -0.25, -0.32):
+            p = quickexact_params()
+            p.simulation_parameters.base = 2
+            p.simulation_parameters.mu_minus = mu_minus
+            sweep.append(p)
+
+        sweep_results = quickexact_batch(layouts[-1], sweep)
+
+        self.assertEqual(len(sweep_results), len(sweep))
+
+        for p, result in zip(sweep, sweep_results):
+            self.assertEqual(len(result.charge_distributions), len(quickexact(layouts[-1], p).charge_distributions))
+
+        self.assertEqual(quickexact_batch([], params), [])
+
+    def test_concurrent_calls(self):
+        and_gate = read_sqd_layout_100(dir_path + "/../../../resources/Bestagon_AND_mu_025_v0.sqd")
+
+        params = quickexact_params()
+        params.simulation_parameters.base = 2
+
+        expected = quickexact(and_gate, params)
+
+        # the GIL is released during simulation, so multiple Python threads simulate concurrently
+        results = [None] * 4
+
+        def simulate(index):
+            results[index] = quickexact(and_gate, params)
+
+        workers = [threading.Thread(target=simulate, args=(i,)) for i in range(len(results))]
+        for worker in workers:
+            worker.start()
+        for worker in workers:
+            worker.join()
+
+        for result in results:
+            self.assertEqual(len(result.charge_distributions), len(expected.charge_distributions))
+            self.assertEqual(
+                result.groundstates()[0].get_all_sidb_charges(), expected.groundstates()[0].get_all_sidb_charges()
+            )
 
 if __name__ == "__main__":
     unittest.main()
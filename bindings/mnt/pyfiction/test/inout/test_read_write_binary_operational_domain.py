@@ -0,0 +1,100 @@
+import os
+import tempfile
+import unittest
+
+from mnt.pyfiction import (
+    binary_operational_domain_kind,
+    critical_temperature_domain,
+    merge_binary_operational_domain,
+    operational_domain,
+    operational_domain_value_range,
+    operational_status,
+    parameter_point,
+    read_binary_critical_temperature_domain,
+    read_binary_operational_domain,
+    read_binary_operational_domain_header,
+    sweep_parameter,
+    write_binary_critical_temperature_domain,
+    write_binary_operational_domain,
+)
+
+
+class TestReadWriteBinaryOperationalDomain(unittest.TestCase):
+    def setUp(self):
+        self.tmp_dir = tempfile.TemporaryDirectory()
+        self.sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 1.0, 3.0, 0.5),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 4.0, 5.0, 1.0),
+        ]
+
+    def tearDown(self):
+        self.tmp_dir.cleanup()
+
+    def test_round_trip(self):
+        opdom = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+
+        opdom[parameter_point([1.5, 4.0])] = operational_status.OPERATIONAL
+        opdom[parameter_point([3.0, 5.0])] = operational_status.NON_OPERATIONAL
+
+        filename = os.path.join(self.tmp_dir.name, "opdom.bin")
+        write_binary_operational_domain(opdom, self.sweep_dimensions, filename)
+
+        header = read_binary_operational_domain_header(filename)
+
+        self.assertEqual(header.kind, binary_operational_domain_kind.OPERATIONAL_DOMAIN)
+        self.assertEqual(header.num_samples, 2)
+        self.assertEqual(len(header.sweep_dimensions), 2)
+        self.assertEqual(header.sweep_dimensions[0].step, 0.5)
+
+        read_opdom = read_binary_operational_domain(filename)
+
+        self.assertEqual(len(read_opdom), 2)
+        self.assertEqual(read_opdom[parameter_point([1.5, 4.0])], operational_status.OPERATIONAL)
+        self.assertEqual(read_opdom[parameter_point([3.0, 5.0])], operational_status.NON_OPERATIONAL)
+
+    def test_critical_temperature_round_trip(self):
+        ct_domain = critical_temperature_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+
+        ct_domain[parameter_point([2.0, 4.0])] = [operational_status.OPERATIONAL, 42.5]
+
+        filename = os.path.join(self.tmp_dir.name, "ct_domain.bin")
+        write_binary_critical_temperature_domain(ct_domain, self.sweep_dimensions, filename)
+
+        read_ct_domain = read_binary_critical_temperature_domain(filename)
+
+        self.assertEqual(read_ct_domain[parameter_point([2.0, 4.0])], (operational_status.OPERATIONAL, 42.5))
+
+    def test_merge_partial_sweeps(self):
+        first = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        first[parameter_point([1.0, 4.0])] = operational_status.OPERATIONAL
+
+        second = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        second[parameter_point([1.0, 4.0])] = operational_status.NON_OPERATIONAL
+        second[parameter_point([1.0, 5.0])] = operational_status.NON_OPERATIONAL
+
+        first_filename = os.path.join(self.tmp_dir.name, "first.bin")
+        second_filename = os.path.join(self.tmp_dir.name, "second.bin")
+
+        write_binary_operational_domain(first, self.sweep_dimensions, first_filename)
+        write_binary_operational_domain(second, self.sweep_dimensions, second_filename)
+
+        merged = operational_domain()
+        merge_binary_operational_domain(merged, first_filename)
+        merge_binary_operational_domain(merged, second_filename)
+
+        self.assertEqual(len(merged), 2)
+        self.assertEqual(merged.get_number_of_dimensions(), 2)
+        # samples that were already present take precedence
+        self.assertEqual(merged[parameter_point([1.0, 4.0])], operational_status.OPERATIONAL)
+        self.assertEqual(merged[parameter_point([1.0, 5.0])], operational_status.NON_OPERATIONAL)
+
+    def test_sample_off_the_grid(self):
+        opdom = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        opdom[parameter_point([1.25, 4.0])] = operational_status.OPERATIONAL
+
+        with self.assertRaises(ValueError):
+            write_binary_operational_domain(opdom, self.sweep_dimensions, os.path.join(self.tmp_dir.name, "x.bin"))
+
+
+if __name__ == "__main__":
+    unittest.main()
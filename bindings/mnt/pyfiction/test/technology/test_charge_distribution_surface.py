@@ -94,5 +94,38 @@ class TestChargeDistributionSurface(unittest.TestCase):
         self.assertEqual(charge_lyt.num_positive_sidbs(), 1)
 
 
+    def test_buffer_views(self):
+        layout = sidb_layout((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        charge_lyt = charge_distribution_surface(layout)
+
+        charges = memoryview(charge_lyt.get_charge_state_view())
+        internal = memoryview(charge_lyt.get_local_internal_potential_view())
+        external = memoryview(charge_lyt.get_local_external_potential_view())
+        potentials = memoryview(charge_lyt.get_chargeless_potential_matrix_view())
+
+        self.assertTrue(charges.readonly)
+        self.assertEqual(charges.tolist(), [-1, -1, -1])
+        self.assertEqual(internal.shape, (3,))
+        self.assertEqual(external.tolist(), [0.0, 0.0, 0.0])
+        self.assertEqual(potentials.shape, (3, 3))
+
+        for i in range(3):
+            self.assertAlmostEqual(internal[i], charge_lyt.get_local_internal_potential_by_index(i))
+            for j in range(3):
+                self.assertAlmostEqual(potentials[i, j], charge_lyt.get_chargeless_potential_by_indices(i, j))
+
+        # views reflect subsequent updates without being requested again
+        view = charge_lyt.get_charge_state_view()
+        charge_lyt.assign_charge_state_by_index(1, sidb_charge_state.NEUTRAL)
+        self.assertEqual(memoryview(view).tolist(), [-1, 0, -1])
+
+        # views keep their data alive
+        del charge_lyt
+        self.assertEqual(memoryview(view).tolist(), [-1, 0, -1])
+
 if __name__ == "__main__":
     unittest.main()
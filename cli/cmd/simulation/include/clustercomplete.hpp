@@ -45,6 +45,10 @@ class clustercomplete_command final : public command
      * ClusterComplete parameters.
      */
     fiction::clustercomplete_params<> cc_params{};
+    /**
+     * ClusterComplete statistics.
+     */
+    fiction::clustercomplete_stats cc_stats{};
     /**
      * Type alias for H-Si(100)-2x1 simulation result.
      */
@@ -122,7 +122,7 @@ void clustercomplete_command::execute()
                     fiction::clustercomplete_params<fiction::cell<Lyt>>::ground_state_space_reporting::ON :
                     fiction::clustercomplete_params<fiction::cell<Lyt>>::ground_state_space_reporting::OFF;
 
-            sim_result = fiction::clustercomplete(*lyt_ptr, cc_params);
+            sim_result = fiction::clustercomplete(*lyt_ptr, cc_params, &cc_stats);
 
             if constexpr (fiction::is_sidb_lattice_100_v<Lyt>)
             {
@@ -180,6 +180,8 @@ nlohmann::json clustercomplete_command::log() const
 
             return nlohmann::json{{"Algorithm name", sim_res.algorithm_name},
                                   {"Simulation runtime", sim_res.simulation_runtime.count()},
+                                  {"Ground State Space runtime", cc_stats.time_ground_state_space.count()},
+                                  {"Unfolding runtime", cc_stats.time_unfolding.count()},
                                   {"Physical parameters",
                                    {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
                                     {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
@@ -199,6 +201,8 @@ nlohmann::json clustercomplete_command::log() const
         return nlohmann::json{
             {"Algorithm name", sim_res.algorithm_name},
             {"Simulation runtime", sim_res.simulation_runtime.count()},
+            {"Ground State Space runtime", cc_stats.time_ground_state_space.count()},
+            {"Unfolding runtime", cc_stats.time_unfolding.count()},
             {"Physical parameters",
              {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
               {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
@@ -220,6 +224,7 @@ void clustercomplete_command::reset_params()
 {
     physical_params = fiction::sidb_simulation_parameters{3, -0.32, 5.6, 5.0};
     cc_params       = {};
+    cc_stats        = {};
     sim_result      = {};
 }
 
@@ -32,6 +32,7 @@ macro(fiction_setup_options)
   option(FICTION_ENABLE_PCH "Enable precompiled headers" OFF)
   option(FICTION_ENABLE_CACHE "Enable ccache" ON)
   option(FICTION_LIGHTWEIGHT_DEBUG_BUILDS "Reduce memory consumption of Debug builds" OFF)
+  option(FICTION_ENABLE_TRACING "Enable trace instrumentation of algorithms" OFF)
 
   if(NOT PROJECT_IS_TOP_LEVEL)
     mark_as_advanced(
@@ -46,7 +47,8 @@ macro(fiction_setup_options)
       FICTION_ENABLE_COVERAGE
       FICTION_ENABLE_PCH
       FICTION_ENABLE_CACHE
-      FICTION_LIGHTWEIGHT_DEBUG_BUILDS)
+      FICTION_LIGHTWEIGHT_DEBUG_BUILDS
+      FICTION_ENABLE_TRACING)
   endif()
 
 endmacro()
@@ -99,6 +101,10 @@ macro(fiction_local_options)
     endif()
   endif()
 
+  if(FICTION_ENABLE_TRACING)
+    target_compile_definitions(fiction_options INTERFACE FICTION_TRACING)
+  endif()
+
   # This applies a memory optimization for Debug builds which may be used to conform to memory limitations
   if (FICTION_LIGHTWEIGHT_DEBUG_BUILDS)
      if (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
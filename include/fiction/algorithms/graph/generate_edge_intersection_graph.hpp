@@ -9,15 +9,18 @@
 #include "fiction/algorithms/path_finding/k_shortest_paths.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/execution_utils.hpp"
 #include "fiction/utils/routing_utils.hpp"
-#include "fiction/utils/stl_utils.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 #include <phmap.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include <combinations.h>
@@ -95,24 +98,16 @@ class generate_edge_intersection_graph_impl
         // measure runtime
         mockturtle::stopwatch stop{pst.time_total};
 
-        std::for_each(objectives.cbegin(), objectives.cend(),
-                      [this](const auto& obj)
-                      {
-                          path_collection<clk_path> obj_paths{};
+        // enumerate the paths of all objectives in parallel since they are independent of each other
+        std::vector<path_collection<clk_path>> paths_per_objective(objectives.size());
 
-                          if (!ps.path_limit.has_value())
-                          {
-                              // enumerate all paths for the current objective
-                              obj_paths = enumerate_all_paths<clk_path>(obstruction_layout{layout},
-                                                                        {obj.source, obj.target}, {ps.crossings});
-                          }
-                          else
-                          {
-                              // enumerate k paths for the current objective
-                              obj_paths = yen_k_shortest_paths<clk_path>(
-                                  obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit, {ps.crossings});
-                          }
+        std::transform(FICTION_EXECUTION_POLICY_PAR objectives.cbegin(), objectives.cend(),
+                       paths_per_objective.begin(), [this](const auto& obj) { return enumerate_paths(obj); });
 
+        // the graph is constructed sequentially in the order of the objectives to obtain deterministic labels
+        std::for_each(paths_per_objective.begin(), paths_per_objective.end(),
+                      [this](auto& obj_paths)
+                      {
                           // assign a unique label to each path and create a corresponding node in the graph
                           initiate_objective_nodes(obj_paths);
 
@@ -130,8 +125,11 @@ class generate_edge_intersection_graph_impl
                           // for each previously stored path, create an edge if there is an intersection
                           create_intersection_edges(obj_paths);
 
-                          // add the collection to all paths gathered thus far
-                          all_paths.insert(all_paths.end(), obj_paths.cbegin(), obj_paths.cend());
+                          // make the paths of this objective available to the intersection queries of later ones
+                          index_paths(obj_paths);
+
+                          // release the memory of the paths as they are stored in the graph already
+                          obj_paths = {};
                       });
 
         // store size of the generated graph
@@ -167,71 +165,11 @@ class generate_edge_intersection_graph_impl
      */
     std::size_t node_id{0}, edge_id{0};
     /**
-     * Extends the layout_coordinate_path to additionally to the vector representation of the path also hold a set that
-     * allows fast lookup needed to find intersections (O(log n)). Additionally, a label is assigned to each path to
-     * identify it in the edge intersection graph.
+     * Extends the layout_coordinate_path by a label to identify it in the edge intersection graph.
      */
-    class labeled_layout_coordinate_lookup_path : public layout_coordinate_path<Lyt>
+    class labeled_layout_coordinate_path : public layout_coordinate_path<Lyt>
     {
       public:
-        /**
-         * Overwrites the append function to additionally store the given coordinate in a set.
-         *
-         * @param c Coordinate to append to the path.
-         */
-        void append(const coordinate<Lyt>& c) noexcept
-        {
-            path_elements.insert(c);
-            layout_coordinate_path<Lyt>::append(c);
-        }
-        /**
-         * Given another path, this function checks if they are not disjoint, i.e., it looks for at least one coordinate
-         * that both paths share.
-         *
-         * If, at some point, the set approach is not to be used anymore, std::find_first_of offers the same
-         * functionality on any kind of range.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are not disjoint, i.e., share at least one coordinate.
-         */
-        template <typename Path>
-        bool has_intersection_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the remaining coordinates occur in the stored path
-            return std::any_of(std::cbegin(other) + 1, std::cend(other) - 1,
-                               [this](const auto& c) { return path_elements.count(c) > 0; });
-        }
-        /**
-         * Like has_intersection_with but allows paths to share crossings, i.e., single-tile intersections.
-         *
-         * Similar to has_intersection_with, this function also returns `true` if source and target are matching in both
-         * paths.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are overlapping, i.e., share at least one coordinate segment
-         * of size 2.
-         */
-        template <typename Path>
-        bool has_overlap_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the coordinates (including I/Os) form a shared segment in the stored path
-            return find_first_two_of(std::cbegin(other), std::cend(other), std::cbegin(*this), std::cend(*this)) !=
-                   std::cend(other);
-        }
         /**
          * Label to identify the path in the edge intersection graph.
          */
@@ -243,24 +181,61 @@ class generate_edge_intersection_graph_impl
       public:
         // make all inherited constructors available
         using base::base;
-
-      private:
+    };
+    /**
+     * Alias for the path type.
+     */
+    using clk_path = labeled_layout_coordinate_path;
+    /**
+     * An entry in the inverted tile index that states that the path with the given label passes through a coordinate
+     * and continues at `successor` from there.
+     */
+    struct tile_occupant
+    {
+        /**
+         * Label of the occupying path.
+         */
+        std::size_t label;
         /**
-         * Uniquely identify path elements in a set to make them searchable in O(1).
+         * The coordinate that follows the indexed one in the occupying path.
          */
-        phmap::flat_hash_set<coordinate<Lyt>> path_elements{};
+        coordinate<Lyt> successor;
     };
     /**
-     * Alias for the path type.
+     * Inverted index that maps each coordinate to all previously enumerated paths that occupy it. Only coordinates
+     * that can lead to an intersection are indexed: without crossings, these are all but the source and target of a
+     * path. With crossings, these are all coordinates with a successor, which is stored alongside to look up shared
+     * segments of size 2. Paths are stored in ascending order of their labels.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, std::vector<tile_occupant>> tile_index{};
+    /**
+     * Maps the source of each previously enumerated path to its target and label. Paths with identical source and
+     * target always intersect. Paths are stored in ascending order of their labels.
      */
-    using clk_path = labeled_layout_coordinate_lookup_path;
+    phmap::flat_hash_map<coordinate<Lyt>, std::vector<std::pair<coordinate<Lyt>, std::size_t>>> terminal_index{};
     /**
-     * Stores a collection of all annotated paths (labeled_layout_coordinate_lookup_path objects) computed thus far to
-     * find intersections with new ones. The edge intersection graph stores plain paths without the extra set and label.
-     * Therefore, after the generate_edge_intersection_graph function terminates, the extra memory overhead is being
-     * released again.
+     * For each node, stores the label of the last path that was connected to it plus one. This deduplicates the
+     * intersection candidates found via multiple coordinates without clearing a set for each query.
      */
-    path_collection<clk_path> all_paths{};
+    std::vector<std::size_t> last_connected_to{};
+    /**
+     * Enumerates all paths that satisfy the given objective or, if a path limit is set, only the shortest ones.
+     *
+     * @param obj Routing objective to enumerate paths for.
+     * @return Collection of paths satisfying `obj`.
+     */
+    [[nodiscard]] path_collection<clk_path> enumerate_paths(const routing_objective<Lyt>& obj) const
+    {
+        if (!ps.path_limit.has_value())
+        {
+            // enumerate all paths for the current objective
+            return enumerate_all_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target}, {ps.crossings});
+        }
+
+        // enumerate k paths for the current objective
+        return yen_k_shortest_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit,
+                                              {ps.crossings});
+    }
     /**
      * Given a collection of paths belonging to the same objective, this function assigns them unique labels and
      * generates corresponding nodes in the edge intersection graph.
@@ -286,6 +261,8 @@ class generate_edge_intersection_graph_impl
         {
             pst.cliques.push_back(clique);
         }
+
+        last_connected_to.resize(node_id, 0);
     }
     /**
      * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
@@ -306,25 +283,109 @@ class generate_edge_intersection_graph_impl
     /**
      * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
      * graph between each corresponding node and all of the already existing nodes that represent paths that intersect
-     * with it, i.e., that share at least one coordinate.
+     * with it, i.e., that share at least one coordinate. If crossings are allowed, paths only intersect if they share
+     * a segment of two consecutive coordinates.
+     *
+     * Instead of comparing against each previously enumerated path, the intersecting paths are looked up in the
+     * inverted tile index. Thereby, the effort only depends on the number of paths that actually occupy the same
+     * coordinates.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
      */
-    void create_intersection_edges(path_collection<clk_path>& objective_paths) noexcept
+    void create_intersection_edges(const path_collection<clk_path>& objective_paths) noexcept
     {
-        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
-                      [this](const auto& obj_p)
-                      {
-                          std::for_each(all_paths.cbegin(), all_paths.cend(),
-                                        [this, &obj_p](const auto& stored_p)
-                                        {
-                                            if (ps.crossings ? obj_p.has_overlap_with(stored_p) :
-                                                               obj_p.has_intersection_with(stored_p))
-                                            {
-                                                graph.insert_edge(obj_p.label, stored_p.label, edge_id++);
-                                            }
-                                        });
-                      });
+        std::vector<std::size_t> intersecting{};
+
+        for (const auto& obj_p : objective_paths)
+        {
+            intersecting.clear();
+
+            const auto add_candidate = [this, &obj_p, &intersecting](const std::size_t label) noexcept
+            {
+                if (last_connected_to[label] != obj_p.label + 1)
+                {
+                    last_connected_to[label] = obj_p.label + 1;
+                    intersecting.push_back(label);
+                }
+            };
+
+            // paths with identical source and target intersect by definition
+            if (const auto it = terminal_index.find(obj_p.source()); it != terminal_index.cend())
+            {
+                for (const auto& [target, label] : it->second)
+                {
+                    if (target == obj_p.target())
+                    {
+                        add_candidate(label);
+                    }
+                }
+            }
+
+            for (auto c = std::cbegin(obj_p); c != std::cend(obj_p); ++c)
+            {
+                const auto it = tile_index.find(*c);
+
+                if (it == tile_index.cend())
+                {
+                    continue;
+                }
+
+                if (!ps.crossings)
+                {
+                    // any shared coordinate is an intersection
+                    for (const auto& occupant : it->second)
+                    {
+                        add_candidate(occupant.label);
+                    }
+                }
+                else if (std::next(c) != std::cend(obj_p))
+                {
+                    // only shared segments of size 2 are intersections
+                    for (const auto& occupant : it->second)
+                    {
+                        if (occupant.successor == *std::next(c))
+                        {
+                            add_candidate(occupant.label);
+                        }
+                    }
+                }
+            }
+
+            // create edges in ascending order of the stored paths' labels
+            std::sort(intersecting.begin(), intersecting.end());
+
+            for (const auto label : intersecting)
+            {
+                graph.insert_edge(obj_p.label, label, edge_id++);
+            }
+        }
+    }
+    /**
+     * Adds a collection of paths belonging to the same objective to the inverted tile index such that paths of
+     * subsequent objectives can find their intersections with them.
+     *
+     * @param objective_paths Collection of paths belonging to the same objective.
+     */
+    void index_paths(const path_collection<clk_path>& objective_paths)
+    {
+        for (const auto& p : objective_paths)
+        {
+            if (p.empty())
+            {
+                continue;
+            }
+
+            terminal_index[p.source()].emplace_back(p.target(), p.label);
+
+            // without crossings, source and target of stored paths do not count towards intersections
+            auto       first = ps.crossings ? std::cbegin(p) : std::next(std::cbegin(p));
+            const auto last  = std::prev(std::cend(p));
+
+            for (; first < last; ++first)
+            {
+                tile_index[*first].push_back({p.label, *std::next(first)});
+            }
+        }
     }
 };
 
@@ -9,14 +9,23 @@
 #include "fiction/technology/technology_mapping_library.hpp"
 #include "fiction/types.hpp"
 #include "fiction/utils/name_utils.hpp"
+#include "fiction/utils/phmap_utils.hpp"
 
 #include <lorina/genlib.hpp>
 #include <mockturtle/algorithms/mapper.hpp>
 #include <mockturtle/io/genlib_reader.hpp>
 #include <mockturtle/utils/tech_library.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <exception>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -33,6 +42,10 @@ struct technology_mapping_params
      * Enforce the application of at least one constant input to three-input gates.
      */
     bool decay{false};
+    /**
+     * Number of threads to use when mapping multiple networks via `parallel_technology_mapping`.
+     */
+    std::size_t num_threads{std::thread::hardware_concurrency()};
 
     // 1-input functions
 
@@ -284,6 +297,152 @@ struct technology_mapping_params
 
     return params;
 }
+/**
+ * Assembles the genlib description of the technology library that is specified by the given parameters. The returned
+ * string is a valid genlib file that can be stored to disk and parsed by any genlib reader. It furthermore uniquely
+ * identifies the gate selection and is therefore used as a key to cache constructed technology libraries.
+ *
+ * @param params Technology mapping parameters.
+ * @return Genlib description of the selected gates.
+ */
+[[nodiscard]] inline std::string technology_mapping_genlib(const technology_mapping_params& params)
+{
+    // gather library description
+    std::stringstream library_stream{};
+
+    library_stream << fiction::GATE_ZERO << fiction::GATE_ONE << fiction::GATE_BUF;
+
+    // 1-input functions
+    if (params.inv)
+    {
+        library_stream << fiction::GATE_INV;
+    }
+    // 2-input functions
+    if (params.and2)
+    {
+        library_stream << fiction::GATE_AND2;
+    }
+    if (params.nand2)
+    {
+        library_stream << fiction::GATE_NAND2;
+    }
+    if (params.or2)
+    {
+        library_stream << fiction::GATE_OR2;
+    }
+    if (params.nor2)
+    {
+        library_stream << fiction::GATE_NOR2;
+    }
+    if (params.xor2)
+    {
+        library_stream << fiction::GATE_XOR2;
+    }
+    if (params.xnor2)
+    {
+        library_stream << fiction::GATE_XNOR2;
+    }
+    if (params.lt2)
+    {
+        library_stream << fiction::GATE_LT2;
+    }
+    if (params.gt2)
+    {
+        library_stream << fiction::GATE_GT2;
+    }
+    if (params.le2)
+    {
+        library_stream << fiction::GATE_LE2;
+    }
+    if (params.ge2)
+    {
+        library_stream << fiction::GATE_GE2;
+    }
+    // 3-input functions
+    if (params.maj3)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_MAJ3;
+        }
+
+        library_stream << fiction::DECAY_MAJ3;
+    }
+    if (params.dot)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_DOT;
+        }
+
+        library_stream << fiction::DECAY_DOT;
+    }
+    if (params.and3)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_AND3;
+        }
+
+        library_stream << fiction::DECAY_AND3;
+    }
+    if (params.xor_and)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_XOR_AND;
+        }
+
+        library_stream << fiction::DECAY_XOR_AND;
+    }
+    if (params.or_and)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_OR_AND;
+        }
+
+        library_stream << fiction::DECAY_OR_AND;
+    }
+    if (params.onehot)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_ONEHOT;
+        }
+
+        library_stream << fiction::DECAY_ONEHOT;
+    }
+    if (params.gamble)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_GAMBLE;
+        }
+
+        library_stream << fiction::DECAY_GAMBLE;
+    }
+    if (params.mux)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_MUX;
+        }
+
+        library_stream << fiction::DECAY_MUX;
+    }
+    if (params.and_xor)
+    {
+        if (!params.decay)
+        {
+            library_stream << fiction::GATE_AND_XOR;
+        }
+
+        library_stream << fiction::DECAY_AND_XOR;
+    }
+
+    return library_stream.str();
+}
 /**
  * Statistics for technology mapping.
  */
@@ -305,6 +464,68 @@ struct technology_mapping_stats
 namespace detail
 {
 
+/**
+ * A technology library for mockturtle's mapper together with the gates it was constructed from.
+ *
+ * @tparam NumInp Maximum input number of the gates in the technology library.
+ */
+template <unsigned NumInp>
+struct cached_technology_library
+{
+    /**
+     * Standard constructor.
+     *
+     * @param g Gates of the technology library.
+     */
+    explicit cached_technology_library(std::vector<mockturtle::gate>&& g) : gates{std::move(g)}, library{gates} {}
+    /**
+     * Gates parsed from the genlib description.
+     */
+    const std::vector<mockturtle::gate> gates;
+    /**
+     * Technology library constructed from the gates.
+     */
+    const mockturtle::tech_library<NumInp> library;
+};
+/**
+ * Returns the technology library described by the given genlib string. The construction of a
+ * `mockturtle::tech_library` enumerates all supergates and their NP-configurations, which is costly compared to the
+ * mapping of small networks. Therefore, each library is only constructed once per process and gate selection and
+ * subsequently shared between all calls to `technology_mapping`. This function is thread-safe.
+ *
+ * @tparam NumInp Maximum input number of the gates in the technology library.
+ * @param genlib Genlib description of the technology library.
+ * @return Shared pointer to the (possibly cached) technology library.
+ */
+template <unsigned NumInp>
+[[nodiscard]] std::shared_ptr<const cached_technology_library<NumInp>>
+technology_library_from_cache(const std::string& genlib)
+{
+    static locked_parallel_flat_hash_map<std::string, std::shared_ptr<const cached_technology_library<NumInp>>>
+        library_cache{};
+
+    std::shared_ptr<const cached_technology_library<NumInp>> lib{};
+
+    library_cache.lazy_emplace_l(
+        genlib, [&lib](const auto& entry) { lib = entry.second; },
+        [&lib, &genlib](const auto& ctor)
+        {
+            std::vector<mockturtle::gate> gates{};
+
+            std::istringstream library_stream{genlib};
+
+            [[maybe_unused]] const auto result =
+                lorina::read_genlib(library_stream, mockturtle::genlib_reader{gates});
+            assert(result == lorina::return_code::success && "Could not parse technology library.");
+
+            lib = std::make_shared<const cached_technology_library<NumInp>>(std::move(gates));
+
+            ctor(genlib, lib);
+        });
+
+    return lib;
+}
+
 template <typename Ntk>
 class technology_mapping_impl
 {
@@ -317,7 +538,7 @@ class technology_mapping_impl
 
     tec_nt run()
     {
-        const auto gate_library = set_up_gates();
+        const auto gate_library = technology_mapping_genlib(params);
 
         tec_nt mapped_ntk{};
 
@@ -352,168 +573,19 @@ class technology_mapping_impl
      */
     technology_mapping_stats& stats;
 
-    /**
-     * Create a mockturtle gate library from the given parameters.
-     *
-     * @return A vector of mockturtle gates.
-     */
-    [[nodiscard]] std::vector<mockturtle::gate> set_up_gates() const
-    {
-        // gather library description
-        std::stringstream library_stream{};
-
-        library_stream << fiction::GATE_ZERO << fiction::GATE_ONE << fiction::GATE_BUF;
-
-        // 1-input functions
-        if (params.inv)
-        {
-            library_stream << fiction::GATE_INV;
-        }
-        // 2-input functions
-        if (params.and2)
-        {
-            library_stream << fiction::GATE_AND2;
-        }
-        if (params.nand2)
-        {
-            library_stream << fiction::GATE_NAND2;
-        }
-        if (params.or2)
-        {
-            library_stream << fiction::GATE_OR2;
-        }
-        if (params.nor2)
-        {
-            library_stream << fiction::GATE_NOR2;
-        }
-        if (params.xor2)
-        {
-            library_stream << fiction::GATE_XOR2;
-        }
-        if (params.xnor2)
-        {
-            library_stream << fiction::GATE_XNOR2;
-        }
-        if (params.lt2)
-        {
-            library_stream << fiction::GATE_LT2;
-        }
-        if (params.gt2)
-        {
-            library_stream << fiction::GATE_GT2;
-        }
-        if (params.le2)
-        {
-            library_stream << fiction::GATE_LE2;
-        }
-        if (params.ge2)
-        {
-            library_stream << fiction::GATE_GE2;
-        }
-        // 3-input functions
-        if (params.maj3)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_MAJ3;
-            }
-
-            library_stream << fiction::DECAY_MAJ3;
-        }
-        if (params.dot)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_DOT;
-            }
-
-            library_stream << fiction::DECAY_DOT;
-        }
-        if (params.and3)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_AND3;
-            }
-
-            library_stream << fiction::DECAY_AND3;
-        }
-        if (params.xor_and)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_XOR_AND;
-            }
-
-            library_stream << fiction::DECAY_XOR_AND;
-        }
-        if (params.or_and)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_OR_AND;
-            }
-
-            library_stream << fiction::DECAY_OR_AND;
-        }
-        if (params.onehot)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_ONEHOT;
-            }
-
-            library_stream << fiction::DECAY_ONEHOT;
-        }
-        if (params.gamble)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_GAMBLE;
-            }
-
-            library_stream << fiction::DECAY_GAMBLE;
-        }
-        if (params.mux)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_MUX;
-            }
-
-            library_stream << fiction::DECAY_MUX;
-        }
-        if (params.and_xor)
-        {
-            if (!params.decay)
-            {
-                library_stream << fiction::GATE_AND_XOR;
-            }
-
-            library_stream << fiction::DECAY_AND_XOR;
-        }
-
-        // generate technology library
-        std::vector<mockturtle::gate> gates{};
-
-        [[maybe_unused]] const auto result = lorina::read_genlib(library_stream, mockturtle::genlib_reader{gates});
-        assert(result == lorina::return_code::success && "Could not parse technology library.");
-
-        return gates;
-    }
     /**
      * Perform technology mapping with the given number of inputs.
      *
      * @tparam NumInp Maximum input number of the gates in the technology library.
-     * @param gates Technology library.
+     * @param genlib Genlib description of the technology library.
      * @return Mapped network.
      */
     template <unsigned NumInp>
-    [[nodiscard]] tec_nt perform_mapping(const std::vector<mockturtle::gate>& gates) const noexcept
+    [[nodiscard]] tec_nt perform_mapping(const std::string& genlib) const
     {
-        mockturtle::tech_library<NumInp> lib{gates};
+        const auto lib = technology_library_from_cache<NumInp>(genlib);
 
-        const auto mapped_ntk = mockturtle::map(ntk, lib, params.mapper_params, &stats.mapper_stats);
+        const auto mapped_ntk = mockturtle::map(ntk, lib->library, params.mapper_params, &stats.mapper_stats);
 
         tec_nt converted_ntk{};
 
@@ -559,6 +631,99 @@ template <typename Ntk>
 
     return result;
 }
+/**
+ * Performs technology mapping on all given networks in parallel. Each network is mapped exactly as by
+ * `technology_mapping`, i.e., the results are identical to calling `technology_mapping` on each network individually.
+ * The networks are distributed dynamically among `params.num_threads` worker threads, which all share the same cached
+ * technology library such that it is constructed at most once.
+ *
+ * This function is intended for flows that map entire benchmark suites at once. Partitioning a single network would
+ * duplicate logic that is shared between partitions and thereby alter the mapping result, which is why the unit of
+ * parallelism is the network.
+ *
+ * @note Since copies of mockturtle networks share their storage, the networks in `ntks` must not be copies of each
+ * other.
+ *
+ * If mapping any network throws, no further networks are scheduled and the exception is rethrown after all threads
+ * have finished.
+ *
+ * @tparam Ntk Input logic network type.
+ * @param ntks Input logic networks.
+ * @param params Technology mapping parameters.
+ * @param pst Technology mapping statistics for each network in the order of `ntks`.
+ * @return Mapped networks in the order of `ntks`.
+ */
+template <typename Ntk>
+[[nodiscard]] std::vector<tec_nt> parallel_technology_mapping(const std::vector<Ntk>&          ntks,
+                                                              const technology_mapping_params& params = {},
+                                                              std::vector<technology_mapping_stats>* pst = nullptr)
+{
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+
+    std::vector<tec_nt>                   results(ntks.size());
+    std::vector<technology_mapping_stats> stats(ntks.size());
+
+    std::atomic<std::size_t> next_ntk{0};
+    std::atomic<bool>        failed{false};
+
+    const auto num_threads = std::min(std::max(params.num_threads, std::size_t{1}), ntks.size());
+
+    // exceptions must not escape the thread functions; they are rethrown after all threads have finished
+    std::vector<std::exception_ptr> worker_exceptions(std::max(num_threads, std::size_t{1}));
+
+    const auto worker = [&ntks, &params, &results, &stats, &next_ntk, &failed, &worker_exceptions](const std::size_t w)
+    {
+        try
+        {
+            for (auto i = next_ntk++; i < ntks.size() && !failed; i = next_ntk++)
+            {
+                detail::technology_mapping_impl p{ntks[i], params, stats[i]};
+
+                results[i] = p.run();
+            }
+        }
+        catch (...)
+        {
+            worker_exceptions[w] = std::current_exception();
+            failed               = true;
+        }
+    };
+
+    if (num_threads <= 1)
+    {
+        worker(0);
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back(worker, i);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    for (const auto& e : worker_exceptions)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    if (pst)
+    {
+        *pst = std::move(stats);
+    }
+
+    return results;
+}
 
 }  // namespace fiction
 
@@ -10,6 +10,7 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <phmap.h>
 
@@ -66,6 +67,8 @@ class a_star_impl
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
+        FICTION_TRACE_ZONE("a_star");
+
         do
         {
             // get coordinate with lowest f-value
@@ -74,6 +77,8 @@ class a_star_impl
             // if coord is the target, a path has been found
             if (current == objective.target)
             {
+                FICTION_TRACE_COUNTER("a_star::num_expanded_coordinates", closed_list.size());
+
                 return reconstruct_path();
             }
             // don't examine the current coordinate again
@@ -84,6 +89,8 @@ class a_star_impl
 
         } while (!open_list.empty());  // until the open list is empty
 
+        FICTION_TRACE_COUNTER("a_star::num_expanded_coordinates", closed_list.size());
+
         return {};  // open list is empty, no path has been found
     }
 
@@ -13,14 +13,22 @@
 
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
-
-#include <cstdint>
 #endif
 #include <mockturtle/traits.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // data types cannot properly be converted to bit field types
 #pragma GCC diagnostic push
@@ -33,6 +41,19 @@
 namespace fiction
 {
 
+/**
+ * Parameters for the application of static gate libraries.
+ */
+struct apply_gate_library_params
+{
+    /**
+     * Number of threads to use for setting up the gate implementations. Each thread collects the cells of its share of
+     * tiles in a local buffer and all buffers are assigned to the cell-level layout in bulk afterward. The result is
+     * identical to the single-threaded application. For small layouts, fewer threads are used.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+};
+
 namespace detail
 {
 
@@ -40,17 +61,25 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
 class apply_gate_library_impl
 {
   public:
-    explicit apply_gate_library_impl(const GateLyt& lyt) :
-            gate_lyt{lyt},
-            cell_lyt{determine_aspect_ratio_for_cell_level_layout(gate_lyt)}
+    explicit apply_gate_library_impl(const GateLyt& lyt) : gate_lyt{lyt}, cell_lyt{create_cell_layout(gate_lyt)} {}
+    /**
+     * Creates an empty cell-level layout whose dimensions, tile sizes, and clocking scheme are derived from the given
+     * gate-level layout.
+     *
+     * @param gate_lyt Gate-level layout to derive the cell-level layout from.
+     * @return An empty cell-level layout that can hold `gate_lyt`'s gate implementations.
+     */
+    [[nodiscard]] static CellLyt create_cell_layout(const GateLyt& gate_lyt)
     {
-        cell_lyt.set_tile_size_x(GateLibrary::gate_x_size());
-        cell_lyt.set_tile_size_y(GateLibrary::gate_y_size());
+        CellLyt lyt{determine_aspect_ratio_for_cell_level_layout(gate_lyt)};
+
+        lyt.set_tile_size_x(GateLibrary::gate_x_size());
+        lyt.set_tile_size_y(GateLibrary::gate_y_size());
 
         // if GateLyt and CellLyt are based on the same coordinate type, copy the clocking scheme over
         if constexpr (std::is_same_v<coordinate<CellLyt>, coordinate<GateLyt>>)
         {
-            cell_lyt.replace_clocking_scheme(gate_lyt.get_clocking_scheme());
+            lyt.replace_clocking_scheme(gate_lyt.get_clocking_scheme());
         }
         // otherwise, try to find a matching clocking scheme (this will discard overwritten clock numbers)
         else
@@ -58,9 +87,11 @@ class apply_gate_library_impl
             if (const auto clk_scheme = get_clocking_scheme<CellLyt>(gate_lyt.get_clocking_scheme().name);
                 clk_scheme.has_value())
             {
-                cell_lyt.replace_clocking_scheme(clk_scheme.value());
+                lyt.replace_clocking_scheme(clk_scheme.value());
             }
         }
+
+        return lyt;
     }
 
     /**
@@ -68,38 +99,113 @@ class apply_gate_library_impl
      *
      * This function performs the cell layout generation process based on the gate library and the gate-level layout
      * information provided by `GateLibrary` and `gate_lyt`. It iterates through the nodes in the gate-level layout and
-     * maps gates to cell implementations based on their corresponding positions and types. Optionally, it performs
+     * maps gates to cell implementations based on their corresponding positions and types. The gate implementations are
+     * set up in parallel if the parameters allow for it and the layout is large enough. Optionally, it performs
      * post-layout optimization and sets the layout name if certain conditions are met.
      *
+     * @param ps Parameters.
      * @param defect_lyt Optional defect surface.
      * @return A `CellLyt` object representing the generated cell layout.
      */
-    [[nodiscard]] CellLyt run_static_gate_library(const std::optional<CellLyt>& defect_surface = std::nullopt)
+    [[nodiscard]] CellLyt run_static_gate_library(const apply_gate_library_params& ps,
+                                                  const std::optional<CellLyt>&    defect_surface = std::nullopt)
     {
-#if (PROGRESS_BARS)
-        // initialize a progress bar
-        mockturtle::progress_bar bar{static_cast<uint32_t>(gate_lyt.size()), "[i] applying gate library: |{0}|"};
-#endif
+        std::vector<mockturtle::node<GateLyt>> nodes{};
+        nodes.reserve(gate_lyt.size());
 
         gate_lyt.foreach_node(
-            [&, this](const auto& n, [[maybe_unused]] auto i)
+            [this, &nodes](const auto& n)
             {
                 if (!gate_lyt.is_constant(n))
                 {
-                    const auto t = gate_lyt.get_tile(n);
+                    nodes.push_back(n);
+                }
+            });
 
-                    // retrieve the top-leftmost cell in tile t
-                    const auto c =
-                        relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
-                                                           GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+        const auto num_threads =
+            std::max(std::min(ps.num_threads, nodes.size() / MIN_NODES_PER_THREAD), std::size_t{1});
+
+        std::vector<gate_cells>         thread_cells(num_threads);
+        std::vector<std::exception_ptr> thread_exceptions(num_threads);
+
+        const auto chunk_size = (nodes.size() + num_threads - 1) / num_threads;  // ceiling division
 
-                    assign_gate(c, GateLibrary::set_up_gate(gate_lyt, t), n);
-                }
 #if (PROGRESS_BARS)
+        // initialize a progress bar
+        mockturtle::progress_bar bar{static_cast<uint32_t>(nodes.size()), "[i] applying gate library: |{0}|"};
+
+        // number of nodes whose gate implementations have been set up on any thread
+        std::atomic<std::size_t> num_set_up_nodes{0};
+#endif
+
+        // invoked on the thread that handles chunk i after each gate implementation has been set up
+        const auto on_gate_set_up = [&]([[maybe_unused]] const std::size_t i)
+        {
+#if (PROGRESS_BARS)
+            const auto num_done = num_set_up_nodes.fetch_add(1, std::memory_order_relaxed) + 1;
+
+            // the progress bar is only updated by the calling thread, which handles chunk 0
+            if (i == 0)
+            {
                 // update progress
-                bar(i);
+                bar(static_cast<uint32_t>(num_done));
+            }
 #endif
-            });
+        };
+
+        const auto collect_range =
+            [this, &nodes, &thread_cells, &thread_exceptions, &on_gate_set_up, chunk_size](const std::size_t i)
+        {
+            const auto begin = std::min(i * chunk_size, nodes.size());
+            const auto end   = std::min(begin + chunk_size, nodes.size());
+
+            try
+            {
+                thread_cells[i] = collect_gates(nodes.cbegin() + static_cast<std::ptrdiff_t>(begin),
+                                                nodes.cbegin() + static_cast<std::ptrdiff_t>(end),
+                                                [&on_gate_set_up, i] { on_gate_set_up(i); });
+            }
+            catch (...)
+            {
+                thread_exceptions[i] = std::current_exception();
+            }
+        };
+
+        // the calling thread handles the first chunk itself
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads - 1);
+
+        for (std::size_t i = 1; i < num_threads; ++i)
+        {
+            threads.emplace_back(collect_range, i);
+        }
+
+        collect_range(0);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // rethrow the first exception in node order, if any
+        for (const auto& e : thread_exceptions)
+        {
+            if (e)
+            {
+                std::rethrow_exception(e);
+            }
+        }
+
+        // merge the buffers in chunk order to obtain the same layout as in a sequential run
+        for (const auto& gc : thread_cells)
+        {
+            cell_lyt.assign_cell_types(gc.types);
+
+            for (const auto& [c, name] : gc.names)
+            {
+                cell_lyt.assign_cell_name(c, name);
+            }
+        }
 
         // perform post-layout optimization if necessary
         if constexpr (has_post_layout_optimization_v<GateLibrary, CellLyt>)
@@ -172,7 +278,7 @@ class apply_gate_library_impl
                     assign_gate(c,
                                 GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(gate_lyt, t, params,
                                                                                             defect_surface),
-                                n);
+                                n, cell_lyt);
                 }
 #if (PROGRESS_BARS)
                 // update progress
@@ -202,6 +308,76 @@ class apply_gate_library_impl
         return cell_lyt;
     }
 
+    /**
+     * Sets up the gate implementations of the static gate library tile row by tile row instead of all at once. For each
+     * tile row `y` in ascending order, the cell-level layout contains exactly the gate implementations of the tile rows
+     * `y - context_rows` to `y + context_rows` when `fn` is invoked. If the gate library defines a post-layout
+     * optimization, it is applied to these cells beforehand. Afterward, all cells are removed again. Thereby, at most
+     * `2 * context_rows + 1` tile rows of cells are held in memory at any time, which allows for exporting cell-level
+     * layouts that would not fit into memory as a whole. The gate implementations of each tile row are set up only once
+     * and reused while the row serves as context.
+     *
+     * Post-layout optimizations are assumed to only depend on cells in adjacent tile rows. Cells of the context rows
+     * are only provided to this end and should not be processed by `fn`.
+     *
+     * @tparam Fn Functor type that can be invoked as `fn(const CellLyt&, uint64_t)`.
+     * @param context_rows Number of adjacent tile rows on either side whose gate implementations are set up as well.
+     * @param fn Functor that receives the partial cell-level layout and the current tile row.
+     */
+    template <typename Fn>
+    void foreach_tile_row(const uint64_t context_rows, Fn&& fn)
+    {
+        std::vector<std::vector<mockturtle::node<GateLyt>>> rows(static_cast<std::size_t>(gate_lyt.y()) + 1);
+
+        gate_lyt.foreach_node(
+            [this, &rows](const auto& n)
+            {
+                if (!gate_lyt.is_constant(n))
+                {
+                    rows[static_cast<std::size_t>(gate_lyt.get_tile(n).y)].push_back(n);
+                }
+            });
+
+        // cells of the tile rows that are currently in context; the first one belongs to tile row next_row - size
+        std::deque<gate_cells> window{};
+        uint64_t               next_row = 0;
+
+        for (uint64_t y = 0; y < rows.size(); ++y)
+        {
+            const auto first_row = y < context_rows ? 0 : y - context_rows;
+            const auto last_row  = std::min(y + context_rows, static_cast<uint64_t>(rows.size() - 1));
+
+            // drop the tile rows that left the context and set up the ones that entered it
+            while (next_row - window.size() < first_row)
+            {
+                window.pop_front();
+            }
+            for (; next_row <= last_row; ++next_row)
+            {
+                window.push_back(collect_gates(rows[next_row].cbegin(), rows[next_row].cend(), [] {}));
+            }
+
+            for (const auto& gc : window)
+            {
+                cell_lyt.assign_cell_types(gc.types);
+
+                for (const auto& [c, name] : gc.names)
+                {
+                    cell_lyt.assign_cell_name(c, name);
+                }
+            }
+
+            if constexpr (has_post_layout_optimization_v<GateLibrary, CellLyt>)
+            {
+                GateLibrary::post_layout_optimization(cell_lyt);
+            }
+
+            std::invoke(fn, std::as_const(cell_lyt), y);
+
+            clear_cells();
+        }
+    }
+
   private:
     /**
      * Gate-level layout.
@@ -212,14 +388,106 @@ class apply_gate_library_impl
      */
     CellLyt cell_lyt;
     /**
-     * This function assigns a given FCN gate implementation to the total cell layout.
+     * Cells of gate implementations that are yet to be assigned to the cell-level layout.
+     */
+    struct gate_cells
+    {
+        /**
+         * Non-empty cells and their types.
+         */
+        std::vector<std::pair<cell<CellLyt>, typename technology<CellLyt>::cell_type>> types{};
+        /**
+         * I/O cells and their names.
+         */
+        std::vector<std::pair<cell<CellLyt>, std::string>> names{};
+        /**
+         * Collects the type of a non-empty cell. Enables `assign_gate` to target the buffer instead of a layout.
+         *
+         * @param c Cell position.
+         * @param type Cell type.
+         */
+        void assign_cell_type(const cell<CellLyt>& c, const typename technology<CellLyt>::cell_type& type)
+        {
+            types.emplace_back(c, type);
+        }
+        /**
+         * Collects the name of an I/O cell. Enables `assign_gate` to target the buffer instead of a layout.
+         *
+         * @param c Cell position.
+         * @param name Cell name.
+         */
+        void assign_cell_name(const cell<CellLyt>& c, const std::string& name)
+        {
+            names.emplace_back(c, name);
+        }
+    };
+    /**
+     * Minimum number of nodes that a thread has to set up to be worth spawning.
+     */
+    static constexpr const std::size_t MIN_NODES_PER_THREAD = 256ul;
+    /**
+     * Sets up the gate implementations of the given range of nodes and collects their cells without modifying the
+     * cell-level layout. This function is safe to be called concurrently on disjoint ranges.
+     *
+     * @tparam It Iterator type of the node range.
+     * @tparam Fn Functor type that can be invoked without arguments.
+     * @param first Begin of the node range.
+     * @param last End of the node range.
+     * @param on_gate_set_up Functor that is invoked after each gate implementation has been set up, e.g., to report
+     * progress.
+     * @return The cells of all gate implementations in the given range in node order.
+     */
+    template <typename It, typename Fn>
+    [[nodiscard]] gate_cells collect_gates(It first, It last, Fn&& on_gate_set_up) const
+    {
+        gate_cells gc{};
+        gc.types.reserve(static_cast<std::size_t>(std::distance(first, last)) * GateLibrary::gate_x_size() *
+                         GateLibrary::gate_y_size());
+
+        for (; first != last; ++first)
+        {
+            const auto n = *first;
+            const auto t = gate_lyt.get_tile(n);
+
+            // retrieve the top-leftmost cell in tile t
+            const auto c = relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
+                                                              GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+
+            assign_gate(c, GateLibrary::set_up_gate(gate_lyt, t), n, gc);
+
+            std::invoke(on_gate_set_up);
+        }
+
+        return gc;
+    }
+    /**
+     * Removes all cells including their modes and names from the cell-level layout.
+     */
+    void clear_cells() noexcept
+    {
+        std::vector<cell<CellLyt>> cells{};
+        cells.reserve(cell_lyt.num_cells());
+
+        cell_lyt.foreach_cell([&cells](const auto& c) { cells.push_back(c); });
+
+        for (const auto& c : cells)
+        {
+            cell_lyt.assign_cell_type(c, technology<CellLyt>::cell_type::EMPTY);
+            cell_lyt.assign_cell_name(c, "");
+        }
+    }
+    /**
+     * This function assigns a given FCN gate implementation to the total cell layout or to a buffer of cells.
      *
+     * @tparam Target Type of the target, i.e., `CellLyt` or `gate_cells`.
      * @param c Top-left cell of the tile where the gate is placed.
      * @param g Gate implementation.
      * @param n Corresponding node in the gate-level layout.
+     * @param target Target that receives the non-empty cells and I/O names of the gate implementation.
      */
+    template <typename Target>
     void assign_gate(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g,
-                     const mockturtle::node<GateLyt>& n)
+                     const mockturtle::node<GateLyt>& n, Target& target) const
     {
         const auto start_x = c.x;
         const auto start_y = c.y;
@@ -234,13 +502,13 @@ class apply_gate_library_impl
 
                 if (!technology<CellLyt>::is_empty_cell(type))
                 {
-                    cell_lyt.assign_cell_type(pos, type);
+                    target.assign_cell_type(pos, type);
                 }
 
                 // set IO names
                 if (technology<CellLyt>::is_input_cell(type) || technology<CellLyt>::is_output_cell(type))
                 {
-                    cell_lyt.assign_cell_name(pos, gate_lyt.get_name(n));
+                    target.assign_cell_name(pos, gate_lyt.get_name(n));
                 }
             }
         }
@@ -287,10 +555,11 @@ class apply_gate_library_impl
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
  * @param lyt The gate-level layout.
+ * @param ps Parameters.
  * @return A cell-level layout that implements `lyt`'s gate types with building blocks defined in `GateLibrary`.
  */
 template <typename CellLyt, typename GateLibrary, typename GateLyt>
-[[nodiscard]] CellLyt apply_gate_library(const GateLyt& lyt)
+[[nodiscard]] CellLyt apply_gate_library(const GateLyt& lyt, const apply_gate_library_params& ps = {})
 {
     static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
     static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
@@ -303,7 +572,7 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
 
     detail::apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> p{lyt};
 
-    return p.run_static_gate_library();
+    return p.run_static_gate_library(ps);
 }
 
 /**
@@ -319,10 +588,13 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
  * @param lyt The gate-level layout.
+ * @param defect_surface Defect surface onto which the layout is mapped.
+ * @param ps Parameters.
  * @return A cell-level layout that implements `lyt`'s gate types with building blocks defined in `GateLibrary`.
  */
 template <typename DefectLyt, typename GateLibrary, typename GateLyt>
-[[nodiscard]] DefectLyt apply_gate_library_to_defective_surface(const GateLyt& lyt, const DefectLyt& defect_surface)
+[[nodiscard]] DefectLyt apply_gate_library_to_defective_surface(const GateLyt& lyt, const DefectLyt& defect_surface,
+                                                                const apply_gate_library_params& ps = {})
 {
     static_assert(is_cell_level_layout_v<DefectLyt>, "DefectLyt is not a cell-level layout");
     static_assert(is_sidb_defect_surface_v<DefectLyt>, "DefectLyt is not an SiDB defect surface");
@@ -335,7 +607,7 @@ template <typename DefectLyt, typename GateLibrary, typename GateLyt>
 
     detail::apply_gate_library_impl<DefectLyt, GateLibrary, GateLyt> p{lyt};
 
-    return p.run_static_gate_library(defect_surface);
+    return p.run_static_gate_library(ps, defect_surface);
 }
 /**
  * Applies a parameterized gate library to a given
@@ -17,6 +17,7 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <fmt/format.h>
 #include <kitty/traits.hpp>
@@ -207,6 +208,8 @@ class design_sidb_gates_impl
     {
         mockturtle::stopwatch stop{stats.time_total};
 
+        FICTION_TRACE_ZONE("design_sidb_gates::exhaustive");
+
         auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(
             params.number_of_canvas_sidbs, static_cast<std::size_t>(all_sidbs_in_canvas.size()));
 
@@ -300,6 +303,8 @@ class design_sidb_gates_impl
      */
     [[nodiscard]] std::vector<Lyt> run_random_design() const noexcept
     {
+        FICTION_TRACE_ZONE("design_sidb_gates::random_design");
+
         std::vector<Lyt> randomly_designed_gate_layouts = {};
 
         // Allow positive charges here, as a layout that displays positive charges without inputs may not exhibit them
@@ -392,11 +397,14 @@ class design_sidb_gates_impl
     {
         mockturtle::stopwatch stop{stats.time_total};
 
+        FICTION_TRACE_ZONE("design_sidb_gates::quickcell");
+
         std::vector<Lyt> gate_candidates{};
         gate_candidates.reserve(all_canvas_layouts.size());
 
         {
             mockturtle::stopwatch stop_pruning{stats.pruning_total};
+            FICTION_TRACE_ZONE("design_sidb_gates::pruning");
             gate_candidates = run_pruning();
         }
 
@@ -445,6 +453,8 @@ class design_sidb_gates_impl
                 return;
             }
 
+            FICTION_TRACE_ZONE("design_sidb_gates::operational_check");
+
             // pruning was already conducted above. Hence, SIMULATION_ONLY is chosen.
             params.operational_params.strategy_to_analyze_operational_status =
                 is_operational_params::operational_analysis_strategy::SIMULATION_ONLY;
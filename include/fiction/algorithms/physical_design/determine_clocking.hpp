@@ -17,9 +17,15 @@
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <numeric>
+#include <optional>
 #include <ostream>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -36,6 +42,16 @@ struct determine_clocking_params
      * The SAT solver to use.
      */
     bill::solvers sat_engine = bill::solvers::bsat2;
+    /**
+     * Maximum number of tiles per region in the decomposition mode. If `0` or if the layout does not contain more
+     * tiles than this, a single monolithic SAT instance over all tiles is constructed. Otherwise, the layout is
+     * partitioned into regions of consecutive rows that are solved independently and stitched together afterward.
+     */
+    uint64_t region_size = 0;
+    /**
+     * Number of threads to use for solving the region instances in the decomposition mode.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 /**
  * Statistics for the `determine_clocking` algorithm.
@@ -46,6 +62,10 @@ struct determine_clocking_stats
      * Total runtime.
      */
     mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of SAT instances that were solved.
+     */
+    std::size_t num_regions{0};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -54,6 +74,7 @@ struct determine_clocking_stats
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] regions    = {}\n", num_regions);
     }
 };
 
@@ -65,37 +86,40 @@ class sat_clocking_handler
 {
   public:
     /**
-     * Default constructor.
+     * Alias for the clock numbers of the handled tiles.
+     */
+    using clock_numbers = std::vector<typename Lyt::clock_number_t>;
+    /**
+     * Standard constructor.
+     *
+     * @param lyt The layout to clock.
+     * @param ts Non-empty tiles to determine clock numbers for. If a tile on a crossing layer is contained, the tile
+     * below it must be contained as well. Data flow from or to tiles that are not contained is disregarded.
      */
-    explicit sat_clocking_handler(Lyt& lyt) : layout{lyt}, number_of_clocks{layout.num_clocks()}
+    sat_clocking_handler(const Lyt& lyt, const std::vector<tile<Lyt>>& ts) :
+            layout{lyt},
+            tiles{ts},
+            number_of_clocks{layout.num_clocks()}
     {
-        // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
+        // for each given tile
+        for (const auto& t : tiles)
+        {
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
             {
-                // skip constants
-                if (layout.is_constant(n))
-                {
-                    return;
-                }
-
-                const auto t = layout.get_tile(n);
-
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    variables[{t, clk}] = solver.add_variable();
-                }
-            });
+                variables[{t, clk}] = solver.add_variable();
+            }
+        }
     }
     /**
-     * Determines clock numbers for the layout.
+     * Determines clock numbers for the tiles.
      *
      * Constructs a SAT instance and passes it to a solver to find a valid clocking scheme.
      *
-     * @return `true` iff a valid clocking scheme could be found.
+     * @return The clock numbers of the tiles in the order they were given or `std::nullopt` if no valid clocking
+     * scheme could be found.
      */
-    bool determine_clocks() noexcept
+    [[nodiscard]] std::optional<clock_numbers> determine_clocks() noexcept
     {
         at_least_one_clock_number_per_tile();
         at_most_one_clock_number_per_tile();
@@ -106,20 +130,23 @@ class sat_clocking_handler
         // pass to the solver
         if (const auto sat_result = solver.solve(); sat_result == bill::result::states::satisfiable)
         {
-            // extract model and assign clock numbers
-            assign_clock_numbers(solver.get_model().model());
-            return true;
+            // extract model
+            return extract_clock_numbers(solver.get_model().model());
         }
 
         // SAT instance was not satisfiable
-        return false;
+        return std::nullopt;
     }
 
   private:
     /**
      * The layout to clock.
      */
-    Lyt& layout;
+    const Lyt& layout;
+    /**
+     * The tiles to clock.
+     */
+    const std::vector<tile<Lyt>>& tiles;
     /**
      * Number of clocks in layout's clocking scheme.
      */
@@ -137,33 +164,35 @@ class sat_clocking_handler
      */
     std::unordered_map<tile_clock_number, bill::var_type> variables{};
 
+    /**
+     * Checks whether tile `t` is part of the SAT instance.
+     *
+     * @param t Tile to check.
+     * @return `true` iff variables have been created for `t`.
+     */
+    [[nodiscard]] bool is_handled(const tile<Lyt>& t) const noexcept
+    {
+        return variables.count({t, typename Lyt::clock_number_t{0}}) > 0;
+    }
     /**
      * Adds constraints to the solver that enforce the assignment of at least one clock number per tile.
      */
     void at_least_one_clock_number_per_tile() noexcept
     {
-        // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
-            {
-                if (layout.is_constant(n))
-                {
-                    return;
-                }
-
-                const auto t = layout.get_tile(n);
-
-                std::vector<bill::var_type> tc{};
-                tc.reserve(number_of_clocks);
+        // for each given tile
+        for (const auto& t : tiles)
+        {
+            std::vector<bill::var_type> tc{};
+            tc.reserve(number_of_clocks);
 
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    tc.push_back(variables[{t, clk}]);
-                }
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                tc.push_back(variables[{t, clk}]);
+            }
 
-                bill::at_least_one(tc, solver);
-            });
+            bill::at_least_one(tc, solver);
+        }
     }
     /**
      * Adds constraints to the solver that enforce the assignment of at most one clock number per tile.
@@ -176,21 +205,13 @@ class sat_clocking_handler
             // use an optimization here: c2 > c1 instead of c2 != c1 to save half the clauses
             for (typename Lyt::clock_number_t c2 = c1 + 1; c2 < number_of_clocks; ++c2)
             {
-                // for each non-empty tile
-                layout.foreach_node(
-                    [this, &c1, &c2](const auto& n)
-                    {
-                        if (layout.is_constant(n))
-                        {
-                            return;
-                        }
-
-                        const auto t = layout.get_tile(n);
-
-                        // not tile has clock 1 OR not tile has clock 2
-                        solver.add_clause({{bill::lit_type{variables[{t, c1}], bill::negative_polarity},
-                                            bill::lit_type{variables[{t, c2}], bill::negative_polarity}}});
-                    });
+                // for each given tile
+                for (const auto& t : tiles)
+                {
+                    // not tile has clock 1 OR not tile has clock 2
+                    solver.add_clause({{bill::lit_type{variables[{t, c1}], bill::negative_polarity},
+                                        bill::lit_type{variables[{t, c2}], bill::negative_polarity}}});
+                }
             }
         }
     }
@@ -199,40 +220,38 @@ class sat_clocking_handler
      */
     void exclude_clock_assignments_that_violate_information_flow() noexcept
     {
-        // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
-            {
-                if (layout.is_constant(n))
+        // for each given tile
+        for (const auto& t1 : tiles)
+        {
+            // for each of t's predecessors (disregarding clocking)
+            const auto incoming_tiles = layout.template incoming_data_flow<false>(t1);
+            std::for_each(
+                incoming_tiles.cbegin(), incoming_tiles.cend(),
+                [this, &t1](const auto& t2)
                 {
-                    return;
-                }
-
-                const auto t1 = layout.get_tile(n);
+                    // data flow across the instance's boundary is disregarded
+                    if (!is_handled(t2))
+                    {
+                        return;
+                    }
 
-                // for each of t's predecessors (disregarding clocking)
-                const auto incoming_tiles = layout.template incoming_data_flow<false>(t1);
-                std::for_each(
-                    incoming_tiles.cbegin(), incoming_tiles.cend(),
-                    [this, &t1](const auto& t2)
+                    // for each combination of possible clock numbers
+                    for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
                     {
-                        // for each combination of possible clock numbers
-                        for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
+                        for (typename Lyt::clock_number_t c2 = 0; c2 < number_of_clocks; ++c2)
                         {
-                            for (typename Lyt::clock_number_t c2 = 0; c2 < number_of_clocks; ++c2)
+                            // if c2 is not c1's incoming clock number
+                            if (!(static_cast<typename Lyt::clock_number_t>((c2 + typename Lyt::clock_number_t{1}) %
+                                                                            number_of_clocks) == c1))
                             {
-                                // if c2 is not c1's incoming clock number
-                                if (!(static_cast<typename Lyt::clock_number_t>((c2 + typename Lyt::clock_number_t{1}) %
-                                                                                number_of_clocks) == c1))
-                                {
-                                    // not tile t1 has clock c1 OR not tile t2 has clock c2
-                                    solver.add_clause({{bill::lit_type{variables[{t1, c1}], bill::negative_polarity},
-                                                        bill::lit_type{variables[{t2, c2}], bill::negative_polarity}}});
-                                }
+                                // not tile t1 has clock c1 OR not tile t2 has clock c2
+                                solver.add_clause({{bill::lit_type{variables[{t1, c1}], bill::negative_polarity},
+                                                    bill::lit_type{variables[{t2, c2}], bill::negative_polarity}}});
                             }
                         }
-                    });
-            });
+                    }
+                });
+        }
     }
     /**
      * Adds constraints to the solver that ensure the assignment of the same clock number to crossing tiles.
@@ -240,27 +259,23 @@ class sat_clocking_handler
     void ensure_same_clock_number_on_crossing_tiles() noexcept
     {
         // for each crossing wire
-        layout.foreach_wire(
-            [this](const auto& w)
+        for (const auto& t : tiles)
+        {
+            if (layout.is_ground_layer(t) || !layout.is_wire_tile(t))
             {
-                const auto t = layout.get_tile(w);
-
-                if (layout.is_ground_layer(t))
-                {
-                    return;
-                }
+                continue;
+            }
 
-                // fetch corresponding tile in ground layer
-                const auto ground_t = layout.below(t);
+            // fetch corresponding tile in ground layer
+            const auto ground_t = layout.below(t);
 
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    // ensure that the clock number of both tiles is identical
-                    solver.add_clause(
-                        bill::add_tseytin_equals(solver, variables[{t, clk}], variables[{ground_t, clk}]));
-                }
-            });
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                // ensure that the clock number of both tiles is identical
+                solver.add_clause(bill::add_tseytin_equals(solver, variables[{t, clk}], variables[{ground_t, clk}]));
+            }
+        }
     }
     /**
      * Adds constraints to the solver that help to speed up the solving process by breaking symmetries in the solution
@@ -268,11 +283,22 @@ class sat_clocking_handler
      */
     void symmetry_breaking() noexcept
     {
+        if (tiles.empty())
+        {
+            return;
+        }
+
         const std::function<void(const mockturtle::node<Lyt>& n)> recurse =
             [this, &recurse, clk = 0](const auto& n) mutable
         {
             const auto t = layout.get_tile(n);
 
+            // stop at the instance's boundary
+            if (!is_handled(t))
+            {
+                return;
+            }
+
             // pre-assign tile t to clock number clk
             solver.add_clause(variables[{t, clk++ % number_of_clocks}]);
 
@@ -285,45 +311,51 @@ class sat_clocking_handler
                                   });
         };
 
+        auto first_pi_handled = false;
+
         // only for the first PI
         layout.foreach_pi(
-            [&recurse](const auto& pi)
+            [this, &recurse, &first_pi_handled](const auto& pi)
             {
-                recurse(pi);
+                if (is_handled(layout.get_tile(pi)))
+                {
+                    recurse(pi);
+                    first_pi_handled = true;
+                }
 
                 return false;  // terminate after one iteration
             });
+
+        // any solution can be rotated; hence, the first tile can always be pre-assigned
+        if (!first_pi_handled)
+        {
+            solver.add_clause(variables[{tiles.front(), typename Lyt::clock_number_t{0}}]);
+        }
     }
     /**
-     * Assigns clock numbers to the layout based on the provided model.
+     * Extracts the clock numbers of all tiles from the provided model.
      *
      * @param model The model to extract the clocking scheme from.
+     * @return The clock numbers of the tiles in the order they were given.
      */
-    void assign_clock_numbers(const bill::result::model_type& model) noexcept
+    [[nodiscard]] clock_numbers extract_clock_numbers(const bill::result::model_type& model) noexcept
     {
-        // for each non-empty tile
-        layout.foreach_node(
-            [this, &model](const auto& n)
+        clock_numbers clocks(tiles.size(), typename Lyt::clock_number_t{0});
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
             {
-                if (layout.is_constant(n))
+                // if tile t is clocked with clock number clk
+                if (model.at(variables.at({tiles[i], clk})) == bill::lbool_type::true_)
                 {
-                    return;
+                    clocks[i] = clk;
                 }
+            }
+        }
 
-                const auto t = layout.get_tile(n);
-
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    // if tile t is clocked with clock number clk
-                    if (model.at(variables.at({t, clk})) == bill::lbool_type::true_)
-                    {
-                        layout.assign_clock_number(t, clk);
-                        layout.assign_clock_number(layout.above(t), clk);
-                        layout.assign_clock_number(layout.below(t), clk);
-                    }
-                }
-            });
+        return clocks;
     }
 };
 
@@ -334,7 +366,8 @@ class determine_clocking_impl
     determine_clocking_impl(Lyt& lyt, const determine_clocking_params& p, determine_clocking_stats& st) :
             layout{lyt},
             params{p},
-            stats{st}
+            stats{st},
+            number_of_clocks{layout.num_clocks()}
     {}
 
     bool run()
@@ -347,50 +380,338 @@ class determine_clocking_impl
             return true;
         }
 
+        auto tiles = collect_tiles();
+
+        std::optional<clock_numbers> clocks{};
+
+        if (params.region_size == 0 || tiles.size() <= params.region_size)
+        {
+            stats.num_regions = 1;
+
+            clocks = solve(tiles);
+        }
+        else
+        {
+            clocks = solve_decomposed(tiles);
+        }
+
+        if (!clocks.has_value())
+        {
+            return false;
+        }
+
+        assign_clock_numbers(tiles, *clocks);
+
+        return true;
+    }
+
+  private:
+    /**
+     * Alias for the clock numbers of a range of tiles.
+     */
+    using clock_numbers = std::vector<typename Lyt::clock_number_t>;
+    /**
+     * The layout to assign clock numbers to.
+     */
+    Lyt& layout;
+    /**
+     * Parameters.
+     */
+    determine_clocking_params params;
+    /**
+     * Statistics.
+     */
+    determine_clocking_stats& stats;
+    /**
+     * Number of clocks in layout's clocking scheme.
+     */
+    const typename Lyt::clock_number_t number_of_clocks;
+
+    /**
+     * Collects all non-empty tiles of the layout.
+     *
+     * @return The tiles of all non-constant nodes.
+     */
+    [[nodiscard]] std::vector<tile<Lyt>> collect_tiles() const noexcept
+    {
+        std::vector<tile<Lyt>> tiles{};
+        tiles.reserve(layout.num_gates() + layout.num_wires());
+
+        layout.foreach_node(
+            [this, &tiles](const auto& n)
+            {
+                // skip constants
+                if (!layout.is_constant(n))
+                {
+                    tiles.push_back(layout.get_tile(n));
+                }
+            });
+
+        return tiles;
+    }
+    /**
+     * Constructs a SAT instance over the given tiles and solves it with the configured SAT engine.
+     *
+     * @param tiles The tiles to determine clock numbers for.
+     * @return The clock numbers of `tiles` or `std::nullopt` if no valid clocking scheme exists for them.
+     */
+    [[nodiscard]] std::optional<clock_numbers> solve(const std::vector<tile<Lyt>>& tiles) const noexcept
+    {
         switch (params.sat_engine)
         {
             case bill::solvers::ghack:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::ghack>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt, bill::solvers::ghack>{layout, tiles}.determine_clocks();
             }
             case bill::solvers::glucose_41:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::glucose_41>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt, bill::solvers::glucose_41>{layout, tiles}.determine_clocks();
             }
             case bill::solvers::bsat2:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::bsat2>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt, bill::solvers::bsat2>{layout, tiles}.determine_clocks();
             }
 #if !defined(BILL_WINDOWS_PLATFORM)
             case bill::solvers::maple:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::maple>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt, bill::solvers::maple>{layout, tiles}.determine_clocks();
             }
             case bill::solvers::bmcg:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::bmcg>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt, bill::solvers::bmcg>{layout, tiles}.determine_clocks();
             }
 #endif
             default:
             {
-                return sat_clocking_handler<Lyt>{layout}.determine_clocks();
+                return sat_clocking_handler<Lyt>{layout, tiles}.determine_clocks();
             }
         }
     }
-
-  private:
     /**
-     * The layout to assign clock numbers to.
+     * Partitions the layout into regions of consecutive rows, solves their SAT instances in parallel, and stitches the
+     * regions' solutions together.
+     *
+     * All constraints fix the difference of two clock numbers modulo the number of clocks. Thus, a region's solution
+     * is unique up to a rotation of the clock numbers in each of its connected components and any global solution
+     * arises from rotating them. Consequently, the regions can be solved without any assumptions on their boundaries
+     * and the stitching step determines these rotations exactly, i.e., it fails iff no valid clocking scheme exists.
+     *
+     * @param tiles All non-empty tiles of the layout. They are reordered by their position.
+     * @return The clock numbers of `tiles` or `std::nullopt` if no valid clocking scheme exists.
      */
-    Lyt& layout;
+    [[nodiscard]] std::optional<clock_numbers> solve_decomposed(std::vector<tile<Lyt>>& tiles)
+    {
+        // sort by position such that crossing tiles are adjacent and regions consist of consecutive rows
+        std::sort(tiles.begin(), tiles.end(),
+                  [](const auto& t1, const auto& t2)
+                  {
+                      if (t1.y != t2.y)
+                      {
+                          return t1.y < t2.y;
+                      }
+                      if (t1.x != t2.x)
+                      {
+                          return t1.x < t2.x;
+                      }
+
+                      return t1.z < t2.z;
+                  });
+
+        // partition the tiles into regions without separating crossing tiles
+        std::vector<std::vector<tile<Lyt>>> regions{};
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            if (regions.empty() || (regions.back().size() >= params.region_size &&
+                                    (tiles[i].x != tiles[i - 1].x || tiles[i].y != tiles[i - 1].y)))
+            {
+                regions.emplace_back();
+                regions.back().reserve(params.region_size + 1);
+            }
+
+            regions.back().push_back(tiles[i]);
+        }
+
+        stats.num_regions = regions.size();
+
+        std::vector<std::optional<clock_numbers>> solutions(regions.size());
+
+        std::atomic<std::size_t> next_region{0};
+        std::atomic<bool>        unsatisfiable{false};
+
+        const auto solve_regions = [this, &regions, &solutions, &next_region, &unsatisfiable]
+        {
+            for (auto i = next_region++; i < regions.size() && !unsatisfiable.load(std::memory_order_relaxed);
+                 i = next_region++)
+            {
+                solutions[i] = solve(regions[i]);
+
+                // if a single region cannot be clocked, neither can the layout
+                if (!solutions[i].has_value())
+                {
+                    unsatisfiable.store(true, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        const auto num_threads = std::max(std::min(params.num_threads, regions.size()), std::size_t{1});
+
+        if (num_threads == 1)
+        {
+            solve_regions();
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(solve_regions);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        if (unsatisfiable)
+        {
+            return std::nullopt;
+        }
+
+        clock_numbers clocks{};
+        clocks.reserve(tiles.size());
+
+        for (const auto& s : solutions)
+        {
+            clocks.insert(clocks.cend(), s->cbegin(), s->cend());
+        }
+
+        return stitch(tiles, std::move(clocks));
+    }
     /**
-     * Parameters.
+     * Rotates the clock numbers of the regions' connected components such that all data flow connections and
+     * crossings across region boundaries are respected. To this end, the rotations are tracked via a union-find data
+     * structure whose edges are weighted with the difference of the rotations of their end points.
+     *
+     * @param tiles All non-empty tiles of the layout.
+     * @param clocks Clock numbers of `tiles` that are valid within each region.
+     * @return The rotated clock numbers of `tiles` or `std::nullopt` if the regions cannot be stitched together.
      */
-    determine_clocking_params params;
+    [[nodiscard]] std::optional<clock_numbers> stitch(const std::vector<tile<Lyt>>& tiles, clock_numbers clocks) const
+    {
+        std::unordered_map<tile<Lyt>, std::size_t> index{};
+        index.reserve(tiles.size());
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            index[tiles[i]] = i;
+        }
+
+        const auto k = static_cast<uint64_t>(number_of_clocks);
+
+        // parent of each tile and its rotation relative to the parent
+        std::vector<std::size_t> parent(tiles.size());
+        std::iota(parent.begin(), parent.end(), std::size_t{0});
+        std::vector<uint64_t> rotation(tiles.size(), 0);
+
+        // returns the root of i and the rotation of i relative to it
+        const auto find = [&parent, &rotation, k](const std::size_t i) -> std::pair<std::size_t, uint64_t>
+        {
+            auto root = i;
+            auto rot  = uint64_t{0};
+
+            while (parent[root] != root)
+            {
+                rot  = (rot + rotation[root]) % k;
+                root = parent[root];
+            }
+
+            // path compression
+            for (auto j = i, rot_j = rot; parent[j] != root && j != root;)
+            {
+                const auto next     = parent[j];
+                const auto next_rot = (rot_j + k - rotation[j]) % k;
+
+                parent[j]   = root;
+                rotation[j] = rot_j;
+
+                j     = next;
+                rot_j = next_rot;
+            }
+
+            return {root, rot};
+        };
+
+        // enforces rotation(i) - rotation(j) = diff modulo k; returns false if this contradicts previous relations
+        const auto relate =
+            [&parent, &rotation, &find, k](const std::size_t i, const std::size_t j, const uint64_t diff)
+        {
+            const auto [root_i, rot_i] = find(i);
+            const auto [root_j, rot_j] = find(j);
+
+            if (root_i == root_j)
+            {
+                return (rot_i + k - rot_j) % k == diff;
+            }
+
+            parent[root_i]   = root_j;
+            rotation[root_i] = (diff + rot_j + k - rot_i) % k;
+
+            return true;
+        };
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            const auto& t1 = tiles[i];
+
+            // clock(t1) = clock(t2) + 1 for each predecessor t2
+            for (const auto& t2 : layout.template incoming_data_flow<false>(t1))
+            {
+                if (const auto it = index.find(t2); it != index.cend())
+                {
+                    if (!relate(i, it->second, (clocks[it->second] + 1 + k - clocks[i]) % k))
+                    {
+                        return std::nullopt;
+                    }
+                }
+            }
+
+            // clock(t1) = clock(ground) for crossing tiles
+            if (!layout.is_ground_layer(t1) && layout.is_wire_tile(t1))
+            {
+                const auto g = index.at(layout.below(t1));
+
+                if (!relate(i, g, (clocks[g] + k - clocks[i]) % k))
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            clocks[i] = static_cast<typename Lyt::clock_number_t>((clocks[i] + find(i).second) % k);
+        }
+
+        return clocks;
+    }
     /**
-     * Statistics.
+     * Assigns the given clock numbers to the layout.
+     *
+     * @param tiles The tiles to assign clock numbers to.
+     * @param clocks The clock numbers of `tiles`.
      */
-    determine_clocking_stats& stats;
+    void assign_clock_numbers(const std::vector<tile<Lyt>>& tiles, const clock_numbers& clocks) noexcept
+    {
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            layout.assign_clock_number(tiles[i], clocks[i]);
+            layout.assign_clock_number(layout.above(tiles[i]), clocks[i]);
+            layout.assign_clock_number(layout.below(tiles[i]), clocks[i]);
+        }
+    }
 };
 
 }  // namespace detail
@@ -403,6 +724,10 @@ class determine_clocking_impl
  *
  * If no valid clock number assignment exists for `lyt`, this function returns `false` and does not modify `lyt`.
  *
+ * If `params.region_size` is set, the layout is partitioned into regions of consecutive rows whose SAT instances are
+ * solved in parallel. Their solutions are stitched together afterward by rotating the clock numbers of each region's
+ * connected components, which succeeds iff a valid clock number assignment exists for the entire layout.
+ *
  * This algorithm was proposed in \"Ending the Tyranny of the Clock: SAT-based Clock Number Assignment for Field-coupled
  * Nanotechnologies\" by M. Walter, J. Drewniok, and R. Wille in IEEE NANO 2024
  * (https://ieeexplore.ieee.org/abstract/document/10628908).
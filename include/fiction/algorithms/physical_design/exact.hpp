@@ -17,8 +17,12 @@
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
 #include "fiction/utils/placement_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
+#include "fiction/utils/z3_cnf_translation.hpp"
 
+#include <bill/sat/interface/common.hpp>
+#include <bill/sat/interface/types.hpp>
 #include <fmt/format.h>
 #include <kitty/dynamic_truth_table.hpp>
 #include <kitty/operations.hpp>
@@ -71,6 +75,23 @@ enum class technology_constraints : uint8_t
      */
     TOPOLINANO
 };
+/**
+ * Solver backends for the exact physical design algorithm.
+ */
+enum class exact_physical_design_backend : uint8_t
+{
+    /**
+     * Solve the generated instances with the SMT solver Z3.
+     */
+    SMT = 0,
+    /**
+     * Translate the generated instances to CNF and solve them incrementally with a SAT solver from `bill`. Instances
+     * that contain arithmetic over non-Boolean variables, i.e., the ones that use synchronization elements, are solved
+     * by Z3 instead. If optimization criteria are specified, they are handled by Z3 after the SAT solver found the
+     * instance to be satisfiable.
+     */
+    SAT
+};
 /**
  * Parameters for the exact physical design algorithm.
  */
@@ -148,6 +169,14 @@ struct exact_physical_design_params
      * Technology-specific constraints that are only to be added for a certain target technology.
      */
     technology_constraints technology_specifics = technology_constraints::NONE;
+    /**
+     * Solver backend to use.
+     */
+    exact_physical_design_backend backend = exact_physical_design_backend::SMT;
+    /**
+     * The SAT solver to use if `backend` is `SAT`.
+     */
+    bill::solvers sat_engine = bill::solvers::ghack;
 };
 /**
  * Statistics.
@@ -161,6 +190,8 @@ struct exact_physical_design_stats
 
     uint32_t num_aspect_ratios{0ul};
 
+    uint32_t num_sat_checks{0ul}, num_sat_fallbacks{0ul};
+
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time      = {:.2f} secs\n", mockturtle::to_seconds(time_total));
@@ -168,6 +199,12 @@ struct exact_physical_design_stats
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
         out << fmt::format("[i] num. crossings  = {}\n", num_crossings);
+
+        if (num_sat_checks + num_sat_fallbacks > 0)
+        {
+            out << fmt::format("[i] SAT checks      = {} ({} solved by Z3)\n", num_sat_checks + num_sat_fallbacks,
+                               num_sat_fallbacks);
+        }
     }
 };
 
@@ -201,12 +238,12 @@ class exact_impl
 
     std::optional<Lyt> run()
     {
-        if (ps.num_threads > 1)
-        {
-            return run_asynchronously();
-        }
+        auto result = ps.num_threads > 1 ? run_asynchronously() : run_synchronously();
 
-        return run_synchronously();
+        pst.num_sat_checks    = sat_usage.num_sat_checks.load();
+        pst.num_sat_fallbacks = sat_usage.num_sat_fallbacks.load();
+
+        return result;
     }
 
   private:
@@ -256,6 +293,25 @@ class exact_impl
     using solver_ptr   = std::shared_ptr<z3::solver>;
     using optimize_ptr = std::shared_ptr<z3::optimize>;
 
+    /**
+     * Counts how the instance checks of all handlers were solved if the SAT backend is used.
+     */
+    struct sat_backend_usage
+    {
+        /**
+         * Number of checks that were solved by the SAT solver.
+         */
+        std::atomic<uint32_t> num_sat_checks{0ul};
+        /**
+         * Number of checks that could not be translated to CNF and were, thus, solved by Z3.
+         */
+        std::atomic<uint32_t> num_sat_fallbacks{0ul};
+    };
+    /**
+     * SAT backend usage of all handlers.
+     */
+    sat_backend_usage sat_usage{};
+
     /**
      * Sub-class to exact to handle construction of SMT instances as well as house-keeping like storing solver
      * states across incremental calls etc. Multiple handlers can be created in order to explore possible aspect ratios
@@ -270,14 +326,16 @@ class exact_impl
          * @param ctxp The context that is used in all solvers.
          * @param lyt The empty gate-level layout that is going to contain the created layout.
          * @param ps The parameters to respect in the SMT instance generation process.
+         * @param usage Counters that log how instance checks are solved if the SAT backend is used.
          */
         smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk, const exact_physical_design_params& ps,
-                    const surface_black_list<Lyt, port_direction>& sbl) noexcept :
+                    const surface_black_list<Lyt, port_direction>& sbl, sat_backend_usage& usage) noexcept :
                 ctx{std::move(ctxp)},
                 layout{lyt},
                 network{ntk},
                 params{ps},
                 black_list{sbl},
+                sat_usage{usage},
                 node2pos{ntk},
                 depth_ntk{ntk},
                 inv_levels{inverse_levels(ntk)}
@@ -375,19 +433,23 @@ class exact_impl
          */
         [[nodiscard]] bool is_satisfiable()
         {
+            FICTION_TRACE_ZONE("exact::is_satisfiable");
+
             generate_smt_instance();
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            if (auto model = check(); model.has_value())
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
                 {
+                    FICTION_TRACE_ZONE("exact::optimize");
+
                     opt->check();
                     assign_layout(opt->get_model());
                 }
                 else
                 {
-                    assign_layout(solver->get_model());
+                    assign_layout(*model);
                 }
 
                 return true;
@@ -431,6 +493,21 @@ class exact_impl
              */
             z3::expr e, s;
         };
+        /**
+         * If the SAT backend is used, all assertions of a solver are incrementally translated to CNF. Since the
+         * assertions are still collected in the Z3 solver, it can take over should the translation fail.
+         */
+        struct cnf_state
+        {
+            /**
+             * Translator that holds the SAT solver.
+             */
+            z3_cnf_translator translator;
+            /**
+             * Number of the solver's assertions that have been passed to the translator.
+             */
+            unsigned num_translated_assertions{0u};
+        };
         /**
          * Incremental solver calls require some kind of continuous solver state that can be extended. This state
          * involves a pointer to the solver alongside its assumption literals.
@@ -445,6 +522,10 @@ class exact_impl
              * Watched literals for eastern and southern constraints which are used to reformulate them.
              */
             assumption_literals lit;
+            /**
+             * CNF translation of the solver's assertions if the SAT backend is used; `nullptr` otherwise.
+             */
+            std::shared_ptr<cnf_state> cnf;
         };
         /**
          * Alias for a pointer to a solver state.
@@ -498,6 +579,10 @@ class exact_impl
          * Maps tiles to blacklisted gate types via their truth tables and port information.
          */
         const surface_black_list<Lyt, port_direction>& black_list;
+        /**
+         * Counters that log how instance checks are solved if the SAT backend is used.
+         */
+        sat_backend_usage& sat_usage;
         /**
          * Maps nodes to tile positions when creating the layout from the SMT model.
          */
@@ -592,7 +677,7 @@ class exact_impl
 
                 // deep-copy solver state
                 const auto   state     = it_x->second;
-                solver_state new_state = {state->solver, {get_lit_e(), state->lit.s}};
+                solver_state new_state = {state->solver, {get_lit_e(), state->lit.s}, state->cnf};
 
                 // reset eastern constraints
                 new_state.solver->add(!(state->lit.e));
@@ -616,7 +701,7 @@ class exact_impl
 
                 // deep-copy solver state
                 const auto   state     = it_y->second;
-                solver_state new_state = {state->solver, {state->lit.e, get_lit_s()}};
+                solver_state new_state = {state->solver, {state->lit.e, get_lit_s()}, state->cnf};
 
                 // reset southern constraints
                 new_state.solver->add(!(state->lit.s));
@@ -639,7 +724,10 @@ class exact_impl
             }
 
             // create new state
-            solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()}};
+            solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()},
+                                   params.backend == exact_physical_design_backend::SAT ?
+                                       std::make_shared<cnf_state>(cnf_state{{*ctx, params.sat_engine}}) :
+                                       nullptr};
 
             return {std::make_shared<solver_state>(new_state), added_tiles, {}, create_assumptions(new_state)};
         }
@@ -2567,6 +2655,62 @@ class exact_impl
             define_number_of_connections();
             utilize_hierarchical_information();
         }
+        /**
+         * Passes all assertions of the current solver that have not been translated yet to the CNF translator.
+         *
+         * @param cnf CNF state of the current solver.
+         * @return `true` iff all assertions could be translated.
+         */
+        [[nodiscard]] bool translate_assertions(cnf_state& cnf) const
+        {
+            const auto assertions = solver->assertions();
+
+            for (; cnf.num_translated_assertions < assertions.size(); ++cnf.num_translated_assertions)
+            {
+                if (!cnf.translator.add(assertions[cnf.num_translated_assertions]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+        /**
+         * Checks the current instance under the check point's assumptions. If the SAT backend is used and all
+         * assertions could be translated to CNF, the SAT solver is called. Otherwise, Z3 is.
+         *
+         * @return A model of the instance if it is satisfiable; `std::nullopt` otherwise.
+         */
+        [[nodiscard]] std::optional<z3::model> check()
+        {
+            const auto& cnf = check_point->state->cnf;
+
+            if (cnf != nullptr && translate_assertions(*cnf))
+            {
+                FICTION_TRACE_ZONE("exact::sat");
+
+                ++sat_usage.num_sat_checks;
+
+                if (cnf->translator.solve(check_point->assumptions) == bill::result::states::satisfiable)
+                {
+                    return cnf->translator.get_model();
+                }
+
+                return std::nullopt;
+            }
+
+            if (cnf != nullptr)
+            {
+                ++sat_usage.num_sat_fallbacks;
+            }
+
+            if (solver->check(check_point->assumptions) == z3::sat)
+            {
+                return solver->get_model();
+            }
+
+            return std::nullopt;
+        }
         /**
          * Creates and returns a z3::optimize if optimization criteria were set by the configuration. The optimize gets
          * passed all constraints from the current solver and the respective optimization constraints are added to it,
@@ -2857,7 +3001,7 @@ class exact_impl
 
         Lyt layout{{}, scheme};
 
-        smt_handler handler{ctx, layout, *ntk, ps, black_list};
+        smt_handler handler{ctx, layout, *ntk, ps, black_list, sat_usage};
         (*ti_list)[t_num].ctx = ctx;
 
         while (true)
@@ -3059,7 +3203,7 @@ class exact_impl
     {
         Lyt layout{{}, scheme};
 
-        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps, black_list};
+        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps, black_list, sat_usage};
 
         const auto upper_bound = std::min(static_cast<uint64_t>(ps.upper_bound_area),
                                           static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y));
@@ -3153,6 +3297,10 @@ class exact_impl
  * and `is_gate_level_layout`, respectively. It is, thereby, mostly technology-independent but can make certain
  * assumptions if needed, for instance for ToPoliNano-compliant circuits.
  *
+ * Alternatively to Z3, the instances can be solved by a SAT solver after translating them to CNF. To this end, set
+ * `ps.backend` to `exact_physical_design_backend::SAT`. Configurations that are not expressible in CNF are still
+ * handled by Z3.
+ *
  * This approach requires the Z3 SMT solver to be installed on the system. Due to this circumstance, it is excluded from
  * (CLI) compilation by default. To enable it, pass `-DFICTION_Z3=ON` to the cmake call.
  *
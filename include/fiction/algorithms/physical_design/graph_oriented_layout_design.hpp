@@ -31,10 +31,11 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
-#include <future>
 #include <iostream>
 #include <limits>
 #include <mutex>
@@ -164,9 +165,19 @@ struct graph_oriented_layout_design_params
      * overhead for thread synchronization and can increase memory usage. It is therefore not recommended for small
      * input networks.
      *
+     * Worker threads are not bound to individual search space graphs. Instead, each worker repeatedly picks any search
+     * space graph that is currently not being expanded by another worker such that workers whose search space graphs
+     * are exhausted early take over the remaining ones. The costs of the best layouts found so far are shared between
+     * all workers and used to prune vertices that cannot lead to better layouts.
+     *
      * Default value: `false`
      */
     bool enable_multithreading = false;
+    /**
+     * Number of worker threads to use if `enable_multithreading` is `true`. The number of workers is additionally
+     * bounded by the number of search space graphs.
+     */
+    uint64_t num_threads = std::thread::hardware_concurrency();
     /**
      * Verbosity.
      */
@@ -231,6 +242,11 @@ struct graph_oriented_layout_design_stats
      * Number of crossings.
      */
     uint64_t num_crossings{0ull};
+    /**
+     * Number of search space graph vertices that were discarded without expansion because they could not lead to a
+     * layout that is better than the best one found so far.
+     */
+    uint64_t num_pruned_vertices{0ull};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -308,10 +324,20 @@ class priority_queue
      *
      * @param item The element to be added.
      * @param priority The priority of the element.
+     * @param lower_bound Lower bound on the cost of all layouts that can be reached from the element.
+     */
+    void put(const coord_vec_type<Lyt>& item, double priority, const uint64_t lower_bound = 0ul)
+    {
+        elements.emplace(priority, counter++, item, lower_bound);
+    }
+    /**
+     * Returns the lower bound on the cost of the element with the highest priority without removing it.
+     *
+     * @return The lower bound of the element with the highest priority.
      */
-    void put(const coord_vec_type<Lyt>& item, double priority)
+    [[nodiscard]] uint64_t top_lower_bound() const
     {
-        elements.emplace(priority, counter++, item);
+        return std::get<3>(elements.top());
     }
     /**
      * Retrieves and removes the element with the highest priority from the queue.
@@ -331,9 +357,10 @@ class priority_queue
      */
     std::size_t counter = 0ul;
     /**
-     * Tuple containing the priority, counter, and element.
+     * Tuple containing the priority, counter, element, and the lower bound on the cost of reachable layouts. Since
+     * counters are unique, the lower bound never takes part in comparisons.
      */
-    using queue_element = std::tuple<double, std::size_t, coord_vec_type<Lyt>>;
+    using queue_element = std::tuple<double, std::size_t, coord_vec_type<Lyt>, uint64_t>;
     /**
      * Priority queue containing elements with associated priorities.
      */
@@ -411,6 +438,11 @@ struct search_space_graph
      */
     graph_oriented_layout_design_params::cost_objective cost =
         graph_oriented_layout_design_params::cost_objective::AREA;
+    /**
+     * Cost of the partial layout of the most recently expanded vertex, which is a lower bound on the cost of all
+     * layouts reachable from the vertices generated by this expansion.
+     */
+    uint64_t expansion_lower_bound = 0ul;
 };
 /**
  * @brief Custom view class derived from mockturtle::topo_view.
@@ -723,91 +755,20 @@ class graph_oriented_layout_design_impl
             timeout = 10000u;
         }
 
-        // main loop
-        while (!timeout_limit_reached)
+        if (ps.enable_multithreading)
         {
-            // if multithreading is enabled
-            if (ps.enable_multithreading)
+            if (auto first_layout = explore_in_parallel(best_lyt, timeout_set); first_layout.has_value())
             {
-                // separate mutexes for better concurrency
-                std::mutex update_best_layout_mutex{};
+                pst.num_pruned_vertices = num_pruned_vertices;
 
-                // reuse futures pool to avoid allocation overhead
-                futures_pool.clear();
-                futures_pool.reserve(ssg_vec.size());
-
-                // process `ssg_vec` in parallel using std::async
-                for (auto& ssg : ssg_vec)
-                {
-                    auto* ssg_ptr = &ssg;
-                    futures_pool.emplace_back(
-                        std::async(std::launch::async,
-                                   [this, ssg_ptr, &update_best_layout_mutex, &best_lyt]() -> std::optional<Lyt>
-                                   {
-                                       if (auto result = process_ssg(*ssg_ptr); result)
-                                       {
-                                           const std::lock_guard<std::mutex> lock(update_best_layout_mutex);
-                                           best_lyt = std::move(*result);
-                                           restore_names(ssg_ptr->network, best_lyt);
-                                           update_stats(best_lyt);
-
-                                           if (ps.return_first)
-                                           {
-                                               return best_lyt;
-                                           }
-                                       }
-                                       return std::nullopt;
-                                   }));
-                }
-
-                // check the futures for the result - poll for readiness to support return_first
-                while (true)
-                {
-                    bool all_done = true;
-                    for (auto& f : futures_pool)
-                    {
-                        if (f.valid())
-                        {
-                            using namespace std::chrono_literals;
-                            if (f.wait_for(0ms) == std::future_status::ready)
-                            {
-                                if (auto r = f.get())
-                                {
-                                    // cancel remaining futures if return_first is enabled
-                                    if (ps.return_first)
-                                    {
-                                        for (auto& remaining_future : futures_pool)
-                                        {
-                                            if (remaining_future.valid())
-                                            {
-                                                remaining_future.wait();
-                                            }
-                                        }
-                                    }
-                                    return *r;  // return immediately when first result is ready
-                                }
-                            }
-                            else
-                            {
-                                all_done = false;
-                            }
-                        }
-                    }
-                    if (all_done)
-                    {
-                        break;
-                    }
-                    // adaptive sleep: shorter sleep when more futures are active
-                    const auto active_futures = std::count_if(futures_pool.cbegin(), futures_pool.cend(),
-                                                              [](const auto& f) { return f.valid(); });
-                    const auto sleep_duration =
-                        active_futures > 4 ? std::chrono::microseconds(100) : std::chrono::milliseconds(1);
-                    std::this_thread::sleep_for(sleep_duration);
-                }
+                return first_layout;
             }
-            else
+        }
+        else
+        {
+            // main loop
+            while (!timeout_limit_reached)
             {
-                // single-threaded version
                 for (auto& ssg : ssg_vec)
                 {
                     auto result = process_ssg(ssg);
@@ -819,53 +780,30 @@ class graph_oriented_layout_design_impl
 
                         if (ps.return_first)
                         {
+                            pst.num_pruned_vertices = num_pruned_vertices;
+
                             return *result;
                         }
                     }
                 }
-            }
 
-            // update current_vertex and frontier_flag (non-parallel for now)
-            for (auto& ssg : ssg_vec)
-            {
-                if (ssg.frontier_flag)
+                // update current_vertex and frontier_flag
+                for (auto& ssg : ssg_vec)
                 {
-                    if (!ssg.frontier.empty())
-                    {
-                        ssg.current_vertex = ssg.frontier.get();
-                    }
-                    else
-                    {
-                        ssg.frontier_flag = false;
-                    }
+                    select_next_vertex(ssg);
                 }
-            }
-
-            // check if timeout is reached or solution found
-            timeout_limit_reached =
-                std::none_of(ssg_vec.cbegin(), ssg_vec.cend(), [](const auto& ssg) { return ssg.frontier_flag; });
-
-            const auto end = std::chrono::high_resolution_clock::now();
-            const auto duration_ms =
-                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 
-            if (duration_ms >= timeout)
-            {
-                // terminate the algorithm if the specified timeout was set or a solution was found in high-efficiency
-                // mode
-                if ((ps.mode == graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY &&
-                     (improve_area_solution || improve_wire_solution || improve_crossing_solution ||
-                      improve_acp_solution || improve_custom_solution)) ||
-                    timeout_set)
-                {
-                    timeout_limit_reached = true;
-                }
+                // check if timeout is reached or solution found
+                timeout_limit_reached =
+                    std::none_of(ssg_vec.cbegin(), ssg_vec.cend(), [](const auto& ssg) { return ssg.frontier_flag; }) ||
+                    timeout_exceeded(timeout_set);
             }
         }
 
+        pst.num_pruned_vertices = num_pruned_vertices;
+
         // check if any layout was found
-        if (improve_area_solution || improve_wire_solution || improve_crossing_solution || improve_acp_solution ||
-            improve_custom_solution)
+        if (solution_found())
         {
             return best_lyt;
         }
@@ -1009,9 +947,14 @@ class graph_oriented_layout_design_impl
      */
     std::uint32_t seed;
     /**
-     * Thread pool for multithreaded execution to avoid thread creation overhead.
+     * Number of vertices that were discarded without expansion because they could not lead to a better layout.
+     */
+    std::atomic<uint64_t> num_pruned_vertices{0ul};
+    /**
+     * Number of consecutive expansions a worker performs on a search space graph before moving on to the next one in
+     * multithreaded mode.
      */
-    mutable std::vector<std::future<std::optional<Lyt>>> futures_pool{};
+    static constexpr const uint64_t EXPANSIONS_PER_BATCH = 16ul;
     /**
      * Get thread-local random number generator for `tiles_to_skip_between_pis` randomization.
      * Each thread will have its own RNG to avoid mutex contention.
@@ -1076,6 +1019,264 @@ class graph_oriented_layout_design_impl
         pst.num_wires     = best_lyt.num_wires();
         pst.num_crossings = best_lyt.num_crossings();
     }
+    /**
+     * Checks whether a layout has been found for any cost objective.
+     *
+     * @return `true` iff a layout has been found.
+     */
+    [[nodiscard]] bool solution_found() const noexcept
+    {
+        return improve_area_solution || improve_wire_solution || improve_crossing_solution || improve_acp_solution ||
+               improve_custom_solution;
+    }
+    /**
+     * Checks whether the search is to be terminated due to the timeout. In high-efficiency mode without a user-defined
+     * timeout, the search is only terminated after the timeout once a layout has been found.
+     *
+     * @param timeout_set Flag indicating whether a timeout was set by the user.
+     * @return `true` iff the search is to be terminated.
+     */
+    [[nodiscard]] bool timeout_exceeded(const bool timeout_set) const noexcept
+    {
+        const auto end = std::chrono::high_resolution_clock::now();
+        const auto duration_ms =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
+        if (duration_ms < timeout)
+        {
+            return false;
+        }
+
+        // terminate the algorithm if the specified timeout was set or a solution was found in high-efficiency mode
+        return (ps.mode == graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY && solution_found()) ||
+               timeout_set;
+    }
+    /**
+     * Atomically lowers the given value to `value` if `value` is smaller.
+     *
+     * @param target Atomic value to update.
+     * @param value Candidate value.
+     * @return `true` iff `target` was lowered to `value`.
+     */
+    static bool update_minimum(std::atomic<uint64_t>& target, const uint64_t value) noexcept
+    {
+        auto current = target.load();
+
+        while (value < current)
+        {
+            if (target.compare_exchange_weak(current, value))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Checks whether all layouts with the given lower bound on their cost are more expensive than the best layout found
+     * so far for the given cost objective. Since custom cost objectives are not necessarily monotone during placement,
+     * they are never pruned this way.
+     *
+     * Layouts that merely tie with the best one are not pruned because completed layouts are accepted if their cost
+     * does not exceed the best one (see `process_ssg`) and post-layout optimization may still reduce the cost of a
+     * tie.
+     *
+     * @param cost The cost objective.
+     * @param lower_bound Lower bound on the cost.
+     * @return `true` iff layouts with cost of at least `lower_bound` are more expensive than the best layout found so
+     * far.
+     */
+    [[nodiscard]] bool exceeds_best_solution(const graph_oriented_layout_design_params::cost_objective cost,
+                                             const uint64_t lower_bound) const noexcept
+    {
+        switch (cost)
+        {
+            case graph_oriented_layout_design_params::cost_objective::AREA:
+            {
+                return improve_area_solution && lower_bound > best_area_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::WIRES:
+            {
+                return improve_wire_solution && lower_bound > best_wire_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
+            {
+                return improve_crossing_solution && lower_bound > best_crossing_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::ACP:
+            {
+                return improve_acp_solution && lower_bound > best_acp_solution;
+            }
+            default:
+            {
+                return false;
+            }
+        }
+    }
+    /**
+     * Pops the next vertex to expand from the frontier of the given search space graph. Vertices that cannot lead to a
+     * layout that is better than the best one found so far are discarded. If the frontier is exhausted, the search
+     * space graph is deactivated.
+     *
+     * @param ssg The search space graph.
+     */
+    void select_next_vertex(search_space_graph<ObstrLyt>& ssg)
+    {
+        if (!ssg.frontier_flag)
+        {
+            return;
+        }
+
+        while (!ssg.frontier.empty())
+        {
+            if (exceeds_best_solution(ssg.cost, ssg.frontier.top_lower_bound()))
+            {
+                static_cast<void>(ssg.frontier.get());
+                ++num_pruned_vertices;
+
+                continue;
+            }
+
+            ssg.current_vertex = ssg.frontier.get();
+
+            return;
+        }
+
+        ssg.frontier_flag = false;
+    }
+    /**
+     * Expands all search space graphs concurrently. Search space graphs that still have vertices to expand wait in a
+     * shared queue. Each worker takes the next search space graph from this queue, performs a batch of expansions on
+     * it, and puts it back at the end of the queue unless it is exhausted. Hence, each search space graph is expanded
+     * by a single worker at a time, while workers whose search space graphs are exhausted early take over the remaining
+     * ones. Workers that find the queue empty wait until another worker returns a search space graph or until all of
+     * them are exhausted.
+     *
+     * @param best_lyt The best layout found so far, which is updated by this function.
+     * @param timeout_set Flag indicating whether a timeout was set by the user.
+     * @return The first layout found if `return_first` is set, `std::nullopt` otherwise.
+     */
+    std::optional<Lyt> explore_in_parallel(Lyt& best_lyt, const bool timeout_set)
+    {
+        std::mutex update_best_layout_mutex{};
+
+        // indices of the search space graphs that are neither exhausted nor currently being expanded
+        std::deque<std::size_t> ready_ssgs{};
+        // number of search space graphs that are currently being expanded
+        std::size_t             num_claimed_ssgs{0ul};
+        std::mutex              queue_mutex{};
+        std::condition_variable queue_changed{};
+
+        for (std::size_t i = 0; i < ssg_vec.size(); ++i)
+        {
+            if (ssg_vec[i].frontier_flag)
+            {
+                ready_ssgs.push_back(i);
+            }
+        }
+
+        std::atomic<bool> terminate{false};
+
+        uint64_t           best_cost = std::numeric_limits<uint64_t>::max();
+        std::optional<Lyt> first_layout{};
+
+        const auto store_layout = [this, &update_best_layout_mutex, &best_lyt, &best_cost, &first_layout,
+                                   &terminate](Lyt&& layout, const search_space_graph<ObstrLyt>& ssg)
+        {
+            const std::lock_guard<std::mutex> lock{update_best_layout_mutex};
+
+            // layouts may arrive out of order, so only keep the cheapest one
+            if (const auto cost = calculate_cost(layout, ps.cost); cost < best_cost || ps.return_first)
+            {
+                best_cost = cost;
+                best_lyt  = std::move(layout);
+                restore_names(ssg.network, best_lyt);
+                update_stats(best_lyt);
+
+                if (ps.return_first && !first_layout.has_value())
+                {
+                    first_layout = best_lyt;
+                    terminate    = true;
+                }
+            }
+        };
+
+        const auto worker =
+            [this, &ready_ssgs, &num_claimed_ssgs, &queue_mutex, &queue_changed, &terminate, &store_layout, timeout_set]
+        {
+            while (true)
+            {
+                std::size_t idx{};
+
+                {
+                    std::unique_lock<std::mutex> lock{queue_mutex};
+
+                    queue_changed.wait(lock, [&ready_ssgs, &num_claimed_ssgs, &terminate]
+                                       { return terminate || !ready_ssgs.empty() || num_claimed_ssgs == 0; });
+
+                    if (terminate || ready_ssgs.empty())
+                    {
+                        // either terminated or all search space graphs are exhausted
+                        return;
+                    }
+
+                    idx = ready_ssgs.front();
+                    ready_ssgs.pop_front();
+                    ++num_claimed_ssgs;
+                }
+
+                auto& ssg = ssg_vec[idx];
+
+                for (uint64_t step = 0ul; step < EXPANSIONS_PER_BATCH && ssg.frontier_flag && !terminate; ++step)
+                {
+                    if (auto result = process_ssg(ssg); result)
+                    {
+                        store_layout(std::move(*result), ssg);
+                    }
+
+                    select_next_vertex(ssg);
+                }
+
+                const auto timed_out = timeout_exceeded(timeout_set);
+
+                {
+                    const std::lock_guard<std::mutex> lock{queue_mutex};
+
+                    --num_claimed_ssgs;
+
+                    if (timed_out)
+                    {
+                        terminate = true;
+                    }
+                    else if (ssg.frontier_flag)
+                    {
+                        ready_ssgs.push_back(idx);
+                    }
+                }
+
+                // wake up waiting workers to take over this search space graph or to terminate
+                queue_changed.notify_all();
+            }
+        };
+
+        const auto num_workers =
+            std::max(std::min(ps.num_threads, static_cast<uint64_t>(ssg_vec.size())), static_cast<uint64_t>(1ul));
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_workers);
+
+        for (uint64_t i = 0ul; i < num_workers; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        return first_layout;
+    }
     /**
      * Checks if there is a path between the source and destination tiles in the given layout.
      *
@@ -1932,32 +2133,32 @@ class graph_oriented_layout_design_impl
                 {
                     case graph_oriented_layout_design_params::cost_objective::AREA:
                     {
+                        update_minimum(best_area_solution, cost);
                         improve_area_solution = true;
-                        best_area_solution    = cost;
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::WIRES:
                     {
+                        update_minimum(best_wire_solution, cost);
                         improve_wire_solution = true;
-                        best_wire_solution    = cost;
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
                     {
+                        update_minimum(best_crossing_solution, cost);
                         improve_crossing_solution = true;
-                        best_crossing_solution    = cost;
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::ACP:
                     {
+                        update_minimum(best_acp_solution, cost);
                         improve_acp_solution = true;
-                        best_acp_solution    = cost;
                         break;
                     }
                     default:
                     {
+                        update_minimum(best_custom_solution, cost);
                         improve_custom_solution = true;
-                        best_custom_solution    = cost;
                         break;
                     }
                 }
@@ -1990,10 +2191,8 @@ class graph_oriented_layout_design_impl
 
                 desired_cost = calculate_cost(layout, ps.cost);
 
-                if (desired_cost < best_optimized_solution)
+                if (update_minimum(best_optimized_solution, desired_cost))
                 {
-                    best_optimized_solution = desired_cost;
-
                     if (ps.verbose)
                     {
                         print_placement_info(layout);
@@ -2057,6 +2256,12 @@ class graph_oriented_layout_design_impl
             }
         }
 
+        // the cost of the partial layout bounds the cost of all layouts reachable from its expansions
+        if (ssg.cost != graph_oriented_layout_design_params::cost_objective::CUSTOM)
+        {
+            ssg.expansion_lower_bound = calculate_cost(layout, ssg.cost);
+        }
+
         return generate_next_positions(possible_positions, layout, ssg);
     }
     /**
@@ -2082,7 +2287,7 @@ class graph_oriented_layout_design_impl
                 {
                     ssg.cost_so_far[next] = cost;
                     double priority       = cost;
-                    ssg.frontier.put(next, priority);
+                    ssg.frontier.put(next, priority, ssg.expansion_lower_bound);
                 }
             }
         }
@@ -17,6 +17,7 @@
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
@@ -195,6 +196,8 @@ void optimize_output_positions(Lyt& lyt) noexcept
     static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
     static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
 
+    FICTION_TRACE_ZONE("post_layout_optimization::optimize_output_positions");
+
     bool optimizable = true;
 
     for (uint64_t x = 0; x <= lyt.x(); ++x)
@@ -439,6 +442,8 @@ class post_layout_optimization_impl
         // start the stopwatch to measure total optimization time
         const mockturtle::stopwatch stop{pst.time_total};
 
+        FICTION_TRACE_ZONE("post_layout_optimization");
+
         // record initial layout statistics
         pst.x_size_before        = plyt.x() + 1;
         pst.y_size_before        = plyt.y() + 1;
@@ -1079,6 +1084,8 @@ class post_layout_optimization_impl
      */
     bool improve_gate_location(ObstrLyt& lyt, const tile<ObstrLyt>& old_pos) noexcept
     {
+        FICTION_TRACE_ZONE("post_layout_optimization::improve_gate_location");
+
         const auto& [fanins, fanouts, to_clear, old_path_from_fanin_1_to_gate, old_path_from_fanin_2_to_gate,
                      old_path_from_gate_to_fanout_1, old_path_from_gate_to_fanout_2] =
             get_fanin_and_fanouts(lyt, old_pos);
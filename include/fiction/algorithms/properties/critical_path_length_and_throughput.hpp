@@ -11,8 +11,14 @@
 #include <phmap.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <map>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -36,6 +42,74 @@ struct cp_and_tp
 namespace detail
 {
 
+/**
+ * Length, delay, and path length difference of the dominant path that leads to a tile.
+ */
+struct path_info
+{
+    path_info() = default;
+    path_info(const uint64_t len, const uint64_t dly, const uint64_t dff) : length(len), delay(dly), diff(dff) {};
+
+    uint64_t length{0ull}, delay{0ull}, diff{0ull};
+
+    [[nodiscard]] bool operator==(const path_info& other) const noexcept
+    {
+        return length == other.length && delay == other.delay && diff == other.diff;
+    }
+
+    [[nodiscard]] bool operator!=(const path_info& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+/**
+ * Determines the dominant path that leads to the non-empty tile `t` from the dominant paths that lead to its incoming
+ * tiles.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt Gate-level layout.
+ * @param t Non-empty tile.
+ * @param infos Dominant paths of the incoming tiles of `t` in the order of `lyt.incoming_data_flow(t)`.
+ * @return Dominant path that leads to `t`.
+ */
+template <typename Lyt>
+[[nodiscard]] path_info dominant_path_info(const Lyt& lyt, const tile<Lyt>& t, std::vector<path_info> infos) noexcept
+{
+    if (infos.empty())
+    {
+        return {1, lyt.get_clock_number(t), 0};
+    }
+
+    path_info dominant_path{};
+
+    if (lyt.is_pi_tile(t))  // primary input to the circuit
+    {
+        infos.emplace_back(
+            1ull, static_cast<uint64_t>((lyt.get_clock_number(t) + (lyt.num_clocks() - 1)) % lyt.num_clocks()), 0ull);
+    }
+
+    if (infos.size() == 1)  // size cannot be 0
+    {
+        dominant_path = infos.front();
+    }
+    else  // fetch the highest delay and difference
+    {
+        // sort by path length
+        std::sort(infos.begin(), infos.end(), [](const auto& i1, const auto& i2) { return i1.length < i2.length; });
+
+        dominant_path.length = infos.back().length;
+        dominant_path.delay  = infos.back().delay;
+        dominant_path.diff =
+            static_cast<uint64_t>(std::abs(static_cast<int64_t>(infos.back().delay - infos.front().delay)));
+    }
+
+    // incorporate self
+    ++dominant_path.length;
+    ++dominant_path.delay;
+
+    return dominant_path;
+}
+
 template <typename Lyt>
 class critical_path_length_and_throughput_impl
 {
@@ -79,14 +153,6 @@ class critical_path_length_and_throughput_impl
      */
     cp_and_tp result;
 
-    struct path_info
-    {
-        path_info() = default;
-        path_info(const uint64_t len, const uint64_t dly, const uint64_t dff) : length(len), delay(dly), diff(dff) {};
-
-        uint64_t length{0ull}, delay{0ull}, diff{0ull};
-    };
-
     phmap::flat_hash_map<tile<Lyt>, path_info> delay_cache{};
 
     path_info signal_delay(const tile<Lyt> t) noexcept
@@ -99,7 +165,7 @@ class critical_path_length_and_throughput_impl
         const auto idf = lyt.incoming_data_flow(t);
         if (idf.empty())
         {
-            return {1, lyt.get_clock_number(t), 0};
+            return dominant_path_info(lyt, t, {});
         }
         if (const auto it = delay_cache.find(t); it != delay_cache.end())  // cache hit
         {
@@ -113,33 +179,7 @@ class critical_path_length_and_throughput_impl
         std::transform(idf.cbegin(), idf.cend(), std::back_inserter(infos),
                        [this](const auto& in_tile) { return signal_delay(in_tile); });
 
-        path_info dominant_path{};
-
-        if (lyt.is_pi_tile(t))  // primary input to the circuit
-        {
-            infos.emplace_back(
-                1ull, static_cast<uint64_t>((lyt.get_clock_number(t) + (lyt.num_clocks() - 1)) % lyt.num_clocks()),
-                0ull);
-        }
-
-        if (infos.size() == 1)  // size cannot be 0
-        {
-            dominant_path = infos.front();
-        }
-        else  // fetch the highest delay and difference
-        {
-            // sort by path length
-            std::sort(infos.begin(), infos.end(), [](const auto& i1, const auto& i2) { return i1.length < i2.length; });
-
-            dominant_path.length = infos.back().length;
-            dominant_path.delay  = infos.back().delay;
-            dominant_path.diff =
-                static_cast<uint64_t>(std::abs(static_cast<int64_t>(infos.back().delay - infos.front().delay)));
-        }
-
-        // incorporate self
-        ++dominant_path.length;
-        ++dominant_path.delay;
+        const auto dominant_path = dominant_path_info(lyt, t, std::move(infos));
 
         // cache value for gates only
         if (!lyt.is_wire_tile(t))
@@ -187,6 +227,361 @@ cp_and_tp critical_path_length_and_throughput(const Lyt& lyt)
     return p.run();
 }
 
+/**
+ * An incremental critical path length and throughput analysis for gate-level layouts. While
+ * `critical_path_length_and_throughput` computes the signal delays of all tiles from scratch on every call, this class
+ * subscribes to the layout's network events and, on each call to `update`, only re-evaluates tiles that have been
+ * touched by creating, moving, reconnecting, or removing nodes since the previous call. Changed delays are propagated
+ * through the fan-out cones of these tiles, where the propagation stops at tiles whose delays remain unchanged.
+ *
+ * This is beneficial in optimization loops that apply small modifications to large layouts and need to keep track of
+ * their critical path length and throughput.
+ *
+ * The result is identical to that of `critical_path_length_and_throughput` if all gates are in the transitive fan-in
+ * of a PO. Otherwise, path length differences at the remaining gates are taken into account for the throughput as well.
+ *
+ * The complexity of each call to `update` is \f$\mathcal{O}(|T'| \cdot \log |T| + |O|)\f$ where \f$T'\f$ is the set
+ * of re-evaluated tiles, \f$T\f$ is the set of all occupied tiles, and \f$O\f$ is the set of all POs in the layout.
+ *
+ * @note Modifications that do not stem from node manipulation, e.g., re-assigning clock numbers, are not observed.
+ * Call `invalidate` after such modifications to enforce a full re-evaluation.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+class incremental_critical_path_length_and_throughput
+{
+  public:
+    /**
+     * Standard constructor. Registers the event handlers on the given layout. The first call to `update` evaluates all
+     * tiles.
+     *
+     * @param src Gate-level layout to observe. The layout must outlive this object.
+     */
+    explicit incremental_critical_path_length_and_throughput(const Lyt& src) : lyt{src}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate layout type");
+
+        modified_event = lyt.events().register_modified_event(
+            [this](const auto& n, [[maybe_unused]] const auto& previous_children) { touch(lyt.get_tile(n)); });
+        delete_event = lyt.events().register_delete_event([this](const auto& n) { touch(lyt.get_tile(n)); });
+    }
+    /**
+     * Destructor. Releases the event handlers.
+     */
+    ~incremental_critical_path_length_and_throughput()
+    {
+        lyt.events().release_modified_event(modified_event);
+        lyt.events().release_delete_event(delete_event);
+    }
+
+    incremental_critical_path_length_and_throughput(const incremental_critical_path_length_and_throughput&) = delete;
+    incremental_critical_path_length_and_throughput(incremental_critical_path_length_and_throughput&&)      = delete;
+    incremental_critical_path_length_and_throughput&
+    operator=(const incremental_critical_path_length_and_throughput&) = delete;
+    incremental_critical_path_length_and_throughput&
+    operator=(incremental_critical_path_length_and_throughput&&) = delete;
+    /**
+     * Re-evaluates the signal delays of all tiles that could have been affected by modifications since the previous
+     * call and computes the critical path length and throughput of the observed layout.
+     *
+     * @return A struct containing the CP and TP.
+     */
+    cp_and_tp update()
+    {
+        if (full_evaluation_required)
+        {
+            timings.clear();
+            dependents.clear();
+            gate_diffs.clear();
+
+            lyt.foreach_node(
+                [this](const auto& n)
+                {
+                    if (!lyt.is_constant(n))
+                    {
+                        touch(lyt.get_tile(n));
+                    }
+                });
+
+            full_evaluation_required = false;
+        }
+        else
+        {
+            // nodes are never deleted from the storage; hence, nodes created since the last update are appended
+            for (auto n = static_cast<mockturtle::node<Lyt>>(num_known_nodes); n < lyt.size(); ++n)
+            {
+                touch(lyt.get_tile(n));
+            }
+        }
+
+        num_known_nodes = lyt.size();
+        num_reevaluated = 0;
+
+        std::vector<tile<Lyt>> pending(touched_tiles.cbegin(), touched_tiles.cend());
+
+        while (!pending.empty())
+        {
+            const auto t = pending.back();
+            pending.pop_back();
+
+            // t might have been re-evaluated already as part of another tile's fan-in
+            if (touched_tiles.count(t) > 0)
+            {
+                reevaluate(t, pending);
+            }
+        }
+
+        cp_and_tp result{};
+
+        lyt.foreach_po(
+            [this, &result](const auto& po)
+            {
+                result.critical_path_length =
+                    std::max(delay_of(static_cast<tile<Lyt>>(po)).length, result.critical_path_length);
+            });
+
+        if (!gate_diffs.empty())
+        {
+            result.throughput = gate_diffs.crbegin()->first;
+        }
+
+        // give throughput in cycles, not in phases
+        result.throughput /= lyt.num_clocks();
+
+        // convert cycle difference to throughput, i.e., x where throughput == 1/x
+        result.throughput++;
+
+        return result;
+    }
+    /**
+     * Enforces a full re-evaluation on the next call to `update`.
+     */
+    void invalidate() noexcept
+    {
+        full_evaluation_required = true;
+    }
+    /**
+     * Returns the number of tiles whose signal delays were re-evaluated during the last call to `update`.
+     *
+     * @return Number of re-evaluated tiles.
+     */
+    [[nodiscard]] std::size_t num_reevaluated_tiles() const noexcept
+    {
+        return num_reevaluated;
+    }
+
+  private:
+    /**
+     * The observed layout.
+     */
+    const Lyt lyt;
+    /**
+     * Event type for node modifications.
+     */
+    using modified_event_type =
+        typename std::remove_reference_t<decltype(std::declval<const Lyt&>().events())>::modified_event_type;
+    /**
+     * Event type for node deletions.
+     */
+    using delete_event_type =
+        typename std::remove_reference_t<decltype(std::declval<const Lyt&>().events())>::delete_event_type;
+    /**
+     * Handler for node modifications.
+     */
+    std::shared_ptr<modified_event_type> modified_event;
+    /**
+     * Handler for node deletions.
+     */
+    std::shared_ptr<delete_event_type> delete_event;
+    /**
+     * Signal delay of a tile and the incoming tiles it was derived from.
+     */
+    struct tile_timing
+    {
+        /**
+         * Dominant path that leads to the tile.
+         */
+        detail::path_info info{};
+        /**
+         * Incoming tiles at the time of the evaluation.
+         */
+        std::vector<tile<Lyt>> incoming{};
+        /**
+         * Flag to indicate that the tile's path length difference is considered for the throughput.
+         */
+        bool is_gate{false};
+    };
+    /**
+     * Flag to indicate that all tiles need to be evaluated.
+     */
+    bool full_evaluation_required{true};
+    /**
+     * Number of nodes in the layout at the time of the last update.
+     */
+    std::size_t num_known_nodes{0};
+    /**
+     * Number of tiles that were re-evaluated during the last update.
+     */
+    std::size_t num_reevaluated{0};
+    /**
+     * Tiles that need to be re-evaluated.
+     */
+    phmap::flat_hash_set<tile<Lyt>> touched_tiles{};
+    /**
+     * Signal delays of all occupied tiles.
+     */
+    phmap::flat_hash_map<tile<Lyt>, tile_timing> timings{};
+    /**
+     * Inverse of the incoming tiles stored in `timings`, i.e., tiles whose signal delays were derived from a tile.
+     */
+    phmap::flat_hash_map<tile<Lyt>, phmap::flat_hash_set<tile<Lyt>>> dependents{};
+    /**
+     * Multiset of the path length differences of all gates.
+     */
+    std::map<uint64_t, std::size_t> gate_diffs{};
+
+    /**
+     * Marks the given tile for re-evaluation.
+     *
+     * @param t Modified tile.
+     */
+    void touch(const tile<Lyt>& t)
+    {
+        if (!t.is_dead())
+        {
+            touched_tiles.insert(t);
+        }
+    }
+    /**
+     * Returns the most recently evaluated signal delay of the given tile.
+     *
+     * @param t Tile whose delay is desired.
+     * @return Dominant path that leads to `t` or an empty path if `t` is empty.
+     */
+    [[nodiscard]] detail::path_info delay_of(const tile<Lyt>& t) const noexcept
+    {
+        if (const auto it = timings.find(t); it != timings.cend())
+        {
+            return it->second.info;
+        }
+
+        return {};
+    }
+    /**
+     * Re-evaluates the signal delay of the given tile after re-evaluating its touched incoming tiles. If the delay
+     * changed, all tiles whose delays were derived from it are touched and appended to `pending`.
+     *
+     * @param t Touched tile to re-evaluate.
+     * @param pending Tiles that remain to be re-evaluated.
+     */
+    void reevaluate(const tile<Lyt>& t, std::vector<tile<Lyt>>& pending)
+    {
+        std::optional<tile_timing> timing{};
+
+        if (!lyt.is_empty_tile(t))
+        {
+            tile_timing tt{};
+            tt.incoming = lyt.incoming_data_flow(t);
+
+            std::vector<detail::path_info> infos{};
+            infos.reserve(tt.incoming.size());
+
+            for (const auto& in_tile : tt.incoming)
+            {
+                if (touched_tiles.count(in_tile) > 0)
+                {
+                    reevaluate(in_tile, pending);
+                }
+
+                infos.push_back(delay_of(in_tile));
+            }
+
+            tt.info    = detail::dominant_path_info(lyt, t, std::move(infos));
+            tt.is_gate = !tt.incoming.empty() && !lyt.is_wire_tile(t);
+
+            timing = std::move(tt);
+        }
+
+        touched_tiles.erase(t);
+        ++num_reevaluated;
+
+        if (assign(t, std::move(timing)))
+        {
+            if (const auto it = dependents.find(t); it != dependents.cend())
+            {
+                for (const auto& d : it->second)
+                {
+                    if (touched_tiles.insert(d).second)
+                    {
+                        pending.push_back(d);
+                    }
+                }
+            }
+        }
+    }
+    /**
+     * Replaces the stored signal delay of the given tile and updates `dependents` and `gate_diffs` accordingly.
+     *
+     * @param t Tile whose signal delay is to be replaced.
+     * @param timing New signal delay of `t` or `std::nullopt` if `t` is empty.
+     * @return `true` iff the dominant path that leads to `t` changed.
+     */
+    bool assign(const tile<Lyt>& t, std::optional<tile_timing> timing)
+    {
+        std::optional<detail::path_info> previous{};
+
+        if (const auto it = timings.find(t); it != timings.end())
+        {
+            previous = it->second.info;
+
+            if (it->second.is_gate)
+            {
+                if (const auto d = gate_diffs.find(it->second.info.diff); --d->second == 0)
+                {
+                    gate_diffs.erase(d);
+                }
+            }
+
+            for (const auto& in_tile : it->second.incoming)
+            {
+                if (const auto dep = dependents.find(in_tile); dep != dependents.end())
+                {
+                    dep->second.erase(t);
+
+                    if (dep->second.empty())
+                    {
+                        dependents.erase(dep);
+                    }
+                }
+            }
+
+            timings.erase(it);
+        }
+
+        if (!timing.has_value())
+        {
+            return previous.has_value();
+        }
+
+        if (timing->is_gate)
+        {
+            ++gate_diffs[timing->info.diff];
+        }
+
+        for (const auto& in_tile : timing->incoming)
+        {
+            dependents[in_tile].insert(t);
+        }
+
+        const auto changed = !previous.has_value() || *previous != timing->info;
+
+        timings.emplace(t, std::move(*timing));
+
+        return changed;
+    }
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_CRITICAL_PATH_LENGTH_AND_THROUGHPUT_HPP
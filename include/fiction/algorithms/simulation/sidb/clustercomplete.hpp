@@ -17,15 +17,23 @@
 #include "fiction/technology/sidb_cluster_hierarchy.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/tracing.hpp"
 
+#include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -91,15 +99,53 @@ struct clustercomplete_params
      */
     uint64_t num_overlapping_witnesses_limit_gss = 6;
     /**
-     * Number of threads to make available to *ClusterComplete* for the unfolding stage.
+     * Number of threads to make available to *ClusterComplete* for both the *Ground State Space* construction and the
+     * unfolding stage.
      */
     uint64_t available_threads = std::thread::hardware_concurrency();
+    /**
+     * Projected number of charge distributions below which a clustering state is unfolded entirely by the thread that
+     * holds it instead of making its compositions available to other threads. The projection is given by the simulation
+     * base raised to the number of SiDBs that are not yet resolved into singleton clusters. Lower values provide more
+     * opportunities for work stealing at the cost of synchronization overhead. Only applies to multithreaded unfolding.
+     */
+    uint64_t work_splitting_threshold = 1024;
     /**
      * Option to decide if the *Ground State Space* statistics are reported to the standard output. By default, this
      * option is disabled.
      */
     ground_state_space_reporting report_gss_stats = ground_state_space_reporting::OFF;
 };
+/**
+ * Statistics of a *ClusterComplete* simulation, which separate the runtimes of its two phases.
+ */
+struct clustercomplete_stats
+{
+    /**
+     * The total runtime of the simulation, i.e., the sum of the runtimes of both phases.
+     */
+    std::chrono::duration<double> time_total{0};
+    /**
+     * The runtime of the *Ground State Space* construction.
+     */
+    std::chrono::duration<double> time_ground_state_space{0};
+    /**
+     * The runtime of unfolding the *Ground State Space* construct into all physically valid charge distributions.
+     */
+    std::chrono::duration<double> time_unfolding{0};
+    /**
+     * Reports the statistics to the given output stream.
+     *
+     * @param out Output stream.
+     */
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total time              = {:.4f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] Ground State Space time = {:.4f} secs\n",
+                           mockturtle::to_seconds(time_ground_state_space));
+        out << fmt::format("[i] unfolding time          = {:.4f} secs\n", mockturtle::to_seconds(time_unfolding));
+    }
+};
 
 namespace detail
 {
@@ -116,6 +162,8 @@ class clustercomplete_impl
      */
     clustercomplete_impl(const Lyt& lyt, const clustercomplete_params<cell<Lyt>>& params) noexcept :
             available_threads{std::max(uint64_t{1}, params.available_threads)},
+            work_splitting_threshold{params.work_splitting_threshold},
+            simulation_base{params.simulation_parameters.base},
             charge_layout{initialize_charge_layout(lyt, params)},
             mu_bounds_with_error{constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
                                  -constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
@@ -127,9 +175,11 @@ class clustercomplete_impl
      * then destructing the result into the set of all physically valid charge distributions that are returned.
      *
      * @param params Parameter required for both the invocation of *Ground State Space*, and the simulation following.
+     * @param st Statistics to store the runtimes of both phases in.
      * @return Results of the exact simulation.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt> run(const clustercomplete_params<cell<Lyt>>& params) noexcept
+    [[nodiscard]] sidb_simulation_result<Lyt> run(const clustercomplete_params<cell<Lyt>>& params,
+                                                  clustercomplete_stats&                   st) noexcept
     {
         result.simulation_parameters = params.simulation_parameters;
         result.algorithm_name        = "ClusterComplete";
@@ -143,7 +193,10 @@ class clustercomplete_impl
         const ground_state_space_results& gss_stats = ground_state_space(
             charge_layout, ground_state_space_params{params.simulation_parameters,
                                                      params.validity_witness_partitioning_max_cluster_size_gss,
-                                                     params.num_overlapping_witnesses_limit_gss});
+                                                     params.num_overlapping_witnesses_limit_gss, available_threads});
+
+        st.time_ground_state_space = gss_stats.runtime;
+        st.time_total              = gss_stats.runtime;
 
         if (!gss_stats.top_cluster)
         {
@@ -211,8 +264,11 @@ class clustercomplete_impl
             }
         }
 
+        st.time_unfolding = time_counter;
+        st.time_total     = st.time_ground_state_space + st.time_unfolding;
+
         // The ClusterComplete runtime includes the runtime for the Ground State Space procedure
-        result.simulation_runtime = time_counter + gss_stats.runtime;
+        result.simulation_runtime = st.time_total;
 
         return result;
     }
@@ -222,6 +278,79 @@ class clustercomplete_impl
      * Forward declaration of the worker struct.
      */
     struct worker;
+    /**
+     * Keeps track of the workers that hold work and lets idle workers wait until new work becomes available or until no
+     * busy worker remains, instead of repeatedly scanning all queues.
+     */
+    struct work_availability
+    {
+        /**
+         * Number of workers that currently hold work. Since only busy workers may add work to their queues, there can
+         * be no more work once this number drops to zero.
+         */
+        std::atomic<uint64_t> num_busy_workers{0};
+        /**
+         * Number of idle workers that are looking for work to steal.
+         */
+        std::atomic<uint64_t> num_idle_workers{0};
+        /**
+         * Incremented whenever work is added to a queue or the last busy worker becomes idle.
+         */
+        std::atomic<uint64_t> generation{0};
+        /**
+         * Mutex used to wait for and to signal changes of the generation.
+         */
+        std::mutex mutex_to_protect_the_waiting;
+        /**
+         * Condition variable that idle workers wait on.
+         */
+        std::condition_variable generation_changed;
+        /**
+         * Wakes up all idle workers. Only acquires the mutex if there are idle workers.
+         */
+        void signal() noexcept
+        {
+            // sequentially consistent operations ensure that an idle worker either observes the new generation before
+            // it starts waiting or is counted here
+            generation.fetch_add(1);
+
+            if (num_idle_workers.load() != 0)
+            {
+                {
+                    // synchronize with idle workers that are about to wait such that they cannot miss the notification
+                    const std::lock_guard lock{mutex_to_protect_the_waiting};
+                }
+
+                generation_changed.notify_all();
+            }
+        }
+        /**
+         * Decrements the number of busy workers and wakes up all idle workers if no busy worker remains, since there
+         * will be no more work in that case.
+         */
+        void release_busy_worker() noexcept
+        {
+            if (num_busy_workers.fetch_sub(1) == 1)
+            {
+                signal();
+            }
+        }
+        /**
+         * Blocks until the generation differs from the given one or until no busy worker remains.
+         *
+         * @param observed_generation Generation that was observed before the queues were found empty.
+         */
+        void wait_for_change(const uint64_t observed_generation) noexcept
+        {
+            std::unique_lock lock{mutex_to_protect_the_waiting};
+
+            generation_changed.wait(lock,
+                                    [this, observed_generation] {
+                                        return generation.load() != observed_generation ||
+                                               num_busy_workers.load() == 0;
+                                    });
+        }
+    };
     /**
      * Simulation results.
      */
@@ -230,10 +359,22 @@ class clustercomplete_impl
      * Number of available threads.
      */
     const uint64_t available_threads;
+    /**
+     * Projected number of charge distributions below which a clustering state is not split among workers.
+     */
+    const uint64_t work_splitting_threshold;
+    /**
+     * The simulation base, used to project the number of charge distributions of a clustering state.
+     */
+    const uint8_t simulation_base;
     /**
      * Vector containing all workers.
      */
     std::vector<std::unique_ptr<worker>> workers{};
+    /**
+     * Coordination of busy and idle workers.
+     */
+    work_availability availability{};
     /**
      * Mutex to protect the simulation results.
      */
@@ -689,9 +830,10 @@ class clustercomplete_impl
          */
         std::deque<std::deque<work_t>> queue;
         /**
-         * Counter to keep track of the total amount of work in the double-layer work queue.
+         * Counter to keep track of the total amount of work in the double-layer work queue. It is only modified while
+         * holding the mutex below, but may be read without it such that thieves can skip empty queues without locking.
          */
-        uint64_t work_in_queue_count{0};
+        std::atomic<uint64_t> work_in_queue_count{0};
         /**
          * Mutex used to protect shared resources in this queue.
          */
@@ -813,29 +955,27 @@ class clustercomplete_impl
             return work;
         }
         /**
-         * Attempt to steal work from this queue in a non-blocking fashion. When a lock is acquired, forward-tracking is
-         * applied to dynamically update the clustering state for thieves to where it can be copied for a thief that
-         * steals the last work item in this queue.
+         * Attempt to steal work from this queue. Empty queues are skipped without acquiring the lock. Otherwise,
+         * forward-tracking is applied to dynamically update the clustering state for thieves to where it can be copied
+         * for a thief that steals the last work item in this queue.
          *
-         * @return Either `true` when the queue is locked, `false` when there is no work in this queue, or a pair of a
-         * copy of the updated (forward-tracked) clustering state for thieves along with the corresponding work item.
+         * @return Either `std::nullopt` when there is no work in this queue, or a pair of a copy of the updated
+         * (forward-tracked) clustering state for thieves along with the corresponding work item.
          */
-        [[nodiscard]] std::variant<bool, std::pair<sidb_clustering_state, work_t>> try_steal_from_this_queue() noexcept
+        [[nodiscard]] std::optional<std::pair<sidb_clustering_state, work_t>> try_steal_from_this_queue() noexcept
         {
-            const std::unique_lock lock{mutex_to_protect_this_queue, std::try_to_lock};
-
-            if (!lock.owns_lock())
+            if (work_in_queue_count.load(std::memory_order_acquire) == 0)
             {
-                // non-blocking lock attempt failed
-                return true;
+                // nothing to steal
+                return std::nullopt;
             }
 
-            // acquired lock
+            const std::lock_guard lock{mutex_to_protect_this_queue};
 
             if (work_in_queue_count == 0)
             {
-                // nothing to steal
-                return false;
+                // the remaining work was taken in the meantime
+                return std::nullopt;
             }
 
             // apply forward-tracking (opposite of backtracking) to update the clustering state for thieves such that it
@@ -883,23 +1023,31 @@ class clustercomplete_impl
          * The vector of all workers where this worker is at `ix`.
          */
         const std::vector<std::unique_ptr<worker>>& all_workers;
+        /**
+         * Coordination of busy and idle workers, shared by all workers.
+         */
+        work_availability& availability;
         /**
          * Standard constructor.
          *
          * @param ix Worker index in the vector of all workers.
          * @param num_sidbs The number of SiDBs in the layout to simulate.
          * @param workers The vector of all workers where this worker is at `ix`.
+         * @param work_avail Coordination of busy and idle workers, shared by all workers.
          */
-        worker(const uint64_t ix, const uint64_t num_sidbs,
-               const std::vector<std::unique_ptr<worker>>& workers) noexcept :
+        worker(const uint64_t ix, const uint64_t num_sidbs, const std::vector<std::unique_ptr<worker>>& workers,
+               work_availability& work_avail) noexcept :
                 index{ix},
                 work_stealing_queue{num_sidbs},
                 clustering_state{num_sidbs},
-                all_workers{workers}
+                all_workers{workers},
+                availability{work_avail}
         {}
         /**
          * Obtains work for this worker, either from their own queue, or else from another worker's queue (work
-         * stealing).
+         * stealing). A worker without work of its own keeps looking for work to steal as long as any other worker is
+         * busy, since busy workers may make new work available at any time. In between, it blocks until new work is
+         * added to any queue or until no busy worker remains.
          *
          * @return Either nothing, if no work was found (and this thread can thus terminate), or the work that was
          * obtained.
@@ -913,12 +1061,14 @@ class clustercomplete_impl
                 return std::get<work_t>(work);
             }
 
-            // no own work found, look for work until all threads have no work in their queue and are not busy
-            bool encountered_locked_queue = true;
+            // no own work found; an idle worker's queue is empty and stays empty until it steals work
+            availability.num_idle_workers.fetch_add(1);
+            availability.release_busy_worker();
 
-            while (encountered_locked_queue)
+            while (true)
             {
-                encountered_locked_queue = false;
+                // any work that is added after this observation changes the generation
+                const uint64_t observed_generation = availability.generation.load();
 
                 for (uint64_t i = 0; i < all_workers.size(); ++i)
                 {
@@ -928,24 +1078,39 @@ class clustercomplete_impl
                         continue;
                     }
 
-                    std::variant<bool, std::pair<sidb_clustering_state, work_t>> work =
-                        all_workers[i]->work_stealing_queue.try_steal_from_this_queue();
+                    if (all_workers[i]->work_stealing_queue.work_in_queue_count.load(std::memory_order_acquire) == 0)
+                    {
+                        continue;
+                    }
+
+                    // count as busy before stealing such that the stolen work is never unaccounted for
+                    availability.num_busy_workers.fetch_add(1);
 
-                    if (!std::holds_alternative<bool>(work))
+                    if (auto stolen = all_workers[i]->work_stealing_queue.try_steal_from_this_queue(); stolen)
                     {
-                        clustering_state = std::move(std::get<std::pair<sidb_clustering_state, work_t>>(work).first);
+                        availability.num_idle_workers.fetch_sub(1);
+
+                        clustering_state = std::move(stolen->first);
 
                         work_stealing_queue.initialize_queue_after_stealing(clustering_state);
 
-                        return std::get<std::pair<sidb_clustering_state, work_t>>(work).second;
+                        return stolen->second;
                     }
 
-                    encountered_locked_queue |= std::get<bool>(work);
+                    availability.release_busy_worker();
                 }
-            }
 
-            // no more work -> terminate thread
-            return std::nullopt;
+                // all queues are empty and no busy worker remains that could add to them
+                if (availability.num_busy_workers.load() == 0)
+                {
+                    availability.num_idle_workers.fetch_sub(1);
+
+                    // no more work -> terminate thread
+                    return std::nullopt;
+                }
+
+                availability.wait_for_change(observed_generation);
+            }
         }
     };
     /**
@@ -973,7 +1138,62 @@ class clustercomplete_impl
         return work_from_top_cluster;
     }
     /**
-     * Initializes the worker queues with work from the top cluster, dividing it evenly over the available threads.
+     * Projects the number of charge distributions that a composition may unfold into. This is given by the product of
+     * the numbers of compositions of its projector states, i.e., the number of clustering states on the next level.
+     *
+     * @param composition Composition to project the number of charge distributions of.
+     * @return The projected number of charge distributions, saturated at the maximum value of `uint64_t`.
+     */
+    [[nodiscard]] static uint64_t projected_state_count(const sidb_charge_space_composition& composition) noexcept
+    {
+        uint64_t count = 1;
+
+        for (const sidb_cluster_projector_state& pst : composition.proj_states)
+        {
+            const uint64_t num_compositions = std::max(uint64_t{1}, get_projector_state_compositions(pst).size());
+
+            if (count > std::numeric_limits<uint64_t>::max() / num_compositions)
+            {
+                return std::numeric_limits<uint64_t>::max();
+            }
+
+            count *= num_compositions;
+        }
+
+        return count;
+    }
+    /**
+     * Determines whether the number of charge distributions projected for the given clustering state is small enough
+     * such that its unfolding should not be split among workers. The projection is given by the simulation base raised
+     * to the number of SiDBs that are not yet resolved into singleton clusters.
+     *
+     * @param clustering_state Clustering state to project the number of charge distributions of.
+     * @return `true` iff the projected number of charge distributions is below the work splitting threshold.
+     */
+    [[nodiscard]] bool is_below_work_splitting_threshold(const sidb_clustering_state& clustering_state) const noexcept
+    {
+        // cluster sizes add up to the number of SiDBs, hence this is the number of SiDBs in non-singleton clusters
+        // minus the number of such clusters
+        const uint64_t num_unresolved_sidbs = charge_layout.num_cells() - clustering_state.proj_states.size();
+
+        uint64_t projected_count = 1;
+
+        for (uint64_t i = 0; i < num_unresolved_sidbs; ++i)
+        {
+            projected_count *= simulation_base;
+
+            if (projected_count >= work_splitting_threshold)
+            {
+                return false;
+            }
+        }
+
+        return projected_count < work_splitting_threshold;
+    }
+    /**
+     * Initializes the worker queues with work from the top cluster. The work is balanced over the available threads by
+     * its projected number of charge distributions, always assigning the next largest work item to the worker with the
+     * least projected load.
      *
      * @param work_from_top_cluster A vector containing all compositions of all charge space elements of the top
      * cluster.
@@ -983,48 +1203,55 @@ class clustercomplete_impl
         const uint64_t num_threads_with_initial_work =
             std::min(available_threads, uint64_t{work_from_top_cluster.size()});
 
-        // divide the work into sections for each thread to handle
-        std::vector<std::pair<uint64_t, uint64_t>> ranges{};
-        ranges.reserve(available_threads);
-
-        const uint64_t chunk_size = work_from_top_cluster.size() / num_threads_with_initial_work;
-        uint64_t       start      = 0;
-        uint64_t       end        = chunk_size - 1;
+        // order the work by its projected number of charge distributions, largest first
+        std::vector<std::pair<uint64_t, work_t>> projected_work{};
+        projected_work.reserve(work_from_top_cluster.size());
 
-        for (uint64_t i = 0; i < num_threads_with_initial_work; ++i)
+        for (const work_t& work : work_from_top_cluster)
         {
-            ranges.emplace_back(start, end);
-            start = end + 1;
-            end   = i == num_threads_with_initial_work - 2 ? work_from_top_cluster.size() - 1 : start + chunk_size - 1;
+            projected_work.emplace_back(projected_state_count(work.get()), work);
         }
 
+        std::stable_sort(projected_work.begin(), projected_work.end(),
+                         [](const auto& a, const auto& b) { return a.first > b.first; });
+
         workers.reserve(available_threads);
 
-        // for each worker, add work to the queue from the respectively assigned section
         for (uint64_t i = 0; i < num_threads_with_initial_work; ++i)
         {
-            std::unique_ptr<worker> w = std::make_unique<worker>(i, charge_layout.num_cells(), workers);
+            workers.emplace_back(std::make_unique<worker>(i, charge_layout.num_cells(), workers, availability));
+            workers.back()->work_stealing_queue.queue.emplace_front();
+        }
 
-            w->work_stealing_queue.queue.emplace_front();
+        // assign each work item to the worker with the least projected load
+        std::vector<uint64_t> projected_loads(num_threads_with_initial_work, 0);
 
-            const auto& [i_start, i_end] = ranges.at(i);
+        for (const auto& [count, work] : projected_work)
+        {
+            const auto least_loaded = static_cast<uint64_t>(std::distance(
+                projected_loads.cbegin(), std::min_element(projected_loads.cbegin(), projected_loads.cend())));
 
-            // fill queue with work
-            for (uint64_t work_ix = i_start; work_ix <= i_end; ++work_ix)
-            {
-                w->work_stealing_queue.queue.front().emplace_front(work_from_top_cluster.at(work_ix));
-            }
+            // saturating addition
+            auto& load = projected_loads[least_loaded];
+            load += std::min(count, std::numeric_limits<uint64_t>::max() - load);
 
-            w->work_stealing_queue.work_in_queue_count = w->work_stealing_queue.queue.front().size();
+            workers[least_loaded]->work_stealing_queue.queue.front().emplace_front(work);
+        }
 
-            workers.emplace_back(std::move(w));
+        for (uint64_t i = 0; i < num_threads_with_initial_work; ++i)
+        {
+            workers[i]->work_stealing_queue.work_in_queue_count = workers[i]->work_stealing_queue.queue.front().size();
         }
 
         // initialize each worker that did not get initial work as thieves
-        for (uint64_t thread_ix = 0; thread_ix < available_threads - num_threads_with_initial_work; ++thread_ix)
+        while (workers.size() < available_threads)
         {
-            workers.emplace_back(std::make_unique<worker>(thread_ix, charge_layout.num_cells(), workers));
+            workers.emplace_back(
+                std::make_unique<worker>(workers.size(), charge_layout.num_cells(), workers, availability));
         }
+
+        // all workers start out busy and only count themselves as idle once they found their own queue to be empty
+        availability.num_busy_workers = available_threads;
     }
     /**
      * This recursive function is the heart of the *ClusterComplete* destruction. The given clustering state is
@@ -1041,6 +1268,10 @@ class clustercomplete_impl
      * clusters and passes the population stability check. In the latter case, the configuration stability check is
      * performed before the associated charge distribution is added to the simulation results.
      *
+     * Clustering states that are projected to unfold into fewer charge distributions than the work splitting threshold
+     * are unfolded without making their compositions available to other workers, which avoids synchronization for work
+     * items that are too small to be worth stealing.
+     *
      * @param w The worker running on the current thread. It has a clustering state that holds a specific combination of
      * multiset charge configurations as projector states of which the respectively associated clusters form a
      * clustering in the cluster hierarchy.
@@ -1053,6 +1284,13 @@ class clustercomplete_impl
     [[nodiscard]] bool
     add_physically_valid_charge_configurations(worker& w, const sidb_charge_space_composition& composition) noexcept
     {
+        // small clustering states are unfolded on this thread without making work available to thieves
+        if (is_below_work_splitting_threshold(w.clustering_state))
+        {
+            add_physically_valid_charge_configurations(w.clustering_state);
+            return true;
+        }
+
         // check for pruning
         if (!meets_population_stability_criterion(w.clustering_state))
         {
@@ -1112,6 +1350,12 @@ class clustercomplete_impl
 
         w.work_stealing_queue.add_to_queue(compositions, std::move(informant));
 
+        if (compositions.size() > 1)
+        {
+            // wake up idle workers to steal the added work
+            w.availability.signal();
+        }
+
         // unfold first composition
         unfold_composition(w, compositions.front());
 
@@ -1184,16 +1428,29 @@ class clustercomplete_impl
  * @tparam Lyt SiDB cell-level layout type.
  * @param lyt Layout to simulate.
  * @param params Parameter required for both the invocation of *Ground State Space*, and the simulation following.
+ * @param pst Statistics. They separate the runtime of the *Ground State Space* construction from that of the unfolding.
  * @return Simulation results.
  */
 template <typename Lyt>
-[[nodiscard]] sidb_simulation_result<Lyt> clustercomplete(const Lyt&                               lyt,
-                                                          const clustercomplete_params<cell<Lyt>>& params = {}) noexcept
+[[nodiscard]] sidb_simulation_result<Lyt>
+clustercomplete(const Lyt& lyt, const clustercomplete_params<cell<Lyt>>& params = {},
+                clustercomplete_stats* pst = nullptr) noexcept
 {
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
-    return detail::clustercomplete_impl<Lyt>{lyt, params}.run(params);
+    FICTION_TRACE_ZONE("clustercomplete");
+
+    clustercomplete_stats st{};
+
+    auto result = detail::clustercomplete_impl<Lyt>{lyt, params}.run(params, st);
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
 }
 
 }  // namespace fiction
@@ -188,41 +188,66 @@ class critical_temperature_impl
                     critical_temperature = 0.0;
                     return;
                 }
-                stats.num_valid_lyt = sim_result.charge_distributions.size();
-                // The energy distribution of the physically valid charge configurations for the given layout is
-                // determined.
-                const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
 
-                sidb_energy_and_state_type energy_state_type{};
+                gate_based_simulation_of_input(sim_result, spec, i, output_bdl_pairs, input_bdl_wires,
+                                               output_bdl_wires);
+            }
+        }
+    }
+    /**
+     * Updates the *Gate-based Critical Temperature* with the physically valid charge distributions of the layout at a
+     * single input combination. Thereby, the critical temperature can be determined from simulation results that are
+     * shared with other figures of merit.
+     *
+     * @tparam TT Type of the truth table.
+     * @param sim_result Physically valid charge distributions of the layout at the given input combination. Must not be
+     * empty.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param input_index Index of the input combination.
+     * @param output_bdl_pairs Output BDL pairs of the layout.
+     * @param input_bdl_wires Input BDL wires of the layout (only required if kinks are rejected).
+     * @param output_bdl_wires Output BDL wires of the layout (only required if kinks are rejected).
+     */
+    template <typename TT>
+    void gate_based_simulation_of_input(const sidb_simulation_result<Lyt>& sim_result, const std::vector<TT>& spec,
+                                        const uint64_t                          input_index,
+                                        const std::vector<bdl_pair<cell<Lyt>>>& output_bdl_pairs,
+                                        const std::vector<bdl_wire<Lyt>>&       input_bdl_wires,
+                                        std::vector<bdl_wire<Lyt>>&             output_bdl_wires) noexcept
+    {
+        assert(!sim_result.charge_distributions.empty() && "simulation result must not be empty");
 
-                if (params.operational_params.op_condition ==
-                    is_operational_params::operational_condition::REJECT_KINKS)
-                {
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_rejected<Lyt>(
-                        distribution, sim_result.charge_distributions, spec, i, input_bdl_wires, output_bdl_wires);
-                }
-                else
-                {
-                    // A label that indicates whether the state still fulfills the logic.
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_accepted<Lyt>(
-                        distribution, sim_result.charge_distributions, output_bdl_pairs, spec, i);
-                }
+        stats.num_valid_lyt = sim_result.charge_distributions.size();
+        // The energy distribution of the physically valid charge configurations for the given layout is determined.
+        const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
 
-                const auto min_energy = energy_state_type.cbegin()->first;
+        sidb_energy_and_state_type energy_state_type{};
 
-                auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
+        if (params.operational_params.op_condition == is_operational_params::operational_condition::REJECT_KINKS)
+        {
+            energy_state_type = calculate_energy_and_state_type_with_kinks_rejected<Lyt>(
+                distribution, sim_result.charge_distributions, spec, input_index, input_bdl_wires, output_bdl_wires);
+        }
+        else
+        {
+            // A label that indicates whether the state still fulfills the logic.
+            energy_state_type = calculate_energy_and_state_type_with_kinks_accepted<Lyt>(
+                distribution, sim_result.charge_distributions, output_bdl_pairs, spec, input_index);
+        }
 
-                if (ground_state_is_transparent)
-                {
-                    this->determine_critical_temperature(energy_state_type);
-                }
+        const auto min_energy = energy_state_type.cbegin()->first;
 
-                else
-                {
-                    critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
-                                                 // Temperature is zero. May be worth it to change µ_.
-                }
-            }
+        auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
+
+        if (ground_state_is_transparent)
+        {
+            this->determine_critical_temperature(energy_state_type);
+        }
+
+        else
+        {
+            critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
+                                         // Temperature is zero. May be worth it to change µ_.
         }
     }
 
@@ -327,6 +352,57 @@ class critical_temperature_impl
             }
         }
     }
+    /**
+     * This function conducts physical simulation of the given layout (gate layout with certain input combination).
+     * The simulation results are stored in the `sim_result_100` variable.
+     *
+     * @param bdl_iterator A reference to a BDL input iterator representing the gate layout at a given input
+     * combination. The simulation is performed based on the configuration represented by the iterator.
+     * @return Simulation results.
+     */
+    [[nodiscard]] sidb_simulation_result<Lyt>
+    physical_simulation_of_bdl_iterator(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
+    {
+        if (params.operational_params.sim_engine == sidb_simulation_engine::EXGS)
+        {
+            // perform exhaustive ground state simulation
+            return exhaustive_ground_state_simulation(*bdl_iterator, params.operational_params.simulation_parameters);
+        }
+        if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKEXACT)
+        {
+            // perform QuickExact exact simulation
+            const quickexact_params<cell<Lyt>> qe_params{
+                params.operational_params.simulation_parameters,
+                fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
+            return quickexact(*bdl_iterator, qe_params);
+        }
+#if (FICTION_ALGLIB_ENABLED)
+        if (params.operational_params.sim_engine == sidb_simulation_engine::CLUSTERCOMPLETE)
+        {
+            // perform ClusterComplete exact simulation
+            const clustercomplete_params<cell<Lyt>> cc_params{params.operational_params.simulation_parameters};
+            return clustercomplete(*bdl_iterator, cc_params);
+        }
+#endif  // FICTION_ALGLIB_ENABLED
+        if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKSIM)
+        {
+            assert(params.operational_params.simulation_parameters.base == 2 &&
+                   "QuickSim does not support base-3 simulation");
+
+            const quicksim_params qs_params{params.operational_params.simulation_parameters, params.iteration_steps,
+                                            params.alpha};
+
+            if (const auto result = quicksim<Lyt>(*bdl_iterator, qs_params))
+            {
+                return result.value();
+            }
+            return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
+        }
+
+        assert(false && "unsupported simulation engine");
+
+        return sidb_simulation_result<Lyt>{};
+    }
     /**
      * Returns the critical temperature.
      *
@@ -429,57 +505,6 @@ class critical_temperature_impl
      * Critical temperature [K].
      */
     double critical_temperature;
-    /**
-     * This function conducts physical simulation of the given layout (gate layout with certain input combination).
-     * The simulation results are stored in the `sim_result_100` variable.
-     *
-     * @param bdl_iterator A reference to a BDL input iterator representing the gate layout at a given input
-     * combination. The simulation is performed based on the configuration represented by the iterator.
-     * @return Simulation results.
-     */
-    [[nodiscard]] sidb_simulation_result<Lyt>
-    physical_simulation_of_bdl_iterator(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
-    {
-        if (params.operational_params.sim_engine == sidb_simulation_engine::EXGS)
-        {
-            // perform exhaustive ground state simulation
-            return exhaustive_ground_state_simulation(*bdl_iterator, params.operational_params.simulation_parameters);
-        }
-        if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKEXACT)
-        {
-            // perform QuickExact exact simulation
-            const quickexact_params<cell<Lyt>> qe_params{
-                params.operational_params.simulation_parameters,
-                fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-            return quickexact(*bdl_iterator, qe_params);
-        }
-#if (FICTION_ALGLIB_ENABLED)
-        if (params.operational_params.sim_engine == sidb_simulation_engine::CLUSTERCOMPLETE)
-        {
-            // perform ClusterComplete exact simulation
-            const clustercomplete_params<cell<Lyt>> cc_params{params.operational_params.simulation_parameters};
-            return clustercomplete(*bdl_iterator, cc_params);
-        }
-#endif  // FICTION_ALGLIB_ENABLED
-        if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKSIM)
-        {
-            assert(params.operational_params.simulation_parameters.base == 2 &&
-                   "QuickSim does not support base-3 simulation");
-
-            const quicksim_params qs_params{params.operational_params.simulation_parameters, params.iteration_steps,
-                                            params.alpha};
-
-            if (const auto result = quicksim<Lyt>(*bdl_iterator, qs_params))
-            {
-                return result.value();
-            }
-            return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
-        }
-
-        assert(false && "unsupported simulation engine");
-
-        return sidb_simulation_result<Lyt>{};
-    }
 };
 
 }  // namespace detail
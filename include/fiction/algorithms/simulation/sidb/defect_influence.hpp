@@ -15,8 +15,11 @@
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
+#include "fiction/utils/checkpoint_utils.hpp"
 #include "fiction/utils/layout_utils.hpp"
 
+#include <fmt/format.h>
+#include <kitty/print.hpp>
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
@@ -25,8 +28,14 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
+#include <istream>
+#include <iterator>
 #include <optional>
+#include <ostream>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_set>
 #include <vector>
@@ -72,6 +81,18 @@ struct defect_influence_params
      * Definition of defect influence.
      */
     influence_definition influence_def{influence_definition::OPERATIONALITY_CHANGE};
+    /**
+     * Path of a checkpoint file. If non-empty, the evaluated defect positions are periodically written to this file. If
+     * the file already exists when the computation starts, the defect positions stored in it are restored instead of
+     * being re-evaluated, which allows to resume interrupted sweeps. The first line of the file holds a fingerprint of
+     * the layout, the specification, and all parameters (see `periodic_checkpoint`), i.e., the checkpoint must have
+     * been created for the same layout, specification, defect, and parameters.
+     */
+    std::string checkpoint_file{};
+    /**
+     * Number of evaluated defect positions after which the checkpoint file is updated.
+     */
+    std::size_t checkpoint_interval{1000};
 };
 
 /**
@@ -127,6 +148,14 @@ struct defect_influence_stats
      * Number of parameter combinations, for which the layout is not influenced.
      */
     std::size_t num_non_influencing_defect_positions{0};
+    /**
+     * Number of defect positions that were restored from the checkpoint file instead of being evaluated.
+     */
+    std::size_t num_restored_defect_positions{0};
+    /**
+     * Number of checkpoints that were written.
+     */
+    std::size_t num_checkpoints{0};
 };
 
 namespace detail
@@ -136,14 +165,67 @@ template <typename Lyt>
 class defect_influence_impl
 {
   public:
-    defect_influence_impl(const Lyt& lyt, const defect_influence_params<cell<Lyt>>& ps, defect_influence_stats& st) :
+    /**
+     * Standard constructor.
+     *
+     * @tparam TT Truth table type.
+     * @param lyt SiDB cell-level layout to investigate.
+     * @param ps Parameters for the defect influence domain computation.
+     * @param st Statistics of the defect influence domain computation.
+     * @param spec Expected Boolean function of the layout, if any. It is part of the checkpoint fingerprint.
+     */
+    template <typename TT = tt>
+    defect_influence_impl(const Lyt& lyt, const defect_influence_params<cell<Lyt>>& ps, defect_influence_stats& st,
+                          const std::optional<std::vector<TT>>& spec = std::nullopt) :
             layout{lyt},
             params{ps},
-            stats{st}
+            stats{st},
+            checkpoint{params.checkpoint_file, params.checkpoint_interval, checkpoint_fingerprint(spec)}
     {
         determine_nw_se_cells();
     }
 
+    /**
+     * Restores the defect positions stored in the checkpoint file, if one is specified and exists. Restored positions
+     * are not re-evaluated by any of the defect influence computation algorithms.
+     *
+     * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+     * specification, defect, or parameters.
+     */
+    void restore_checkpoint()
+    {
+        checkpoint.restore(
+            [this](std::istream& is)
+            {
+                std::string magic{};
+
+                if (!std::getline(is, magic) || magic != CHECKPOINT_MAGIC)
+                {
+                    throw std::invalid_argument("malformed defect influence checkpoint file");
+                }
+
+                int64_t x{};
+                int64_t y{};
+                int64_t z{};
+                int64_t status{};
+
+                while (is >> x >> y >> z >> status)
+                {
+                    influence_domain.add_value(
+                        typename Lyt::cell{x, y, z},
+                        {status == static_cast<int64_t>(defect_influence_status::INFLUENTIAL) ?
+                             defect_influence_status::INFLUENTIAL :
+                             defect_influence_status::NON_INFLUENTIAL});
+
+                    ++stats.num_restored_defect_positions;
+                }
+
+                if (!is.eof())
+                {
+                    throw std::invalid_argument("malformed defect influence checkpoint file");
+                }
+            });
+    }
     /**
      * Simulates for each position in the area (spanned by `nw_cell` and `se_cell`) if the existence of a
      * defect influences the layout.
@@ -202,6 +284,8 @@ class defect_influence_impl
             }
         }
 
+        save_checkpoint();
+
         log_stats();
 
         return influence_domain;
@@ -268,6 +352,8 @@ class defect_influence_impl
             }
         }
 
+        save_checkpoint();
+
         log_stats();  // Log the statistics after processing
 
         // Return the computed defect influence domain
@@ -402,6 +488,8 @@ class defect_influence_impl
                 next_point           = next_clockwise_point(current_neighborhood, backtrack_point);
             }
         }
+        save_checkpoint();
+
         log_stats();
 
         return influence_domain;
@@ -468,6 +556,14 @@ class defect_influence_impl
      * Number of available hardware threads.
      */
     const std::size_t num_threads{std::thread::hardware_concurrency()};
+    /**
+     * First line of a defect influence checkpoint file.
+     */
+    static constexpr const char* CHECKPOINT_MAGIC = "fiction defect influence checkpoint v2";
+    /**
+     * Periodically writes the evaluated defect positions to the checkpoint file, if one is specified.
+     */
+    periodic_checkpoint checkpoint;
     /**
      * This function determines the northwest and southeast cells based on the layout and the additional scan
      * area specified.
@@ -547,6 +643,7 @@ class defect_influence_impl
         {
             ++num_simulator_invocations;
             influence_domain.add_value(defect_cell, {defect_influence_status::NON_INFLUENTIAL});
+            record_checkpoint();
 
             return defect_influence_status::NON_INFLUENTIAL;
         };
@@ -555,6 +652,7 @@ class defect_influence_impl
         {
             ++num_simulator_invocations;
             influence_domain.add_value(defect_cell, {defect_influence_status::INFLUENTIAL});
+            record_checkpoint();
 
             return defect_influence_status::INFLUENTIAL;
         };
@@ -729,6 +827,75 @@ class defect_influence_impl
 
         return latest_non_influential_defect_position;
     }
+    /**
+     * Computes the fingerprint of all inputs that determine the evaluated defect positions, i.e., the layout, the
+     * specification, the defect, the scanning area, the definition of influence, and the operational parameters.
+     *
+     * @tparam TT Truth table type.
+     * @param spec Expected Boolean function of the layout, if any.
+     * @return Fingerprint to identify checkpoints of this computation, or 0 if no checkpoint file is specified.
+     */
+    template <typename TT>
+    [[nodiscard]] uint64_t checkpoint_fingerprint(const std::optional<std::vector<TT>>& spec) const
+    {
+        if (params.checkpoint_file.empty())
+        {
+            return 0;
+        }
+
+        fmt::memory_buffer buffer{};
+
+        if (spec.has_value())
+        {
+            for (const auto& tt : spec.value())
+            {
+                fmt::format_to(std::back_inserter(buffer), "{}:{};", tt.num_vars(), kitty::to_hex(tt));
+            }
+        }
+        else
+        {
+            fmt::format_to(std::back_inserter(buffer), "none");
+        }
+
+        fmt::format_to(std::back_inserter(buffer), "|{},{},{},{}|{},{}|{}", static_cast<uint16_t>(params.defect.type),
+                       params.defect.charge, params.defect.epsilon_r, params.defect.lambda_tf,
+                       params.additional_scanning_area.x, params.additional_scanning_area.y,
+                       static_cast<uint16_t>(params.influence_def));
+
+        return operational_assessment_fingerprint(layout, params.operational_params,
+                                                  fingerprint_inputs(std::string_view{buffer.data(), buffer.size()}));
+    }
+    /**
+     * Writes the current defect influence domain to the checkpoint file. The first line holds a magic string and every
+     * following line a defect position as `x y z status`.
+     *
+     * @param os Output stream of the checkpoint file.
+     */
+    void write_checkpoint(std::ostream& os) const
+    {
+        os << CHECKPOINT_MAGIC << '\n';
+
+        influence_domain.for_each(
+            [&os](const auto& defect_pos, const auto& status)
+            {
+                os << static_cast<int64_t>(defect_pos.x) << ' ' << static_cast<int64_t>(defect_pos.y) << ' '
+                   << static_cast<int64_t>(defect_pos.z) << ' ' << static_cast<int64_t>(std::get<0>(status)) << '\n';
+            });
+    }
+    /**
+     * Reports an evaluated defect position to the checkpoint, which is written if it is due.
+     */
+    void record_checkpoint() noexcept
+    {
+        checkpoint.record([this](std::ostream& os) { write_checkpoint(os); });
+    }
+    /**
+     * Writes the final checkpoint after the computation has finished.
+     */
+    void save_checkpoint() noexcept
+    {
+        static_cast<void>(checkpoint.save([this](std::ostream& os) { write_checkpoint(os); }));
+    }
     /**
      * Helper function that writes the the statistics of the defect influence domain computation to the statistics
      * object.
@@ -737,6 +904,7 @@ class defect_influence_impl
     {
         stats.num_simulator_invocations      = num_simulator_invocations.load();
         stats.num_evaluated_defect_positions = num_evaluated_defect_positions.load();
+        stats.num_checkpoints                = checkpoint.num_checkpoints();
 
         influence_domain.for_each(
             [this](const auto& defect_pos [[maybe_unused]], const auto& status)
@@ -858,6 +1026,8 @@ class defect_influence_impl
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -871,7 +1041,10 @@ defect_influence_grid_search(const Lyt& lyt, const std::vector<TT>& spec,
     static_assert(has_cube_coord_v<Lyt>, "Lyt is not based on cube coordinates");
 
     defect_influence_stats             st{};
-    detail::defect_influence_impl<Lyt> p{lyt, params, st};
+    detail::defect_influence_impl<Lyt> p{lyt, params, st, std::optional{spec}};
+
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
 
     const auto result = p.grid_search(step_size, std::optional{spec});
 
@@ -893,6 +1066,8 @@ defect_influence_grid_search(const Lyt& lyt, const std::vector<TT>& spec,
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -906,6 +1081,9 @@ defect_influence_grid_search(const Lyt& lyt, const defect_influence_params<cell<
     defect_influence_stats             st{};
     detail::defect_influence_impl<Lyt> p{lyt, params, st};
 
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
+
     const auto result = p.grid_search(step_size);
 
     if (stats)
@@ -927,6 +1105,8 @@ defect_influence_grid_search(const Lyt& lyt, const defect_influence_params<cell<
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -940,7 +1120,10 @@ defect_influence_random_sampling(const Lyt& lyt, const std::vector<TT>& spec, st
     static_assert(has_cube_coord_v<Lyt>, "Lyt is not based on cube coordinates");
 
     defect_influence_stats             st{};
-    detail::defect_influence_impl<Lyt> p{lyt, params, st};
+    detail::defect_influence_impl<Lyt> p{lyt, params, st, std::optional{spec}};
+
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
 
     const auto result = p.random_sampling(samples, std::optional{spec});
 
@@ -962,6 +1145,8 @@ defect_influence_random_sampling(const Lyt& lyt, const std::vector<TT>& spec, st
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -976,6 +1161,9 @@ defect_influence_random_sampling(const Lyt& lyt, std::size_t samples,
     defect_influence_stats             st{};
     detail::defect_influence_impl<Lyt> p{lyt, params, st};
 
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
+
     const auto result = p.random_sampling(samples);
 
     if (stats)
@@ -1022,6 +1210,8 @@ defect_influence_random_sampling(const Lyt& lyt, std::size_t samples,
  * @param params Defect influence domain computation parameters.
  * @param stats Defect influence computation statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -1034,7 +1224,10 @@ defect_influence_quicktrace(const Lyt& lyt, const std::vector<TT>& spec, const s
     static_assert(has_cube_coord_v<Lyt>, "Lyt is not based on cube coordinates");
 
     defect_influence_stats             st{};
-    detail::defect_influence_impl<Lyt> p{lyt, params, st};
+    detail::defect_influence_impl<Lyt> p{lyt, params, st, std::optional{spec}};
+
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
 
     const auto result = p.quicktrace(samples, std::optional{spec});
 
@@ -1073,6 +1266,8 @@ defect_influence_quicktrace(const Lyt& lyt, const std::vector<TT>& spec, const s
  * @param params Defect influence domain computation parameters.
  * @param stats Defect influence computation statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the checkpoint file is malformed or was created for a different layout,
+ * specification, defect, or parameters.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -1087,6 +1282,9 @@ defect_influence_quicktrace(const Lyt& lyt, const std::size_t samples,
     defect_influence_stats             st{};
     detail::defect_influence_impl<Lyt> p{lyt, params, st};
 
+    // this may throw an `std::invalid_argument` exception
+    p.restore_checkpoint();
+
     const auto result = p.quicktrace(samples);
 
     if (stats)
@@ -10,6 +10,7 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
@@ -40,6 +41,8 @@ exhaustive_ground_state_simulation(const Lyt&                        lyt,
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
+    FICTION_TRACE_ZONE("exhaustive_ground_state_simulation");
+
     sidb_simulation_result<Lyt> simulation_result{};
     simulation_result.algorithm_name        = "ExGS";
     simulation_result.simulation_parameters = params;
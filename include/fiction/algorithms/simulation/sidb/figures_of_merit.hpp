@@ -0,0 +1,558 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_FIGURES_OF_MERIT_HPP
+#define FICTION_FIGURES_OF_MERIT_HPP
+
+#include "fiction/algorithms/iter/bdl_input_iterator.hpp"
+#include "fiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp"
+#include "fiction/algorithms/simulation/sidb/critical_temperature.hpp"
+#include "fiction/algorithms/simulation/sidb/defect_clearance.hpp"
+#include "fiction/algorithms/simulation/sidb/defect_influence.hpp"
+#include "fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp"
+#include "fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp"
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain.hpp"
+#include "fiction/algorithms/simulation/sidb/physical_population_stability.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+#include "fiction/traits.hpp"
+
+#include <kitty/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Parameters for the evaluation of figures of merit.
+ *
+ * @tparam CellType Cell type of the layout.
+ */
+template <typename CellType>
+struct figures_of_merit_params
+{
+    /**
+     * Parameters that determine the simulation of all input combinations at the nominal physical parameters. The
+     * resulting charge distributions are shared by the critical temperature and the band bending resilience. Since the
+     * band bending resilience requires the exact ground state, input combinations are simulated again with
+     * *QuickExact* for it if the charge distributions were obtained by a heuristic engine or with too few charge
+     * states.
+     */
+    is_operational_params operational_params{};
+    /**
+     * Flag to indicate whether the gate-based critical temperature is evaluated.
+     */
+    bool evaluate_critical_temperature{true};
+    /**
+     * Confidence level of the critical temperature (see `critical_temperature_params`).
+     */
+    double confidence_level{0.99};
+    /**
+     * Maximum temperature considered for the critical temperature (unit: K).
+     */
+    double max_temperature{400};
+    /**
+     * Flag to indicate whether the band bending resilience is evaluated.
+     */
+    bool evaluate_band_bending_resilience{true};
+    /**
+     * Flag to indicate whether the ratio of operational parameter points is evaluated via a grid search of the
+     * operational domain.
+     */
+    bool evaluate_operational_domain{false};
+    /**
+     * Parameters for the grid search of the operational domain.
+     */
+    operational_domain_params op_domain_params{};
+    /**
+     * Defects for each of which the defect clearance is evaluated via a grid search of the defect influence domain.
+     * Requires a layout based on cube coordinates if non-empty.
+     */
+    std::vector<sidb_defect> defects{};
+    /**
+     * Parameters for the defect influence grid searches. The defect is replaced by each of `defects`.
+     */
+    defect_influence_params<CellType> defect_params{};
+    /**
+     * Step size of the defect influence grid searches.
+     */
+    std::size_t defect_step_size{1};
+    /**
+     * Number of threads to use. The simulations of the input combinations, the operational domain, and the defect
+     * influence domains are distributed among them.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+};
+/**
+ * Figures of merit of an SiDB gate layout as proposed in \"Unifying Figures of Merit: A Versatile Cost Function for
+ * Silicon Dangling Bond Logic\" by J. Drewniok, M. Walter, S. S. H. Ng, K. Walus, and R. Wille in IEEE NANO 2024
+ * (https://ieeexplore.ieee.org/abstract/document/10628671). Figures of merit that were not requested are left empty.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+struct figures_of_merit
+{
+    /**
+     * Gate-based critical temperature (unit: K).
+     */
+    std::optional<double> critical_temperature{};
+    /**
+     * Minimum electrostatic potential required to induce a charge change in the ground state of any input combination
+     * (unit: V).
+     */
+    std::optional<double> band_bending_resilience{};
+    /**
+     * Population stability of the ground state for each input combination. It is `std::nullopt` for input combinations
+     * without physically valid charge distributions.
+     */
+    std::vector<std::optional<population_stability_information<Lyt>>> ground_state_population_stability{};
+    /**
+     * Ratio of operational parameter points to all parameter points of the operational domain grid search.
+     */
+    std::optional<double> operational_domain_ratio{};
+    /**
+     * Defect clearance for each of the requested defects in the same order.
+     */
+    std::vector<defect_clearance<cell<Lyt>>> defect_clearances{};
+};
+/**
+ * Statistics for the evaluation of figures of merit.
+ */
+struct figures_of_merit_stats
+{
+    /**
+     * Total runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of input combinations that were simulated at the nominal physical parameters.
+     */
+    std::size_t num_simulations{0};
+};
+
+namespace detail
+{
+
+/**
+ * Implementation of `evaluate_figures_of_merit`. It distributes the simulations of all input combinations and the grid
+ * searches among multiple threads and combines their results.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ */
+template <typename Lyt, typename TT>
+class figures_of_merit_impl
+{
+  public:
+    /**
+     * Standard constructor. Detects the BDL pairs and wires of the layout, which are shared by all input combinations.
+     *
+     * @param lyt The gate layout to evaluate.
+     * @param tt Expected Boolean function of the layout given as a multi-output truth table.
+     * @param ps Parameters.
+     * @param st Statistics.
+     */
+    figures_of_merit_impl(const Lyt& lyt, const std::vector<TT>& tt, const figures_of_merit_params<cell<Lyt>>& ps,
+                          figures_of_merit_stats& st) :
+            layout{lyt},
+            spec{tt},
+            params{ps},
+            stats{st},
+            ct_params{ps.operational_params, ps.confidence_level, ps.max_temperature},
+            output_bdl_pairs{detect_bdl_pairs(lyt, sidb_technology::cell_type::OUTPUT,
+                                              ps.operational_params.input_bdl_iterator_params.bdl_wire_params
+                                                  .bdl_pairs_params)},
+            input_bdl_wires{detect_bdl_wires(lyt, ps.operational_params.input_bdl_iterator_params.bdl_wire_params,
+                                             bdl_wire_selection::INPUT)},
+            output_bdl_wires{detect_bdl_wires(lyt, ps.operational_params.input_bdl_iterator_params.bdl_wire_params,
+                                              bdl_wire_selection::OUTPUT)}
+    {}
+    /**
+     * Evaluates all requested figures of merit.
+     *
+     * @return The requested figures of merit of the layout.
+     * @throws std::invalid_argument if defects are given but the layout is not based on cube coordinates, if the
+     * operational domain sweep parameters are invalid, or if a checkpoint file does not match.
+     */
+    [[nodiscard]] figures_of_merit<Lyt> run()
+    {
+        mockturtle::stopwatch stop{stats.time_total};
+
+        figures_of_merit<Lyt> result{};
+
+        std::vector<std::function<void()>> tasks{};
+
+        // the sweeps cannot reuse the nominal simulations and take the longest, so they are started first
+        if (params.evaluate_operational_domain)
+        {
+            tasks.emplace_back([this, &result] { result.operational_domain_ratio = evaluate_operational_domain(); });
+        }
+
+        if constexpr (has_cube_coord_v<Lyt>)
+        {
+            result.defect_clearances.resize(params.defects.size());
+
+            for (auto i = 0ul; i < params.defects.size(); ++i)
+            {
+                tasks.emplace_back([this, &result, i]
+                                   { result.defect_clearances[i] = evaluate_defect_clearance(params.defects[i]); });
+            }
+        }
+        else
+        {
+            if (!params.defects.empty())
+            {
+                throw std::invalid_argument("defect clearance requires a layout based on cube coordinates");
+            }
+        }
+
+        const auto num_input_combinations = spec.front().num_bits();
+
+        std::vector<input_combination_figures> input_figures{};
+
+        if (params.evaluate_critical_temperature || params.evaluate_band_bending_resilience)
+        {
+            input_figures.resize(num_input_combinations);
+
+            for (auto i = 0ul; i < num_input_combinations; ++i)
+            {
+                tasks.emplace_back([this, &input_figures, i] { input_figures[i] = evaluate_input_combination(i); });
+            }
+        }
+
+        execute(tasks);
+
+        if (params.evaluate_critical_temperature)
+        {
+            // the critical temperature of the gate is the minimum among all input combinations
+            result.critical_temperature = params.max_temperature;
+
+            for (const auto& figures : input_figures)
+            {
+                result.critical_temperature = std::min(*result.critical_temperature, figures.critical_temperature);
+            }
+        }
+
+        if (params.evaluate_band_bending_resilience)
+        {
+            result.band_bending_resilience = std::numeric_limits<double>::infinity();
+            result.ground_state_population_stability.reserve(num_input_combinations);
+
+            for (const auto& figures : input_figures)
+            {
+                if (figures.ground_state_stability.has_value())
+                {
+                    for (const auto& transition : figures.ground_state_stability->transition_potentials)
+                    {
+                        result.band_bending_resilience =
+                            std::min(*result.band_bending_resilience, transition.second.second);
+                    }
+                }
+
+                result.ground_state_population_stability.push_back(figures.ground_state_stability);
+            }
+        }
+
+        stats.num_simulations = static_cast<std::size_t>(std::count_if(
+            input_figures.cbegin(), input_figures.cend(), [](const auto& figures) { return figures.simulated; }));
+
+        return result;
+    }
+
+  private:
+    /**
+     * Figures of merit that are derived from the simulation of a single input combination.
+     */
+    struct input_combination_figures
+    {
+        /**
+         * Flag to indicate whether the input combination was simulated.
+         */
+        bool simulated{false};
+        /**
+         * Critical temperature of the input combination (unit: K).
+         */
+        double critical_temperature{0.0};
+        /**
+         * Population stability of the ground state.
+         */
+        std::optional<population_stability_information<Lyt>> ground_state_stability{};
+    };
+    /**
+     * The layout to evaluate.
+     */
+    const Lyt& layout;
+    /**
+     * The expected Boolean function of the layout.
+     */
+    const std::vector<TT>& spec;
+    /**
+     * Parameters.
+     */
+    const figures_of_merit_params<cell<Lyt>>& params;
+    /**
+     * Statistics.
+     */
+    figures_of_merit_stats& stats;
+    /**
+     * Parameters for the critical temperature that are derived from `params`.
+     */
+    const critical_temperature_params ct_params;
+    /**
+     * Output BDL pairs of the layout.
+     */
+    const std::vector<bdl_pair<cell<Lyt>>> output_bdl_pairs;
+    /**
+     * Input BDL wires of the layout.
+     */
+    const std::vector<bdl_wire<Lyt>> input_bdl_wires;
+    /**
+     * Output BDL wires of the layout.
+     */
+    const std::vector<bdl_wire<Lyt>> output_bdl_wires;
+
+    /**
+     * Simulates the layout at the given input combination once and derives all figures of merit that rely on the
+     * nominal physical parameters from the resulting charge distributions. Since the charge distributions are only
+     * accessed by the calling thread, multiple input combinations can be evaluated concurrently.
+     *
+     * @param input_index Index of the input combination.
+     * @return The figures of merit of the input combination.
+     */
+    [[nodiscard]] input_combination_figures evaluate_input_combination(const uint64_t input_index) const
+    {
+        input_combination_figures figures{};
+
+        bdl_input_iterator<Lyt> bii{layout, params.operational_params.input_bdl_iterator_params, input_bdl_wires};
+        bii = input_index;
+
+        const auto& op_params = params.operational_params;
+
+        // if positively charged SiDBs can occur, the critical temperature is zero
+        const auto positive_charges_possible = can_positive_charges_occur(*bii, op_params.simulation_parameters);
+
+        const auto evaluate_critical_temperature = params.evaluate_critical_temperature && !positive_charges_possible;
+
+        // the population stability requires the exact ground state, which the shared simulation result only contains
+        // if it was obtained by an exact engine with all charge states that can occur
+        const auto exact_ground_state = op_params.sim_engine != sidb_simulation_engine::QUICKSIM &&
+                                        (!positive_charges_possible || op_params.simulation_parameters.base == 3);
+
+        const auto reuse_for_band_bending_resilience = params.evaluate_band_bending_resilience && exact_ground_state;
+
+        if (!evaluate_critical_temperature && !params.evaluate_band_bending_resilience)
+        {
+            return figures;
+        }
+
+        critical_temperature_stats              ct_stats{};
+        detail::critical_temperature_impl<Lyt> ct{layout, ct_params, ct_stats};
+
+        sidb_simulation_result<Lyt> sim_result{};
+
+        if (evaluate_critical_temperature || reuse_for_band_bending_resilience)
+        {
+            sim_result        = ct.physical_simulation_of_bdl_iterator(bii);
+            figures.simulated = true;
+        }
+
+        if (evaluate_critical_temperature && !sim_result.charge_distributions.empty())
+        {
+            // the wires are only modified if kinks are rejected
+            auto output_wires = output_bdl_wires;
+
+            ct.gate_based_simulation_of_input(sim_result, spec, input_index, output_bdl_pairs, input_bdl_wires,
+                                              output_wires);
+
+            figures.critical_temperature = ct.get_critical_temperature();
+        }
+
+        if (params.evaluate_band_bending_resilience)
+        {
+            const physical_population_stability_params pps_params{op_params.simulation_parameters};
+
+            detail::physical_population_stability_impl<Lyt> pps{*bii, pps_params};
+
+            // without an exact shared simulation result, the input combination is simulated again with QuickExact
+            const auto stability = reuse_for_band_bending_resilience ? pps.run(sim_result) : pps.run();
+            figures.simulated    = true;
+
+            if (!stability.empty())
+            {
+                figures.ground_state_stability = stability.front();
+            }
+        }
+
+        return figures;
+    }
+    /**
+     * Computes the ratio of operational parameter points via a grid search of the operational domain.
+     *
+     * @return The ratio of operational parameter points to all parameter points.
+     */
+    [[nodiscard]] double evaluate_operational_domain() const
+    {
+        operational_domain_stats op_stats{};
+
+        [[maybe_unused]] const auto op_domain =
+            operational_domain_grid_search(layout, spec, params.op_domain_params, &op_stats);
+
+        if (op_stats.num_total_parameter_points == 0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(op_stats.num_operational_parameter_combinations) /
+               static_cast<double>(op_stats.num_total_parameter_points);
+    }
+    /**
+     * Computes the defect clearance of the given defect via a grid search of the defect influence domain.
+     *
+     * @param defect The defect to compute the clearance for.
+     * @return The defect clearance.
+     */
+    [[nodiscard]] defect_clearance<cell<Lyt>> evaluate_defect_clearance(const sidb_defect& defect) const
+    {
+        static_assert(has_cube_coord_v<Lyt>, "Lyt is not based on cube coordinates");
+
+        auto defect_params   = params.defect_params;
+        defect_params.defect = defect;
+
+        const auto defect_inf_domain =
+            defect_influence_grid_search(layout, spec, defect_params, params.defect_step_size);
+
+        return calculate_defect_clearance(layout, defect_inf_domain);
+    }
+    /**
+     * Executes the given tasks on up to `params.num_threads` threads. Exceptions thrown by the tasks are rethrown after
+     * all tasks have finished.
+     *
+     * @param tasks Tasks to execute.
+     */
+    void execute(const std::vector<std::function<void()>>& tasks) const
+    {
+        const auto num_threads = std::max(std::min(params.num_threads, tasks.size()), std::size_t{1});
+
+        std::atomic<std::size_t>        next_task{0};
+        std::vector<std::exception_ptr> exceptions(tasks.size());
+
+        const auto worker = [&tasks, &next_task, &exceptions]
+        {
+            for (auto i = next_task++; i < tasks.size(); i = next_task++)
+            {
+                try
+                {
+                    tasks[i]();
+                }
+                catch (...)
+                {
+                    exceptions[i] = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads - 1);
+
+        for (auto i = 1ul; i < num_threads; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        // the calling thread participates as well
+        worker();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto& e : exceptions)
+        {
+            if (e)
+            {
+                std::rethrow_exception(e);
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Evaluates multiple figures of merit of an SiDB gate layout while simulating each input combination at the nominal
+ * physical parameters only once. The physically valid charge distributions of each input combination are kept and
+ * shared by the gate-based critical temperature (see `critical_temperature_gate_based`) and the band bending
+ * resilience (see `band_bending_resilience`), which would otherwise each simulate all input combinations themselves.
+ * The band bending resilience is thereby determined from the ground state of each input combination. Since it
+ * requires the exact ground state, the simulation result is only shared if the simulation engine is exact and
+ * considers all charge states that can occur; otherwise, the input combination is simulated again with *QuickExact*.
+ * The operational domain and the defect clearances, which require simulations at other physical parameters or in the
+ * presence of defects, are evaluated by their respective grid searches. All input combinations and grid searches are
+ * evaluated concurrently.
+ *
+ * This is useful to rank large numbers of gate designs, e.g., obtained via `design_sidb_gates`, by a cost function
+ * such as `cost_function_chi`.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt The gate layout to evaluate.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param params Parameters.
+ * @param stats Statistics.
+ * @return The requested figures of merit of `lyt`.
+ * @throws std::invalid_argument if defects are given but `Lyt` is not based on cube coordinates, if the operational
+ * domain sweep parameters are invalid, or if a checkpoint file does not match.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] figures_of_merit<Lyt> evaluate_figures_of_merit(const Lyt& lyt, const std::vector<TT>& spec,
+                                                              const figures_of_merit_params<cell<Lyt>>& params = {},
+                                                              figures_of_merit_stats* stats = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(!is_charge_distribution_surface_v<Lyt>, "Lyt cannot be a charge distribution surface");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+    assert(lyt.num_pis() > 0 && "gate needs input cells");
+    assert(lyt.num_pos() > 0 && "gate needs output cells");
+
+    assert(!spec.empty());
+    // all elements in tts must have the same number of variables
+    assert(std::adjacent_find(spec.cbegin(), spec.cend(), [](const auto& a, const auto& b)
+                              { return a.num_vars() != b.num_vars(); }) == spec.cend());
+
+    figures_of_merit_stats                   st{};
+    detail::figures_of_merit_impl<Lyt, TT> p{lyt, spec, params, st};
+
+    auto result = p.run();
+
+    if (stats)
+    {
+        *stats = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_FIGURES_OF_MERIT_HPP
@@ -20,14 +20,19 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -59,6 +64,13 @@ struct ground_state_space_params
      * input to the factorial call. As above, the defaulted value ensures no hindrance in runtimes.
      */
     uint64_t num_overlapping_witnesses_limit_gss = 6;
+    /**
+     * Number of threads to use for merging clusters. The charge spaces of the children of the newly forming parent are
+     * combined in parallel, as are the potential projections of the parent onto independent SiDBs. The pruning of
+     * charge spaces between merges is performed sequentially, so the resulting hierarchy does not depend on this value.
+     * The threads are spawned once per construction and merge steps with little work are performed sequentially.
+     */
+    uint64_t num_threads = 1;
 };
 /**
  * This struct is used to store the results of the *Ground State Space* construction.
@@ -134,7 +146,8 @@ class ground_state_space_impl
             mu_bounds_with_error{constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
                                  -constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
                                  constants::ERROR_MARGIN - params.simulation_parameters.mu_plus(),
-                                 -constants::ERROR_MARGIN - params.simulation_parameters.mu_plus()}
+                                 -constants::ERROR_MARGIN - params.simulation_parameters.mu_plus()},
+            pool{params.num_threads > 1 ? params.num_threads - 1 : 0}
     {}
     /**
      * The main loop in the *Ground State Space* construction. Charge spaces are updated until a fixed point is reached,
@@ -206,6 +219,31 @@ class ground_state_space_impl
     {
         return pot_bound > mu_bounds_with_error.at(2);
     }
+    /**
+     * Invokes the given function for each task index in \f$[0, n)\f$. If the estimated work of all tasks together
+     * exceeds `MIN_PARALLEL_WORK` and worker threads are available, the tasks are distributed dynamically over the
+     * calling thread and the workers of the pool. Tasks must therefore only modify disjoint data.
+     *
+     * @tparam Fn Type of the function to invoke, i.e., `void(uint64_t)`.
+     * @param num_tasks The number of tasks \f$n\f$.
+     * @param work Estimated number of potential bound operations that all tasks perform together.
+     * @param fn The function to invoke with each task index.
+     */
+    template <typename Fn>
+    void run_in_parallel(const uint64_t num_tasks, const uint64_t work, Fn&& fn) const noexcept
+    {
+        if (num_tasks <= 1 || work < MIN_PARALLEL_WORK || pool.num_workers() == 0)
+        {
+            for (uint64_t i = 0; i < num_tasks; ++i)
+            {
+                fn(i);
+            }
+
+            return;
+        }
+
+        pool.run(num_tasks, fn);
+    }
     /**
      * Function used to initialize two charge distribution surfaces, each corresponding to the initial lower/upper bound
      * on the electrostatic potential in the layout. The minimum electrostatic potential depends on the given simulation
@@ -278,6 +316,8 @@ class ground_state_space_impl
 
             const double loc_ext_pot = *min_loc_pot_cds.get_local_external_potential_by_index(i) + defect_pot;
 
+            c->pot_projs.resize(min_loc_pot_cds.num_cells());
+
             c->initialize_singleton_cluster_charge_space(-min_loc_pot, -max_loc_pot, -loc_ext_pot,
                                                          min_loc_pot_cds.get_simulation_params().base, c);
 
@@ -808,8 +848,13 @@ class ground_state_space_impl
      */
     void write_children_pot_bounds_to_complete_store(const sidb_cluster_ptr& parent) const noexcept
     {
-        for (const sidb_cluster_ptr& child : parent->children)
+        const std::vector<sidb_cluster_ptr> children{parent->children.cbegin(), parent->children.cend()};
+
+        // each child owns its complete potential bounds store, hence the children are handled independently
+        const auto write_child_pot_bounds = [&](const uint64_t i)
         {
+            const sidb_cluster_ptr& child = children[i];
+
             for (const sidb_cluster_charge_state& m : child->charge_space)
             {
                 const auto ccs = static_cast<uint64_t>(m);
@@ -828,7 +873,16 @@ class ground_state_space_impl
 
                 child->pot_projs_complete_store[ccs] = std::move(complete_pot_store);
             }
+        };
+
+        uint64_t work = 0;
+
+        for (const sidb_cluster_ptr& child : children)
+        {
+            work += child->charge_space.size() * top_cluster->num_sidbs();
         }
+
+        run_in_parallel(children.size(), work, write_child_pot_bounds);
     }
     /**
      * This function performs the first step to merging a set of clusters to their direct parent. When clusters are
@@ -841,13 +895,18 @@ class ground_state_space_impl
      * @return The number of projector states that is the accumulation of the number of projector states in the
      * composition of each charge space element of each child.
      */
-    [[nodiscard]] static uint64_t
-    compute_external_pot_bounds_for_saved_compositions(const sidb_cluster_ptr& parent) noexcept
+    [[nodiscard]] uint64_t
+    compute_external_pot_bounds_for_saved_compositions(const sidb_cluster_ptr& parent) const noexcept
     {
-        uint64_t saved_projector_states = 0;
+        const std::vector<sidb_cluster_ptr> children{parent->children.cbegin(), parent->children.cend()};
 
-        for (const sidb_cluster_ptr& child : parent->children)
+        std::vector<uint64_t> saved_projector_states(children.size(), 0);
+
+        // the compositions stored by each child only refer to the children of that child
+        const auto compute_child_composition_pot_bounds = [&](const uint64_t i)
         {
+            const sidb_cluster_ptr& child = children[i];
+
             for (const sidb_cluster_charge_state& m : child->charge_space)
             {
                 for (sidb_charge_space_composition& composition : m.compositions)
@@ -863,12 +922,21 @@ class ground_state_space_impl
                         }
                     }
 
-                    saved_projector_states += composition.proj_states.size();
+                    saved_projector_states[i] += composition.proj_states.size();
                 }
             }
+        };
+
+        uint64_t work = 0;
+
+        for (const sidb_cluster_ptr& child : children)
+        {
+            work += child->charge_space.size() * child->external_sidbs.size();
         }
 
-        return saved_projector_states;
+        run_in_parallel(children.size(), work, compute_child_composition_pot_bounds);
+
+        return std::accumulate(saved_projector_states.cbegin(), saved_projector_states.cend(), uint64_t{0});
     }
     /**
      * This function derives the new externally received partial sums of electrostatic potential local to an SiDB
@@ -965,12 +1033,14 @@ class ground_state_space_impl
      * the combination of charge space element. When it reaches out of bounds, a combination is complete and may be
      * verified before adding it to the parent charge space.
      * @param m The dynamically combined cluster charge state (i.e., multiset charge configuration). A copy of `m` when
-     * it is a complete composition of charge space elements of the children is added to the parent charge space if
+     * it is a complete composition of charge space elements of the children is added to the merged charge space if
      * verification passes. After, `m` is dynamically transformed to the next combination until no new combination
      * exists.
+     * @param merged_charge_space The charge space to which verified combinations are added.
      */
     void fill_merged_charge_state_space(const sidb_cluster_ptr& parent, const uint64_t cur_child_ix,
-                                        sidb_cluster_charge_state& m) const noexcept
+                                        sidb_cluster_charge_state&       m,
+                                        sidb_cluster_charge_state_space& merged_charge_space) const noexcept
     {
         if (cur_child_ix >= parent->children.size())
         {
@@ -980,14 +1050,14 @@ class ground_state_space_impl
             }
 
             // check if cluster charge state exists
-            const auto it = parent->charge_space.find(m);
-            if (it != parent->charge_space.cend())
+            const auto it = merged_charge_space.find(m);
+            if (it != merged_charge_space.cend())
             {
                 it->compositions.emplace_back(m.compositions.front());
             }
             else
             {
-                parent->charge_space.emplace(m);
+                merged_charge_space.emplace(m);
             }
 
             return;
@@ -1001,7 +1071,7 @@ class ground_state_space_impl
                 sidb_cluster_projector_state{cur_child, static_cast<uint64_t>(m_part)});
             m += m_part;
 
-            fill_merged_charge_state_space(parent, cur_child_ix + 1, m);
+            fill_merged_charge_state_space(parent, cur_child_ix + 1, m, merged_charge_space);
 
             m.compositions.front().proj_states.pop_back();
             m -= m_part;
@@ -1009,16 +1079,58 @@ class ground_state_space_impl
     }
     /**
      * This function calls the recursive function above that goes through all combination of charge space elements of
-     * children to form the charge space of their direct parent.
+     * children to form the charge space of their direct parent. The combinations are partitioned by the charge space
+     * element chosen for the first child, such that each part may be verified independently. The partial charge spaces
+     * are then combined in the order of the charge space of the first child, which yields the same compositions as a
+     * sequential construction would.
      *
      * @param parent The parent cluster to which charge spaces are combined.
      */
     void construct_merged_charge_state_space(const sidb_cluster_ptr& parent) const noexcept
     {
-        sidb_cluster_charge_state m{};
-        m.compositions.emplace_back();
+        const sidb_cluster_ptr& first_child = *parent->children.cbegin();
+
+        std::vector<const sidb_cluster_charge_state*> first_child_m_parts{};
+        first_child_m_parts.reserve(first_child->charge_space.size());
+
+        for (const sidb_cluster_charge_state& m_part : first_child->charge_space)
+        {
+            first_child_m_parts.emplace_back(&m_part);
+        }
+
+        std::vector<sidb_cluster_charge_state_space> partial_charge_spaces(first_child_m_parts.size());
+
+        const auto fill_partial_charge_space = [&](const uint64_t i)
+        {
+            sidb_cluster_charge_state m{};
+            m.compositions.emplace_back();
+
+            m.compositions.front().proj_states.emplace_back(
+                sidb_cluster_projector_state{first_child, static_cast<uint64_t>(*first_child_m_parts[i])});
+            m += *first_child_m_parts[i];
 
-        fill_merged_charge_state_space(parent, 0, m);
+            fill_merged_charge_state_space(parent, 1, m, partial_charge_spaces[i]);
+        };
+
+        // every combination of charge space elements of the children is verified against all SiDBs
+        uint64_t work = top_cluster->num_sidbs();
+
+        for (const sidb_cluster_ptr& child : parent->children)
+        {
+            work *= child->charge_space.size();
+        }
+
+        run_in_parallel(first_child_m_parts.size(), work, fill_partial_charge_space);
+
+        for (const sidb_cluster_charge_state_space& partial_charge_space : partial_charge_spaces)
+        {
+            for (const sidb_cluster_charge_state& m : partial_charge_space)
+            {
+                const auto it = parent->charge_space.emplace(static_cast<uint64_t>(m)).first;
+
+                std::move(m.compositions.begin(), m.compositions.end(), std::back_inserter(it->compositions));
+            }
+        }
     }
     /**
      * This function aggregates the bounds on the electrostatic potential from the respective children onto the given
@@ -1067,17 +1179,24 @@ class ground_state_space_impl
      */
     void construct_merged_potential_projections(const sidb_cluster_ptr& parent) const noexcept
     {
-        // merge the projections of the children to projections of the parent
-        for (const sidb_cluster_ptr& non_child : clustering)
+        const std::vector<sidb_cluster_ptr> non_children{clustering.cbegin(), clustering.cend()};
+
+        // each non-child only receives the projections onto its own SiDBs, hence the non-children are independent
+        const auto merge_pot_projections_onto_non_child = [&](const uint64_t i)
         {
-            for (const uint64_t sidb_ix : non_child->sidbs)
+            for (const uint64_t sidb_ix : non_children[i]->sidbs)
             {
-                const sidb_cluster_receptor_state rst{non_child, sidb_ix};
+                const sidb_cluster_receptor_state rst{non_children[i], sidb_ix};
 
                 merge_pot_projection_bounds<bound_direction::LOWER>(parent, rst);
                 merge_pot_projection_bounds<bound_direction::UPPER>(parent, rst);
             }
-        }
+        };
+
+        const uint64_t work = (top_cluster->num_sidbs() - parent->num_sidbs()) * parent->charge_space.size();
+
+        // merge the projections of the children to projections of the parent
+        run_in_parallel(non_children.size(), work, merge_pot_projections_onto_non_child);
     }
     /**
      * This function performs the flatten operation; the partial sum of the electrostatic potential local to all
@@ -1089,11 +1208,13 @@ class ground_state_space_impl
      *
      * @param parent The newly-forming parent cluster.
      */
-    static void compute_meets_for_internal_pot_bounds(const sidb_cluster_ptr& parent) noexcept
+    void compute_meets_for_internal_pot_bounds(const sidb_cluster_ptr& parent) const noexcept
     {
-        for (const sidb_cluster_charge_state& m : parent->charge_space)
+        const auto compute_meets_for_sidb = [&parent](const uint64_t i)
         {
-            for (const uint64_t sidb_ix : parent->sidbs)
+            const uint64_t sidb_ix = parent->sidbs[i];
+
+            for (const sidb_cluster_charge_state& m : parent->charge_space)
             {
                 double lb_meet = potential_bound_top<bound_direction::LOWER>();
                 double ub_meet = potential_bound_top<bound_direction::UPPER>();
@@ -1109,7 +1230,11 @@ class ground_state_space_impl
                 add_pot_projection(parent, sidb_ix, potential_projection{lb_meet, static_cast<uint64_t>(m)});
                 add_pot_projection(parent, sidb_ix, potential_projection{ub_meet, static_cast<uint64_t>(m)});
             }
-        }
+        };
+
+        const uint64_t work = parent->sidbs.size() * parent->charge_space.size();
+
+        run_in_parallel(parent->sidbs.size(), work, compute_meets_for_sidb);
     }
     /**
      * This function performs the complete merging operation from a set of sibling clusters to their direct parent. In
@@ -1153,6 +1278,8 @@ class ground_state_space_impl
             return;
         }
 
+        min_parent->pot_projs.resize(top_cluster->num_sidbs());
+
         construct_merged_potential_projections(min_parent);
 
         compute_meets_for_internal_pot_bounds(min_parent);
@@ -1178,6 +1305,186 @@ class ground_state_space_impl
         return params.simulation_parameters.base == 3 ? ((number_of_sidbs + 1) * (number_of_sidbs + 2)) / 2 :
                                                         number_of_sidbs + 1;
     }
+    /**
+     * Worker threads that are kept alive during the entire construction to run the tasks of `run_in_parallel`. The
+     * calling thread takes part in running the tasks, hence the pool holds one thread less than `num_threads`.
+     */
+    class worker_pool
+    {
+      public:
+        /**
+         * Standard constructor. Spawns the worker threads. If the system refuses to spawn some of them, the pool runs
+         * with the ones that could be spawned.
+         *
+         * @param n The number of worker threads to spawn.
+         */
+        explicit worker_pool(const uint64_t n) noexcept
+        {
+            try
+            {
+                workers.reserve(n);
+
+                for (uint64_t t = 0; t < n; ++t)
+                {
+                    workers.emplace_back([this] { work(); });
+                }
+            }
+            catch (...)  // NOLINT(bugprone-empty-catch): continue with the workers spawned so far
+            {}
+        }
+        /**
+         * Destructor. Stops and joins all worker threads.
+         */
+        ~worker_pool() noexcept
+        {
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                shutdown = true;
+            }
+
+            task_available.notify_all();
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        worker_pool(const worker_pool&)            = delete;
+        worker_pool& operator=(const worker_pool&) = delete;
+        worker_pool(worker_pool&&)                 = delete;
+        worker_pool& operator=(worker_pool&&)      = delete;
+        /**
+         * Returns the number of worker threads.
+         *
+         * @return The number of worker threads.
+         */
+        [[nodiscard]] uint64_t num_workers() const noexcept
+        {
+            return workers.size();
+        }
+        /**
+         * Invokes the given function for each task index in \f$[0, n)\f$ on the calling thread and all workers and
+         * returns once all tasks are finished.
+         *
+         * @tparam Fn Type of the function to invoke, i.e., `void(uint64_t)`.
+         * @param n The number of tasks.
+         * @param fn The function to invoke with each task index.
+         */
+        template <typename Fn>
+        void run(const uint64_t n, Fn& fn) noexcept
+        {
+            // wrapping a reference does not allocate
+            const std::function<void(uint64_t)> f{std::ref(fn)};
+
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+
+                task           = &f;
+                num_tasks      = n;
+                active_workers = workers.size();
+                next_task      = 0;
+                ++generation;
+            }
+
+            task_available.notify_all();
+
+            process_tasks();
+
+            std::unique_lock<std::mutex> lock{mutex};
+            tasks_finished.wait(lock, [this] { return active_workers == 0; });
+
+            task = nullptr;
+        }
+
+      private:
+        /**
+         * Worker threads.
+         */
+        std::vector<std::thread> workers{};
+        /**
+         * Protects the task description and the worker states.
+         */
+        std::mutex mutex{};
+        /**
+         * Notifies the workers of new tasks or of the shutdown.
+         */
+        std::condition_variable task_available{};
+        /**
+         * Notifies the calling thread of `run` that all workers finished their tasks.
+         */
+        std::condition_variable tasks_finished{};
+        /**
+         * The function to invoke with each task index of the current run.
+         */
+        const std::function<void(uint64_t)>* task{nullptr};
+        /**
+         * The number of tasks of the current run.
+         */
+        uint64_t num_tasks{0};
+        /**
+         * The index of the next task to claim.
+         */
+        std::atomic<uint64_t> next_task{0};
+        /**
+         * Counts the runs so that each worker takes part in each run exactly once.
+         */
+        uint64_t generation{0};
+        /**
+         * The number of workers that have not finished the current run yet.
+         */
+        uint64_t active_workers{0};
+        /**
+         * `true` if and only if the workers are to terminate.
+         */
+        bool shutdown{false};
+        /**
+         * Claims and runs tasks of the current run until none are left.
+         */
+        void process_tasks() noexcept
+        {
+            for (uint64_t i = next_task++; i < num_tasks; i = next_task++)
+            {
+                (*task)(i);
+            }
+        }
+        /**
+         * Main loop of a worker thread, which takes part in each run until the pool shuts down.
+         */
+        void work() noexcept
+        {
+            uint64_t seen_generation = 0;
+
+            std::unique_lock<std::mutex> lock{mutex};
+
+            while (true)
+            {
+                task_available.wait(lock, [this, &seen_generation]
+                                    { return shutdown || generation != seen_generation; });
+
+                if (shutdown)
+                {
+                    return;
+                }
+
+                seen_generation = generation;
+
+                lock.unlock();
+                process_tasks();
+                lock.lock();
+
+                if (--active_workers == 0)
+                {
+                    tasks_finished.notify_one();
+                }
+            }
+        }
+    };
+    /**
+     * Minimum estimated work for `run_in_parallel` to hand the tasks to the worker pool. Below, waking up the workers
+     * costs more than it saves.
+     */
+    static constexpr const uint64_t MIN_PARALLEL_WORK = 4096ul;
     /**
      * Parameters used during the construction.
      */
@@ -1202,6 +1509,10 @@ class ground_state_space_impl
      * Globally available array of bounds that section the band gap, used for pruning.
      */
     const std::array<double, 4> mu_bounds_with_error;
+    /**
+     * Worker threads used by `run_in_parallel`.
+     */
+    mutable worker_pool pool;
 };
 
 }  // namespace detail
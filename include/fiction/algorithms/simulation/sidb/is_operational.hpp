@@ -22,8 +22,11 @@
 #include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/checkpoint_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
 
+#include <fmt/format.h>
 #include <kitty/bit_operations.hpp>
 #include <kitty/traits.hpp>
 
@@ -31,9 +34,13 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -176,6 +183,90 @@ enum class layout_invalidity_reason : uint8_t
      */
     IO_INSTABILITY,
 };
+/**
+ * Appends a canonical description of the given layout and the parameters that determine its operational status to the
+ * given buffer. The description consists of all cells with their types, all atomic defects if `Lyt` is a defect
+ * surface, and all operational parameters. Since cells and defects are sorted, two layouts yield the same description
+ * if and only if they consist of the same cells and defects, regardless of the order in which these were added.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt The layout.
+ * @param params Parameters that determine the operational status.
+ * @param buffer Buffer to append the description to.
+ */
+template <typename Lyt>
+void describe_operational_assessment(const Lyt& lyt, const is_operational_params& params, fmt::memory_buffer& buffer)
+{
+    std::vector<std::tuple<int64_t, int64_t, int64_t, char>> cells{};
+    cells.reserve(lyt.num_cells());
+
+    lyt.foreach_cell(
+        [&lyt, &cells](const auto& c)
+        {
+            cells.emplace_back(static_cast<int64_t>(c.x), static_cast<int64_t>(c.y), static_cast<int64_t>(c.z),
+                               static_cast<char>(lyt.get_cell_type(c)));
+        });
+
+    std::sort(cells.begin(), cells.end());
+
+    for (const auto& [x, y, z, type] : cells)
+    {
+        fmt::format_to(std::back_inserter(buffer), "{},{},{},{};", x, y, z, type);
+    }
+
+    buffer.push_back('|');
+
+    if constexpr (is_sidb_defect_surface_v<Lyt>)
+    {
+        std::vector<std::string> defects{};
+
+        lyt.foreach_sidb_defect(
+            [&defects](const auto& cd)
+            {
+                const auto& [c, d] = cd;
+                defects.emplace_back(fmt::format("{},{},{},{},{},{},{};", c.x, c.y, c.z, static_cast<uint16_t>(d.type),
+                                                 d.charge, d.epsilon_r, d.lambda_tf));
+            });
+
+        std::sort(defects.begin(), defects.end());
+
+        for (const auto& d : defects)
+        {
+            fmt::format_to(std::back_inserter(buffer), "{}", d);
+        }
+    }
+
+    const auto& sim = params.simulation_parameters;
+    const auto& bdl = params.input_bdl_iterator_params.bdl_wire_params;
+
+    fmt::format_to(std::back_inserter(buffer), "|{},{},{},{}|{}|{},{},{},{}|{}|{}", sim.epsilon_r, sim.lambda_tf,
+                   sim.mu_minus, sim.base, static_cast<uint16_t>(params.sim_engine), bdl.threshold_bdl_interdistance,
+                   bdl.bdl_pairs_params.minimum_distance, bdl.bdl_pairs_params.maximum_distance,
+                   static_cast<uint16_t>(params.input_bdl_iterator_params.input_bdl_config),
+                   static_cast<uint16_t>(params.op_condition),
+                   static_cast<uint16_t>(params.strategy_to_analyze_operational_status));
+}
+/**
+ * Computes a fingerprint of the given layout and the parameters that determine its operational status, i.e., a hash of
+ * their description (see `describe_operational_assessment`). Long computations that persist intermediate results,
+ * e.g., in checkpoint files, use it to detect whether such results were obtained for the same inputs.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt The layout.
+ * @param params Parameters that determine the operational status.
+ * @param seed Initial hash value, e.g., the fingerprint of further inputs.
+ * @return Fingerprint of the layout and the parameters (see `fingerprint_inputs`).
+ */
+template <typename Lyt>
+[[nodiscard]] uint64_t operational_assessment_fingerprint(const Lyt& lyt, const is_operational_params& params,
+                                                          const uint64_t seed = fingerprint_inputs(""))
+{
+    fmt::memory_buffer buffer{};
+
+    describe_operational_assessment(lyt, params, buffer);
+
+    return fingerprint_inputs(std::string_view{buffer.data(), buffer.size()}, seed);
+}
 
 /**
  * Implementation of the `is_operational` algorithm for a given SiDB layout.
@@ -352,6 +443,8 @@ class is_operational_impl
      */
     [[nodiscard]] std::pair<operational_status, non_operationality_reason> run() noexcept
     {
+        FICTION_TRACE_ZONE("is_operational");
+
         if (!canvas_lyt.is_empty())
         {
             if ((parameters.op_condition == is_operational_params::operational_condition::REJECT_KINKS &&
@@ -920,6 +1013,8 @@ class is_operational_impl
     [[nodiscard]] sidb_simulation_result<Lyt>
     physical_simulation_of_layout(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
     {
+        FICTION_TRACE_ZONE("is_operational::physical_simulation_of_layout");
+
         if (parameters.sim_engine == sidb_simulation_engine::EXGS)
         {
             // perform exhaustive ground state simulation
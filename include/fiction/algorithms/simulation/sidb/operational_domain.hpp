@@ -10,340 +10,61 @@
 #include "fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp"
 #include "fiction/algorithms/simulation/sidb/energy_distribution.hpp"
 #include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain_types.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain_worker_pool.hpp"
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_domain.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/io/read_binary_operational_domain.hpp"
+#include "fiction/io/write_binary_operational_domain.hpp"
 #include "fiction/technology/cell_technologies.hpp"
-#include "fiction/technology/constants.hpp"
 #include "fiction/traits.hpp"
-#include "fiction/utils/hash.hpp"
+#include "fiction/utils/checkpoint_utils.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <btree.h>
 #include <fmt/format.h>
+#include <kitty/print.hpp>
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
+#include <deque>
+#include <filesystem>
 #include <functional>
+#include <istream>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <numeric>
 #include <optional>
+#include <ostream>
 #include <queue>
 #include <random>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace fiction
 {
 
-/**
- * The parameter point holds parameter values in the x and y dimension.
- */
-struct parameter_point
-{
-    /**
-     * Default constructor.
-     */
-    parameter_point() = default;
-    /**
-     * Standard constructor.
-     *
-     * @param values Parameter values for each dimension.
-     */
-    explicit parameter_point(const std::vector<double>& values) : parameters(values) {}
-    /**
-     * Equality operator. Checks if this parameter point is equal to another point within a specified tolerance.
-     * The tolerance is defined by `constants::ERROR_MARGIN`.
-     *
-     * @param other Other parameter point to compare with.
-     * @return `true` iff the parameter points are equal.
-     */
-    [[nodiscard]] bool operator==(const parameter_point& other) const noexcept
-    {
-        // Check if sizes are equal
-        if (parameters.size() != other.parameters.size())
-        {
-            return false;
-        }
-
-        // Define tolerance for comparison
-        constexpr auto tolerance = constants::ERROR_MARGIN;
-
-        // Compare each element with tolerance
-        for (std::size_t i = 0; i < parameters.size(); ++i)
-        {
-            if (std::fabs(parameters[i] - other.parameters[i]) >= tolerance)
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-    /**
-     * Inequality operator.
-     *
-     * @param other Other parameter point to compare with.
-     * @return `true` if the parameter points are not equal.
-     */
-    bool operator!=(const parameter_point& other) const noexcept
-    {
-        return !(*this == other);
-    }
-    /**
-     * Support for structured bindings.
-     *
-     * @tparam I Index of the parameter value to be returned.
-     * @return The parameter value at the specified index.
-     * @throws std::out_of_range if the index is out of bounds.
-     */
-    template <std::size_t I>
-    auto get() const
-    {
-        if (I >= parameters.size())
-        {
-            throw std::out_of_range("Index out of bounds for parameter_point");
-        }
-
-        return parameters[I];
-    }
-    /**
-     * Returns the parameter values for each dimension.
-     *
-     * @return The parameter values for each dimension.
-     */
-    [[nodiscard]] const std::vector<double>& get_parameters() const noexcept
-    {
-        return parameters;
-    }
-
-  private:
-    /**
-     * Parameter values for each dimension.
-     */
-    std::vector<double> parameters;
-};
-/**
- * Possible sweep parameters for the operational domain computation.
- */
-enum class sweep_parameter : uint8_t
-{
-    /**
-     * The relative permittivity of the dielectric material.
-     */
-    EPSILON_R,
-    /**
-     * The Thomas-Fermi screening length.
-     */
-    LAMBDA_TF,
-    /**
-     * The energy transition level.
-     */
-    MU_MINUS
-};
-/**
- * An operational domain is a set of simulation parameter values for which a given SiDB layout is logically operational.
- * This means that a layout is deemed operational if the layout's ground state corresponds with a given Boolean function
- * at the layout's outputs for all possible input combinations. In this implementation, \f$n\f$ BDL input wires and a
- * single BDL output wire are assumed for a given layout. Any operational domain computation algorithm toggles through
- * all \f$2^n\f$ input combinations and evaluates the layout's output behavior in accordance with the given Boolean
- * function. The layout is only considered operational for a certain parameter combination, if the output behavior is
- * correct for all input combinations. The operational domain can be computed by sweeping over specified simulation
- * parameters and checking the operational status of the layout for each parameter combination. The operational domain
- * is then defined as the set of all parameter combinations for which the layout is operational. Different techniques
- * for performing these sweep are implemented.
- */
-class operational_domain : public sidb_simulation_domain<parameter_point, operational_status>
-{
-  public:
-    /**
-     * Default constructor.
-     */
-    operational_domain() = default;
-    /**
-     * Standard constructor.
-     *
-     * @param dims Dimensions.
-     */
-    explicit operational_domain(const std::vector<sweep_parameter>& dims) : dimensions(dims) {}
-    /**
-     * Adds a dimension to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
-     * etc.
-     *
-     * @param dim The dimension to add.
-     */
-    void add_dimension(const sweep_parameter& dim)
-    {
-        dimensions.push_back(dim);
-    }
-    /**
-     * Returns a specific dimension by index.
-     *
-     * @param index The index of the dimension to return.
-     * @return The dimension at the specified index.
-     * @throws std::out_of_range if the index is out of range.
-     */
-    [[nodiscard]] const sweep_parameter& get_dimension(const std::size_t index) const
-    {
-        return dimensions.at(index);
-    }
-    /**
-     * Returns the number of dimensions to sweep over.
-     *
-     * @return The number of dimensions to sweep over.
-     */
-    [[nodiscard]]
-    std::size_t get_number_of_dimensions() const noexcept
-    {
-        return dimensions.size();
-    }
-
-  private:
-    /**
-     * The dimensions to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
-     * etc.
-     */
-    std::vector<sweep_parameter> dimensions;
-};
-/**
- * The `critical_temperature_domain` class collects the critical temperature and the operational status for a range of
- * different physical parameters of a given SiDB layout. It allows for the evaluation of how the critical temperature
- * depends on variations in the underlying parameter points. This enables simulations to explore the critical
- * temperature's behavior across different conditions and configurations.
- *
- * It was proposed in \"The Operational Domain Explorer: A Comprehensive Framework to Unveil the Thermal Landscape of
- * Silicon Dangling Bond Logic Beyond Conventional Operability\" by M. Walter, J. Drewniok, and R. Wille in IEEE-NANO
- * 2025 (https://ieeexplore.ieee.org/abstract/document/11113672).
- */
-class critical_temperature_domain : public sidb_simulation_domain<parameter_point, operational_status, double>
-{
-  public:
-    /**
-     * Default constructor.
-     */
-    critical_temperature_domain() = default;
-    /**
-     * Standard constructor.
-     *
-     * @param dims Dimensions.
-     */
-    explicit critical_temperature_domain(const std::vector<sweep_parameter>& dims) : dimensions(dims) {}
-    /**
-     * Adds a dimension to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
-     * etc.
-     *
-     * @param param The dimension to add.
-     */
-    void add_dimension(const sweep_parameter& param)
-    {
-        dimensions.push_back(param);
-    }
-    /**
-     * Returns a specific dimension by index.
-     *
-     * @param index The index of the dimension to return.
-     * @return The dimension at the specified index.
-     * @throws std::out_of_range if the index is out of range.
-     */
-    [[nodiscard]] const sweep_parameter& get_dimension(const std::size_t index) const
-    {
-        return dimensions.at(index);
-    }
-    /**
-     * Returns the number of dimensions to sweep over.
-     *
-     * @return The number of dimensions to sweep over.
-     */
-    [[nodiscard]]
-    std::size_t get_number_of_dimensions() const noexcept
-    {
-        return dimensions.size();
-    }
-    /**
-     * Finds the minimum critical temperature in the domain.
-     *
-     * @return The minimum critical temperature.
-     */
-    [[nodiscard]] double minimum_ct() const noexcept
-    {
-        double min_ct = std::numeric_limits<double>::max();
-
-        this->for_each(
-            [&min_ct](const auto&, const auto& op_value)
-            {
-                if (std::get<0>(op_value) == operational_status::OPERATIONAL)
-                {
-                    min_ct = std::min(min_ct, std::get<1>(op_value));
-                }
-            });
-
-        return min_ct;
-    }
-    /**
-     * Finds the maximum critical temperature in the domain.
-     *
-     * @return The maximum critical temperature.
-     */
-    [[nodiscard]] double maximum_ct() const noexcept
-    {
-        double max_ct = 0.0;
-
-        this->for_each(
-            [&max_ct](const auto&, const auto& op_value)
-            {
-                if (std::get<0>(op_value) == operational_status::OPERATIONAL)
-                {
-                    max_ct = std::max(max_ct, std::get<1>(op_value));
-                }
-            });
-
-        return max_ct;
-    }
-
-  private:
-    /**
-     * The dimensions to sweep over, ordered by priority. The first dimension is the x dimension, the second dimension
-     * is the y dimension, etc.
-     */
-    std::vector<sweep_parameter> dimensions;
-};
-
-/**
- * A range of values for a dimension sweep. The range is defined by a minimum value, a maximum value and a step size.
- */
-struct operational_domain_value_range
-{
-    /**
-     * The sweep parameter of the dimension.
-     */
-    sweep_parameter dimension;
-    /**
-     * The minimum value of the dimension sweep.
-     */
-    double min{1.0};
-    /**
-     * The maximum value of the dimension sweep.
-     */
-    double max{10.0};
-    /**
-     * The step size of the dimension sweep.
-     */
-    double step{0.1};
-};
 /**
  * Parameters for the operational domain computation. The parameters are used across the different operational domain
  * computation algorithms.
@@ -361,6 +82,19 @@ struct operational_domain_params
     std::vector<operational_domain_value_range> sweep_dimensions{
         operational_domain_value_range{sweep_parameter::EPSILON_R, 1.0, 10.0, 0.1},
         operational_domain_value_range{sweep_parameter::LAMBDA_TF, 1.0, 10.0, 0.1}};
+    /**
+     * Path of a checkpoint file. If non-empty, the evaluated parameter points are periodically written to this file in
+     * the binary operational domain format (see `write_binary_operational_domain`), preceded by a line that holds a
+     * fingerprint of the layout, the specification, and all parameters (see `periodic_checkpoint`). If the file
+     * already exists when the computation starts, the parameter points stored in it are restored instead of being
+     * re-evaluated, which allows to resume interrupted sweeps. The checkpoint must have been created for the same
+     * layout, specification, and parameters.
+     */
+    std::string checkpoint_file{};
+    /**
+     * Number of evaluated parameter points after which the checkpoint file is updated.
+     */
+    std::size_t checkpoint_interval{1000};
 };
 /**
  * Statistics for the operational domain computation. The statistics are used across the different operational domain
@@ -392,6 +126,37 @@ struct operational_domain_stats
      * Total number of parameter points in the parameter space.
      */
     std::size_t num_total_parameter_points{0};
+    /**
+     * Number of parameter points that were restored from the checkpoint file instead of being evaluated.
+     */
+    std::size_t num_restored_parameter_points{0};
+    /**
+     * Number of checkpoints that were written.
+     */
+    std::size_t num_checkpoints{0};
+};
+/**
+ * Parameters for the distributed operational domain computation.
+ */
+struct distributed_operational_domain_params
+{
+    /**
+     * Parameters of the operational domain computation. Workers must be configured with the same sweep dimensions.
+     */
+    operational_domain_params domain_params{};
+    /**
+     * Strategy to choose the parameter points to evaluate.
+     */
+    distributed_sweep_algorithm algorithm{distributed_sweep_algorithm::GRID_SEARCH};
+    /**
+     * Number of random samples to start from. Ignored for `distributed_sweep_algorithm::GRID_SEARCH`.
+     */
+    std::size_t samples{1000};
+    /**
+     * Maximum number of parameter points per batch. Larger batches reduce the communication overhead, smaller ones
+     * allow the frontier of flood fill and contour tracing to follow the results more closely.
+     */
+    std::size_t batch_size{16};
 };
 
 namespace detail
@@ -473,28 +238,11 @@ class operational_domain_impl
         {
             op_domain.add_dimension(params.sweep_dimensions[d].dimension);
 
-            // generate the step points for the dimension
-            indices.push_back(std::vector<std::size_t>(num_steps(d) + 1));
-            std::iota(indices[d].begin(), indices[d].end(), 0ul);
+            // generate the values and the step points for the dimension
+            values.push_back(sweep_dimension_values(params.sweep_dimensions[d]));
 
-            // if the value of the parameter is greater than params.max after num_x_steps() steps, this value is
-            // ignored in the operational domain calculation
-            if ((params.sweep_dimensions[d].min +
-                 static_cast<double>(indices[d].size() - 1) * params.sweep_dimensions[d].step) -
-                    params.sweep_dimensions[d].max >
-                constants::ERROR_MARGIN)
-            {
-                indices[d].pop_back();
-            }
-
-            values.emplace_back();
-
-            // generate the values for the dimension
-            for (const auto i : indices[d])
-            {
-                values[d].push_back(params.sweep_dimensions[d].min +
-                                    (static_cast<double>(i) * params.sweep_dimensions[d].step));
-            }
+            indices.push_back(std::vector<std::size_t>(values[d].size()));
+            std::iota(indices[d].begin(), indices[d].end(), 0ul);
         }
     }
     /**
@@ -521,29 +269,305 @@ class operational_domain_impl
         {
             op_domain.add_dimension(params.sweep_dimensions[d].dimension);
 
-            // generate the step points for the dimension
-            indices.push_back(std::vector<std::size_t>(num_steps(d) + 1));
+            // generate the values and the step points for the dimension
+            values.push_back(sweep_dimension_values(params.sweep_dimensions[d]));
+
+            indices.push_back(std::vector<std::size_t>(values[d].size()));
             std::iota(indices[d].begin(), indices[d].end(), 0ul);
+        }
+    }
+    /**
+     * Checks whether the given step indices address a parameter point of the sweep.
+     *
+     * @param steps Step indices, one per sweep dimension.
+     * @return `true` iff the number of indices matches the number of dimensions and all indices are within range.
+     */
+    [[nodiscard]] bool is_within_sweep(const std::vector<std::size_t>& steps) const noexcept
+    {
+        if (steps.size() != num_dimensions)
+        {
+            return false;
+        }
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            if (steps[d] >= values[d].size())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Evaluates the operational status of all parameter points in the given batch. This function is executed by the
+     * workers of a distributed operational domain computation. Since it attributes the simulator invocations to the
+     * batch, it must not be called concurrently on the same object.
+     *
+     * @param batch Batch whose parameter points are all within the sweep (see `is_within_sweep`).
+     * @return The operational statuses of the batch.
+     */
+    [[nodiscard]] operational_domain_batch_result evaluate_batch(const operational_domain_batch& batch) noexcept
+    {
+        operational_domain_batch_result result{batch.id, {}, 0};
+        result.statuses.reserve(batch.step_points.size());
+
+        const auto num_simulator_invocations_before = num_simulator_invocations.load();
+
+        for (const auto& steps : batch.step_points)
+        {
+            assert(is_within_sweep(steps) && "Step point is outside of the sweep");
+
+            result.statuses.push_back(is_step_point_operational(step_point{steps}));
+        }
+
+        result.num_simulator_invocations = num_simulator_invocations.load() - num_simulator_invocations_before;
+
+        return result;
+    }
+    /**
+     * Coordinates a distributed operational domain computation. Parameter points are handed out to the workers of the
+     * given pool in batches and their statuses are collected as soon as they become available. Flood fill and contour
+     * tracing extend their frontier from each collected result such that new batches can be handed out while others are
+     * still being evaluated.
+     *
+     * Contour tracing moves outwards from each operational sample along the first dimension until it leaves the
+     * operational domain. From there on, it only extends the frontier around points that have a neighbor with a
+     * different operational status or, if operational, lie on the border of the parameter range. Unlike
+     * `contour_tracing`, this also works in three dimensions.
+     *
+     * Parameter points that were restored from a checkpoint are treated as if they had just been collected.
+     *
+     * @param pool Worker pool to evaluate batches.
+     * @param algorithm Strategy to choose the parameter points to evaluate.
+     * @param samples Number of random samples to start from. Ignored for grid search.
+     * @param batch_size Maximum number of parameter points per batch.
+     * @return The (partial) operational domain of the layout.
+     * @throws std::runtime_error if the pool returns a result whose number of statuses does not match its batch.
+     */
+    [[nodiscard]] OpDomain distributed_sweep(operational_domain_worker_pool& pool,
+                                             const distributed_sweep_algorithm algorithm, const std::size_t samples,
+                                             const std::size_t batch_size)
+    {
+        static_assert(std::is_same_v<OpDomain, operational_domain>,
+                      "Distributed computations are only supported for operational domains");
+
+        assert(batch_size > 0 && "Batch size must be positive");
+        assert((algorithm == distributed_sweep_algorithm::GRID_SEARCH ||
+                algorithm == distributed_sweep_algorithm::RANDOM_SAMPLING || num_dimensions == 2 ||
+                num_dimensions == 3) &&
+               "Flood fill and contour tracing are only supported for two and three dimensions");
 
-            // if the value of the parameter is greater than params.max after num_x_steps() steps, this value is
-            // ignored in the operational domain calculation
-            if ((params.sweep_dimensions[d].min +
-                 static_cast<double>(indices[d].size() - 1) * params.sweep_dimensions[d].step) -
-                    params.sweep_dimensions[d].max >
-                constants::ERROR_MARGIN)
+        mockturtle::stopwatch stop{stats.time_total};
+
+        // points that are waiting to be handed out
+        std::deque<step_point> frontier{};
+        // points that were ever added to the frontier
+        phmap::btree_set<step_point> scheduled{};
+        // points that contour tracing moves outwards from
+        phmap::btree_set<step_point> outward_points{};
+        // points of the batches that were handed out but not yet collected
+        std::unordered_map<uint64_t, std::vector<step_point>> in_flight{};
+
+        uint64_t next_batch_id = 0;
+
+        const auto schedule = [this, &frontier, &scheduled](const step_point& sp)
+        {
+            if (!op_domain.contains(to_parameter_point(sp)).has_value() && scheduled.insert(sp).second)
             {
-                indices[d].pop_back();
+                frontier.push_back(sp);
             }
+        };
 
-            values.emplace_back();
+        const auto neighborhood = [this](const step_point& sp)
+        { return num_dimensions == 2 ? moore_neighborhood_2d(sp) : moore_neighborhood_3d(sp); };
+
+        const auto schedule_neighborhood = [&schedule, &neighborhood](const step_point& sp)
+        {
+            for (const auto& n : neighborhood(sp))
+            {
+                schedule(n);
+            }
+        };
 
-            // generate the values for the dimension
-            for (const auto i : indices[d])
+        const auto is_on_sweep_border = [this](const step_point& sp) noexcept
+        {
+            for (auto d = 0u; d < num_dimensions; ++d)
             {
-                values[d].push_back(params.sweep_dimensions[d].min +
-                                    (static_cast<double>(i) * params.sweep_dimensions[d].step));
+                if (sp.step_values[d] == 0 || sp.step_values[d] + 1 == values[d].size())
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        const auto extend_frontier = [&](const step_point& sp, const operational_status status)
+        {
+            if (algorithm == distributed_sweep_algorithm::FLOOD_FILL)
+            {
+                if (status == operational_status::OPERATIONAL)
+                {
+                    schedule_neighborhood(sp);
+                }
+            }
+            else if (algorithm == distributed_sweep_algorithm::CONTOUR_TRACING)
+            {
+                if (status == operational_status::OPERATIONAL && is_on_sweep_border(sp))
+                {
+                    schedule_neighborhood(sp);
+                }
+
+                for (const auto& n : neighborhood(sp))
+                {
+                    if (const auto n_value = op_domain.contains(to_parameter_point(n));
+                        n_value.has_value() && std::get<0>(*n_value) != status)
+                    {
+                        schedule_neighborhood(sp);
+                        schedule_neighborhood(n);
+                    }
+                }
+
+                // move outwards along the first dimension until the contour is found
+                if (outward_points.count(sp) != 0 && status == operational_status::OPERATIONAL &&
+                    sp.step_values[0] + 1 < values[0].size())
+                {
+                    auto next = sp;
+                    ++next.step_values[0];
+
+                    outward_points.insert(next);
+                    schedule(next);
+                }
+            }
+        };
+
+        if (algorithm == distributed_sweep_algorithm::GRID_SEARCH)
+        {
+            const auto all_index_combinations = cartesian_combinations(indices);
+
+            std::vector<step_point> all_step_points{};
+            all_step_points.reserve(all_index_combinations.size());
+
+            std::transform(all_index_combinations.cbegin(), all_index_combinations.cend(),
+                           std::back_inserter(all_step_points),
+                           [](const auto& comb) noexcept { return step_point{comb}; });
+
+            // see grid_search for the load-balancing benefits of shuffling
+            std::shuffle(all_step_points.begin(), all_step_points.end(), std::mt19937_64{std::random_device{}()});
+
+            std::for_each(all_step_points.cbegin(), all_step_points.cend(), schedule);
+        }
+        else
+        {
+            for (const auto& sp : generate_random_step_points(samples))
+            {
+                if (algorithm == distributed_sweep_algorithm::CONTOUR_TRACING)
+                {
+                    outward_points.insert(sp);
+                }
+
+                schedule(sp);
             }
         }
+
+        // continue from the points restored from a checkpoint
+        op_domain.for_each([this, &extend_frontier](const auto& param_point, const auto& status)
+                           { extend_frontier(to_step_point(param_point), std::get<0>(status)); });
+
+        while (true)
+        {
+            // keep the workers busy
+            while (in_flight.size() < pool.capacity() && !frontier.empty())
+            {
+                operational_domain_batch batch{next_batch_id++, {}};
+
+                std::vector<step_point> batch_points{};
+
+                while (batch_points.size() < batch_size && !frontier.empty())
+                {
+                    batch.step_points.push_back(frontier.front().step_values);
+                    batch_points.push_back(frontier.front());
+
+                    frontier.pop_front();
+                }
+
+                pool.submit(batch);
+
+                in_flight.emplace(batch.id, std::move(batch_points));
+            }
+
+            if (in_flight.empty())
+            {
+                break;
+            }
+
+            const auto result = pool.collect();
+
+            const auto it = in_flight.find(result.id);
+
+            if (it == in_flight.cend())
+            {
+                continue;
+            }
+
+            const auto batch_points = std::move(it->second);
+            in_flight.erase(it);
+
+            // pools are responsible for handing out batches again whose results are malformed
+            if (result.statuses.size() != batch_points.size())
+            {
+                throw std::runtime_error(fmt::format("the result of batch {} holds {} instead of {} statuses",
+                                                     result.id, result.statuses.size(), batch_points.size()));
+            }
+
+            num_simulator_invocations += result.num_simulator_invocations;
+
+            for (std::size_t i = 0; i < batch_points.size(); ++i)
+            {
+                ++num_evaluated_parameter_combinations;
+
+                op_domain.add_value(to_parameter_point(batch_points[i]), std::make_tuple(result.statuses[i]));
+
+                record_checkpoint();
+
+                extend_frontier(batch_points[i], result.statuses[i]);
+            }
+        }
+
+        save_checkpoint();
+
+        log_stats();
+
+        return op_domain;
+    }
+    /**
+     * Restores the parameter points stored in the checkpoint file, if one is specified and exists. Restored points are
+     * not re-evaluated by any of the operational domain computation algorithms.
+     *
+     * @throws std::invalid_argument if the checkpoint was created for a different layout, specification, or
+     * parameters, including different sweep dimensions.
+     * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
+     */
+    void restore_checkpoint()
+    {
+        checkpoint.restore(
+            [this](std::istream& is)
+            {
+                OpDomain restored{};
+
+                const auto header = read_binary_operational_domain(restored, is);
+
+                if (!is_matching_sweep(header.sweep_dimensions))
+                {
+                    throw std::invalid_argument(
+                        "the checkpoint file was created with different sweep dimensions than the current computation");
+                }
+
+                restored.for_each([this](const auto& pp, const auto& op_val) { op_domain.add_value(pp, op_val); });
+
+                stats.num_restored_parameter_points = restored.size();
+            });
     }
     /**
      * Performs a grid search over the specified parameter ranges with the specified step sizes. The grid search always
@@ -572,6 +596,8 @@ class operational_domain_impl
 
         simulate_operational_status_in_parallel(all_step_points);
 
+        save_checkpoint();
+
         log_stats();
 
         return op_domain;
@@ -591,6 +617,8 @@ class operational_domain_impl
 
         simulate_operational_status_in_parallel(step_point_samples);
 
+        save_checkpoint();
+
         log_stats();
 
         return op_domain;
@@ -686,6 +714,8 @@ class operational_domain_impl
             }
         }
 
+        save_checkpoint();
+
         log_stats();
 
         return op_domain;
@@ -786,6 +816,176 @@ class operational_domain_impl
             infer_operational_status_in_enclosing_contour(starting_point);
         }
 
+        save_checkpoint();
+
+        log_stats();
+
+        return op_domain;
+    }
+    /**
+     * Performs adaptive refinement to determine the operational domain. The parameter space is first divided into
+     * cells, i.e., squares in 2D (quadtree) or cubes in 3D (octree), of the given edge length. The operational status
+     * is determined at the corners of each cell. Cells whose corners all share the same operational status are assumed
+     * to be uniform and are not refined further. All other cells are halved along each dimension and their corners are
+     * evaluated in turn until the cells reach the resolution given by the step sizes of the sweep dimensions. The
+     * corners of each refinement level are evaluated in parallel.
+     *
+     * The operational domain will finally only contain the evaluated cell corners, i.e., a coarse sampling of uniform
+     * regions and a fine sampling of the borders between operational and non-operational regions.
+     *
+     * @param initial_cell_size Edge length of the initial cells in steps of the sweep dimensions.
+     * @return The (partial) operational domain of the layout.
+     */
+    [[nodiscard]] OpDomain adaptive_refinement(const std::size_t initial_cell_size) noexcept
+    {
+        assert((num_dimensions == 2 || num_dimensions == 3) &&
+               "Adaptive refinement is only supported for two and three dimensions");
+        assert(initial_cell_size > 0 && "The initial cell size must be positive");
+
+        mockturtle::stopwatch stop{stats.time_total};
+
+        // an axis-aligned box of step points given by its lower and upper corner (inclusive)
+        struct refinement_cell
+        {
+            std::vector<std::size_t> lower;
+            std::vector<std::size_t> upper;
+        };
+
+        // all cell corners, i.e., the combinations of the lower and upper bounds in each dimension
+        const auto cell_corners = [this](const refinement_cell& cell)
+        {
+            std::vector<step_point> corners{};
+            corners.reserve(std::size_t{1} << num_dimensions);
+
+            for (std::size_t mask = 0; mask < (std::size_t{1} << num_dimensions); ++mask)
+            {
+                std::vector<std::size_t> steps(num_dimensions);
+
+                for (auto d = 0u; d < num_dimensions; ++d)
+                {
+                    steps[d] = ((mask >> d) & 1u) != 0 ? cell.upper[d] : cell.lower[d];
+                }
+
+                corners.emplace_back(steps);
+            }
+
+            return corners;
+        };
+
+        // combines each of the given cells with each of the given intervals [lower, upper] of the next dimension
+        const auto extend_cells = [](const std::vector<refinement_cell>&                     cells,
+                                     const std::vector<std::pair<std::size_t, std::size_t>>& intervals)
+        {
+            std::vector<refinement_cell> extended_cells{};
+            extended_cells.reserve(cells.size() * intervals.size());
+
+            for (const auto& cell : cells)
+            {
+                for (const auto& [lower, upper] : intervals)
+                {
+                    auto extended = cell;
+                    extended.lower.push_back(lower);
+                    extended.upper.push_back(upper);
+
+                    extended_cells.push_back(std::move(extended));
+                }
+            }
+
+            return extended_cells;
+        };
+
+        // divide the parameter space into cells of the initial size; the last cell in each dimension may be smaller
+        std::vector<refinement_cell> cells(1);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            const auto last_step = indices[d].size() - 1;
+
+            std::vector<std::pair<std::size_t, std::size_t>> intervals{};
+
+            for (std::size_t lower = 0; lower < last_step; lower += initial_cell_size)
+            {
+                intervals.emplace_back(lower, std::min(lower + initial_cell_size, last_step));
+            }
+
+            // degenerate dimension with a single value
+            if (intervals.empty())
+            {
+                intervals.emplace_back(0, 0);
+            }
+
+            cells = extend_cells(cells, intervals);
+        }
+
+        // refine level by level
+        while (!cells.empty())
+        {
+            // evaluate all corners of the current level that have not been evaluated yet
+            phmap::btree_set<step_point> pending_corners{};
+
+            for (const auto& cell : cells)
+            {
+                for (const auto& corner : cell_corners(cell))
+                {
+                    if (!op_domain.contains(to_parameter_point(corner)).has_value())
+                    {
+                        pending_corners.insert(corner);
+                    }
+                }
+            }
+
+            if (!pending_corners.empty())
+            {
+                simulate_operational_status_in_parallel(
+                    std::vector<step_point>(pending_corners.cbegin(), pending_corners.cend()));
+            }
+
+            std::vector<refinement_cell> refined_cells{};
+
+            for (const auto& cell : cells)
+            {
+                const auto corners = cell_corners(cell);
+
+                const auto first_status = is_step_point_operational(corners.front());
+
+                // the cell is uniform and thus not refined any further
+                if (std::all_of(corners.cbegin() + 1, corners.cend(),
+                                [this, &first_status](const auto& corner)
+                                { return is_step_point_operational(corner) == first_status; }))
+                {
+                    continue;
+                }
+
+                // halve the cell along each dimension that has not yet reached the step resolution
+                std::vector<refinement_cell> subcells(1);
+
+                for (auto d = 0u; d < num_dimensions; ++d)
+                {
+                    std::vector<std::pair<std::size_t, std::size_t>> halves{{cell.lower[d], cell.upper[d]}};
+
+                    if (cell.upper[d] - cell.lower[d] > 1)
+                    {
+                        const auto mid = cell.lower[d] + (cell.upper[d] - cell.lower[d]) / 2;
+
+                        halves = {{cell.lower[d], mid}, {mid, cell.upper[d]}};
+                    }
+
+                    subcells = extend_cells(subcells, halves);
+                }
+
+                // a cell at step resolution cannot be halved any further
+                if (subcells.size() > 1)
+                {
+                    refined_cells.insert(refined_cells.end(), std::make_move_iterator(subcells.begin()),
+                                         std::make_move_iterator(subcells.end()));
+                }
+            }
+
+            cells = std::move(refined_cells);
+        }
+
+        save_checkpoint();
+
         log_stats();
 
         return op_domain;
@@ -959,6 +1159,10 @@ class operational_domain_impl
      * The operational domain of the layout.
      */
     OpDomain op_domain{};
+    /**
+     * Periodically writes the evaluated parameter points to the checkpoint file, if one is specified.
+     */
+    periodic_checkpoint checkpoint{params.checkpoint_file, params.checkpoint_interval, checkpoint_fingerprint()};
     /**
      * Forward-declare step_point.
      */
@@ -1085,19 +1289,6 @@ class operational_domain_impl
 
         return step_point{step_values};
     }
-    /**
-     * Calculates the number of steps in the given dimension based on the provided parameters.
-     *
-     * @return The number of steps in the given dimension.
-     */
-    [[nodiscard]] std::size_t num_steps(const std::size_t dimension) const noexcept
-    {
-        assert(dimension < num_dimensions && "Invalid dimension");
-
-        return static_cast<std::size_t>(
-            std::round((params.sweep_dimensions[dimension].max - params.sweep_dimensions[dimension].min) /
-                       params.sweep_dimensions[dimension].step));
-    }
     /**
      * Helper function that sets the value of a sweep dimension in the simulation parameters.
      *
@@ -1166,6 +1357,8 @@ class operational_domain_impl
                 op_domain.add_value(param_point, std::make_tuple(operational_status::OPERATIONAL));
             }
 
+            record_checkpoint();
+
             return operational_status::OPERATIONAL;
         };
 
@@ -1180,9 +1373,13 @@ class operational_domain_impl
                 op_domain.add_value(param_point, std::make_tuple(operational_status::NON_OPERATIONAL));
             }
 
+            record_checkpoint();
+
             return operational_status::NON_OPERATIONAL;
         };
 
+        FICTION_TRACE_ZONE("operational_domain::is_step_point_operational");
+
         ++num_evaluated_parameter_combinations;
 
         sidb_simulation_parameters sim_params = params.operational_params.simulation_parameters;
@@ -1200,6 +1397,8 @@ class operational_domain_impl
 
         num_simulator_invocations += sim_calls;
 
+        FICTION_TRACE_COUNTER("operational_domain::num_simulator_invocations", num_simulator_invocations.load());
+
         if (status == operational_status::NON_OPERATIONAL)
         {
             return non_operational();
@@ -1662,6 +1861,81 @@ class operational_domain_impl
             queue_next_points(sp);
         }
     }
+    /**
+     * Checks whether the given sweep dimensions, e.g., read from a checkpoint file, match the ones of the current
+     * computation.
+     *
+     * @param sweep_dimensions Sweep dimensions to compare.
+     * @return `true` iff the dimensions, ranges, and step sizes match.
+     */
+    [[nodiscard]] bool
+    is_matching_sweep(const std::vector<operational_domain_value_range>& sweep_dimensions) const noexcept
+    {
+        return std::equal(sweep_dimensions.cbegin(), sweep_dimensions.cend(), params.sweep_dimensions.cbegin(),
+                          params.sweep_dimensions.cend(),
+                          [](const auto& lhs, const auto& rhs) noexcept
+                          {
+                              return lhs.dimension == rhs.dimension &&
+                                     std::fabs(lhs.min - rhs.min) < constants::ERROR_MARGIN &&
+                                     std::fabs(lhs.max - rhs.max) < constants::ERROR_MARGIN &&
+                                     std::fabs(lhs.step - rhs.step) < constants::ERROR_MARGIN;
+                          });
+    }
+    /**
+     * Computes the fingerprint of all inputs that determine the evaluated parameter points, i.e., the kind of the
+     * domain, the specification, the sweep dimensions, the layout, and the operational parameters.
+     *
+     * @return Fingerprint to identify checkpoints of this computation, or 0 if no checkpoint file is specified.
+     */
+    [[nodiscard]] uint64_t checkpoint_fingerprint() const
+    {
+        if (params.checkpoint_file.empty())
+        {
+            return 0;
+        }
+
+        fmt::memory_buffer buffer{};
+
+        fmt::format_to(std::back_inserter(buffer), "{}|",
+                       std::is_same_v<OpDomain, critical_temperature_domain> ? "critical temperature" : "operational");
+
+        for (const auto& tt : truth_table)
+        {
+            fmt::format_to(std::back_inserter(buffer), "{}:{};", tt.num_vars(), kitty::to_hex(tt));
+        }
+
+        for (const auto& range : params.sweep_dimensions)
+        {
+            fmt::format_to(std::back_inserter(buffer), "|{},{},{},{}", static_cast<uint16_t>(range.dimension),
+                           range.min, range.max, range.step);
+        }
+
+        return detail::operational_assessment_fingerprint(
+            layout, params.operational_params, fingerprint_inputs(std::string_view{buffer.data(), buffer.size()}));
+    }
+    /**
+     * Writes the current operational domain to the checkpoint file in the binary operational domain format.
+     *
+     * @param os Output stream of the checkpoint file.
+     */
+    void write_checkpoint(std::ostream& os) const
+    {
+        write_binary_operational_domain(op_domain, params.sweep_dimensions, os);
+    }
+    /**
+     * Reports an evaluated parameter point to the checkpoint, which is written if it is due.
+     */
+    void record_checkpoint() noexcept
+    {
+        checkpoint.record([this](std::ostream& os) { write_checkpoint(os); });
+    }
+    /**
+     * Writes the final checkpoint after the computation has finished.
+     */
+    void save_checkpoint() noexcept
+    {
+        static_cast<void>(checkpoint.save([this](std::ostream& os) { write_checkpoint(os); }));
+    }
     /**
      * Helper function that writes the the statistics of the operational domain computation to the statistics object.
      * Due to data races that can occur during the computation, each value is temporarily held in an atomic variable and
@@ -1671,6 +1945,7 @@ class operational_domain_impl
     {
         stats.num_simulator_invocations            = num_simulator_invocations.load();
         stats.num_evaluated_parameter_combinations = num_evaluated_parameter_combinations.load();
+        stats.num_checkpoints                      = checkpoint.num_checkpoints();
 
         op_domain.for_each(
             [this](const auto& param_point [[maybe_unused]], const auto& status)
@@ -1713,7 +1988,8 @@ class operational_domain_impl
  * @param ps Parameters for the operational domain computation.
  * @param st Statistics of the process.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_grid_search(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1730,6 +2006,9 @@ template <typename Lyt, typename TT>
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.grid_search();
 
     if (stats)
@@ -1759,7 +2038,8 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_random_sampling(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1777,6 +2057,9 @@ template <typename Lyt, typename TT>
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.random_sampling(samples);
 
     if (stats)
@@ -1816,7 +2099,8 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain
@@ -1838,6 +2122,9 @@ operational_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& spec, const
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.flood_fill(samples);
 
     if (stats)
@@ -1876,7 +2163,8 @@ operational_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& spec, const
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_contour_tracing(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1888,9 +2176,76 @@ template <typename Lyt, typename TT>
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
     static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
 
-    if (params.sweep_dimensions.size() != 2)
+    if (params.sweep_dimensions.size() != 2)
+    {
+        throw std::invalid_argument("Contour tracing is only applicable to exactly 2 dimensions");
+    }
+
+    // this may throw an `std::invalid_argument` exception
+    detail::validate_sweep_parameters(params);
+
+    operational_domain_stats                                     st{};
+    detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
+
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
+    const auto result = p.contour_tracing(samples);
+
+    if (stats)
+    {
+        *stats = st;
+    }
+
+    return result;
+}
+/**
+ * Computes the operational domain of the given SiDB cell-level layout. The operational domain is the set of all
+ * parameter combinations for which the layout is logically operational. Logical operation is defined as the layout
+ * implementing the given truth table. The input BDL pairs of the layout are assumed to be in the same order as the
+ * inputs of the truth table.
+ *
+ * This algorithm uses adaptive refinement on a quadtree (2D) or octree (3D) of cells. It starts from a coarse grid
+ * whose cells have an edge length of `initial_cell_size` steps and determines the operational status at their
+ * corners. Only cells whose corners disagree in their operational status are recursively halved until the resolution
+ * given by the step sizes of the sweep dimensions is reached. Since uniform regions are only sampled at the coarse
+ * resolution, the number of operational checks grows with the size of the borders of the operational domain instead
+ * of with its volume. The result is stored sparsely, i.e., it only contains the evaluated cell corners.
+ *
+ * Operational or non-operational regions that lie entirely within a coarse cell without touching its corners remain
+ * undetected. Hence, `initial_cell_size` should be smaller than the smallest expected feature of the domain.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt Layout to compute the operational domain for.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param initial_cell_size Edge length of the initial cells in steps of the sweep dimensions.
+ * @param params Operational domain computation parameters.
+ * @param stats Operational domain computation statistics.
+ * @return The (partial) operational domain of the layout.
+ * @throws std::invalid_argument if the given sweep parameters are invalid, `initial_cell_size` is 0, or the parameters
+ * do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] operational_domain
+operational_domain_adaptive_refinement(const Lyt& lyt, const std::vector<TT>& spec,
+                                       const std::size_t                initial_cell_size,
+                                       const operational_domain_params& params = {},
+                                       operational_domain_stats*        stats  = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+    if (params.sweep_dimensions.size() != 2 && params.sweep_dimensions.size() != 3)
     {
-        throw std::invalid_argument("Contour tracing is only applicable to exactly 2 dimensions");
+        throw std::invalid_argument("Adaptive refinement is only applicable to 2 or 3 dimensions");
+    }
+
+    if (initial_cell_size == 0)
+    {
+        throw std::invalid_argument("The initial cell size must be positive");
     }
 
     // this may throw an `std::invalid_argument` exception
@@ -1898,7 +2253,11 @@ template <typename Lyt, typename TT>
 
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
-    const auto                                                   result = p.contour_tracing(samples);
+
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
+    const auto result = p.adaptive_refinement(initial_cell_size);
 
     if (stats)
     {
@@ -1927,7 +2286,8 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -1945,6 +2305,9 @@ critical_temperature_domain_grid_search(const Lyt& lyt, const std::vector<TT>& s
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.grid_search();
 
     if (stats)
@@ -1973,7 +2336,8 @@ critical_temperature_domain_grid_search(const Lyt& lyt, const std::vector<TT>& s
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -1991,6 +2355,9 @@ critical_temperature_domain_random_sampling(const Lyt& lyt, const std::vector<TT
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.random_sampling(samples);
 
     if (stats)
@@ -2025,7 +2392,8 @@ critical_temperature_domain_random_sampling(const Lyt& lyt, const std::vector<TT
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -2048,6 +2416,9 @@ critical_temperature_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& sp
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
     const auto result = p.flood_fill(samples);
 
     if (stats)
@@ -2085,7 +2456,8 @@ critical_temperature_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& sp
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -2107,7 +2479,11 @@ critical_temperature_domain_contour_tracing(const Lyt& lyt, const std::vector<TT
 
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
-    const auto                                                            result = p.contour_tracing(samples);
+
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
+    const auto result = p.contour_tracing(samples);
 
     if (stats)
     {
@@ -2116,41 +2492,458 @@ critical_temperature_domain_contour_tracing(const Lyt& lyt, const std::vector<TT
 
     return result;
 }
+/**
+ * Computes the critical temperature domain of the given SiDB cell-level layout. The critical temperature domain
+ * consists of all parameter combinations for which the layout is logically operational, along with the critical
+ * temperature for each specific parameter point.
+ *
+ * This algorithm uses adaptive refinement on a quadtree (2D) or octree (3D) of cells. It starts from a coarse grid
+ * whose cells have an edge length of `initial_cell_size` steps and determines the operational status at their
+ * corners. Only cells whose corners disagree in their operational status are recursively halved until the resolution
+ * given by the step sizes of the sweep dimensions is reached. Since uniform regions are only sampled at the coarse
+ * resolution, the number of operational checks grows with the size of the borders of the operational domain instead
+ * of with its volume. The result is stored sparsely, i.e., it only contains the evaluated cell corners.
+ *
+ * Operational or non-operational regions that lie entirely within a coarse cell without touching its corners remain
+ * undetected. Hence, `initial_cell_size` should be smaller than the smallest expected feature of the domain.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt Layout to compute the operational domain for.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param initial_cell_size Edge length of the initial cells in steps of the sweep dimensions.
+ * @param params Operational domain computation parameters.
+ * @param stats Operational domain computation statistics.
+ * @return The (partial) critical temperature domain of the layout.
+ * @throws std::invalid_argument if the given sweep parameters are invalid, `initial_cell_size` is 0, or the parameters
+ * do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] critical_temperature_domain
+critical_temperature_domain_adaptive_refinement(const Lyt& lyt, const std::vector<TT>& spec,
+                                                const std::size_t                initial_cell_size,
+                                                const operational_domain_params& params = {},
+                                                operational_domain_stats*        stats  = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
 
-}  // namespace fiction
+    if (params.sweep_dimensions.size() != 2 && params.sweep_dimensions.size() != 3)
+    {
+        throw std::invalid_argument("Adaptive refinement is only applicable to 2 or 3 dimensions");
+    }
+
+    if (initial_cell_size == 0)
+    {
+        throw std::invalid_argument("The initial cell size must be positive");
+    }
+
+    // this may throw an `std::invalid_argument` exception
+    detail::validate_sweep_parameters(params);
+
+    operational_domain_stats                                              st{};
+    detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
+
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
+    const auto result = p.adaptive_refinement(initial_cell_size);
+
+    if (stats)
+    {
+        *stats = st;
+    }
 
-namespace std
+    return result;
+}
+/**
+ * A worker pool whose workers are threads of the current process. It serves as a local stand-in for distributed
+ * worker pools, e.g., to test a distributed setup on a single machine or to use all cores of the coordinating machine.
+ *
+ * Each worker evaluates batches with its own copy of the operational domain computation state. The layout is
+ * referenced and must outlive the pool.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ */
+template <typename Lyt, typename TT>
+class local_operational_domain_worker_pool : public operational_domain_worker_pool
 {
+  public:
+    /**
+     * Standard constructor. Launches the worker threads.
+     *
+     * @param lyt Layout to compute the operational domain for.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param ps Operational domain computation parameters. Checkpointing is disabled for the workers.
+     * @param num_workers Number of worker threads.
+     */
+    local_operational_domain_worker_pool(const Lyt& lyt, const std::vector<TT>& spec,
+                                         const operational_domain_params& ps,
+                                         const std::size_t num_workers = std::thread::hardware_concurrency()) :
+            operational_domain_worker_pool(),
+            specification{spec},
+            params{ps}
+    {
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+        static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+        // the coordinator is responsible for checkpoints
+        params.checkpoint_file.clear();
+
+        const auto num_threads = std::max(num_workers, std::size_t{1});
+
+        workers.reserve(num_threads);
+
+        for (std::size_t i = 0; i < num_threads; ++i)
+        {
+            workers.emplace_back([this, &lyt] { run_worker(lyt, specification); });
+        }
+    }
+    /**
+     * Copy constructor is deleted.
+     */
+    local_operational_domain_worker_pool(const local_operational_domain_worker_pool&) = delete;
+    /**
+     * Move constructor is deleted.
+     */
+    local_operational_domain_worker_pool(local_operational_domain_worker_pool&&) = delete;
+    /**
+     * Copy assignment operator is deleted.
+     */
+    local_operational_domain_worker_pool& operator=(const local_operational_domain_worker_pool&) = delete;
+    /**
+     * Move assignment operator is deleted.
+     */
+    local_operational_domain_worker_pool& operator=(local_operational_domain_worker_pool&&) = delete;
+    /**
+     * Destructor. Stops and joins the worker threads.
+     */
+    ~local_operational_domain_worker_pool() override
+    {
+        {
+            const std::lock_guard lock{mutex};
+            stop = true;
+        }
+
+        batch_available.notify_all();
+
+        for (auto& worker : workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+    /**
+     * Returns twice the number of workers such that each worker finds its next batch ready when it finishes one.
+     *
+     * @return Number of concurrently submitted batches.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept override
+    {
+        return 2 * workers.size();
+    }
+    /**
+     * Queues the batch for the next idle worker.
+     *
+     * @param batch Batch of parameter points to evaluate.
+     */
+    void submit(const operational_domain_batch& batch) override
+    {
+        {
+            const std::lock_guard lock{mutex};
+            batches.push_back(batch);
+        }
+
+        batch_available.notify_one();
+    }
+    /**
+     * Waits for the next evaluated batch.
+     *
+     * @return Result of an evaluated batch.
+     */
+    [[nodiscard]] operational_domain_batch_result collect() override
+    {
+        std::unique_lock lock{mutex};
+        result_available.wait(lock, [this] { return !results.empty(); });
+
+        auto result = std::move(results.front());
+        results.pop_front();
+
+        return result;
+    }
+
+  private:
+    /**
+     * Expected Boolean function of the layout.
+     */
+    const std::vector<TT> specification;
+    /**
+     * Parameters of the workers.
+     */
+    operational_domain_params params;
+    /**
+     * Protects the queues and the stop flag.
+     */
+    std::mutex mutex{};
+    /**
+     * Signals that a batch was submitted or that the workers should stop.
+     */
+    std::condition_variable batch_available{};
+    /**
+     * Signals that a batch was evaluated.
+     */
+    std::condition_variable result_available{};
+    /**
+     * Submitted batches that are not yet being evaluated.
+     */
+    std::deque<operational_domain_batch> batches{};
+    /**
+     * Results that are not yet collected.
+     */
+    std::deque<operational_domain_batch_result> results{};
+    /**
+     * Flag to stop the workers.
+     */
+    bool stop{false};
+    /**
+     * Worker threads.
+     */
+    std::vector<std::thread> workers{};
+    /**
+     * Evaluates batches until the pool is destroyed.
+     *
+     * @param lyt Layout to compute the operational domain for.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     */
+    void run_worker(const Lyt& lyt, const std::vector<TT>& spec) noexcept
+    {
+        operational_domain_stats                                     st{};
+        detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
-// make `operational_domain::parameter_point` compatible with `std::integral_constant`
-template <>
-struct tuple_size<fiction::parameter_point> : std::integral_constant<size_t, 2>
-{};
+        while (true)
+        {
+            operational_domain_batch batch{};
+
+            {
+                std::unique_lock lock{mutex};
+                batch_available.wait(lock, [this] { return stop || !batches.empty(); });
+
+                if (stop)
+                {
+                    return;
+                }
+
+                batch = std::move(batches.front());
+                batches.pop_front();
+            }
 
-// make `operational_domain::parameter_point` compatible with `std::tuple_element`
-template <size_t I>
-struct tuple_element<I, fiction::parameter_point>
+            auto result = p.evaluate_batch(batch);
+
+            {
+                const std::lock_guard lock{mutex};
+                results.push_back(std::move(result));
+            }
+
+            result_available.notify_one();
+        }
+    }
+};
+/**
+ * Parameters for `operational_domain_worker`.
+ */
+struct operational_domain_worker_params
 {
-    using type = double;
+    /**
+     * Time between two scans of the shared directory for batches.
+     */
+    std::chrono::milliseconds poll_interval{100};
 };
-
-// make `operational_domain::parameter_point` compatible with `std::hash`
-template <>
-struct hash<fiction::parameter_point>
+/**
+ * Runs a worker of a distributed operational domain computation that communicates with its coordinator via a shared
+ * directory (see `shared_directory_operational_domain_worker_pool`). The worker repeatedly claims a batch, evaluates
+ * it, and writes its result until the coordinator signals that the computation has finished. Any number of workers,
+ * e.g., one process per node of a cluster, may serve the same directory.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt Layout to compute the operational domain for.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param params Operational domain computation parameters. The sweep dimensions must match the coordinator's.
+ * @param directory Shared directory.
+ * @param ps Worker parameters.
+ * @return Number of evaluated batches.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or if a batch does not match them. In the
+ * latter case, the batch is released for other workers.
+ */
+template <typename Lyt, typename TT>
+std::size_t operational_domain_worker(const Lyt& lyt, const std::vector<TT>& spec,
+                                      const operational_domain_params& params, const std::filesystem::path& directory,
+                                      const operational_domain_worker_params& ps = {})
 {
-    size_t operator()(const fiction::parameter_point& pp) const noexcept
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+    // this may throw an `std::invalid_argument` exception
+    detail::validate_sweep_parameters(params);
+
+    // the coordinator is responsible for checkpoints
+    auto worker_params = params;
+    worker_params.checkpoint_file.clear();
+
+    operational_domain_stats                                     st{};
+    detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, worker_params, st};
+
+    // a token that distinguishes the batches claimed by this worker from those claimed by others
+    const auto token = std::to_string(std::random_device{}()) + std::to_string(std::random_device{}());
+
+    std::size_t num_batches = 0;
+
+    while (true)
     {
-        size_t hash_value = 0;
-        for (const auto& parameter : pp.get_parameters())
+        bool found_batch = false;
+
+        for (const auto& entry : std::filesystem::directory_iterator{directory})
+        {
+            const auto id = detail::operational_domain_file_id(entry.path().filename().string(), "batch_", ".txt");
+
+            if (!id.has_value())
+            {
+                continue;
+            }
+
+            // claiming a batch via renaming fails if another worker claimed it first
+            const auto claimed = directory / (entry.path().filename().string() + "." + token + ".claimed");
+
+            std::error_code ec{};
+            std::filesystem::rename(entry.path(), claimed, ec);
+
+            if (ec)
+            {
+                continue;
+            }
+
+            found_batch = true;
+
+            std::optional<operational_domain_batch> batch{};
+
+            {
+                std::ifstream is{claimed};
+                batch = detail::read_operational_domain_batch(is);
+            }
+
+            if (!batch.has_value() || batch->id != *id ||
+                !std::all_of(batch->step_points.cbegin(), batch->step_points.cend(),
+                             [&p](const auto& steps) { return p.is_within_sweep(steps); }))
+            {
+                std::filesystem::rename(claimed, entry.path(), ec);
+
+                throw std::invalid_argument(
+                    fmt::format("batch {} does not match the sweep dimensions of the worker", *id));
+            }
+
+            const auto result = p.evaluate_batch(*batch);
+
+            const auto write_result = [&result](std::ostream& os)
+            { detail::write_operational_domain_batch_result(result, os); };
+
+            // a resubmitted batch may be evaluated by several workers at once, which must not share a temporary file;
+            // temporary files do not match the result file pattern and are thus never picked up by the coordinator
+            if (!write_file_atomically((directory / detail::operational_domain_result_file(*id)).string(),
+                                       write_result, "." + token + ".tmp"))
+            {
+                // release the batch for other workers
+                std::filesystem::rename(claimed, entry.path(), ec);
+
+                continue;
+            }
+
+            std::filesystem::remove(claimed, ec);
+
+            ++num_batches;
+        }
+
+        if (!found_batch)
         {
-            // hash the double values with tolerance
-            fiction::hash_combine(hash_value, static_cast<size_t>(parameter / fiction::constants::ERROR_MARGIN));
+            if (std::filesystem::exists(directory / detail::OPERATIONAL_DOMAIN_DONE_FILE))
+            {
+                return num_batches;
+            }
+
+            std::this_thread::sleep_for(ps.poll_interval);
         }
+    }
+}
+/**
+ * Computes the operational domain of the given SiDB cell-level layout by distributing the evaluation of parameter
+ * points among the workers of the given pool. This function acts as the coordinator: it hands out batches of
+ * parameter points according to the chosen algorithm and collects their operational statuses. Flood fill and contour
+ * tracing extend their frontier as results arrive, such that the workers are kept busy throughout the computation.
+ *
+ * Workers can be threads of the current process (`local_operational_domain_worker_pool`) or processes on other
+ * machines that share a directory with the coordinator (`shared_directory_operational_domain_worker_pool` and
+ * `operational_domain_worker`). If a checkpoint file is specified, the coordinator writes checkpoints and resumes from
+ * them as described in `operational_domain_params`.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt Layout to compute the operational domain for.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param pool Worker pool to evaluate the parameter points.
+ * @param params Distributed operational domain computation parameters.
+ * @param stats Operational domain computation statistics.
+ * @return The (partial) operational domain of the layout.
+ * @throws std::invalid_argument if the given parameters are invalid or do not match the checkpoint file.
+ * @throws binary_operational_domain_parsing_error if the checkpoint file is malformed.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] operational_domain
+operational_domain_distributed(const Lyt& lyt, const std::vector<TT>& spec, operational_domain_worker_pool& pool,
+                               const distributed_operational_domain_params& params = {},
+                               operational_domain_stats*                    stats  = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
 
-        return hash_value;
+    if ((params.algorithm == distributed_sweep_algorithm::FLOOD_FILL ||
+         params.algorithm == distributed_sweep_algorithm::CONTOUR_TRACING) &&
+        params.domain_params.sweep_dimensions.size() != 2 && params.domain_params.sweep_dimensions.size() != 3)
+    {
+        throw std::invalid_argument(
+            "Distributed flood fill and contour tracing are only applicable to 2 or 3 dimensions");
+    }
+
+    if (params.batch_size == 0)
+    {
+        throw std::invalid_argument("The batch size must be positive");
+    }
+
+    // this may throw an `std::invalid_argument` exception
+    detail::validate_sweep_parameters(params.domain_params);
+
+    operational_domain_stats                                     st{};
+    detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params.domain_params, st};
+
+    // this may throw an `std::invalid_argument` or a `binary_operational_domain_parsing_error` exception
+    p.restore_checkpoint();
+
+    const auto result = p.distributed_sweep(pool, params.algorithm, params.samples, params.batch_size);
+
+    if (stats)
+    {
+        *stats = st;
     }
-};
 
-}  // namespace std
+    return result;
+}
+
+}  // namespace fiction
 
 #endif  // FICTION_OPERATIONAL_DOMAIN_HPP
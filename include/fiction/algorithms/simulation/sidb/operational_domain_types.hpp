@@ -0,0 +1,384 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_OPERATIONAL_DOMAIN_TYPES_HPP
+#define FICTION_OPERATIONAL_DOMAIN_TYPES_HPP
+
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_domain.hpp"
+#include "fiction/technology/constants.hpp"
+#include "fiction/utils/hash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * The parameter point holds parameter values in the x and y dimension.
+ */
+struct parameter_point
+{
+    /**
+     * Default constructor.
+     */
+    parameter_point() = default;
+    /**
+     * Standard constructor.
+     *
+     * @param values Parameter values for each dimension.
+     */
+    explicit parameter_point(const std::vector<double>& values) : parameters(values) {}
+    /**
+     * Equality operator. Checks if this parameter point is equal to another point within a specified tolerance.
+     * The tolerance is defined by `constants::ERROR_MARGIN`.
+     *
+     * @param other Other parameter point to compare with.
+     * @return `true` iff the parameter points are equal.
+     */
+    [[nodiscard]] bool operator==(const parameter_point& other) const noexcept
+    {
+        // Check if sizes are equal
+        if (parameters.size() != other.parameters.size())
+        {
+            return false;
+        }
+
+        // Define tolerance for comparison
+        constexpr auto tolerance = constants::ERROR_MARGIN;
+
+        // Compare each element with tolerance
+        for (std::size_t i = 0; i < parameters.size(); ++i)
+        {
+            if (std::fabs(parameters[i] - other.parameters[i]) >= tolerance)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Inequality operator.
+     *
+     * @param other Other parameter point to compare with.
+     * @return `true` if the parameter points are not equal.
+     */
+    bool operator!=(const parameter_point& other) const noexcept
+    {
+        return !(*this == other);
+    }
+    /**
+     * Support for structured bindings.
+     *
+     * @tparam I Index of the parameter value to be returned.
+     * @return The parameter value at the specified index.
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    template <std::size_t I>
+    auto get() const
+    {
+        if (I >= parameters.size())
+        {
+            throw std::out_of_range("Index out of bounds for parameter_point");
+        }
+
+        return parameters[I];
+    }
+    /**
+     * Returns the parameter values for each dimension.
+     *
+     * @return The parameter values for each dimension.
+     */
+    [[nodiscard]] const std::vector<double>& get_parameters() const noexcept
+    {
+        return parameters;
+    }
+
+  private:
+    /**
+     * Parameter values for each dimension.
+     */
+    std::vector<double> parameters;
+};
+/**
+ * Possible sweep parameters for the operational domain computation.
+ */
+enum class sweep_parameter : uint8_t
+{
+    /**
+     * The relative permittivity of the dielectric material.
+     */
+    EPSILON_R,
+    /**
+     * The Thomas-Fermi screening length.
+     */
+    LAMBDA_TF,
+    /**
+     * The energy transition level.
+     */
+    MU_MINUS
+};
+/**
+ * An operational domain is a set of simulation parameter values for which a given SiDB layout is logically operational.
+ * This means that a layout is deemed operational if the layout's ground state corresponds with a given Boolean function
+ * at the layout's outputs for all possible input combinations. In this implementation, \f$n\f$ BDL input wires and a
+ * single BDL output wire are assumed for a given layout. Any operational domain computation algorithm toggles through
+ * all \f$2^n\f$ input combinations and evaluates the layout's output behavior in accordance with the given Boolean
+ * function. The layout is only considered operational for a certain parameter combination, if the output behavior is
+ * correct for all input combinations. The operational domain can be computed by sweeping over specified simulation
+ * parameters and checking the operational status of the layout for each parameter combination. The operational domain
+ * is then defined as the set of all parameter combinations for which the layout is operational. Different techniques
+ * for performing these sweep are implemented.
+ */
+class operational_domain : public sidb_simulation_domain<parameter_point, operational_status>
+{
+  public:
+    /**
+     * Default constructor.
+     */
+    operational_domain() = default;
+    /**
+     * Standard constructor.
+     *
+     * @param dims Dimensions.
+     */
+    explicit operational_domain(const std::vector<sweep_parameter>& dims) : dimensions(dims) {}
+    /**
+     * Adds a dimension to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
+     * etc.
+     *
+     * @param dim The dimension to add.
+     */
+    void add_dimension(const sweep_parameter& dim)
+    {
+        dimensions.push_back(dim);
+    }
+    /**
+     * Returns a specific dimension by index.
+     *
+     * @param index The index of the dimension to return.
+     * @return The dimension at the specified index.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    [[nodiscard]] const sweep_parameter& get_dimension(const std::size_t index) const
+    {
+        return dimensions.at(index);
+    }
+    /**
+     * Returns the number of dimensions to sweep over.
+     *
+     * @return The number of dimensions to sweep over.
+     */
+    [[nodiscard]]
+    std::size_t get_number_of_dimensions() const noexcept
+    {
+        return dimensions.size();
+    }
+
+  private:
+    /**
+     * The dimensions to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
+     * etc.
+     */
+    std::vector<sweep_parameter> dimensions;
+};
+/**
+ * The `critical_temperature_domain` class collects the critical temperature and the operational status for a range of
+ * different physical parameters of a given SiDB layout. It allows for the evaluation of how the critical temperature
+ * depends on variations in the underlying parameter points. This enables simulations to explore the critical
+ * temperature's behavior across different conditions and configurations.
+ *
+ * It was proposed in \"The Operational Domain Explorer: A Comprehensive Framework to Unveil the Thermal Landscape of
+ * Silicon Dangling Bond Logic Beyond Conventional Operability\" by M. Walter, J. Drewniok, and R. Wille in IEEE-NANO
+ * 2025 (https://ieeexplore.ieee.org/abstract/document/11113672).
+ */
+class critical_temperature_domain : public sidb_simulation_domain<parameter_point, operational_status, double>
+{
+  public:
+    /**
+     * Default constructor.
+     */
+    critical_temperature_domain() = default;
+    /**
+     * Standard constructor.
+     *
+     * @param dims Dimensions.
+     */
+    explicit critical_temperature_domain(const std::vector<sweep_parameter>& dims) : dimensions(dims) {}
+    /**
+     * Adds a dimension to sweep over. The first dimension is the x dimension, the second dimension is the y dimension,
+     * etc.
+     *
+     * @param param The dimension to add.
+     */
+    void add_dimension(const sweep_parameter& param)
+    {
+        dimensions.push_back(param);
+    }
+    /**
+     * Returns a specific dimension by index.
+     *
+     * @param index The index of the dimension to return.
+     * @return The dimension at the specified index.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    [[nodiscard]] const sweep_parameter& get_dimension(const std::size_t index) const
+    {
+        return dimensions.at(index);
+    }
+    /**
+     * Returns the number of dimensions to sweep over.
+     *
+     * @return The number of dimensions to sweep over.
+     */
+    [[nodiscard]]
+    std::size_t get_number_of_dimensions() const noexcept
+    {
+        return dimensions.size();
+    }
+    /**
+     * Finds the minimum critical temperature in the domain.
+     *
+     * @return The minimum critical temperature.
+     */
+    [[nodiscard]] double minimum_ct() const noexcept
+    {
+        double min_ct = std::numeric_limits<double>::max();
+
+        this->for_each(
+            [&min_ct](const auto&, const auto& op_value)
+            {
+                if (std::get<0>(op_value) == operational_status::OPERATIONAL)
+                {
+                    min_ct = std::min(min_ct, std::get<1>(op_value));
+                }
+            });
+
+        return min_ct;
+    }
+    /**
+     * Finds the maximum critical temperature in the domain.
+     *
+     * @return The maximum critical temperature.
+     */
+    [[nodiscard]] double maximum_ct() const noexcept
+    {
+        double max_ct = 0.0;
+
+        this->for_each(
+            [&max_ct](const auto&, const auto& op_value)
+            {
+                if (std::get<0>(op_value) == operational_status::OPERATIONAL)
+                {
+                    max_ct = std::max(max_ct, std::get<1>(op_value));
+                }
+            });
+
+        return max_ct;
+    }
+
+  private:
+    /**
+     * The dimensions to sweep over, ordered by priority. The first dimension is the x dimension, the second dimension
+     * is the y dimension, etc.
+     */
+    std::vector<sweep_parameter> dimensions;
+};
+
+/**
+ * A range of values for a dimension sweep. The range is defined by a minimum value, a maximum value and a step size.
+ */
+struct operational_domain_value_range
+{
+    /**
+     * The sweep parameter of the dimension.
+     */
+    sweep_parameter dimension;
+    /**
+     * The minimum value of the dimension sweep.
+     */
+    double min{1.0};
+    /**
+     * The maximum value of the dimension sweep.
+     */
+    double max{10.0};
+    /**
+     * The step size of the dimension sweep.
+     */
+    double step{0.1};
+};
+/**
+ * Generates the parameter values of a dimension sweep, i.e., all values \f$min + i \cdot step\f$ that do not exceed
+ * `max`. These are exactly the values that the operational domain computation algorithms sample in this dimension.
+ *
+ * @param range The value range of the dimension sweep.
+ * @return The parameter values of the dimension sweep in ascending order.
+ */
+[[nodiscard]] inline std::vector<double> sweep_dimension_values(const operational_domain_value_range& range) noexcept
+{
+    auto num_values = static_cast<std::size_t>(std::round((range.max - range.min) / range.step)) + 1;
+
+    // if the value of the parameter is greater than max after the last step, this value is ignored
+    if ((range.min + static_cast<double>(num_values - 1) * range.step) - range.max > constants::ERROR_MARGIN)
+    {
+        --num_values;
+    }
+
+    std::vector<double> values{};
+    values.reserve(num_values);
+
+    for (std::size_t i = 0; i < num_values; ++i)
+    {
+        values.push_back(range.min + (static_cast<double>(i) * range.step));
+    }
+
+    return values;
+}
+
+}  // namespace fiction
+
+namespace std
+{
+
+// make `operational_domain::parameter_point` compatible with `std::integral_constant`
+template <>
+struct tuple_size<fiction::parameter_point> : std::integral_constant<size_t, 2>
+{};
+
+// make `operational_domain::parameter_point` compatible with `std::tuple_element`
+template <size_t I>
+struct tuple_element<I, fiction::parameter_point>
+{
+    using type = double;
+};
+
+// make `operational_domain::parameter_point` compatible with `std::hash`
+template <>
+struct hash<fiction::parameter_point>
+{
+    size_t operator()(const fiction::parameter_point& pp) const noexcept
+    {
+        size_t hash_value = 0;
+        for (const auto& parameter : pp.get_parameters())
+        {
+            // hash the double values with tolerance
+            fiction::hash_combine(hash_value, static_cast<size_t>(parameter / fiction::constants::ERROR_MARGIN));
+        }
+
+        return hash_value;
+    }
+};
+
+}  // namespace std
+
+#endif  // FICTION_OPERATIONAL_DOMAIN_TYPES_HPP
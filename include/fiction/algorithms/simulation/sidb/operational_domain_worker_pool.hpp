@@ -0,0 +1,599 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
+#define FICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
+
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/utils/checkpoint_utils.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Strategy that a distributed operational domain computation uses to choose the parameter points to evaluate.
+ */
+enum class distributed_sweep_algorithm : uint8_t
+{
+    /**
+     * Evaluate all parameter points of the sweep (cf. `operational_domain_grid_search`).
+     */
+    GRID_SEARCH,
+    /**
+     * Evaluate a number of random parameter points (cf. `operational_domain_random_sampling`).
+     */
+    RANDOM_SAMPLING,
+    /**
+     * Evaluate random parameter points and extend the frontier from all operational points found among the results
+     * (cf. `operational_domain_flood_fill`).
+     */
+    FLOOD_FILL,
+    /**
+     * Evaluate random parameter points, move outwards from operational ones until the border of the operational domain
+     * is found, and extend the frontier along that border only (cf. `operational_domain_contour_tracing`).
+     */
+    CONTOUR_TRACING
+};
+/**
+ * A batch of parameter points that a coordinator hands out to a worker for evaluation. Points are given as step
+ * indices into the sweep dimensions, which coordinator and workers must agree upon. This keeps the exchanged points
+ * exact regardless of how they are transmitted.
+ */
+struct operational_domain_batch
+{
+    /**
+     * Identifier of the batch, unique within a computation.
+     */
+    uint64_t id{0};
+    /**
+     * Step indices of the parameter points, one index per sweep dimension.
+     */
+    std::vector<std::vector<std::size_t>> step_points{};
+};
+/**
+ * The operational statuses that a worker determined for an `operational_domain_batch`.
+ */
+struct operational_domain_batch_result
+{
+    /**
+     * Identifier of the evaluated batch.
+     */
+    uint64_t id{0};
+    /**
+     * Operational status of each parameter point in the order of `operational_domain_batch::step_points`.
+     */
+    std::vector<operational_status> statuses{};
+    /**
+     * Number of simulator invocations that were required to evaluate the batch.
+     */
+    std::size_t num_simulator_invocations{0};
+};
+/**
+ * Interface between the coordinator of a distributed operational domain computation and its workers. The coordinator
+ * submits batches of parameter points and collects their results in the order in which they become available.
+ *
+ * Implementations decide where batches are evaluated, e.g., by threads of the current process (see
+ * `local_operational_domain_worker_pool`) or by processes on other machines (see
+ * `shared_directory_operational_domain_worker_pool`).
+ */
+class operational_domain_worker_pool
+{
+  public:
+    /**
+     * Default constructor.
+     */
+    operational_domain_worker_pool() = default;
+    /**
+     * Default copy constructor.
+     */
+    operational_domain_worker_pool(const operational_domain_worker_pool&) = default;
+    /**
+     * Default move constructor.
+     */
+    operational_domain_worker_pool(operational_domain_worker_pool&&) noexcept = default;
+    /**
+     * Default copy assignment operator.
+     */
+    operational_domain_worker_pool& operator=(const operational_domain_worker_pool&) = default;
+    /**
+     * Default move assignment operator.
+     */
+    operational_domain_worker_pool& operator=(operational_domain_worker_pool&&) noexcept = default;
+    /**
+     * Default destructor.
+     */
+    virtual ~operational_domain_worker_pool() = default;
+    /**
+     * Returns the number of batches that the coordinator should keep in flight to occupy all workers.
+     *
+     * @return Number of concurrently submitted batches.
+     */
+    [[nodiscard]] virtual std::size_t capacity() const noexcept = 0;
+    /**
+     * Hands out a batch for evaluation. This function must not block until the batch is evaluated.
+     *
+     * @param batch Batch of parameter points to evaluate.
+     */
+    virtual void submit(const operational_domain_batch& batch) = 0;
+    /**
+     * Blocks until the result of any submitted batch is available and returns it. Each submitted batch is returned
+     * exactly once. Must only be called while at least one submitted batch has not yet been collected.
+     *
+     * @return Result of an evaluated batch.
+     */
+    [[nodiscard]] virtual operational_domain_batch_result collect() = 0;
+};
+
+namespace detail
+{
+
+/**
+ * First line of a batch file exchanged via a shared directory.
+ */
+inline constexpr const char* OPERATIONAL_DOMAIN_BATCH_MAGIC = "fiction operational domain batch v1";
+/**
+ * First line of a result file exchanged via a shared directory.
+ */
+inline constexpr const char* OPERATIONAL_DOMAIN_RESULT_MAGIC = "fiction operational domain result v1";
+/**
+ * Name of the file that signals workers that the computation has finished.
+ */
+inline constexpr const char* OPERATIONAL_DOMAIN_DONE_FILE = "done";
+/**
+ * Returns the file name of a batch in a shared directory.
+ *
+ * @param id Batch identifier.
+ * @return File name of the batch.
+ */
+[[nodiscard]] inline std::string operational_domain_batch_file(const uint64_t id)
+{
+    return "batch_" + std::to_string(id) + ".txt";
+}
+/**
+ * Returns the file name of a batch result in a shared directory.
+ *
+ * @param id Batch identifier.
+ * @return File name of the result.
+ */
+[[nodiscard]] inline std::string operational_domain_result_file(const uint64_t id)
+{
+    return "result_" + std::to_string(id) + ".txt";
+}
+/**
+ * Extracts the batch identifier from a file name of the form `<prefix><id><suffix>`.
+ *
+ * @param filename File name to parse.
+ * @param prefix Expected prefix.
+ * @param suffix Expected suffix.
+ * @return The batch identifier or `std::nullopt` if the file name does not match.
+ */
+[[nodiscard]] inline std::optional<uint64_t> operational_domain_file_id(const std::string& filename,
+                                                                        const std::string& prefix,
+                                                                        const std::string& suffix)
+{
+    if (filename.size() <= prefix.size() + suffix.size() || filename.compare(0, prefix.size(), prefix) != 0 ||
+        filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) != 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto digits = filename.substr(prefix.size(), filename.size() - prefix.size() - suffix.size());
+
+    // reject non-numeric identifiers as well as those that exceed the range of uint64_t
+    if (digits.size() > 19 || digits.find_first_not_of("0123456789") != std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    return std::stoull(digits);
+}
+/**
+ * Writes a batch in the text format exchanged via a shared directory.
+ *
+ * @param batch Batch to write.
+ * @param os Output stream.
+ */
+inline void write_operational_domain_batch(const operational_domain_batch& batch, std::ostream& os)
+{
+    const auto num_dimensions = batch.step_points.empty() ? std::size_t{0} : batch.step_points.front().size();
+
+    os << OPERATIONAL_DOMAIN_BATCH_MAGIC << '\n'
+       << batch.id << ' ' << batch.step_points.size() << ' ' << num_dimensions << '\n';
+
+    for (const auto& sp : batch.step_points)
+    {
+        for (std::size_t d = 0; d < sp.size(); ++d)
+        {
+            os << (d == 0 ? "" : " ") << sp[d];
+        }
+
+        os << '\n';
+    }
+}
+/**
+ * Reads a batch in the text format exchanged via a shared directory.
+ *
+ * @param is Input stream.
+ * @return The batch or `std::nullopt` if the input is malformed.
+ */
+[[nodiscard]] inline std::optional<operational_domain_batch> read_operational_domain_batch(std::istream& is)
+{
+    std::string magic{};
+
+    operational_domain_batch batch{};
+    std::size_t              num_points{};
+    std::size_t              num_dimensions{};
+
+    if (!std::getline(is, magic) || magic != OPERATIONAL_DOMAIN_BATCH_MAGIC ||
+        !(is >> batch.id >> num_points >> num_dimensions))
+    {
+        return std::nullopt;
+    }
+
+    batch.step_points.assign(num_points, std::vector<std::size_t>(num_dimensions));
+
+    for (auto& sp : batch.step_points)
+    {
+        for (auto& s : sp)
+        {
+            if (!(is >> s))
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    return batch;
+}
+/**
+ * Writes a batch result in the text format exchanged via a shared directory.
+ *
+ * @param result Result to write.
+ * @param os Output stream.
+ */
+inline void write_operational_domain_batch_result(const operational_domain_batch_result& result, std::ostream& os)
+{
+    os << OPERATIONAL_DOMAIN_RESULT_MAGIC << '\n'
+       << result.id << ' ' << result.statuses.size() << ' ' << result.num_simulator_invocations << '\n';
+
+    for (const auto status : result.statuses)
+    {
+        os << static_cast<uint32_t>(status) << '\n';
+    }
+}
+/**
+ * Reads a batch result in the text format exchanged via a shared directory.
+ *
+ * @param is Input stream.
+ * @return The result or `std::nullopt` if the input is malformed.
+ */
+[[nodiscard]] inline std::optional<operational_domain_batch_result>
+read_operational_domain_batch_result(std::istream& is)
+{
+    std::string magic{};
+
+    operational_domain_batch_result result{};
+    std::size_t                     num_points{};
+
+    if (!std::getline(is, magic) || magic != OPERATIONAL_DOMAIN_RESULT_MAGIC ||
+        !(is >> result.id >> num_points >> result.num_simulator_invocations))
+    {
+        return std::nullopt;
+    }
+
+    result.statuses.reserve(num_points);
+
+    for (std::size_t i = 0; i < num_points; ++i)
+    {
+        uint32_t status{};
+
+        if (!(is >> status) || status > static_cast<uint32_t>(operational_status::NON_OPERATIONAL))
+        {
+            return std::nullopt;
+        }
+
+        result.statuses.push_back(static_cast<operational_status>(status));
+    }
+
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * Parameters for the `shared_directory_operational_domain_worker_pool`.
+ */
+struct shared_directory_worker_pool_params
+{
+    /**
+     * Number of batches that are kept in flight. This should be at least the total number of worker processes.
+     */
+    std::size_t capacity{64};
+    /**
+     * Time between two scans of the shared directory for results.
+     */
+    std::chrono::milliseconds poll_interval{100};
+    /**
+     * Time after which a claimed batch whose result is still missing is handed out again, e.g., because the worker
+     * that claimed it crashed. A value of 0 disables resubmission.
+     */
+    std::chrono::milliseconds resubmission_timeout{0};
+};
+/**
+ * Coordinator side of a worker pool whose workers are separate processes, potentially on different machines, that
+ * communicate with the coordinator via a shared directory, e.g., on a network file system.
+ *
+ * The coordinator writes each batch to a file `batch_<id>.txt`. Workers (see `operational_domain_worker`) claim a
+ * batch by renaming its file, evaluate it, and write the result to `result_<id>.txt`, which the coordinator picks up.
+ * All files are first written to a temporary file that is then renamed such that no party ever reads a partially
+ * written file. Batches whose result is malformed are handed out again. Once the computation has finished, the
+ * coordinator creates a file `done`, upon which the workers terminate.
+ */
+class shared_directory_operational_domain_worker_pool : public operational_domain_worker_pool
+{
+  public:
+    /**
+     * Standard constructor. Creates the shared directory if necessary and removes any batch, result, and `done` files
+     * that were left behind by a previous computation. Workers should therefore be started after the coordinator.
+     *
+     * @param dir Shared directory.
+     * @param ps Parameters.
+     */
+    explicit shared_directory_operational_domain_worker_pool(std::filesystem::path            dir,
+                                                             shared_directory_worker_pool_params ps = {}) :
+            operational_domain_worker_pool(),
+            directory{std::move(dir)},
+            params{ps}
+    {
+        std::filesystem::create_directories(directory);
+
+        for (const auto& entry : std::filesystem::directory_iterator{directory})
+        {
+            const auto filename = entry.path().filename().string();
+
+            if (filename == detail::OPERATIONAL_DOMAIN_DONE_FILE || filename.rfind("batch_", 0) == 0 ||
+                filename.rfind("result_", 0) == 0)
+            {
+                std::error_code ec{};
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+    }
+    /**
+     * Copy constructor is deleted.
+     */
+    shared_directory_operational_domain_worker_pool(const shared_directory_operational_domain_worker_pool&) = delete;
+    /**
+     * Move constructor is deleted.
+     */
+    shared_directory_operational_domain_worker_pool(shared_directory_operational_domain_worker_pool&&) = delete;
+    /**
+     * Copy assignment operator is deleted.
+     */
+    shared_directory_operational_domain_worker_pool&
+    operator=(const shared_directory_operational_domain_worker_pool&) = delete;
+    /**
+     * Move assignment operator is deleted.
+     */
+    shared_directory_operational_domain_worker_pool&
+    operator=(shared_directory_operational_domain_worker_pool&&) = delete;
+    /**
+     * Destructor. Signals the workers to terminate.
+     */
+    ~shared_directory_operational_domain_worker_pool() override
+    {
+        finish();
+    }
+    /**
+     * Returns the number of batches that are kept in flight.
+     *
+     * @return Number of concurrently submitted batches.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept override
+    {
+        return params.capacity;
+    }
+    /**
+     * Writes the batch to the shared directory.
+     *
+     * @param batch Batch of parameter points to evaluate.
+     * @throws std::ofstream::failure if the batch file could not be written.
+     */
+    void submit(const operational_domain_batch& batch) override
+    {
+        write_batch(batch);
+
+        pending[batch.id] = pending_batch{batch, std::nullopt};
+    }
+    /**
+     * Polls the shared directory until the result of a pending batch is available. Results of batches that were
+     * already collected, e.g., because a resubmitted batch was evaluated twice, are discarded. Malformed results as
+     * well as results whose number of statuses does not match their batch are discarded, too, and the respective
+     * batch is handed out again.
+     *
+     * @return Result of an evaluated batch.
+     * @throws std::ofstream::failure if a batch file could not be written.
+     */
+    [[nodiscard]] operational_domain_batch_result collect() override
+    {
+        while (true)
+        {
+            for (const auto& entry : std::filesystem::directory_iterator{directory})
+            {
+                const auto id = detail::operational_domain_file_id(entry.path().filename().string(), "result_", ".txt");
+
+                if (!id.has_value())
+                {
+                    continue;
+                }
+
+                std::optional<operational_domain_batch_result> result{};
+
+                {
+                    std::ifstream is{entry.path()};
+                    result = detail::read_operational_domain_batch_result(is);
+                }
+
+                std::error_code ec{};
+                std::filesystem::remove(entry.path(), ec);
+
+                const auto it = pending.find(*id);
+
+                if (it == pending.cend())
+                {
+                    continue;
+                }
+
+                if (result.has_value() && result->id == *id &&
+                    result->statuses.size() == it->second.batch.step_points.size())
+                {
+                    pending.erase(it);
+
+                    return *result;
+                }
+
+                // the worker already released its claim, so the batch has to be handed out again
+                resubmit(it->second);
+            }
+
+            resubmit_overdue_batches();
+
+            std::this_thread::sleep_for(params.poll_interval);
+        }
+    }
+    /**
+     * Signals the workers that the computation has finished. Called automatically upon destruction.
+     */
+    void finish() noexcept
+    {
+        static_cast<void>(write_file_atomically((directory / detail::OPERATIONAL_DOMAIN_DONE_FILE).string(),
+                                                [](std::ostream& os) { os << '\n'; }));
+    }
+
+  private:
+    /**
+     * Shared directory.
+     */
+    const std::filesystem::path directory;
+    /**
+     * Parameters.
+     */
+    const shared_directory_worker_pool_params params;
+    /**
+     * A batch whose result has not yet been collected.
+     */
+    struct pending_batch
+    {
+        /**
+         * The batch as it was submitted.
+         */
+        operational_domain_batch batch;
+        /**
+         * Time at which the coordinator first observed that a worker claimed the batch, if it did so.
+         */
+        std::optional<std::chrono::steady_clock::time_point> claimed_at;
+    };
+    /**
+     * All batches whose results have not yet been collected.
+     */
+    std::unordered_map<uint64_t, pending_batch> pending{};
+    /**
+     * Writes the given batch to the shared directory.
+     *
+     * @param batch Batch to write.
+     * @throws std::ofstream::failure if the batch file could not be written.
+     */
+    void write_batch(const operational_domain_batch& batch) const
+    {
+        if (!write_file_atomically((directory / detail::operational_domain_batch_file(batch.id)).string(),
+                                   [&batch](std::ostream& os) { detail::write_operational_domain_batch(batch, os); }))
+        {
+            throw std::ofstream::failure("could not write batch file");
+        }
+    }
+    /**
+     * Hands out the given pending batch again.
+     *
+     * @param pb Pending batch to resubmit.
+     * @throws std::ofstream::failure if the batch file could not be written.
+     */
+    void resubmit(pending_batch& pb) const
+    {
+        write_batch(pb.batch);
+
+        pb.claimed_at = std::nullopt;
+    }
+    /**
+     * Hands out batches again that were claimed by a worker longer than `resubmission_timeout` ago without a result.
+     * Since workers claim batches by renaming them, the claim time is the time at which the coordinator first observes
+     * the claimed file. Time that a batch spends waiting for a worker thus does not count towards the timeout.
+     */
+    void resubmit_overdue_batches()
+    {
+        if (params.resubmission_timeout.count() == 0)
+        {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+
+        for (const auto& entry : std::filesystem::directory_iterator{directory})
+        {
+            const auto filename = entry.path().filename().string();
+
+            if (filename.rfind("batch_", 0) != 0 || filename.size() < 8 ||
+                filename.compare(filename.size() - 8, 8, ".claimed") != 0)
+            {
+                continue;
+            }
+
+            // claimed files are named `batch_<id>.txt.<worker>.claimed`
+            const auto id = detail::operational_domain_file_id(filename.substr(0, filename.find(".txt") + 4), "batch_",
+                                                               ".txt");
+
+            if (!id.has_value())
+            {
+                continue;
+            }
+
+            const auto it = pending.find(*id);
+
+            if (it == pending.cend())
+            {
+                continue;
+            }
+
+            if (!it->second.claimed_at.has_value())
+            {
+                it->second.claimed_at = now;
+            }
+            else if (now - *it->second.claimed_at >= params.resubmission_timeout)
+            {
+                std::error_code ec{};
+                std::filesystem::rename(entry.path(), directory / detail::operational_domain_batch_file(*id), ec);
+
+                it->second.claimed_at = std::nullopt;
+            }
+        }
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_OPERATIONAL_DOMAIN_WORKER_POOL_HPP
@@ -135,8 +135,22 @@ class physical_population_stability_impl
     [[nodiscard]] std::vector<population_stability_information<Lyt>> run() noexcept
     {
         const quickexact_params<cell<Lyt>> quickexact_parameters{params.simulation_parameters};
-        const auto                         simulation_results = quickexact(layout, quickexact_parameters);
-        const auto energy_and_unique_charge_index             = collect_energy_and_charge_index(simulation_results);
+
+        return run(quickexact(layout, quickexact_parameters));
+    }
+    /**
+     * Determines the population stability of all physically valid charge distributions in the given simulation
+     * results instead of simulating the layout. Thereby, the population stability can be assessed from simulation
+     * results that are shared with other figures of merit.
+     *
+     * @param simulation_results Physically valid charge distributions of the layout.
+     * @return A vector of population stability information structures, where each element represents a charge
+     * distribution in ascending energy order.
+     */
+    [[nodiscard]] std::vector<population_stability_information<Lyt>>
+    run(const sidb_simulation_result<Lyt>& simulation_results) noexcept
+    {
+        const auto energy_and_unique_charge_index = collect_energy_and_charge_index(simulation_results);
 
         std::vector<population_stability_information<Lyt>> popstability_information{};
         popstability_information.reserve(simulation_results.charge_distributions.size());
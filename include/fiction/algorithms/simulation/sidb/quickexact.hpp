@@ -14,6 +14,7 @@
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
@@ -570,6 +571,8 @@ template <typename Lyt>
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
+    FICTION_TRACE_ZONE("quickexact");
+
     detail::quickexact_impl<Lyt> p{lyt, params};
 
     return p.run();
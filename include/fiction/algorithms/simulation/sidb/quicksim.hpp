@@ -12,6 +12,7 @@
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/execution_utils.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
@@ -77,6 +78,8 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
     static_assert(!is_sidb_defect_surface_v<Lyt>,
                   "Lyt cannot be an SiDB defect surface, defects are not supported by the QuickSim algorithm");
 
+    FICTION_TRACE_ZONE("quicksim");
+
     if (ps.iteration_steps == 0)
     {
         return std::nullopt;
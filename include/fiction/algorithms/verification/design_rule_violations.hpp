@@ -12,10 +12,21 @@
 #include <fmt/ranges.h>
 #include <mockturtle/traits.hpp>
 #include <nlohmann/json.hpp>
-
+#include <phmap.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -75,8 +86,21 @@ struct gate_level_drv_params
      */
     bool border_io = true;
 
+    // Performance
+
+    /**
+     * Generate the detailed JSON report that lists all affected tiles and nodes per check. If `false`, only the number
+     * of DRVs and warnings are determined, which is considerably faster on large layouts.
+     */
+    bool generate_report = true;
+    /**
+     * Maximum number of threads to use for the tile-local checks. Layouts with only few occupied tiles are always
+     * checked sequentially.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+
     /**
-     * Stream to write the report into.
+     * Stream to write the report into. If `nullptr`, nothing is printed.
      */
     std::ostream* out = &std::cout;
 };
@@ -100,10 +124,73 @@ struct gate_level_drv_stats
 namespace detail
 {
 
+/**
+ * Design rule violations and warnings that are local to a single tile, i.e., that can be determined by inspecting only
+ * the tile, its adjacent tiles, and the tiles of its children.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+struct tile_drvs
+{
+    /**
+     * The tile hosts a dead node.
+     */
+    bool placed_dead{false};
+    /**
+     * The tile is missing an incoming or outgoing connection.
+     */
+    bool missing_connection{false};
+    /**
+     * The tile hosts a wire that crosses a gate.
+     */
+    bool crossing_gate{false};
+    /**
+     * Tiles of children that are not adjacent to the tile.
+     */
+    std::vector<tile<Lyt>> non_adjacent_children{};
+    /**
+     * Tiles of children whose clocking does not allow for data flow to the tile.
+     */
+    std::vector<tile<Lyt>> improperly_clocked_children{};
+    /**
+     * Returns the number of design rule violations at the tile.
+     *
+     * @return Number of DRVs.
+     */
+    [[nodiscard]] std::size_t num_drvs() const noexcept
+    {
+        return non_adjacent_children.size() + improperly_clocked_children.size() +
+               static_cast<std::size_t>(missing_connection) + static_cast<std::size_t>(crossing_gate);
+    }
+    /**
+     * Returns the number of warnings at the tile.
+     *
+     * @return Number of warnings.
+     */
+    [[nodiscard]] std::size_t num_warnings() const noexcept
+    {
+        return static_cast<std::size_t>(placed_dead);
+    }
+    /**
+     * Checks whether neither DRVs nor warnings were found at the tile.
+     *
+     * @return `true` iff the tile is free of issues.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return num_drvs() + num_warnings() == 0;
+    }
+};
+
 template <typename Lyt>
 class gate_level_drvs_impl
 {
   public:
+    /**
+     * Tile-local check results of all tiles that exhibit at least one DRV or warning.
+     */
+    using tile_drvs_list = std::vector<std::pair<tile<Lyt>, tile_drvs<Lyt>>>;
     /**
      * Standard constructor.
      *
@@ -130,67 +217,254 @@ class gate_level_drvs_impl
      *   - Unplaced (alive) nodes
      *   - Non-wire I/O
      *   - Non-border I/O
+     *
+     * All tile-local properties are checked in a single (possibly parallel) pass over the occupied tiles.
      */
     void run()
     {
-        *ps.out << "[i] Topology:\n";
+        run(check_tiles(lyt, ps, occupied_tiles(lyt)));
+    }
+    /**
+     * Performs design rule checks on the stored gate layout like `run()` but uses the given results of the tile-local
+     * checks instead of computing them. This allows incremental checkers to only re-evaluate tiles that have changed.
+     *
+     * @param tile_results Results of the tile-local checks of all tiles that exhibit at least one issue.
+     */
+    void run(const tile_drvs_list& tile_results)
+    {
+        print("[i] Topology:\n");
         if (ps.unplaced_nodes)
         {
-            *ps.out << "[i]" << unplaced_nodes_check() << '\n';
+            print(fmt::format("[i]{}\n", unplaced_nodes_check()));
         }
         if (ps.placed_dead_nodes)
         {
-            *ps.out << "[i]" << placed_dead_nodes_check() << '\n';
+            print(fmt::format("[i]{}\n", placed_dead_nodes_check(tile_results)));
         }
         if (ps.non_adjacent_connections)
         {
-            *ps.out << "[i]" << non_adjacent_connections_check() << '\n';
+            print(fmt::format("[i]{}\n", non_adjacent_connections_check(tile_results)));
         }
         if (ps.missing_connections)
         {
-            *ps.out << "[i]" << missing_connections_check() << '\n';
+            print(fmt::format("[i]{}\n", missing_connections_check(tile_results)));
         }
         if (ps.crossing_gates)
         {
-            *ps.out << "[i]" << crossing_gates_check() << '\n';
+            print(fmt::format("[i]{}\n", crossing_gates_check(tile_results)));
         }
-        *ps.out << '\n';
+        print("\n");
 
-        *ps.out << "[i] Clocking:\n";
+        print("[i] Clocking:\n");
         if (ps.clocked_data_flow)
         {
-            *ps.out << "[i]" << clocked_data_flow_check() << '\n';
+            print(fmt::format("[i]{}\n", clocked_data_flow_check(tile_results)));
         }
-        *ps.out << '\n';
+        print("\n");
 
-        *ps.out << "[i] I/O ports:\n";
+        print("[i] I/O ports:\n");
         if (ps.has_io)
         {
-            *ps.out << "[i]" << has_io_check() << '\n';
+            print(fmt::format("[i]{}\n", has_io_check()));
         }
         if (ps.empty_io)
         {
-            *ps.out << "[i]" << empty_io_check() << '\n';
+            print(fmt::format("[i]{}\n", empty_io_check()));
         }
         if (ps.io_pins)
         {
-            *ps.out << "[i]" << io_pin_check() << '\n';
+            print(fmt::format("[i]{}\n", io_pin_check()));
         }
         if (ps.border_io)
         {
-            *ps.out << "[i]" << border_io_check() << '\n';
+            print(fmt::format("[i]{}\n", border_io_check()));
         }
 
-        *ps.out << fmt::format(
-                       "\n[i] DRVs: {}, Warnings: {}",
-                       (pst.drvs != 0u ? fmt::format(fmt::fg(fmt::color::red), std::to_string(pst.drvs)) : ZERO_ISSUES),
-                       (pst.warnings != 0u ? fmt::format(fmt::fg(fmt::color::yellow), std::to_string(pst.warnings)) :
-                                             ZERO_ISSUES))
-                << std::endl;
+        if (ps.out != nullptr)
+        {
+            *ps.out << fmt::format("\n[i] DRVs: {}, Warnings: {}",
+                                   (pst.drvs != 0u ? fmt::format(fmt::fg(fmt::color::red), std::to_string(pst.drvs)) :
+                                                     ZERO_ISSUES),
+                                   (pst.warnings != 0u ?
+                                        fmt::format(fmt::fg(fmt::color::yellow), std::to_string(pst.warnings)) :
+                                        ZERO_ISSUES))
+                    << std::endl;
+        }
 
         pst.report["DRVs"]     = pst.drvs;
         pst.report["Warnings"] = pst.warnings;
     }
+    /**
+     * Collects all tiles of the given layout that have a node assigned to them. In contrast to iterating over all
+     * tiles via `foreach_tile`, the runtime is independent of the layout's area.
+     *
+     * @param layout Gate-level layout.
+     * @return All occupied tiles in `layout`.
+     */
+    [[nodiscard]] static std::vector<tile<Lyt>> occupied_tiles(const Lyt& layout) noexcept
+    {
+        std::vector<tile<Lyt>> tiles{};
+        tiles.reserve(layout.strg->data.tile_node_map.size());
+
+        for (const auto& [t, n] : layout.strg->data.tile_node_map)
+        {
+            // skip the constants' reserved tiles
+            if (!layout.is_constant(n))
+            {
+                tiles.push_back(static_cast<tile<Lyt>>(t));
+            }
+        }
+
+        return tiles;
+    }
+    /**
+     * Returns the tiles that the children of the node on the given tile point to.
+     *
+     * @param layout Gate-level layout.
+     * @param t Tile whose children are desired.
+     * @return Tiles of the incoming signals of the node placed on `t`.
+     */
+    [[nodiscard]] static std::vector<tile<Lyt>> child_tiles(const Lyt& layout, const tile<Lyt>& t) noexcept
+    {
+        std::vector<tile<Lyt>> children{};
+
+        if (const auto n = layout.get_node(t); !layout.is_constant(n))
+        {
+            const auto& node_children = layout.strg->nodes[n].children;
+            children.reserve(node_children.size());
+
+            std::transform(node_children.cbegin(), node_children.cend(), std::back_inserter(children),
+                           [](const auto& c) { return static_cast<tile<Lyt>>(c.index); });
+        }
+
+        return children;
+    }
+    /**
+     * Performs all tile-local checks that are enabled in the given parameters on tile `t`.
+     *
+     * @param layout Gate-level layout.
+     * @param params Parameters.
+     * @param t Occupied tile to check.
+     * @return Issues found at `t`.
+     */
+    [[nodiscard]] static tile_drvs<Lyt> check_tile(const Lyt& layout, const gate_level_drv_params& params,
+                                                   const tile<Lyt>& t) noexcept
+    {
+        tile_drvs<Lyt> result{};
+
+        if (layout.is_empty_tile(t))
+        {
+            return result;
+        }
+
+        const auto n = layout.get_node(t);
+
+        // if the node is dead but placed
+        if (params.placed_dead_nodes && layout.is_dead(n))
+        {
+            result.placed_dead = true;
+        }
+
+        if (params.non_adjacent_connections || params.clocked_data_flow)
+        {
+            for (const auto& child : layout.strg->nodes[n].children)
+            {
+                const auto ct = layout.get_tile(layout.get_node(child.index));
+
+                if (params.non_adjacent_connections && !layout.is_adjacent_elevation_of(t, ct))
+                {
+                    result.non_adjacent_children.push_back(ct);
+                }
+                if (params.clocked_data_flow && !layout.is_incoming_clocked(t, ct))
+                {
+                    result.improperly_clocked_children.push_back(ct);
+                }
+            }
+        }
+
+        if (params.missing_connections)
+        {
+            const bool dangling_inp_connection = layout.fanin_size(n) == 0 && !layout.is_pi_tile(t);
+            const bool dangling_out_connection = layout.fanout_size(n) == 0 && !layout.is_po_tile(t);
+
+            result.missing_connection = dangling_inp_connection || dangling_out_connection;
+        }
+
+        if (params.crossing_gates && layout.is_wire(n) && !layout.is_dead(n) && layout.is_crossing_layer(t))
+        {
+            result.crossing_gate = !layout.is_wire_tile(layout.below(t));
+        }
+
+        return result;
+    }
+    /**
+     * Performs the tile-local checks on all given tiles. If the parameters allow for it and enough tiles are given,
+     * the tiles are distributed evenly among multiple threads.
+     *
+     * @param layout Gate-level layout.
+     * @param params Parameters.
+     * @param tiles Tiles to check.
+     * @return Check results of all tiles in `tiles` that exhibit at least one issue.
+     */
+    [[nodiscard]] static tile_drvs_list check_tiles(const Lyt& layout, const gate_level_drv_params& params,
+                                                    const std::vector<tile<Lyt>>& tiles)
+    {
+        const auto check_range = [&layout, &params, &tiles](const std::size_t begin, const std::size_t end)
+        {
+            tile_drvs_list results{};
+
+            for (auto i = begin; i < end; ++i)
+            {
+                if (auto result = check_tile(layout, params, tiles[i]); !result.empty())
+                {
+                    results.emplace_back(tiles[i], std::move(result));
+                }
+            }
+
+            return results;
+        };
+
+        const auto num_threads =
+            std::max(std::min(params.num_threads, tiles.size() / MIN_TILES_PER_THREAD), std::size_t{1});
+
+        if (num_threads == 1)
+        {
+            return check_range(0, tiles.size());
+        }
+
+        std::vector<tile_drvs_list> thread_results(num_threads);
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        const auto chunk_size = (tiles.size() + num_threads - 1) / num_threads;  // ceiling division
+
+        for (std::size_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back(
+                [&check_range, &thread_results, &tiles, chunk_size, i]
+                {
+                    const auto begin = std::min(i * chunk_size, tiles.size());
+                    const auto end   = std::min(begin + chunk_size, tiles.size());
+
+                    thread_results[i] = check_range(begin, end);
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        tile_drvs_list results{};
+
+        for (auto& thread_result : thread_results)
+        {
+            std::move(thread_result.begin(), thread_result.end(), std::back_inserter(results));
+        }
+
+        return results;
+    }
 
   private:
     /**
@@ -206,6 +480,10 @@ class gate_level_drvs_impl
      */
     gate_level_drv_stats& pst;
 
+    /**
+     * Minimum number of tiles that a thread has to check to be worth spawning.
+     */
+    static constexpr const std::size_t MIN_TILES_PER_THREAD = 4096ul;
     /**
      * Escape color sequence for passed checks followed by a check mark.
      */
@@ -223,15 +501,32 @@ class gate_level_drvs_impl
      */
     inline static const auto ZERO_ISSUES = fmt::format(fmt::fg(fmt::color::green), "0");
 
+    /**
+     * Writes the given message to the output stream if one is specified.
+     *
+     * @param msg Message to print.
+     */
+    void print(const std::string& msg) const
+    {
+        if (ps.out != nullptr)
+        {
+            *ps.out << msg;
+        }
+    }
     /**
      * Logs information about the given tile in the given report. Nodes are logged in this process under the tile
-     * position.
+     * position. Does nothing if no report is to be generated.
      *
      * @param t Tile whose attributes are to be logged.
      * @param report Report to log into.
      */
     void log_tile(const tile<Lyt> t, nlohmann::json& report) const noexcept
     {
+        if (!ps.generate_report)
+        {
+            return;
+        }
+
         std::stringstream s{};
 
         if (lyt.is_empty_tile(t))
@@ -267,7 +562,23 @@ class gate_level_drvs_impl
 
     void log_node(const mockturtle::node<Lyt>& n, nlohmann::json& report) const noexcept
     {
-        report[n] = lyt.node_to_index(n);
+        if (ps.generate_report)
+        {
+            report[n] = lyt.node_to_index(n);
+        }
+    }
+    /**
+     * Stores the given check report under the given name if a report is to be generated.
+     *
+     * @param name Name of the check.
+     * @param check_report Report of the check.
+     */
+    void store_report(const char* name, nlohmann::json&& check_report) const
+    {
+        if (ps.generate_report)
+        {
+            pst.report[name] = std::move(check_report);
+        }
     }
     /**
      * Generates a summarizing one liner for a design rule check.
@@ -312,197 +623,139 @@ class gate_level_drvs_impl
                 });
         }
 
-        pst.report["Unplaced nodes"] = unplaced_report;
+        store_report("Unplaced nodes", std::move(unplaced_report));
 
         return summary("all nodes are properly placed", all_placed, false);
     }
     /**
-     * Checks for nodes that are placed but dead.
+     * Evaluates the tile-local check for nodes that are placed but dead.
      *
+     * @param tile_results Results of the tile-local checks.
      * @return Check summary as a one liner.
      */
-    std::string placed_dead_nodes_check()
+    std::string placed_dead_nodes_check(const tile_drvs_list& tile_results)
     {
         nlohmann::json placed_dead_report{};
 
         auto all_alive = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, result] : tile_results)
         {
-            lyt.foreach_tile(
-                [&placed_dead_report, &all_alive, this](const auto& t)
-                {
-                    // skip empty tiles
-                    if (!lyt.is_empty_tile(t))
-                    {
-                        const auto n = lyt.get_node(t);
-
-                        // if the node is dead but placed
-                        if (lyt.is_dead(n))
-                        {
-                            all_alive = false;
-                            log_tile(t, placed_dead_report);
-                            ++pst.warnings;
-                        }
-                    }
-                });
+            if (result.placed_dead)
+            {
+                all_alive = false;
+                log_tile(t, placed_dead_report);
+                ++pst.warnings;
+            }
         }
 
-        pst.report["Dead placed nodes"] = placed_dead_report;
+        store_report("Dead placed nodes", std::move(placed_dead_report));
 
         return summary("all placed nodes are alive", all_alive, false);
     }
     /**
-     * Checks for proper clocking of connected tiles based on their assigned nodes.
+     * Evaluates the tile-local check for connections between non-adjacent tiles.
      *
+     * @param tile_results Results of the tile-local checks.
      * @return Check summary as a one liner.
      */
-    std::string non_adjacent_connections_check()
+    std::string non_adjacent_connections_check(const tile_drvs_list& tile_results)
     {
         nlohmann::json non_adjacency_report{};
 
         auto adjacencies_respected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, result] : tile_results)
         {
-            lyt.foreach_tile(
-                [this, &non_adjacency_report, &adjacencies_respected](const auto& t)
-                {
-                    // skip empty tiles
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    for (const auto& child : lyt.strg->nodes[n].children)
-                    {
-                        const auto ct = lyt.get_tile(lyt.get_node(child.index));
-                        if (!lyt.is_adjacent_elevation_of(t, ct))
-                        {
-                            adjacencies_respected = false;
-                            log_tile(ct, non_adjacency_report);
-                            log_tile(t, non_adjacency_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            for (const auto& ct : result.non_adjacent_children)
+            {
+                adjacencies_respected = false;
+                log_tile(ct, non_adjacency_report);
+                log_tile(t, non_adjacency_report);
+                ++pst.drvs;
+            }
         }
 
-        pst.report["Non adjacent connections"] = non_adjacency_report;
+        store_report("Non adjacent connections", std::move(non_adjacency_report));
 
         return summary("all tiles are adjacently connected", adjacencies_respected, true);
     }
     /**
-     * Checks for non-PO tiles with successors and non-PI tiles without predecessors.
+     * Evaluates the tile-local check for non-PO tiles without successors and non-PI tiles without predecessors.
      *
+     * @param tile_results Results of the tile-local checks.
      * @return Check summary as a one liner.
      */
-    std::string missing_connections_check()
+    std::string missing_connections_check(const tile_drvs_list& tile_results)
     {
         nlohmann::json connections_report{};
 
         auto all_connected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, result] : tile_results)
         {
-            lyt.foreach_tile(
-                [this, &connections_report, &all_connected](const auto& t)
-                {
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    const bool dangling_inp_connection = lyt.fanin_size(n) == 0 && !lyt.is_pi_tile(t);
-                    const bool dangling_out_connection = lyt.fanout_size(n) == 0 && !lyt.is_po_tile(t);
-
-                    if (dangling_out_connection || dangling_inp_connection)
-                    {
-                        all_connected = false;
-                        log_tile(t, connections_report);
-                        ++pst.drvs;
-                    }
-                });
+            if (result.missing_connection)
+            {
+                all_connected = false;
+                log_tile(t, connections_report);
+                ++pst.drvs;
+            }
         }
 
-        pst.report["Missing connections"] = connections_report;
+        store_report("Missing connections", std::move(connections_report));
 
         return summary("all occupied tiles are properly connected", all_connected, true);
     }
     /**
-     * Check for wires crossing gates.
+     * Evaluates the tile-local check for wires crossing gates.
      *
+     * @param tile_results Results of the tile-local checks.
      * @return Check summary as a one liner.
      */
-    std::string crossing_gates_check()
+    std::string crossing_gates_check(const tile_drvs_list& tile_results)
     {
         nlohmann::json crossing_report{};
 
         auto all_wire_crossings = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, result] : tile_results)
         {
-            lyt.foreach_wire(
-                [this, &crossing_report, &all_wire_crossings](const auto& w)
-                {
-                    if (const auto t = lyt.get_tile(w); lyt.is_crossing_layer(t))
-                    {
-                        if (!lyt.is_wire_tile(lyt.below(t)))
-                        {
-                            all_wire_crossings = false;
-                            log_tile(t, crossing_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            if (result.crossing_gate)
+            {
+                all_wire_crossings = false;
+                log_tile(t, crossing_report);
+                ++pst.drvs;
+            }
         }
 
-        pst.report["Wires crossing gates"] = crossing_report;
+        store_report("Wires crossing gates", std::move(crossing_report));
 
         return summary("all wire crossings cross over other wires only", all_wire_crossings, true);
     }
     /**
-     * Checks for proper clocking of connected tiles based on their assigned nodes.
+     * Evaluates the tile-local check for proper clocking of connected tiles.
      *
+     * @param tile_results Results of the tile-local checks.
      * @return Check summary as a one liner.
      */
-    std::string clocked_data_flow_check()
+    std::string clocked_data_flow_check(const tile_drvs_list& tile_results)
     {
         nlohmann::json data_flow_report{};
 
         auto data_flow_respected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, result] : tile_results)
         {
-            lyt.foreach_tile(
-                [this, &data_flow_report, &data_flow_respected](const auto& t)
-                {
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    for (const auto& child : lyt.strg->nodes[n].children)
-                    {
-                        const auto ct = lyt.get_tile(lyt.get_node(child.index));
-                        if (!lyt.is_incoming_clocked(t, ct))
-                        {
-                            data_flow_respected = false;
-                            log_tile(ct, data_flow_report);
-                            log_tile(t, data_flow_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            for (const auto& ct : result.improperly_clocked_children)
+            {
+                data_flow_respected = false;
+                log_tile(ct, data_flow_report);
+                log_tile(t, data_flow_report);
+                ++pst.drvs;
+            }
         }
 
-        pst.report["Improperly clocked tiles"] = data_flow_report;
+        store_report("Improperly clocked tiles", std::move(data_flow_report));
 
         return summary("all connected tiles are properly clocked", data_flow_respected, true);
     }
@@ -546,7 +799,7 @@ class gate_level_drvs_impl
             }
         }
 
-        pst.report["I/O counts"] = has_io_report;
+        store_report("I/O counts", std::move(has_io_report));
 
         return summary("all I/O are properly specified", ios_present, true);
     }
@@ -577,7 +830,7 @@ class gate_level_drvs_impl
             lyt.foreach_po([this, &check_io](const auto& o) { check_io(lyt.get_node(o)); });
         }
 
-        pst.report["Empty I/O ports"] = empty_io_report;
+        store_report("Empty I/O ports", std::move(empty_io_report));
 
         return summary("all I/O ports are assigned to a non-empty tile", all_non_empty, true);
     }
@@ -608,7 +861,7 @@ class gate_level_drvs_impl
             lyt.foreach_po([this, &check_io](const auto& o) { check_io(lyt.get_node(o)); });
         }
 
-        pst.report["Gate I/O ports"] = io_pin_report;
+        store_report("Gate I/O ports", std::move(io_pin_report));
 
         return summary("all I/O ports are realized by designated pins", all_pin, false);
     }
@@ -639,7 +892,7 @@ class gate_level_drvs_impl
             lyt.foreach_po([this, &check_io](const auto& o) { check_io(lyt.get_node(o)); });
         }
 
-        pst.report["Border I/O ports"] = border_report;
+        store_report("Border I/O ports", std::move(border_report));
 
         return summary("all I/O ports are located at the layout's borders", all_border, false);
     }
@@ -686,6 +939,314 @@ void gate_level_drvs(const Lyt& lyt, const gate_level_drv_params& ps = {}, gate_
     }
 }
 
+/**
+ * An incremental design rule violation (DRV) checker for gate-level layouts. While `gate_level_drvs` inspects the
+ * entire layout on every call, this checker subscribes to the layout's network events and, on each call to `check`,
+ * re-evaluates only those tile-local checks that could have been affected by modifications since the previous call.
+ * Affected are all tiles that have been touched by creating, moving, reconnecting, or removing nodes, as well as their
+ * adjacent tiles and all tiles whose nodes have incoming signals pointing to them. The I/O checks and the check for
+ * unplaced nodes do not depend on single tiles and are re-evaluated on every call.
+ *
+ * This is beneficial in optimization loops that apply small modifications to large layouts and need to ensure that
+ * no DRVs were introduced.
+ *
+ * @note Modifications that do not stem from node manipulation, e.g., re-assigning clock numbers or resizing the
+ * layout, are not observed. Call `invalidate` after such modifications to enforce a full check.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+class incremental_gate_level_drvs
+{
+  public:
+    /**
+     * Standard constructor. Registers the event handlers on the given layout. The first call to `check` performs a
+     * full check.
+     *
+     * @param src Gate-level layout to observe. The layout must outlive the checker.
+     * @param p Parameters.
+     */
+    explicit incremental_gate_level_drvs(const Lyt& src, const gate_level_drv_params& p = {}) : lyt{src}, ps{p}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+        modified_event = lyt.events().register_modified_event(
+            [this](const auto& n, const auto& previous_children)
+            {
+                touch(lyt.get_tile(n));
+
+                // the fanouts of the previous children changed as well, even if they are not adjacent to n
+                for (const auto& c : previous_children)
+                {
+                    touch_child(static_cast<tile<Lyt>>(c));
+                }
+            });
+        delete_event = lyt.events().register_delete_event([this](const auto& n) { touch(lyt.get_tile(n)); });
+    }
+    /**
+     * Destructor. Releases the event handlers.
+     */
+    ~incremental_gate_level_drvs()
+    {
+        lyt.events().release_modified_event(modified_event);
+        lyt.events().release_delete_event(delete_event);
+    }
+
+    incremental_gate_level_drvs(const incremental_gate_level_drvs&)            = delete;
+    incremental_gate_level_drvs(incremental_gate_level_drvs&&)                 = delete;
+    incremental_gate_level_drvs& operator=(const incremental_gate_level_drvs&) = delete;
+    incremental_gate_level_drvs& operator=(incremental_gate_level_drvs&&)      = delete;
+    /**
+     * Performs design rule checks on the observed layout. The result is identical to that of `gate_level_drvs`.
+     *
+     * @return Statistics containing the number of DRVs and warnings and, if enabled, the report.
+     */
+    gate_level_drv_stats check()
+    {
+        using impl = detail::gate_level_drvs_impl<Lyt>;
+
+        std::vector<tile<Lyt>> tiles_to_check{};
+
+        if (full_check_required)
+        {
+            tile_results.clear();
+            children.clear();
+            parents.clear();
+
+            tiles_to_check = impl::occupied_tiles(lyt);
+
+            full_check_required = false;
+        }
+        else
+        {
+            // nodes are never deleted from the storage; hence, nodes created since the last check are appended
+            for (auto n = static_cast<mockturtle::node<Lyt>>(num_known_nodes); n < lyt.size(); ++n)
+            {
+                touch(lyt.get_tile(n));
+            }
+
+            tiles_to_check = affected_tiles();
+        }
+
+        touched_tiles.clear();
+        touched_children.clear();
+        num_known_nodes = lyt.size();
+
+        // update the signal structure, which is required to determine affected tiles in subsequent checks
+        for (const auto& t : tiles_to_check)
+        {
+            update_children(t);
+        }
+
+        // discard outdated results and re-evaluate
+        for (const auto& t : tiles_to_check)
+        {
+            tile_results.erase(t);
+        }
+
+        for (auto&& [t, result] : impl::check_tiles(lyt, ps, tiles_to_check))
+        {
+            tile_results[t] = std::move(result);
+        }
+
+        num_rechecked = tiles_to_check.size();
+
+        const typename impl::tile_drvs_list results(tile_results.cbegin(), tile_results.cend());
+
+        gate_level_drv_stats st{};
+        impl                 p{lyt, ps, st};
+
+        p.run(results);
+
+        return st;
+    }
+    /**
+     * Enforces a full check on the next call to `check`.
+     */
+    void invalidate() noexcept
+    {
+        full_check_required = true;
+    }
+    /**
+     * Returns the number of tiles whose local checks were re-evaluated during the last call to `check`.
+     *
+     * @return Number of re-evaluated tiles.
+     */
+    [[nodiscard]] std::size_t num_rechecked_tiles() const noexcept
+    {
+        return num_rechecked;
+    }
+
+  private:
+    /**
+     * The observed layout.
+     */
+    const Lyt lyt;
+    /**
+     * Parameters.
+     */
+    const gate_level_drv_params ps;
+    /**
+     * Event type for node modifications.
+     */
+    using modified_event_type =
+        typename std::remove_reference_t<decltype(std::declval<const Lyt&>().events())>::modified_event_type;
+    /**
+     * Event type for node deletions.
+     */
+    using delete_event_type =
+        typename std::remove_reference_t<decltype(std::declval<const Lyt&>().events())>::delete_event_type;
+    /**
+     * Handler for node modifications.
+     */
+    std::shared_ptr<modified_event_type> modified_event;
+    /**
+     * Handler for node deletions.
+     */
+    std::shared_ptr<delete_event_type> delete_event;
+    /**
+     * Flag to indicate that all tiles need to be checked.
+     */
+    bool full_check_required{true};
+    /**
+     * Number of nodes in the layout at the time of the last check.
+     */
+    std::size_t num_known_nodes{0};
+    /**
+     * Number of tiles that were re-evaluated during the last check.
+     */
+    std::size_t num_rechecked{0};
+    /**
+     * Tiles that were modified since the last check.
+     */
+    phmap::flat_hash_set<tile<Lyt>> touched_tiles{};
+    /**
+     * Tiles whose fanouts were modified since the last check because they were disconnected from a modified node.
+     */
+    phmap::flat_hash_set<tile<Lyt>> touched_children{};
+    /**
+     * Tile-local check results of all tiles that exhibit at least one issue.
+     */
+    phmap::flat_hash_map<tile<Lyt>, detail::tile_drvs<Lyt>> tile_results{};
+    /**
+     * Tiles that the incoming signals of a tile pointed to at the time of its last check.
+     */
+    phmap::flat_hash_map<tile<Lyt>, std::vector<tile<Lyt>>> children{};
+    /**
+     * Inverse of `children`, i.e., tiles whose incoming signals pointed to a tile at the time of their last check.
+     */
+    phmap::flat_hash_map<tile<Lyt>, phmap::flat_hash_set<tile<Lyt>>> parents{};
+
+    /**
+     * Marks the given tile as modified.
+     *
+     * @param t Modified tile.
+     */
+    void touch(const tile<Lyt>& t)
+    {
+        if (!t.is_dead())
+        {
+            touched_tiles.insert(t);
+        }
+    }
+    /**
+     * Marks the given tile as a tile whose fanouts were modified.
+     *
+     * @param t Tile whose fanouts were modified.
+     */
+    void touch_child(const tile<Lyt>& t)
+    {
+        if (!t.is_dead())
+        {
+            touched_children.insert(t);
+        }
+    }
+    /**
+     * Computes all tiles whose local check results could have changed due to the touched tiles, i.e., the touched
+     * tiles, their adjacent tiles, the tiles they were or are connected to, and the tiles whose fanouts changed.
+     *
+     * @return Affected tiles.
+     */
+    [[nodiscard]] std::vector<tile<Lyt>> affected_tiles() const
+    {
+        phmap::flat_hash_set<tile<Lyt>> affected{};
+
+        const auto add_with_elevations = [this, &affected](const tile<Lyt>& t)
+        {
+            affected.insert(t);
+            affected.insert(lyt.above(t));
+            affected.insert(lyt.below(t));
+        };
+
+        for (const auto& t : touched_tiles)
+        {
+            add_with_elevations(t);
+
+            lyt.foreach_adjacent_coordinate(t, add_with_elevations);
+            lyt.foreach_adjacent_coordinate(lyt.above(t), add_with_elevations);
+            lyt.foreach_adjacent_coordinate(lyt.below(t), add_with_elevations);
+
+            // non-adjacent tiles whose incoming signals point to t
+            if (const auto it = parents.find(t); it != parents.cend())
+            {
+                affected.insert(it->second.cbegin(), it->second.cend());
+            }
+
+            // non-adjacent tiles that t's incoming signals pointed to at the time of the last check
+            if (const auto it = children.find(t); it != children.cend())
+            {
+                std::for_each(it->second.cbegin(), it->second.cend(), add_with_elevations);
+            }
+
+            // non-adjacent tiles that t's incoming signals point to now
+            const auto current_children = detail::gate_level_drvs_impl<Lyt>::child_tiles(lyt, t);
+            std::for_each(current_children.cbegin(), current_children.cend(), add_with_elevations);
+        }
+
+        // non-adjacent tiles whose fanouts changed since they were disconnected from a modified node
+        std::for_each(touched_children.cbegin(), touched_children.cend(), add_with_elevations);
+
+        return std::vector<tile<Lyt>>(affected.cbegin(), affected.cend());
+    }
+    /**
+     * Updates `children` and `parents` with the current incoming signals of the given tile.
+     *
+     * @param t Tile to update.
+     */
+    void update_children(const tile<Lyt>& t)
+    {
+        if (const auto it = children.find(t); it != children.end())
+        {
+            for (const auto& c : it->second)
+            {
+                if (const auto p = parents.find(c); p != parents.end())
+                {
+                    p->second.erase(t);
+
+                    if (p->second.empty())
+                    {
+                        parents.erase(p);
+                    }
+                }
+            }
+
+            children.erase(it);
+        }
+
+        auto current_children = detail::gate_level_drvs_impl<Lyt>::child_tiles(lyt, t);
+
+        if (!current_children.empty())
+        {
+            for (const auto& c : current_children)
+            {
+                parents[c].insert(t);
+            }
+
+            children[t] = std::move(current_children);
+        }
+    }
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_DESIGN_RULE_VIOLATIONS_HPP
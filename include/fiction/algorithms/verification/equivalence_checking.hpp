@@ -10,15 +10,27 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/name_utils.hpp"
 
-#include <fmt/format.h>
-#include <mockturtle/algorithms/equivalence_checking.hpp>
-#include <mockturtle/algorithms/miter.hpp>
+#include <bill/sat/interface/common.hpp>
+#include <bill/sat/solver.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <phmap.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
-#include <sstream>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -42,6 +54,51 @@ enum class eq_type
     STRONG
 };
 
+/**
+ * Parameters for equivalence checking. Equivalence is checked in stages, each of which can only be reached if the
+ * previous one could not decide the problem:
+ *
+ * 1. Specification and implementation are copied into a shared k-LUT network over the same primary inputs, which
+ * structurally hashes identical gates. Primary output pairs that end up on the same node are equivalent.
+ * 2. Bit-parallel simulation of all input patterns if the number of primary inputs is small enough, which decides
+ * equivalence without any SAT call.
+ * 3. Bit-parallel random simulation, which cheaply discovers counterexamples.
+ * 4. SAT-based checking of the remaining primary output pairs. If SAT sweeping is enabled, internal nodes with identical
+ * simulation signatures are proven equivalent and merged on the fly, which drastically simplifies the final SAT calls.
+ */
+struct equivalence_checking_params
+{
+    /**
+     * Number of primary inputs up to which all input patterns are simulated instead of invoking a SAT solver.
+     */
+    uint32_t max_exhaustive_simulation_inputs = 16u;
+    /**
+     * Number of 64-bit words of random input patterns to simulate before invoking a SAT solver. The resulting simulation
+     * signatures also determine the candidate equivalence points for SAT sweeping. If 0, random simulation is skipped.
+     */
+    uint32_t num_random_simulation_words = 16u;
+    /**
+     * Seed for the random input patterns.
+     */
+    uint64_t seed = 0ull;
+    /**
+     * Prove and merge internal equivalence points before checking the primary outputs.
+     */
+    bool sat_sweeping = true;
+    /**
+     * Conflict limit of each SAT call that attempts to prove an internal equivalence point. 0 means no limit.
+     */
+    uint32_t sweeping_conflict_limit = 1000u;
+    /**
+     * Conflict limit of each SAT call on a primary output pair. 0 means no limit.
+     */
+    uint32_t conflict_limit = 0u;
+    /**
+     * Number of threads used to check primary output pairs independently of each other.
+     */
+    std::size_t num_threads = 1ul;
+};
+
 struct equivalence_checking_stats
 {
     /**
@@ -61,14 +118,509 @@ struct equivalence_checking_stats
      */
     mockturtle::stopwatch<>::duration runtime{0};
     /**
-     * Stores DRVs.
+     * Stores the numbers of DRVs and warnings. No detailed report is generated.
      */
     fiction::gate_level_drv_stats spec_drv_stats{}, impl_drv_stats{};
+    /**
+     * Number of SAT calls performed.
+     */
+    std::size_t num_sat_calls{0};
+    /**
+     * Number of internal nodes that were proven equivalent to other nodes and merged via SAT sweeping.
+     */
+    std::size_t num_merged_nodes{0};
+    /**
+     * Indicates whether the result was determined by simulation alone, i.e., without any SAT call.
+     */
+    bool decided_by_simulation{false};
 };
 
 namespace detail
 {
 
+/**
+ * A k-LUT network that contains both the specification and the implementation over a shared set of primary inputs.
+ * Instead of combining their outputs via XOR gates as a miter would, the outputs are stored separately such that they
+ * can be checked independently of each other.
+ */
+struct joint_network
+{
+    /**
+     * The k-LUT network containing specification and implementation.
+     */
+    mockturtle::klut_network ntk{};
+    /**
+     * Signals of the specification's primary outputs in `ntk`.
+     */
+    std::vector<mockturtle::klut_network::signal> spec_outputs{};
+    /**
+     * Signals of the implementation's primary outputs in `ntk`.
+     */
+    std::vector<mockturtle::klut_network::signal> impl_outputs{};
+};
+/**
+ * Copies specification and implementation into a joint k-LUT network over the same primary inputs.
+ *
+ * @tparam Spec Specification type.
+ * @tparam Impl Implementation type.
+ * @param spec The specification.
+ * @param impl The implementation.
+ * @return The joint network or `std::nullopt` if the numbers of primary inputs or outputs do not match.
+ */
+template <typename Spec, typename Impl>
+[[nodiscard]] std::optional<joint_network> create_joint_network(const Spec& spec, const Impl& impl)
+{
+    if (spec.num_pis() != impl.num_pis() || spec.num_pos() != impl.num_pos())
+    {
+        return std::nullopt;
+    }
+
+    joint_network joint{};
+
+    std::vector<mockturtle::klut_network::signal> pis{};
+    pis.reserve(spec.num_pis());
+
+    for (auto i = 0u; i < spec.num_pis(); ++i)
+    {
+        pis.push_back(joint.ntk.create_pi());
+    }
+
+    joint.spec_outputs = mockturtle::cleanup_dangling(spec, joint.ntk, pis.begin(), pis.end());
+    joint.impl_outputs = mockturtle::cleanup_dangling(impl, joint.ntk, pis.begin(), pis.end());
+
+    return joint;
+}
+/**
+ * Word-parallel simulator for k-LUT networks that evaluates 64 input patterns at once. The node functions and fanins
+ * are extracted once on construction such that consecutive simulation calls avoid all network traversal overhead.
+ */
+class word_simulator
+{
+  public:
+    using node = mockturtle::klut_network::node;
+    /**
+     * Standard constructor. Extracts the node functions and fanins of the given network.
+     *
+     * @param network k-LUT network to simulate.
+     */
+    explicit word_simulator(const mockturtle::klut_network& network) :
+            ntk{network},
+            functions(network.size()),
+            fanins(network.size())
+    {
+        ntk.foreach_gate(
+            [this](const auto& n)
+            {
+                functions[n] = ntk.node_function(n);
+                ntk.foreach_fanin(n, [this, &n](const auto& f) { fanins[n].push_back(ntk.get_node(f)); });
+            });
+    }
+    /**
+     * Simulates one word of input patterns.
+     *
+     * @param pi_words One word of patterns per primary input.
+     * @param node_words Resulting words for each node in the network.
+     */
+    void simulate(const std::vector<uint64_t>& pi_words, std::vector<uint64_t>& node_words) const
+    {
+        node_words.resize(ntk.size());
+
+        node_words[ntk.get_node(ntk.get_constant(false))] = 0ull;
+        node_words[ntk.get_node(ntk.get_constant(true))]  = ~0ull;
+
+        ntk.foreach_pi([&pi_words, &node_words](const auto& pi, const auto i) { node_words[pi] = pi_words[i]; });
+
+        // nodes in k-LUT networks are stored in topological order
+        ntk.foreach_gate([this, &node_words](const auto& n) { node_words[n] = evaluate(n, node_words); });
+    }
+    /**
+     * Returns the function of the given gate.
+     *
+     * @param n Gate.
+     * @return Function of `n`.
+     */
+    [[nodiscard]] const kitty::dynamic_truth_table& function(const node n) const noexcept
+    {
+        return functions[n];
+    }
+    /**
+     * Returns the fanin nodes of the given gate.
+     *
+     * @param n Gate.
+     * @return Fanins of `n`.
+     */
+    [[nodiscard]] const std::vector<node>& fanin_nodes(const node n) const noexcept
+    {
+        return fanins[n];
+    }
+
+  private:
+    /**
+     * The simulated network.
+     */
+    const mockturtle::klut_network& ntk;
+    /**
+     * Functions of all gates.
+     */
+    std::vector<kitty::dynamic_truth_table> functions;
+    /**
+     * Fanin nodes of all gates.
+     */
+    std::vector<std::vector<node>> fanins;
+    /**
+     * Evaluates a single gate on one word of patterns via its on-set.
+     *
+     * @param n Gate to evaluate.
+     * @param node_words Words of all nodes in the transitive fanin of `n`.
+     * @return Word of `n`.
+     */
+    [[nodiscard]] uint64_t evaluate(const node n, const std::vector<uint64_t>& node_words) const noexcept
+    {
+        const auto& tt  = functions[n];
+        const auto& fis = fanins[n];
+
+        uint64_t result = 0ull;
+
+        for (uint64_t row = 0ull; row < tt.num_bits(); ++row)
+        {
+            if (!kitty::get_bit(tt, row))
+            {
+                continue;
+            }
+
+            auto term = ~0ull;
+
+            for (std::size_t i = 0; i < fis.size(); ++i)
+            {
+                term &= ((row >> i) & 1ull) != 0 ? node_words[fis[i]] : ~node_words[fis[i]];
+            }
+
+            result |= term;
+        }
+
+        return result;
+    }
+};
+/**
+ * Checks pairs of nodes of a k-LUT network for equivalence via an incremental SAT solver. The network is encoded lazily,
+ * i.e., only the transitive fanin cones of checked nodes are translated to CNF. If SAT sweeping is enabled, each newly
+ * encoded gate is checked against a previously encoded node with the same simulation signature and, if their
+ * equivalence can be proven, merged into it. Buffers and inverters are never encoded but mapped to the (complemented)
+ * literal of their fanin.
+ */
+class sat_sweeper
+{
+  public:
+    using node = mockturtle::klut_network::node;
+    /**
+     * Standard constructor.
+     *
+     * @param network k-LUT network whose nodes are to be checked.
+     * @param s Simulator holding the network's extracted node functions.
+     * @param sigs Simulation signatures of all nodes, `num_words` consecutive words per node.
+     * @param num_words Number of words per signature.
+     * @param p Parameters.
+     */
+    sat_sweeper(const mockturtle::klut_network& network, const word_simulator& s, const std::vector<uint64_t>& sigs,
+                const std::size_t num_words, const equivalence_checking_params& p) :
+            ntk{network},
+            sim{s},
+            signatures{sigs},
+            words_per_signature{num_words},
+            ps{p},
+            literals(network.size())
+    {
+        const auto const0_var = solver.add_variable();
+        solver.add_clause(bill::lit_type{const0_var, bill::negative_polarity});
+
+        literals[ntk.get_node(ntk.get_constant(false))] = bill::lit_type{const0_var, bill::positive_polarity};
+        literals[ntk.get_node(ntk.get_constant(true))]  = bill::lit_type{const0_var, bill::negative_polarity};
+    }
+    /**
+     * Checks whether the two given nodes compute the same function.
+     *
+     * @param a First node.
+     * @param b Second node.
+     * @return `true` if `a` and `b` are equivalent, `false` if they are not, and `std::nullopt` if the conflict limit was
+     * exceeded. In case of `false`, a counterexample can be obtained via `get_counter_example`.
+     */
+    [[nodiscard]] std::optional<bool> check(const node a, const node b)
+    {
+        const auto lit_a = literal(a);
+        const auto lit_b = literal(b);
+
+        if (lit_a == lit_b)
+        {
+            return true;
+        }
+
+        for (const auto& assumptions : std::array<std::vector<bill::lit_type>, 2>{{{lit_a, ~lit_b}, {~lit_a, lit_b}}})
+        {
+            ++num_sat_calls;
+
+            const auto result = solver.solve(assumptions, ps.conflict_limit);
+
+            if (result == bill::result::states::satisfiable)
+            {
+                extract_counter_example();
+                return false;
+            }
+            if (result != bill::result::states::unsatisfiable)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Returns the counterexample of the last failed check as an assignment to the primary inputs.
+     *
+     * @return Counterexample.
+     */
+    [[nodiscard]] const std::vector<bool>& get_counter_example() const noexcept
+    {
+        return counter_example;
+    }
+    /**
+     * Number of SAT calls performed so far.
+     */
+    std::size_t num_sat_calls{0};
+    /**
+     * Number of internal nodes that were proven equivalent to other nodes and merged.
+     */
+    std::size_t num_merged_nodes{0};
+
+  private:
+    /**
+     * The network whose nodes are checked.
+     */
+    const mockturtle::klut_network& ntk;
+    /**
+     * Simulator holding node functions and fanins.
+     */
+    const word_simulator& sim;
+    /**
+     * Simulation signatures of all nodes.
+     */
+    const std::vector<uint64_t>& signatures;
+    /**
+     * Number of words per signature.
+     */
+    const std::size_t words_per_signature;
+    /**
+     * Parameters.
+     */
+    const equivalence_checking_params& ps;
+    /**
+     * The incremental SAT solver.
+     */
+    bill::solver<bill::solvers::ghack> solver{};
+    /**
+     * Literal representing each encoded node.
+     */
+    std::vector<std::optional<bill::lit_type>> literals;
+    /**
+     * Encoded gates that are not merged into others, grouped by a hash of their phase-normalized signatures.
+     */
+    phmap::flat_hash_map<uint64_t, std::vector<node>> candidates{};
+    /**
+     * Counterexample of the last failed check.
+     */
+    std::vector<bool> counter_example{};
+
+    /**
+     * Returns the literal of the given node and encodes its transitive fanin cone if necessary.
+     *
+     * @param n Node whose literal is desired.
+     * @return Literal representing `n`.
+     */
+    [[nodiscard]] bill::lit_type literal(const node n)
+    {
+        // iterative depth-first traversal to support deep networks
+        std::vector<node> stack{n};
+
+        while (!stack.empty())
+        {
+            const auto top = stack.back();
+
+            if (literals[top].has_value())
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            if (ntk.is_pi(top))
+            {
+                literals[top] = bill::lit_type{solver.add_variable(), bill::positive_polarity};
+                stack.pop_back();
+                continue;
+            }
+
+            bool fanins_encoded = true;
+
+            for (const auto& f : sim.fanin_nodes(top))
+            {
+                if (!literals[f].has_value())
+                {
+                    stack.push_back(f);
+                    fanins_encoded = false;
+                }
+            }
+
+            if (fanins_encoded)
+            {
+                encode_gate(top);
+                stack.pop_back();
+            }
+        }
+
+        return *literals[n];
+    }
+    /**
+     * Encodes the given gate whose fanins are already encoded.
+     *
+     * @param n Gate to encode.
+     */
+    void encode_gate(const node n)
+    {
+        const auto& tt  = sim.function(n);
+        const auto& fis = sim.fanin_nodes(n);
+
+        // buffers and inverters are mapped to the literal of their fanin
+        if (fis.size() == 1 && kitty::get_bit(tt, 0) != kitty::get_bit(tt, 1))
+        {
+            literals[n] = kitty::get_bit(tt, 1) ? *literals[fis.front()] : ~*literals[fis.front()];
+            return;
+        }
+
+        const auto out = bill::lit_type{solver.add_variable(), bill::positive_polarity};
+
+        // one clause per row of the truth table
+        for (uint64_t row = 0ull; row < tt.num_bits(); ++row)
+        {
+            std::vector<bill::lit_type> clause{};
+            clause.reserve(fis.size() + 1);
+
+            for (std::size_t i = 0; i < fis.size(); ++i)
+            {
+                clause.push_back(((row >> i) & 1ull) != 0 ? ~*literals[fis[i]] : *literals[fis[i]]);
+            }
+
+            clause.push_back(kitty::get_bit(tt, row) ? out : ~out);
+
+            solver.add_clause(clause);
+        }
+
+        literals[n] = out;
+
+        if (ps.sat_sweeping && words_per_signature > 0)
+        {
+            sweep(n);
+        }
+    }
+    /**
+     * Attempts to merge the given freshly encoded gate into a previously encoded node with the same simulation
+     * signature (up to complementation).
+     *
+     * @param n Gate to sweep.
+     */
+    void sweep(const node n)
+    {
+        const auto phase = (signatures[n * words_per_signature] & 1ull) != 0;
+
+        uint64_t hash = 0ull;
+
+        for (std::size_t w = 0; w < words_per_signature; ++w)
+        {
+            const auto word = phase ? ~signatures[n * words_per_signature + w] : signatures[n * words_per_signature + w];
+            hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6u) + (hash >> 2u);
+        }
+
+        auto& bucket = candidates[hash];
+
+        for (const auto& c : bucket)
+        {
+            const auto c_phase = (signatures[c * words_per_signature] & 1ull) != 0;
+
+            bool same_signature = true;
+
+            for (std::size_t w = 0; w < words_per_signature && same_signature; ++w)
+            {
+                const auto n_word = signatures[n * words_per_signature + w];
+                const auto c_word = signatures[c * words_per_signature + w];
+
+                same_signature = (phase == c_phase) ? (n_word == c_word) : (n_word == ~c_word);
+            }
+
+            if (!same_signature)
+            {
+                continue;
+            }
+
+            const auto lit_n = *literals[n];
+            const auto lit_c = phase == c_phase ? *literals[c] : ~*literals[c];
+
+            if (prove_equal(lit_n, lit_c))
+            {
+                // merge n into c
+                solver.add_clause(std::vector<bill::lit_type>{~lit_n, lit_c});
+                solver.add_clause(std::vector<bill::lit_type>{lit_n, ~lit_c});
+
+                literals[n] = lit_c;
+
+                ++num_merged_nodes;
+
+                return;
+            }
+
+            // only attempt one candidate per gate to bound the number of SAT calls
+            break;
+        }
+
+        bucket.push_back(n);
+    }
+    /**
+     * Proves the equivalence of two literals under the sweeping conflict limit.
+     *
+     * @param a First literal.
+     * @param b Second literal.
+     * @return `true` iff `a` and `b` were proven to be equivalent.
+     */
+    [[nodiscard]] bool prove_equal(const bill::lit_type& a, const bill::lit_type& b)
+    {
+        for (const auto& assumptions : std::array<std::vector<bill::lit_type>, 2>{{{a, ~b}, {~a, b}}})
+        {
+            ++num_sat_calls;
+
+            if (solver.solve(assumptions, ps.sweeping_conflict_limit) != bill::result::states::unsatisfiable)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Extracts a counterexample from the solver's current model.
+     */
+    void extract_counter_example()
+    {
+        const auto model = solver.get_model().model();
+
+        counter_example.assign(ntk.num_pis(), false);
+
+        ntk.foreach_pi(
+            [this, &model](const auto& pi, const auto i)
+            {
+                if (const auto& lit = literals[pi]; lit.has_value())
+                {
+                    counter_example[i] = model.at(lit->variable()) == bill::lbool_type::true_;
+                }
+            });
+    }
+};
+
 template <typename Spec, typename Impl>
 class equivalence_checking_impl
 {
@@ -82,9 +634,10 @@ class equivalence_checking_impl
      * @param st Statistics.
      */
     explicit equivalence_checking_impl(const Spec& specification, const Impl& implementation,
-                                       equivalence_checking_stats& st) :
+                                       const equivalence_checking_params& p, equivalence_checking_stats& st) :
             spec{specification},
             impl{implementation},
+            ps{p},
             pst{st}
     {}
 
@@ -107,13 +660,11 @@ class equivalence_checking_impl
             }
         }
 
-        const auto miter = mockturtle::miter<mockturtle::klut_network>(spec, impl);
+        const auto joint = create_joint_network(spec, impl);
 
-        if (miter)
+        if (joint)
         {
-            mockturtle::equivalence_checking_stats st;
-
-            const auto eq = mockturtle::equivalence_checking(*miter, {}, &st);
+            const auto eq = check_joint_network(*joint);
 
             if (eq.has_value())
             {
@@ -143,11 +694,6 @@ class equivalence_checking_impl
                         pst.eq = eq_type::WEAK;
                     }
                 }
-
-                if (!(*eq))
-                {
-                    pst.counter_example = st.counter_example;
-                }
             }
             else
             {
@@ -176,22 +722,247 @@ class equivalence_checking_impl
      * Implementation.
      */
     const Impl impl;
+    /**
+     * Parameters.
+     */
+    const equivalence_checking_params ps;
 
     equivalence_checking_stats& pst;
 
+    /**
+     * Projection functions of the first six variables, i.e., all 64 input patterns over six variables.
+     */
+    static constexpr const std::array<uint64_t, 6> PROJECTIONS{
+        {0xaaaaaaaaaaaaaaaaull, 0xccccccccccccccccull, 0xf0f0f0f0f0f0f0f0ull, 0xff00ff00ff00ff00ull,
+         0xffff0000ffff0000ull, 0xffffffff00000000ull}};
+
     template <typename NtkOrLyt>
     bool has_drvs(const NtkOrLyt& ntk_or_lyt, gate_level_drv_stats* stats) const noexcept
     {
         fiction::gate_level_drv_params drv_ps{};
 
-        // suppress DRV output
-        std::ostringstream null_stream{};
-        drv_ps.out = &null_stream;
+        // only the number of DRVs is of interest; suppress the report and its output
+        drv_ps.generate_report = false;
+        drv_ps.out             = nullptr;
 
         gate_level_drvs(ntk_or_lyt, drv_ps, stats);
 
         return stats->drvs != 0;
     }
+    /**
+     * Checks all primary output pairs of the given joint network for equivalence in stages.
+     *
+     * @param joint Joint network of specification and implementation.
+     * @return `true` if all pairs are equivalent, `false` if not, and `std::nullopt` if a resource limit was exceeded.
+     */
+    [[nodiscard]] std::optional<bool> check_joint_network(const joint_network& joint)
+    {
+        // stage 1: structural hashing
+        std::vector<std::size_t> open_outputs{};
+
+        for (std::size_t i = 0; i < joint.spec_outputs.size(); ++i)
+        {
+            if (joint.spec_outputs[i] != joint.impl_outputs[i])
+            {
+                open_outputs.push_back(i);
+            }
+        }
+
+        if (open_outputs.empty())
+        {
+            return true;
+        }
+
+        const word_simulator sim{joint.ntk};
+
+        std::vector<uint64_t> pi_words(joint.ntk.num_pis());
+        std::vector<uint64_t> node_words{};
+
+        // stage 2: exhaustive simulation
+        if (joint.ntk.num_pis() <= ps.max_exhaustive_simulation_inputs)
+        {
+            const auto num_pis   = joint.ntk.num_pis();
+            const auto num_words = num_pis <= 6 ? 1ull : 1ull << (num_pis - 6);
+
+            for (uint64_t w = 0ull; w < num_words; ++w)
+            {
+                for (auto i = 0u; i < num_pis; ++i)
+                {
+                    pi_words[i] = i < 6 ? PROJECTIONS[i] : (((w >> (i - 6)) & 1ull) != 0 ? ~0ull : 0ull);
+                }
+
+                sim.simulate(pi_words, node_words);
+
+                if (find_counter_example(joint, open_outputs, pi_words, node_words))
+                {
+                    return false;
+                }
+            }
+
+            pst.decided_by_simulation = true;
+
+            return true;
+        }
+
+        // stage 3: random simulation
+        const std::size_t num_words = ps.num_random_simulation_words;
+
+        std::vector<uint64_t> signatures(joint.ntk.size() * num_words);
+
+        std::mt19937_64 generator{ps.seed};
+
+        for (std::size_t w = 0; w < num_words; ++w)
+        {
+            std::generate(pi_words.begin(), pi_words.end(), [&generator] { return generator(); });
+
+            sim.simulate(pi_words, node_words);
+
+            if (find_counter_example(joint, open_outputs, pi_words, node_words))
+            {
+                return false;
+            }
+
+            for (std::size_t n = 0; n < node_words.size(); ++n)
+            {
+                signatures[n * num_words + w] = node_words[n];
+            }
+        }
+
+        // stage 4: SAT sweeping and SAT-based checking of the remaining outputs
+        return check_outputs_via_sat(joint, open_outputs, sim, signatures, num_words);
+    }
+    /**
+     * Looks for a primary output pair that differs in the given simulation results and extracts the corresponding input
+     * pattern as a counterexample.
+     *
+     * @param joint Joint network of specification and implementation.
+     * @param outputs Indices of the primary output pairs to inspect.
+     * @param pi_words Simulated primary input patterns.
+     * @param node_words Simulation results.
+     * @return `true` iff a counterexample was found.
+     */
+    bool find_counter_example(const joint_network& joint, const std::vector<std::size_t>& outputs,
+                              const std::vector<uint64_t>& pi_words, const std::vector<uint64_t>& node_words)
+    {
+        for (const auto i : outputs)
+        {
+            const auto diff = node_words[joint.ntk.get_node(joint.spec_outputs[i])] ^
+                              node_words[joint.ntk.get_node(joint.impl_outputs[i])];
+
+            if (diff != 0ull)
+            {
+                auto bit = 0u;
+
+                while (((diff >> bit) & 1ull) == 0ull)
+                {
+                    ++bit;
+                }
+
+                pst.counter_example.resize(pi_words.size());
+
+                for (std::size_t j = 0; j < pi_words.size(); ++j)
+                {
+                    pst.counter_example[j] = ((pi_words[j] >> bit) & 1ull) != 0ull;
+                }
+
+                pst.decided_by_simulation = true;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Checks the given primary output pairs via SAT. If multiple threads are available, the output pairs are distributed
+     * dynamically among them, each thread using its own solver that only encodes the cones of its output pairs.
+     *
+     * @param joint Joint network of specification and implementation.
+     * @param outputs Indices of the primary output pairs to check.
+     * @param sim Simulator holding the node functions.
+     * @param signatures Random simulation signatures of all nodes.
+     * @param num_words Number of words per signature.
+     * @return `true` if all pairs are equivalent, `false` if not, and `std::nullopt` if a resource limit was exceeded.
+     */
+    [[nodiscard]] std::optional<bool> check_outputs_via_sat(const joint_network& joint,
+                                                            const std::vector<std::size_t>& outputs,
+                                                            const word_simulator&           sim,
+                                                            const std::vector<uint64_t>& signatures,
+                                                            const std::size_t            num_words)
+    {
+        std::atomic<std::size_t> next_output{0};
+        std::atomic<bool>        non_equivalent{false};
+        std::atomic<bool>        undecided{false};
+        std::atomic<std::size_t> num_sat_calls{0};
+        std::atomic<std::size_t> num_merged_nodes{0};
+
+        std::mutex counter_example_mutex{};
+
+        const auto worker = [&, this]
+        {
+            sat_sweeper sweeper{joint.ntk, sim, signatures, num_words, ps};
+
+            for (auto i = next_output++; i < outputs.size() && !non_equivalent && !undecided; i = next_output++)
+            {
+                const auto result = sweeper.check(joint.ntk.get_node(joint.spec_outputs[outputs[i]]),
+                                                  joint.ntk.get_node(joint.impl_outputs[outputs[i]]));
+
+                if (!result.has_value())
+                {
+                    undecided = true;
+                }
+                else if (!*result)
+                {
+                    const std::lock_guard lock{counter_example_mutex};
+
+                    if (!non_equivalent)
+                    {
+                        non_equivalent      = true;
+                        pst.counter_example = sweeper.get_counter_example();
+                    }
+                }
+            }
+
+            num_sat_calls += sweeper.num_sat_calls;
+            num_merged_nodes += sweeper.num_merged_nodes;
+        };
+
+        const auto num_threads = std::min(std::max(ps.num_threads, std::size_t{1}), outputs.size());
+
+        if (num_threads == 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        pst.num_sat_calls    = num_sat_calls;
+        pst.num_merged_nodes = num_merged_nodes;
+
+        if (non_equivalent)
+        {
+            return false;
+        }
+        if (undecided)
+        {
+            return std::nullopt;
+        }
+
+        return true;
+    }
 };
 
 }  // namespace detail
@@ -217,21 +988,26 @@ class equivalence_checking_impl
  * This approach was first proposed in \"Verification for Field-coupled Nanocomputing Circuits\" by M. Walter, R. Wille,
  * F. Sill Torres, D. Große, and R. Drechsler in DAC 2020.
  *
+ * Logical equivalence is decided in stages as described in `equivalence_checking_params`: structural hashing,
+ * exhaustive or random bit-parallel simulation, and, only if necessary, SAT sweeping with incremental SAT calls.
+ *
  * @tparam Spec Specification type.
  * @tparam Impl Implementation type.
  * @param spec The specification.
  * @param impl The implementation.
+ * @param ps Parameters.
  * @param pst Statistics.
  * @return The equivalence type of `spec` and `impl`.
  */
 template <typename Spec, typename Impl>
-eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, const equivalence_checking_params& ps,
+                             equivalence_checking_stats* pst = nullptr)
 {
     static_assert(mockturtle::is_network_type_v<Spec>, "Spec is not a network type");
     static_assert(mockturtle::is_network_type_v<Impl>, "Impl is not a network type");
 
     equivalence_checking_stats        st{};
-    detail::equivalence_checking_impl p{spec, impl, st};
+    detail::equivalence_checking_impl p{spec, impl, ps, st};
 
     const auto result = p.run();
 
@@ -243,6 +1019,23 @@ eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_che
     return result;
 }
 
+/**
+ * Performs SAT-based equivalence checking between a specification of type `Spec` and an implementation of type `Impl`
+ * with default parameters. See the overload above for more details.
+ *
+ * @tparam Spec Specification type.
+ * @tparam Impl Implementation type.
+ * @param spec The specification.
+ * @param impl The implementation.
+ * @param pst Statistics.
+ * @return The equivalence type of `spec` and `impl`.
+ */
+template <typename Spec, typename Impl>
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+{
+    return equivalence_checking(spec, impl, equivalence_checking_params{}, pst);
+}
+
 }  // namespace fiction
 
 #endif  // FICTION_EQUIVALENCE_CHECKING_HPP
@@ -0,0 +1,506 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_GATE_LEVEL_SIMULATION_HPP
+#define FICTION_GATE_LEVEL_SIMULATION_HPP
+
+#include "fiction/traits.hpp"
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A bit-parallel simulator for gate-level layouts. Each simulation word holds `NumBits` input patterns that are
+ * evaluated simultaneously with plain bitwise operations on blocks of 64 bits. Thereby, `NumBits = 64` yields one
+ * machine word per node, while, e.g., `NumBits = 256` allows the compiler to process four blocks at once using vector
+ * instructions. Patterns can span multiple words such that an arbitrary number of patterns can be simulated per call.
+ *
+ * On construction, the layout is compiled into an evaluation schedule, i.e., a topological order of all nodes together
+ * with their fanins and functions. Since this schedule is reused across consecutive calls to `simulate`, repeated
+ * simulations avoid all traversal overhead of the layout. After the layout has been modified, `resimulate` recompiles
+ * the schedule and re-evaluates only the transitive fanout cones of the modified nodes while all other simulation
+ * values are kept.
+ *
+ * Just like `mockturtle::simulate`, fanins are determined via `foreach_fanin`, i.e., only connections that respect the
+ * layout's clocking are taken into account.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @tparam NumBits Number of patterns per simulation word. Must be a positive multiple of 64.
+ */
+template <typename Lyt, std::size_t NumBits = 64>
+class gate_level_simulator
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(NumBits > 0 && NumBits % 64 == 0, "NumBits must be a positive multiple of 64");
+
+  public:
+    /**
+     * Number of 64-bit blocks per simulation word.
+     */
+    static constexpr const std::size_t BLOCKS_PER_WORD = NumBits / 64;
+    /**
+     * A simulation word.
+     */
+    using word_type = std::array<uint64_t, BLOCKS_PER_WORD>;
+    /**
+     * Multi-word simulation patterns of a single node.
+     */
+    using pattern_type = std::vector<word_type>;
+    /**
+     * Node type of the layout.
+     */
+    using node = mockturtle::node<Lyt>;
+    /**
+     * Standard constructor. Compiles the evaluation schedule of the given layout.
+     *
+     * @param layout Gate-level layout to simulate. Must outlive the simulator.
+     * @throws std::invalid_argument if a node has more than six fanins or if the arity of a node's function differs
+     * from its number of fanins.
+     */
+    explicit gate_level_simulator(const Lyt& layout) : lyt{layout}
+    {
+        compile();
+    }
+    /**
+     * Simulates the given input patterns.
+     *
+     * @param patterns One multi-word pattern per primary input in the order of `foreach_pi`. All patterns must consist
+     * of the same number of words. Layouts without primary inputs are simulated on a single word.
+     */
+    void simulate(const std::vector<pattern_type>& patterns)
+    {
+        assert(patterns.size() == lyt.num_pis());
+
+        num_words = patterns.empty() ? 1ul : patterns.front().size();
+
+        allocate();
+
+        lyt.foreach_pi(
+            [this, &patterns](const auto& pi, const auto i)
+            {
+                assert(patterns[i].size() == num_words);
+
+                std::copy(patterns[i].cbegin(), patterns[i].cend(), words_of(pi));
+            });
+
+        for (const auto& op : schedule)
+        {
+            evaluate(op);
+        }
+    }
+    /**
+     * Replaces the pattern of a single primary input. The change is only propagated by a subsequent call to
+     * `resimulate` that includes the respective primary input node.
+     *
+     * @param index Index of the primary input.
+     * @param pattern New multi-word pattern with the same number of words as used in the last call to `simulate`.
+     */
+    void set_input_pattern(const uint32_t index, const pattern_type& pattern)
+    {
+        assert(pattern.size() == num_words);
+
+        std::copy(pattern.cbegin(), pattern.cend(), words_of(lyt.pi_at(index)));
+    }
+    /**
+     * Recompiles the evaluation schedule and re-evaluates only those nodes that are in the transitive fanout of the
+     * given ones, reusing all other simulation values of the last call to `simulate`. This is to be called after the
+     * layout has been modified, e.g., via `move_node`, `connect`, or by creating new nodes, where `changed` must
+     * contain all nodes whose placement, fanins, or function changed as well as all newly created nodes. Primary inputs
+     * whose patterns were replaced via `set_input_pattern` can be passed as well.
+     *
+     * @param changed Nodes whose transitive fanout cones are to be re-evaluated.
+     * @throws std::invalid_argument if a node has more than six fanins or if the arity of a node's function differs
+     * from its number of fanins.
+     */
+    void resimulate(const std::vector<node>& changed)
+    {
+        compile();
+        allocate();
+
+        std::vector<bool> dirty(lyt.size(), false);
+
+        for (const auto& n : changed)
+        {
+            dirty[n] = true;
+        }
+
+        num_last_evaluated_nodes = 0ul;
+
+        // the schedule is topologically ordered, i.e., dirtiness propagates in a single pass
+        for (const auto& op : schedule)
+        {
+            if (!dirty[op.n])
+            {
+                dirty[op.n] = std::any_of(op.fanins.cbegin(), op.fanins.cbegin() + op.num_fanins,
+                                          [&dirty](const auto f) { return dirty[f]; });
+            }
+
+            if (dirty[op.n])
+            {
+                evaluate(op);
+                ++num_last_evaluated_nodes;
+            }
+        }
+    }
+    /**
+     * Returns the simulated pattern of the given node.
+     *
+     * @param n Node whose simulation values are desired.
+     * @return Multi-word pattern of `n`.
+     */
+    [[nodiscard]] pattern_type node_pattern(const node n) const
+    {
+        return pattern_type(words_of(n), words_of(n) + num_words);
+    }
+    /**
+     * Returns the simulated pattern of the primary output with the given index.
+     *
+     * @param index Index of the primary output.
+     * @return Multi-word pattern of the primary output.
+     */
+    [[nodiscard]] pattern_type output_pattern(const uint32_t index) const
+    {
+        return node_pattern(lyt.get_node(lyt.po_at(index)));
+    }
+    /**
+     * Returns the simulated patterns of all primary outputs in the order of `foreach_po`.
+     *
+     * @return Multi-word patterns of all primary outputs.
+     */
+    [[nodiscard]] std::vector<pattern_type> output_patterns() const
+    {
+        std::vector<pattern_type> outputs{};
+        outputs.reserve(lyt.num_pos());
+
+        lyt.foreach_po([this, &outputs](const auto& po) { outputs.push_back(node_pattern(lyt.get_node(po))); });
+
+        return outputs;
+    }
+    /**
+     * Returns the number of nodes in the compiled evaluation schedule.
+     *
+     * @return Number of scheduled nodes.
+     */
+    [[nodiscard]] std::size_t schedule_size() const noexcept
+    {
+        return schedule.size();
+    }
+    /**
+     * Returns the number of nodes that were re-evaluated by the last call to `resimulate`.
+     *
+     * @return Number of re-evaluated nodes.
+     */
+    [[nodiscard]] std::size_t num_reevaluated_nodes() const noexcept
+    {
+        return num_last_evaluated_nodes;
+    }
+
+  private:
+    /**
+     * Maximum number of fanins of a node that can be evaluated, i.e., the number of variables a 64-bit truth table can
+     * hold.
+     */
+    static constexpr const uint32_t MAX_FANINS = 6u;
+    /**
+     * A compiled evaluation step.
+     */
+    struct operation
+    {
+        /**
+         * Node to evaluate.
+         */
+        node n;
+        /**
+         * Fanin nodes of `n`.
+         */
+        std::array<node, MAX_FANINS> fanins{};
+        /**
+         * Number of fanins.
+         */
+        uint32_t num_fanins{0};
+        /**
+         * Truth table of `n`'s function.
+         */
+        uint64_t function{0};
+    };
+    /**
+     * The simulated layout.
+     */
+    const Lyt& lyt;
+    /**
+     * Topologically ordered evaluation schedule.
+     */
+    std::vector<operation> schedule{};
+    /**
+     * Simulation values of all nodes, `num_words` consecutive words per node.
+     */
+    std::vector<word_type> values{};
+    /**
+     * Number of words per pattern.
+     */
+    std::size_t num_words{0};
+    /**
+     * Number of nodes re-evaluated by the last call to `resimulate`.
+     */
+    std::size_t num_last_evaluated_nodes{0};
+
+    /**
+     * Compiles the evaluation schedule via an iterative post-order depth-first traversal of all nodes.
+     */
+    void compile()
+    {
+        schedule.clear();
+
+        // 0: unvisited, 1: on stack, 2: done
+        std::vector<uint8_t> state(lyt.size(), 0u);
+
+        state[0] = state[1] = 2u;
+        lyt.foreach_pi([&state](const auto& pi) { state[pi] = 2u; });
+
+        std::vector<std::pair<node, bool>> stack{};
+
+        lyt.foreach_node(
+            [this, &state, &stack](const auto& root)
+            {
+                if (state[root] != 0u)
+                {
+                    return;
+                }
+
+                stack.emplace_back(root, false);
+
+                while (!stack.empty())
+                {
+                    const auto [n, expanded] = stack.back();
+                    stack.pop_back();
+
+                    if (expanded)
+                    {
+                        state[n] = 2u;
+                        schedule.push_back(compile_node(n));
+
+                        continue;
+                    }
+
+                    if (state[n] != 0u)
+                    {
+                        continue;
+                    }
+
+                    state[n] = 1u;
+                    stack.emplace_back(n, true);
+
+                    lyt.foreach_fanin(n,
+                                      [this, &state, &stack](const auto& f)
+                                      {
+                                          // nodes on the stack indicate cycles, which are broken here
+                                          if (const auto fn = lyt.get_node(f); state[fn] == 0u)
+                                          {
+                                              stack.emplace_back(fn, false);
+                                          }
+                                      });
+                }
+            });
+    }
+    /**
+     * Extracts the fanins and the function of the given node.
+     *
+     * @param n Node to compile.
+     * @return Evaluation step of `n`.
+     * @throws std::invalid_argument if `n` has more than `MAX_FANINS` fanins or if the arity of its function differs
+     * from its number of fanins, e.g., because some of its incoming connections do not respect the clocking.
+     */
+    [[nodiscard]] operation compile_node(const node n) const
+    {
+        operation op{n};
+
+        lyt.foreach_fanin(n,
+                          [this, &op](const auto& f)
+                          {
+                              if (op.num_fanins == MAX_FANINS)
+                              {
+                                  throw std::invalid_argument("node " + std::to_string(op.n) + " has more than " +
+                                                              std::to_string(MAX_FANINS) + " fanins");
+                              }
+
+                              op.fanins[op.num_fanins++] = lyt.get_node(f);
+                          });
+
+        const auto tt = lyt.node_function(n);
+
+        if (tt.num_vars() != op.num_fanins)
+        {
+            throw std::invalid_argument("function of node " + std::to_string(n) + " has " +
+                                        std::to_string(tt.num_vars()) + " variables but the node has " +
+                                        std::to_string(op.num_fanins) + " fanins");
+        }
+
+        op.function = *tt.cbegin();
+
+        return op;
+    }
+    /**
+     * Resizes the value storage to the current layout size and initializes the constants.
+     */
+    void allocate()
+    {
+        values.resize(static_cast<std::size_t>(lyt.size()) * num_words);
+
+        std::fill(words_of(0), words_of(0) + num_words, word_type{});
+
+        word_type ones{};
+        ones.fill(~0ull);
+
+        std::fill(words_of(1), words_of(1) + num_words, ones);
+    }
+    /**
+     * Evaluates a single evaluation step on all words via the on-set of its function.
+     *
+     * @param op Evaluation step.
+     */
+    void evaluate(const operation& op)
+    {
+        auto* const out = words_of(op.n);
+
+        for (std::size_t w = 0; w < num_words; ++w)
+        {
+            word_type result{};
+
+            for (uint64_t row = 0ull; row < (1ull << op.num_fanins); ++row)
+            {
+                if (((op.function >> row) & 1ull) == 0ull)
+                {
+                    continue;
+                }
+
+                word_type term{};
+                term.fill(~0ull);
+
+                for (uint32_t i = 0u; i < op.num_fanins; ++i)
+                {
+                    const auto& in       = words_of(op.fanins[i])[w];
+                    const auto  positive = ((row >> i) & 1ull) != 0ull;
+
+                    for (std::size_t b = 0; b < BLOCKS_PER_WORD; ++b)
+                    {
+                        term[b] &= positive ? in[b] : ~in[b];
+                    }
+                }
+
+                for (std::size_t b = 0; b < BLOCKS_PER_WORD; ++b)
+                {
+                    result[b] |= term[b];
+                }
+            }
+
+            out[w] = result;
+        }
+    }
+    /**
+     * Returns a pointer to the first simulation word of the given node.
+     *
+     * @param n Node.
+     * @return Pointer to `n`'s first word.
+     */
+    [[nodiscard]] word_type* words_of(const node n) noexcept
+    {
+        return values.data() + static_cast<std::size_t>(n) * num_words;
+    }
+    /**
+     * Returns a pointer to the first simulation word of the given node.
+     *
+     * @param n Node.
+     * @return Pointer to `n`'s first word.
+     */
+    [[nodiscard]] const word_type* words_of(const node n) const noexcept
+    {
+        return values.data() + static_cast<std::size_t>(n) * num_words;
+    }
+};
+
+/**
+ * Computes the truth tables of all primary outputs of the given gate-level layout by exhaustively simulating all input
+ * patterns with a bit-parallel `gate_level_simulator`. This is a fast alternative to
+ * `mockturtle::simulate<kitty::dynamic_truth_table>` that is suitable for functional sanity checks after layout
+ * transformations.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @tparam NumBits Number of patterns per simulation word. Must be a positive multiple of 64.
+ * @param lyt Gate-level layout to simulate.
+ * @return Truth tables of all primary outputs in the order of `foreach_po`.
+ * @throws std::invalid_argument if a node has more than six fanins or if the arity of a node's function differs from
+ * its number of fanins.
+ */
+template <typename Lyt, std::size_t NumBits = 256>
+[[nodiscard]] std::vector<kitty::dynamic_truth_table> gate_level_truth_tables(const Lyt& lyt)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    using simulator = gate_level_simulator<Lyt, NumBits>;
+
+    const auto num_vars   = lyt.num_pis();
+    const auto num_blocks = num_vars <= 6 ? 1ul : 1ul << (num_vars - 6);
+    const auto num_words  = (num_blocks + simulator::BLOCKS_PER_WORD - 1) / simulator::BLOCKS_PER_WORD;
+
+    // projection functions of the first six variables
+    static constexpr const std::array<uint64_t, 6> projections{{0xaaaaaaaaaaaaaaaaull, 0xccccccccccccccccull,
+                                                                0xf0f0f0f0f0f0f0f0ull, 0xff00ff00ff00ff00ull,
+                                                                0xffff0000ffff0000ull, 0xffffffff00000000ull}};
+
+    std::vector<typename simulator::pattern_type> patterns(num_vars, typename simulator::pattern_type(num_words));
+
+    for (uint32_t i = 0u; i < num_vars; ++i)
+    {
+        for (std::size_t w = 0; w < num_words; ++w)
+        {
+            for (std::size_t b = 0; b < simulator::BLOCKS_PER_WORD; ++b)
+            {
+                const auto block = w * simulator::BLOCKS_PER_WORD + b;
+
+                patterns[i][w][b] = i < 6 ? projections[i] : (((block >> (i - 6)) & 1ul) != 0ul ? ~0ull : 0ull);
+            }
+        }
+    }
+
+    simulator sim{lyt};
+    sim.simulate(patterns);
+
+    std::vector<kitty::dynamic_truth_table> tts{};
+    tts.reserve(lyt.num_pos());
+
+    for (const auto& pattern : sim.output_patterns())
+    {
+        kitty::dynamic_truth_table tt{num_vars};
+
+        auto it = tt.begin();
+
+        for (std::size_t block = 0; block < num_blocks; ++block, ++it)
+        {
+            *it = pattern[block / simulator::BLOCKS_PER_WORD][block % simulator::BLOCKS_PER_WORD];
+        }
+
+        tt.mask_bits();
+
+        tts.push_back(tt);
+    }
+
+    return tts;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_GATE_LEVEL_SIMULATION_HPP
@@ -6,6 +6,12 @@
 #define FICTION_NETWORK_READER_HPP
 
 #include "fiction/algorithms/network_transformation/network_conversion.hpp"
+#include "fiction/io/read_network_snapshot.hpp"
+#include "fiction/io/write_network_snapshot.hpp"
+#include "fiction/utils/checkpoint_utils.hpp"
+#include "fiction/utils/hash.hpp"
+
+#include <fmt/format.h>
 
 #include <lorina/aiger.hpp>
 #include <lorina/blif.hpp>
@@ -21,15 +27,41 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace fiction
 {
+/**
+ * Parameters for the `network_reader`.
+ */
+struct network_reader_params
+{
+    /**
+     * Number of threads to use for reading files in parallel.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+    /**
+     * Directory in which parsed networks are cached as binary snapshots (see `write_network_snapshot`). Snapshots are
+     * keyed by a hash of the file content and the network type such that modified files are parsed again. If empty, no
+     * caching takes place. The directory is created if it does not exist yet.
+     */
+    std::string cache_directory{};
+};
 /**
  * Helper class to read directories of mockturtle networks of certain types.
  *
@@ -42,10 +74,18 @@ class network_reader
     /**
      * Standard constructor. Reads and constructs logic networks. May throw.
      *
+     * Files are read in parallel. Each file is loaded into memory in one go and parsed from there, which allows hashing
+     * its content to look up previously parsed networks in the snapshot cache if one is specified in `p`. The read
+     * networks as well as all status updates and parser diagnostics are reported in lexicographical order of the file
+     * paths regardless of the number of threads. Parser diagnostics are written to the standard error stream.
+     *
      * @param filename Path to the file or folder of files to read.
      * @param out Output stream to write status updates into.
+     * @param p Parameters.
      */
-    network_reader(const std::string_view& filename, std::ostream& o) : out{o}
+    network_reader(const std::string_view& filename, std::ostream& o, const network_reader_params& p = {}) :
+            out{o},
+            ps{p}
     {
         constexpr const char* verilog_ext = ".v";
         constexpr const char* aig_ext     = ".aig";
@@ -54,10 +94,10 @@ class network_reader
         constexpr const std::array<const char*, 3> extensions{{verilog_ext, aig_ext, blif_ext}};
 
         // checks for extension validity
-        auto is_valid_extension = [&](const auto& p) -> bool
+        auto is_valid_extension = [&](const auto& path) -> bool
         {
             return std::any_of(extensions.cbegin(), extensions.cend(),
-                               [&p](const auto& valid) { return std::filesystem::path(p).extension() == valid; });
+                               [&path](const auto& valid) { return std::filesystem::path(path).extension() == valid; });
         };
 
         std::vector<std::string> paths{};
@@ -99,47 +139,53 @@ class network_reader
             out << "[e] given file name does not exist" << std::endl;
         }
 
-        // handle collected files
-        for (const auto& p : paths)
+        std::sort(paths.begin(), paths.end());
+
+        if (!ps.cache_directory.empty())
         {
-            // parse Verilog
-            if (std::filesystem::path(p).extension() == verilog_ext)
-            {
-                read<mockturtle::verilog_reader<Ntk>,
-                     lorina::return_code(const std::string&, const lorina::verilog_reader&,
-                                         lorina::diagnostic_engine*)>(p, lorina::read_verilog);
-            }
-            // parse AIGER
-            else if (std::filesystem::path(p).extension() == aig_ext)
+            std::error_code ec{};
+            std::filesystem::create_directories(ps.cache_directory, ec);
+        }
+
+        // read files in parallel; networks, status updates, and diagnostics are stored per file to report them in a
+        // fixed order
+        std::vector<NtkPtr>             results(paths.size());
+        std::vector<std::ostringstream> messages(paths.size());
+        std::vector<std::ostringstream> diagnostics(paths.size());
+        std::atomic<std::size_t>        next_file{0};
+
+        const auto worker = [this, &paths, &results, &messages, &diagnostics, &next_file]()
+        {
+            for (auto i = next_file++; i < paths.size(); i = next_file++)
             {
-                read<mockturtle::aiger_reader<Ntk>,
-                     lorina::return_code(const std::string&, const lorina::aiger_reader&, lorina::diagnostic_engine*)>(
-                    p, lorina::read_aiger);
+                results[i] = read_file(paths[i], messages[i], diagnostics[i]);
             }
-            // parse BLIF
-            else if (std::filesystem::path(p).extension() == blif_ext)
+        };
+
+        const auto num_threads = std::max(std::min(ps.num_threads, paths.size()), std::size_t{1});
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            std::cerr << diagnostics[i].str();
+            out << messages[i].str();
+
+            if (results[i] != nullptr)
             {
-                if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::aig_network>)
-                {
-                    out << "[e] AIGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::xag_network>)
-                {
-                    out << "[e] XAGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::mig_network>)
-                {
-                    out << "[e] MIGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else
-                {
-                    read<mockturtle::blif_reader<Ntk>,
-                         lorina::return_code(const std::string&, const lorina::blif_reader&,
-                                             lorina::diagnostic_engine*)>(p, lorina::read_blif);
-                }
+                networks.push_back(std::move(results[i]));
             }
-            // parse ...
-            // else if (std::filesystem::path(p).extension() == ...)
         }
     }
     /**
@@ -159,6 +205,15 @@ class network_reader
 
         return networks;
     }
+    /**
+     * Returns the number of networks that were restored from the snapshot cache instead of being parsed.
+     *
+     * @return Number of cache hits.
+     */
+    [[nodiscard]] std::size_t num_cache_hits() const noexcept
+    {
+        return cache_hits;
+    }
 
   private:
     /**
@@ -169,44 +224,238 @@ class network_reader
      * Vector of logic networks read from files given at construction.
      */
     std::vector<NtkPtr> networks;
+    /**
+     * Parameters.
+     */
+    const network_reader_params ps;
+    /**
+     * Number of networks restored from the snapshot cache.
+     */
+    std::atomic<std::size_t> cache_hits{0};
 
     using Ntk = typename NtkPtr::element_type;
     /**
-     * Actual read function that constructs the logic network from a file.
+     * Diagnostic consumer that writes the parser's diagnostics into a stream in the format of
+     * `lorina::text_diagnostics`. Used to collect the diagnostics of each file separately, which prevents the output of
+     * files that are parsed concurrently from interleaving.
+     */
+    class buffered_diagnostics : public lorina::diagnostic_consumer
+    {
+      public:
+        /**
+         * Standard constructor.
+         *
+         * @param o Output stream to write the diagnostics into.
+         */
+        explicit buffered_diagnostics(std::ostream& o) noexcept : os{o} {}
+        /**
+         * Writes the given diagnostic into the stored stream.
+         *
+         * @param level Severity of the diagnostic.
+         * @param message Diagnostic message.
+         */
+        void handle_diagnostic(const lorina::diagnostic_level level, const std::string& message) const override
+        {
+            switch (level)
+            {
+                case lorina::diagnostic_level::ignore:
+                {
+                    return;
+                }
+                case lorina::diagnostic_level::note:
+                case lorina::diagnostic_level::remark:
+                {
+                    os << "[i] ";
+                    break;
+                }
+                case lorina::diagnostic_level::warning:
+                {
+                    os << "[w] ";
+                    break;
+                }
+                case lorina::diagnostic_level::error:
+                {
+                    os << "[e] ";
+                    break;
+                }
+                default:
+                {
+                    os << "[E] ";
+                    break;
+                }
+            }
+
+            os << message << '\n';
+        }
+
+      private:
+        /**
+         * Output stream to write the diagnostics into.
+         */
+        std::ostream& os;
+    };
+    /**
+     * Reads, parses, and converts the logic network stored in the given file. If a snapshot cache is used, the network
+     * is restored from its snapshot if available or the snapshot is created otherwise.
      *
-     * @tparam Reader The functor type which constructs the network, i.e. handles the callbacks.
-     * @tparam ReadFun The file parser type.
      * @param file The file name.
-     * @param rfun The actual parsing function.
+     * @param msg Output stream to write status updates of this file into.
+     * @param diag Output stream to write the parser diagnostics of this file into.
+     * @return The constructed logic network or `nullptr` if the file could not be read.
      */
-    template <class Reader, class ReadFun>
-    void read(const std::string_view& file, ReadFun rfun) noexcept
+    NtkPtr read_file(const std::string& file, std::ostream& msg, std::ostream& diag) noexcept
     {
-        Ntk ntk{};
+        const auto extension = std::filesystem::path{file}.extension().string();
+
+        if (extension == ".blif")
+        {
+            if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::aig_network>)
+            {
+                msg << "[e] AIGs do not support the full feature set of BLIF files" << std::endl;
+                return nullptr;
+            }
+            else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::xag_network>)
+            {
+                msg << "[e] XAGs do not support the full feature set of BLIF files" << std::endl;
+                return nullptr;
+            }
+            else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::mig_network>)
+            {
+                msg << "[e] MIGs do not support the full feature set of BLIF files" << std::endl;
+                return nullptr;
+            }
+        }
 
         try
         {
-            lorina::text_diagnostics client{};
-            if (lorina::diagnostic_engine diag{&client};
-                rfun(file.data(), Reader{ntk}, &diag) == lorina::return_code::success)
+            // load the entire file at once
+            std::string content{};
             {
-                const auto name = std::filesystem::path{file}.stem().string();
+                std::ifstream is{file, std::ifstream::in | std::ifstream::binary};
 
-                if constexpr (mockturtle::has_set_network_name_v<Ntk>)
+                if (!is.is_open())
                 {
-                    ntk.set_network_name(name);
+                    msg << "[e] could not open " << file << std::endl;
+                    return nullptr;
                 }
 
-                networks.push_back(std::make_shared<Ntk>(convert_network<Ntk>(ntk)));
+                content.resize(std::filesystem::file_size(file));
+                is.read(content.data(), static_cast<std::streamsize>(content.size()));
             }
-            else
+
+            const auto name = std::filesystem::path{file}.stem().string();
+
+            std::string snapshot{};
+
+            if (!ps.cache_directory.empty())
+            {
+                // key the snapshot by the file content, its extension, and the network type
+                const auto key  = fnv1a_hash(extension, fnv1a_hash(content));
+                const auto type = fnv1a_hash(typeid(Ntk).name());
+
+                snapshot = (std::filesystem::path{ps.cache_directory} / fmt::format("{:016x}{:016x}.fns", key, type))
+                               .string();
+
+                if (std::filesystem::exists(snapshot))
+                {
+                    try
+                    {
+                        auto cached = std::make_shared<Ntk>(read_network_snapshot<Ntk>(snapshot));
+                        assign_network_name(*cached, name);
+                        ++cache_hits;
+
+                        return cached;
+                    }
+                    catch (...)  // NOLINT(bugprone-empty-catch): fall back to parsing the file
+                    {}
+                }
+            }
+
+            std::istringstream is{content};
+
+            std::shared_ptr<Ntk> ntk{};
+
+            // parse Verilog
+            if (extension == ".v")
+            {
+                ntk = parse<mockturtle::verilog_reader<Ntk>,
+                            lorina::return_code(std::istream&, const lorina::verilog_reader&,
+                                                lorina::diagnostic_engine*)>(is, lorina::read_verilog, diag);
+            }
+            // parse AIGER
+            else if (extension == ".aig")
             {
-                out << "[e] parsing error in " << file << std::endl;
+                ntk = parse<mockturtle::aiger_reader<Ntk>,
+                            lorina::return_code(std::istream&, const lorina::aiger_reader&,
+                                                lorina::diagnostic_engine*)>(is, lorina::read_aiger, diag);
             }
+            // parse BLIF
+            else if (extension == ".blif")
+            {
+                ntk = parse<mockturtle::blif_reader<Ntk>,
+                            lorina::return_code(std::istream&, const lorina::blif_reader&,
+                                                lorina::diagnostic_engine*)>(is, lorina::read_blif, diag);
+            }
+            // parse ...
+            // else if (extension == ...)
+
+            if (ntk == nullptr)
+            {
+                msg << "[e] parsing error in " << file << std::endl;
+                return nullptr;
+            }
+
+            assign_network_name(*ntk, name);
+
+            if (!snapshot.empty() &&
+                !write_file_atomically(snapshot, [&ntk](std::ostream& os) { write_network_snapshot(*ntk, os); }))
+            {
+                msg << "[w] could not cache " << file << std::endl;
+            }
+
+            return ntk;
         }
         catch (...)
         {
-            out << "[e] " << file << " contains unsupported features" << std::endl;
+            msg << "[e] " << file << " contains unsupported features" << std::endl;
+        }
+
+        return nullptr;
+    }
+    /**
+     * Actual parse function that constructs the logic network from an input stream.
+     *
+     * @tparam Reader The functor type which constructs the network, i.e. handles the callbacks.
+     * @tparam ReadFun The parser type.
+     * @param is The input stream to parse.
+     * @param rfun The actual parsing function.
+     * @param diag Output stream to write the parser diagnostics into.
+     * @return The constructed logic network or `nullptr` if a parsing error occurred.
+     */
+    template <class Reader, class ReadFun>
+    [[nodiscard]] static std::shared_ptr<Ntk> parse(std::istream& is, ReadFun rfun, std::ostream& diag)
+    {
+        Ntk ntk{};
+
+        buffered_diagnostics client{diag};
+        if (lorina::diagnostic_engine diag{&client}; rfun(is, Reader{ntk}, &diag) == lorina::return_code::success)
+        {
+            return std::make_shared<Ntk>(convert_network<Ntk>(ntk));
+        }
+
+        return nullptr;
+    }
+    /**
+     * Assigns the given name to the given network if it supports names.
+     *
+     * @param ntk The network.
+     * @param name The name to assign.
+     */
+    static void assign_network_name([[maybe_unused]] Ntk& ntk, [[maybe_unused]] const std::string& name)
+    {
+        if constexpr (mockturtle::has_set_network_name_v<Ntk>)
+        {
+            ntk.set_network_name(name);
         }
     }
 };
@@ -0,0 +1,505 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
+#define FICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
+
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain_types.hpp"
+#include "fiction/io/write_binary_operational_domain.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Exception thrown when an error occurs during parsing of a binary operational domain file.
+ */
+class binary_operational_domain_parsing_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `binary_operational_domain_parsing_error` object with the given error message.
+     *
+     * @param msg The error message describing the parsing error.
+     */
+    explicit binary_operational_domain_parsing_error(const std::string_view& msg) noexcept :
+            std::runtime_error(msg.data())
+    {}
+};
+/**
+ * Meta data stored in the header of a binary operational domain file.
+ */
+struct binary_operational_domain_header
+{
+    /**
+     * Kind of the stored domain.
+     */
+    binary_operational_domain_kind kind{binary_operational_domain_kind::OPERATIONAL_DOMAIN};
+    /**
+     * Sweep dimensions that define the step grid of the stored samples.
+     */
+    std::vector<operational_domain_value_range> sweep_dimensions{};
+    /**
+     * Number of stored samples.
+     */
+    uint64_t num_samples{0};
+};
+
+namespace detail
+{
+
+/**
+ * Reads the object representation of a trivially copyable value from the given stream.
+ *
+ * @tparam T Value type.
+ * @param is Input stream.
+ * @return The value read.
+ * @throws binary_operational_domain_parsing_error if the stream ends prematurely.
+ */
+template <typename T>
+[[nodiscard]] T read_binary_value(std::istream& is)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    T value{};
+
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T)))  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    {
+        throw binary_operational_domain_parsing_error(
+            "Error parsing binary operational domain: unexpected end of file");
+    }
+
+    return value;
+}
+/**
+ * Reads a column of the given length including its trailing padding bytes.
+ *
+ * @tparam T Element type of the column.
+ * @param is Input stream.
+ * @param num_elements Number of elements in the column.
+ * @return The column read.
+ * @throws binary_operational_domain_parsing_error if the stream ends prematurely.
+ */
+template <typename T>
+[[nodiscard]] std::vector<T> read_binary_column(std::istream& is, const std::size_t num_elements)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    // the column grows in chunks such that a corrupted sample count cannot trigger a huge allocation in case the size
+    // of the stream cannot be determined in advance
+    constexpr std::size_t chunk_size = (std::size_t{1} << 20u) / sizeof(T);
+
+    std::vector<T> column{};
+
+    for (std::size_t num_read = 0; num_read < num_elements;)
+    {
+        const auto num_chunk_elements = std::min(chunk_size, num_elements - num_read);
+
+        column.resize(num_read + num_chunk_elements);
+
+        if (!is.read(reinterpret_cast<char*>(&column[num_read]),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                     static_cast<std::streamsize>(num_chunk_elements * sizeof(T))))
+        {
+            throw binary_operational_domain_parsing_error(
+                "Error parsing binary operational domain: unexpected end of file");
+        }
+
+        num_read += num_chunk_elements;
+    }
+
+    if (!is.ignore(static_cast<std::streamsize>(binary_opdom_padding(num_elements * sizeof(T)))))
+    {
+        throw binary_operational_domain_parsing_error(
+            "Error parsing binary operational domain: unexpected end of file");
+    }
+
+    return column;
+}
+/**
+ * Computes the number of bytes that the columns of a binary operational domain file occupy. Sizes that exceed the
+ * range of `uint64_t`, which only occur for corrupted sample counts, saturate at its maximum.
+ *
+ * @param header Header of the file.
+ * @return Size of all columns including padding in bytes.
+ */
+[[nodiscard]] inline uint64_t binary_opdom_payload_size(const binary_operational_domain_header& header) noexcept
+{
+    constexpr auto max_size = std::numeric_limits<uint64_t>::max();
+
+    const auto column_size = [&header](const uint64_t element_size) -> uint64_t
+    {
+        // leave room for the padding
+        if (header.num_samples > (max_size - BINARY_OPDOM_ALIGNMENT) / element_size)
+        {
+            return max_size;
+        }
+
+        const auto num_bytes = header.num_samples * element_size;
+
+        return num_bytes + binary_opdom_padding(static_cast<std::size_t>(num_bytes));
+    };
+
+    const auto add = [](const uint64_t a, const uint64_t b) -> uint64_t { return a > max_size - b ? max_size : a + b; };
+
+    auto size = column_size(sizeof(uint8_t));
+
+    for (std::size_t d = 0; d < header.sweep_dimensions.size(); ++d)
+    {
+        size = add(size, column_size(sizeof(uint32_t)));
+    }
+
+    if (header.kind == binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN)
+    {
+        size = add(size, column_size(sizeof(double)));
+    }
+
+    return size;
+}
+
+}  // namespace detail
+
+/**
+ * Reads the header of a binary operational domain file as written by `write_binary_operational_domain`. After this
+ * function returns, the stream is positioned at the beginning of the first column.
+ *
+ * @param is The input stream to read from. It should be opened in binary mode.
+ * @return The header of the file.
+ * @throws binary_operational_domain_parsing_error if the header is malformed or the file was written on a machine with
+ * a different byte order or by an incompatible version.
+ */
+[[nodiscard]] inline binary_operational_domain_header read_binary_operational_domain_header(std::istream& is)
+{
+    if (detail::read_binary_value<std::array<char, 8>>(is) != detail::BINARY_OPDOM_MAGIC)
+    {
+        throw binary_operational_domain_parsing_error(
+            "Error parsing binary operational domain: not a binary operational domain file");
+    }
+
+    if (detail::read_binary_value<uint32_t>(is) != detail::BINARY_OPDOM_BYTE_ORDER_MARK)
+    {
+        throw binary_operational_domain_parsing_error(
+            "Error parsing binary operational domain: file was written with a different byte order");
+    }
+
+    if (const auto version = detail::read_binary_value<uint16_t>(is); version != detail::BINARY_OPDOM_VERSION)
+    {
+        throw binary_operational_domain_parsing_error(
+            fmt::format("Error parsing binary operational domain: unsupported version {}", version));
+    }
+
+    binary_operational_domain_header header{};
+
+    const auto kind = detail::read_binary_value<uint8_t>(is);
+
+    if (kind > static_cast<uint8_t>(binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN))
+    {
+        throw binary_operational_domain_parsing_error(
+            fmt::format("Error parsing binary operational domain: unknown domain kind {}", kind));
+    }
+
+    header.kind = static_cast<binary_operational_domain_kind>(kind);
+
+    const auto num_dimensions = detail::read_binary_value<uint8_t>(is);
+
+    if (num_dimensions == 0)
+    {
+        throw binary_operational_domain_parsing_error("Error parsing binary operational domain: no sweep dimensions");
+    }
+
+    header.num_samples = detail::read_binary_value<uint64_t>(is);
+    static_cast<void>(detail::read_binary_value<uint64_t>(is));  // reserved
+
+    header.sweep_dimensions.reserve(num_dimensions);
+
+    for (std::size_t d = 0; d < num_dimensions; ++d)
+    {
+        const auto param = detail::read_binary_value<uint8_t>(is);
+
+        if (param > static_cast<uint8_t>(sweep_parameter::MU_MINUS))
+        {
+            throw binary_operational_domain_parsing_error(
+                fmt::format("Error parsing binary operational domain: unknown sweep parameter {}", param));
+        }
+
+        static_cast<void>(detail::read_binary_value<std::array<uint8_t, 7>>(is));  // reserved
+
+        operational_domain_value_range range{static_cast<sweep_parameter>(param)};
+
+        range.min  = detail::read_binary_value<double>(is);
+        range.max  = detail::read_binary_value<double>(is);
+        range.step = detail::read_binary_value<double>(is);
+
+        if (!(range.step > 0.0))
+        {
+            throw binary_operational_domain_parsing_error(
+                fmt::format("Error parsing binary operational domain: non-positive step size in dimension {}", d));
+        }
+
+        header.sweep_dimensions.push_back(range);
+    }
+
+    // reject truncated files before allocating the columns, if the stream's size can be determined
+    if (const auto pos = is.tellg(); pos != std::istream::pos_type{-1})
+    {
+        is.seekg(0, std::istream::end);
+        const auto end = is.tellg();
+        is.seekg(pos);
+
+        if (static_cast<uint64_t>(end - pos) < detail::binary_opdom_payload_size(header))
+        {
+            throw binary_operational_domain_parsing_error(
+                "Error parsing binary operational domain: file is smaller than announced by its header");
+        }
+    }
+
+    return header;
+}
+/**
+ * Reads the header of a binary operational domain file as written by `write_binary_operational_domain`.
+ *
+ * @param filename The name of the file to read from.
+ * @return The header of the file.
+ * @throws std::ifstream::failure if the file could not be opened.
+ * @throws binary_operational_domain_parsing_error if the header is malformed.
+ */
+[[nodiscard]] inline binary_operational_domain_header
+read_binary_operational_domain_header(const std::string_view& filename)
+{
+    std::ifstream is{filename.data(), std::ifstream::in | std::ifstream::binary};
+
+    if (!is.is_open())
+    {
+        throw std::ifstream::failure("could not open file");
+    }
+
+    return read_binary_operational_domain_header(is);
+}
+/**
+ * Reads the samples of a binary operational domain file as written by `write_binary_operational_domain` and merges them
+ * into the given domain. Samples whose parameter point is already contained in `opdom` are skipped, i.e., existing
+ * samples take precedence. This allows to merge several partial sweeps over the same step grid, e.g., ones that were
+ * computed on different machines, and to resume interrupted sweeps by restoring the already evaluated samples.
+ *
+ * If `opdom` has no dimensions yet, the dimensions of the file are added to it. Otherwise, the file must have the same
+ * dimensions and all parameter points already contained in `opdom` must lie on the file's step grid, i.e., both sweeps
+ * must start at the same minimum and use the same step size, and the file's sweep must extend to all existing points. A
+ * `critical_temperature_domain` file can be read into an `operational_domain`, in which case the critical temperatures
+ * are discarded.
+ *
+ * The entire file is read and validated before any sample is merged. Hence, `opdom` remains unchanged if an exception
+ * is thrown.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param opdom The domain to merge the samples into.
+ * @param is The input stream to read from. It should be opened in binary mode.
+ * @return The header of the file, which contains the step grid of the sweep.
+ * @throws binary_operational_domain_parsing_error if the file is malformed.
+ * @throws std::invalid_argument if the file's dimensions or step grid do not match `opdom` or if an
+ * `operational_domain` file is read into a `critical_temperature_domain`.
+ */
+template <typename OpDomain>
+binary_operational_domain_header read_binary_operational_domain(OpDomain& opdom, std::istream& is)
+{
+    static_assert(std::is_same_v<OpDomain, operational_domain> || std::is_same_v<OpDomain, critical_temperature_domain>,
+                  "OpDomain must be an operational_domain or a critical_temperature_domain");
+
+    auto header = read_binary_operational_domain_header(is);
+
+    const auto num_dimensions = header.sweep_dimensions.size();
+    const auto num_samples    = static_cast<std::size_t>(header.num_samples);
+
+    if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+    {
+        if (header.kind != binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN)
+        {
+            throw std::invalid_argument("the file does not contain critical temperatures");
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> index_columns{};
+    index_columns.reserve(num_dimensions);
+
+    for (std::size_t d = 0; d < num_dimensions; ++d)
+    {
+        index_columns.push_back(detail::read_binary_column<uint32_t>(is, num_samples));
+    }
+
+    const auto status_column = detail::read_binary_column<uint8_t>(is, num_samples);
+
+    std::vector<double> temperature_column{};
+
+    if (header.kind == binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN)
+    {
+        temperature_column = detail::read_binary_column<double>(is, num_samples);
+    }
+
+    // the parameter values of each dimension bound the valid step indices
+    std::vector<std::vector<double>> values{};
+    values.reserve(num_dimensions);
+
+    for (const auto& range : header.sweep_dimensions)
+    {
+        values.push_back(sweep_dimension_values(range));
+    }
+
+    for (std::size_t i = 0; i < num_samples; ++i)
+    {
+        for (std::size_t d = 0; d < num_dimensions; ++d)
+        {
+            if (const auto index = index_columns[d][i]; index >= values[d].size())
+            {
+                throw binary_operational_domain_parsing_error(fmt::format(
+                    "Error parsing binary operational domain: step index {} out of range in dimension {}", index, d));
+            }
+        }
+
+        if (status_column[i] > static_cast<uint8_t>(operational_status::NON_OPERATIONAL))
+        {
+            throw binary_operational_domain_parsing_error(fmt::format(
+                "Error parsing binary operational domain: invalid operational status {}", status_column[i]));
+        }
+    }
+
+    if (opdom.get_number_of_dimensions() != 0)
+    {
+        if (opdom.get_number_of_dimensions() != num_dimensions)
+        {
+            throw std::invalid_argument("the number of dimensions in the file does not match the operational domain");
+        }
+
+        for (std::size_t d = 0; d < num_dimensions; ++d)
+        {
+            if (opdom.get_dimension(d) != header.sweep_dimensions[d].dimension)
+            {
+                throw std::invalid_argument(
+                    fmt::format("dimension {} in the file does not match the operational domain", d));
+            }
+        }
+
+        // the existing samples have to lie on the file's step grid; this throws std::invalid_argument otherwise
+        opdom.for_each(
+            [&values](const auto& pp, const auto&)
+            {
+                const auto& parameters = pp.get_parameters();
+
+                for (std::size_t d = 0; d < values.size(); ++d)
+                {
+                    static_cast<void>(detail::sweep_grid_index(values[d], parameters[d]));
+                }
+            });
+    }
+    else
+    {
+        for (const auto& range : header.sweep_dimensions)
+        {
+            opdom.add_dimension(range.dimension);
+        }
+    }
+
+    std::vector<double> parameters(num_dimensions);
+
+    for (std::size_t i = 0; i < num_samples; ++i)
+    {
+        for (std::size_t d = 0; d < num_dimensions; ++d)
+        {
+            // same values as in sweep_dimension_values to reproduce the sampled parameter values exactly
+            parameters[d] = values[d][index_columns[d][i]];
+        }
+
+        const auto status = static_cast<operational_status>(status_column[i]);
+
+        if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+        {
+            opdom.add_value(parameter_point{parameters}, std::make_tuple(status, temperature_column[i]));
+        }
+        else
+        {
+            opdom.add_value(parameter_point{parameters}, std::make_tuple(status));
+        }
+    }
+
+    return header;
+}
+/**
+ * Reads the samples of a binary operational domain file as written by `write_binary_operational_domain` and merges them
+ * into the given domain. See the stream overload for details.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param opdom The domain to merge the samples into.
+ * @param filename The name of the file to read from.
+ * @return The header of the file, which contains the step grid of the sweep.
+ * @throws std::ifstream::failure if the file could not be opened.
+ * @throws binary_operational_domain_parsing_error if the file is malformed.
+ * @throws std::invalid_argument if the file's dimensions or step grid do not match `opdom` or if an
+ * `operational_domain` file is read into a `critical_temperature_domain`.
+ */
+template <typename OpDomain>
+binary_operational_domain_header read_binary_operational_domain(OpDomain& opdom, const std::string_view& filename)
+{
+    std::ifstream is{filename.data(), std::ifstream::in | std::ifstream::binary};
+
+    if (!is.is_open())
+    {
+        throw std::ifstream::failure("could not open file");
+    }
+
+    auto header = read_binary_operational_domain(opdom, is);
+    is.close();
+
+    return header;
+}
+/**
+ * Reads a binary operational domain file as written by `write_binary_operational_domain` into a new domain.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param is The input stream to read from. It should be opened in binary mode.
+ * @return The domain stored in the file.
+ * @throws binary_operational_domain_parsing_error if the file is malformed.
+ * @throws std::invalid_argument if an `operational_domain` file is read into a `critical_temperature_domain`.
+ */
+template <typename OpDomain>
+[[nodiscard]] OpDomain read_binary_operational_domain(std::istream& is)
+{
+    OpDomain opdom{};
+    static_cast<void>(read_binary_operational_domain(opdom, is));
+
+    return opdom;
+}
+/**
+ * Reads a binary operational domain file as written by `write_binary_operational_domain` into a new domain.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param filename The name of the file to read from.
+ * @return The domain stored in the file.
+ * @throws std::ifstream::failure if the file could not be opened.
+ * @throws binary_operational_domain_parsing_error if the file is malformed.
+ * @throws std::invalid_argument if an `operational_domain` file is read into a `critical_temperature_domain`.
+ */
+template <typename OpDomain>
+[[nodiscard]] OpDomain read_binary_operational_domain(const std::string_view& filename)
+{
+    OpDomain opdom{};
+    static_cast<void>(read_binary_operational_domain(opdom, filename));
+
+    return opdom;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_READ_BINARY_OPERATIONAL_DOMAIN_HPP
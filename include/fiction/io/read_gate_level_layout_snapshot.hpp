@@ -0,0 +1,524 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_READ_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
+#define FICTION_READ_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
+
+#include "fiction/io/write_gate_level_layout_snapshot.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
+#include "fiction/utils/name_utils.hpp"
+
+#include <fmt/format.h>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Exception thrown when an error occurs during parsing of a gate-level layout snapshot file.
+ */
+class gate_level_layout_snapshot_parsing_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `gate_level_layout_snapshot_parsing_error` object with the given error message.
+     *
+     * @param msg The error message describing the parsing error.
+     */
+    explicit gate_level_layout_snapshot_parsing_error(const std::string_view& msg) noexcept :
+            std::runtime_error(msg.data())
+    {}
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class read_gate_level_layout_snapshot_impl
+{
+  public:
+    explicit read_gate_level_layout_snapshot_impl(std::istream& s) : is{s} {}
+
+    Lyt run()
+    {
+        read_payload();
+
+        if (const auto topology = read_string(); topology != layout_topology_name<Lyt>())
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                fmt::format("Error parsing gate-level layout snapshot: Lyt is not a {} layout", topology));
+        }
+
+        const auto name = read_string();
+
+        const auto x = read_value<int32_t>();
+        const auto y = read_value<int32_t>();
+        const auto z = read_value<int32_t>();
+
+        if (x < 0 || y < 0 || z < 0 || z > 1)
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                fmt::format("Error parsing gate-level layout snapshot: invalid aspect ratio ({},{},{})", x, y, z));
+        }
+
+        lyt.resize(aspect_ratio<Lyt>{x, y, z});
+        set_name(lyt, name);
+
+        read_clocking();
+
+        const auto num_nodes = read_value<uint32_t>();
+        signals.reserve(num_nodes);
+
+        for (uint32_t i = 0; i < num_nodes; ++i)
+        {
+            signals.push_back(read_node());
+        }
+
+        if (position != payload.size())
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: unexpected data after the last tile");
+        }
+
+        return lyt;
+    }
+
+  private:
+    /**
+     * Maximum number of bytes of the payload that are read at once. Reading in chunks ensures that a corrupted payload
+     * size in the header cannot cause allocations beyond the actual length of the stream.
+     */
+    static constexpr const std::size_t PAYLOAD_CHUNK_SIZE = 1ul << 20ul;
+    /**
+     * Maximum arity of node functions. Since tiles only receive their fanins from adjacent tiles, no layout exceeds
+     * this arity, while it prevents a corrupted snapshot from requesting huge truth tables.
+     */
+    static constexpr const uint8_t MAX_FUNCTION_ARITY = 16u;
+    /**
+     * The input stream to read from.
+     */
+    std::istream& is;
+    /**
+     * The layout to construct.
+     */
+    Lyt lyt{};
+    /**
+     * Payload read from the stream.
+     */
+    std::string payload{};
+    /**
+     * Current read position in the payload.
+     */
+    std::size_t position{0};
+    /**
+     * Signal of each node in the snapshot, indexed by snapshot index.
+     */
+    std::vector<mockturtle::signal<Lyt>> signals{};
+
+    /**
+     * Reads and verifies the header and reads the entire payload in chunks of `PAYLOAD_CHUNK_SIZE` bytes. The payload
+     * is verified via its checksum before anything is constructed.
+     *
+     * @throws gate_level_layout_snapshot_parsing_error if the header is malformed, the payload is truncated, or the
+     * checksum does not match.
+     */
+    void read_payload()
+    {
+        std::array<char, GATE_LEVEL_LAYOUT_SNAPSHOT_HEADER_SIZE> header{};
+
+        if (!is.read(header.data(), header.size()))
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: unexpected end of file");
+        }
+
+        const std::string_view header_view{header.data(), header.size()};
+
+        if (header_view.substr(0, GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.size()) !=
+            std::string_view{GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.data(), GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.size()})
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: invalid magic bytes");
+        }
+
+        std::size_t offset = GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.size();
+
+        const auto header_value = [&header, &offset](auto value)
+        {
+            std::memcpy(&value, header.data() + offset, sizeof(value));
+            offset += sizeof(value);
+
+            return value;
+        };
+
+        if (const auto version = header_value(uint16_t{}); version != GATE_LEVEL_LAYOUT_SNAPSHOT_VERSION)
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                fmt::format("Error parsing gate-level layout snapshot: unsupported version {}", version));
+        }
+
+        static_cast<void>(header_value(uint16_t{}));  // reserved
+
+        if (header_value(uint32_t{}) != GATE_LEVEL_LAYOUT_SNAPSHOT_BYTE_ORDER_MARK)
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: unsupported byte order");
+        }
+
+        const auto payload_size = header_value(uint64_t{});
+        const auto checksum     = header_value(uint64_t{});
+
+        while (payload.size() < payload_size)
+        {
+            const auto num_read = payload.size();
+            const auto chunk =
+                static_cast<std::size_t>(std::min(payload_size - num_read, uint64_t{PAYLOAD_CHUNK_SIZE}));
+
+            payload.resize(num_read + chunk);
+
+            if (!is.read(payload.data() + num_read, static_cast<std::streamsize>(chunk)))
+            {
+                throw gate_level_layout_snapshot_parsing_error(
+                    "Error parsing gate-level layout snapshot: unexpected end of file");
+            }
+        }
+
+        if (fnv1a_hash(payload) != checksum)
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: checksum mismatch");
+        }
+    }
+    /**
+     * Reads the object representation of a trivially copyable value from the payload.
+     *
+     * @tparam T Value type.
+     * @return The value read.
+     * @throws gate_level_layout_snapshot_parsing_error if the payload ends prematurely.
+     */
+    template <typename T>
+    [[nodiscard]] T read_value()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        if (payload.size() - position < sizeof(T))
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: unexpected end of payload");
+        }
+
+        T value{};
+        std::memcpy(&value, payload.data() + position, sizeof(T));
+        position += sizeof(T);
+
+        return value;
+    }
+    /**
+     * Reads a length-prefixed string from the payload.
+     *
+     * @return The string read.
+     * @throws gate_level_layout_snapshot_parsing_error if the payload ends prematurely.
+     */
+    [[nodiscard]] std::string read_string()
+    {
+        const auto size = read_value<uint32_t>();
+
+        if (payload.size() - position < size)
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                "Error parsing gate-level layout snapshot: unexpected end of payload");
+        }
+
+        std::string str{payload.data() + position, size};
+        position += size;
+
+        return str;
+    }
+    /**
+     * Reads the clocking scheme and, if it is irregular, all clock zones.
+     *
+     * @throws gate_level_layout_snapshot_parsing_error if the clocking scheme is unknown or cannot be represented by
+     * `Lyt` or if a clock zone has an invalid clock number.
+     */
+    void read_clocking()
+    {
+        const auto name       = read_string();
+        const auto num_clocks = read_value<uint8_t>();
+        const auto regular    = read_value<uint8_t>() != 0;
+
+        if constexpr (is_static_clocking_scheme_v<typename Lyt::clocking_scheme_t>)
+        {
+            if (!lyt.is_clocking_scheme(name) || lyt.num_clocks() != num_clocks || !regular)
+            {
+                throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                    "Error parsing gate-level layout snapshot: Lyt is statically clocked by a scheme other than {}",
+                    name));
+            }
+        }
+        else
+        {
+            // the number of clocks is part of the name for schemes that come in several variants
+            auto clocking_scheme = get_clocking_scheme<Lyt>(fmt::format("{}{}", name, num_clocks));
+
+            if (!clocking_scheme.has_value())
+            {
+                clocking_scheme = get_clocking_scheme<Lyt>(name);
+            }
+            if (!clocking_scheme.has_value() || clocking_scheme->num_clocks != num_clocks)
+            {
+                throw gate_level_layout_snapshot_parsing_error(
+                    fmt::format("Error parsing gate-level layout snapshot: unknown clocking scheme: {}", name));
+            }
+
+            lyt.replace_clocking_scheme(*clocking_scheme);
+
+            if (!regular)
+            {
+                for (uint64_t x = 0; x <= lyt.x(); ++x)
+                {
+                    for (uint64_t y = 0; y <= lyt.y(); ++y)
+                    {
+                        const auto clock_number = read_value<uint8_t>();
+
+                        if (clock_number >= num_clocks)
+                        {
+                            throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                                "Error parsing gate-level layout snapshot: invalid clock number {} at ({},{})",
+                                static_cast<uint32_t>(clock_number), x, y));
+                        }
+
+                        lyt.assign_clock_number({x, y}, clock_number);
+                    }
+                }
+            }
+        }
+    }
+    /**
+     * Reads a node and places it in the layout.
+     *
+     * @return Signal pointing to the placed node.
+     * @throws gate_level_layout_snapshot_parsing_error if the node is malformed, its tile is outside the layout, or
+     * its tile is already occupied.
+     */
+    [[nodiscard]] mockturtle::signal<Lyt> read_node()
+    {
+        using kind = gate_level_layout_snapshot_gate_kind;
+
+        const auto k = static_cast<kind>(read_value<uint8_t>());
+
+        const auto x = read_value<int32_t>();
+        const auto y = read_value<int32_t>();
+        const auto z = read_value<int32_t>();
+
+        if (x < 0 || y < 0 || z < 0 || static_cast<uint64_t>(x) > lyt.x() || static_cast<uint64_t>(y) > lyt.y() ||
+            static_cast<uint64_t>(z) > lyt.z())
+        {
+            throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                "Error parsing gate-level layout snapshot: tile ({},{},{}) is outside the layout", x, y, z));
+        }
+
+        const tile<Lyt> t{x, y, z};
+
+        if (!lyt.is_empty_tile(t))
+        {
+            throw gate_level_layout_snapshot_parsing_error(
+                fmt::format("Error parsing gate-level layout snapshot: tile {} is occupied more than once", t));
+        }
+
+        const auto num_fanins = read_value<uint8_t>();
+
+        std::vector<mockturtle::signal<Lyt>> fanins{};
+        fanins.reserve(num_fanins);
+
+        for (uint8_t i = 0; i < num_fanins; ++i)
+        {
+            const auto index = read_value<uint32_t>();
+
+            if (index >= signals.size())
+            {
+                throw gate_level_layout_snapshot_parsing_error(
+                    fmt::format("Error parsing gate-level layout snapshot: fanin {} refers to an unknown tile", index));
+            }
+
+            fanins.push_back(signals[index]);
+        }
+
+        const auto check_arity = [num_fanins, &t](const uint8_t arity)
+        {
+            if (num_fanins != arity)
+            {
+                throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                    "Error parsing gate-level layout snapshot: tile {} has an invalid number of fanins ({})", t,
+                    static_cast<uint32_t>(num_fanins)));
+            }
+        };
+
+        switch (k)
+        {
+            case kind::PI:
+            {
+                check_arity(0);
+                return lyt.create_pi(read_string(), t);
+            }
+            case kind::PO:
+            {
+                check_arity(1);
+                return lyt.create_po(fanins[0], read_string(), t);
+            }
+            case kind::BUF:
+            {
+                check_arity(1);
+                return lyt.create_buf(fanins[0], t);
+            }
+            case kind::INV:
+            {
+                check_arity(1);
+                return lyt.create_not(fanins[0], t);
+            }
+            case kind::AND:
+            {
+                check_arity(2);
+                return lyt.create_and(fanins[0], fanins[1], t);
+            }
+            case kind::NAND:
+            {
+                check_arity(2);
+                return lyt.create_nand(fanins[0], fanins[1], t);
+            }
+            case kind::OR:
+            {
+                check_arity(2);
+                return lyt.create_or(fanins[0], fanins[1], t);
+            }
+            case kind::NOR:
+            {
+                check_arity(2);
+                return lyt.create_nor(fanins[0], fanins[1], t);
+            }
+            case kind::LT:
+            {
+                check_arity(2);
+                return lyt.create_lt(fanins[0], fanins[1], t);
+            }
+            case kind::GE:
+            {
+                check_arity(2);
+                return lyt.create_ge(fanins[0], fanins[1], t);
+            }
+            case kind::GT:
+            {
+                check_arity(2);
+                return lyt.create_gt(fanins[0], fanins[1], t);
+            }
+            case kind::LE:
+            {
+                check_arity(2);
+                return lyt.create_le(fanins[0], fanins[1], t);
+            }
+            case kind::XOR:
+            {
+                check_arity(2);
+                return lyt.create_xor(fanins[0], fanins[1], t);
+            }
+            case kind::XNOR:
+            {
+                check_arity(2);
+                return lyt.create_xnor(fanins[0], fanins[1], t);
+            }
+            case kind::MAJ:
+            {
+                check_arity(3);
+                return lyt.create_maj(fanins[0], fanins[1], fanins[2], t);
+            }
+            case kind::FUNCTION:
+            {
+                if (num_fanins > MAX_FUNCTION_ARITY)
+                {
+                    throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                        "Error parsing gate-level layout snapshot: tile {} has a function with too many variables ({})",
+                        t, static_cast<uint32_t>(num_fanins)));
+                }
+
+                kitty::dynamic_truth_table function{num_fanins};
+
+                std::for_each(function.begin(), function.end(),
+                              [this](auto& block) { block = read_value<uint64_t>(); });
+
+                return lyt.create_node(fanins, function, t);
+            }
+            default:
+            {
+                throw gate_level_layout_snapshot_parsing_error(fmt::format(
+                    "Error parsing gate-level layout snapshot: unknown tile kind {}", static_cast<uint32_t>(k)));
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Reads a gate-level layout from a snapshot that was written by `write_gate_level_layout_snapshot`. The snapshot is
+ * loaded in large blocks and its checksum is verified before the layout is constructed. Since all tiles are stored in
+ * topological order together with the indices of their fanins, no parsing or tile lookups are required.
+ *
+ * This overload uses an input stream to read from.
+ *
+ * @tparam Lyt Gate-level layout type to construct. Its topology has to match the one stored in the snapshot.
+ * @param is The input stream to read from. Should be opened in binary mode.
+ * @return The layout stored in the snapshot.
+ * @throws gate_level_layout_snapshot_parsing_error if the snapshot is malformed or corrupted or does not fit `Lyt`.
+ */
+template <typename Lyt>
+[[nodiscard]] Lyt read_gate_level_layout_snapshot(std::istream& is)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    detail::read_gate_level_layout_snapshot_impl<Lyt> p{is};
+
+    return p.run();
+}
+/**
+ * Reads a gate-level layout from a snapshot that was written by `write_gate_level_layout_snapshot`.
+ *
+ * This overload uses a file name to read from.
+ *
+ * @tparam Lyt Gate-level layout type to construct. Its topology has to match the one stored in the snapshot.
+ * @param filename The file name to read from.
+ * @return The layout stored in the snapshot.
+ * @throws std::ifstream::failure if the file could not be opened.
+ * @throws gate_level_layout_snapshot_parsing_error if the snapshot is malformed or corrupted or does not fit `Lyt`.
+ */
+template <typename Lyt>
+[[nodiscard]] Lyt read_gate_level_layout_snapshot(const std::string_view& filename)
+{
+    std::ifstream is{filename.data(), std::ifstream::in | std::ifstream::binary};
+
+    if (!is.is_open())
+    {
+        throw std::ifstream::failure("could not open file");
+    }
+
+    return read_gate_level_layout_snapshot<Lyt>(is);
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_READ_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
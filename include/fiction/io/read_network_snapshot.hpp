@@ -0,0 +1,431 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_READ_NETWORK_SNAPSHOT_HPP
+#define FICTION_READ_NETWORK_SNAPSHOT_HPP
+
+#include "fiction/io/write_network_snapshot.hpp"
+
+#include <fmt/format.h>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Exception thrown when an error occurs during parsing of a network snapshot file.
+ */
+class network_snapshot_parsing_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `network_snapshot_parsing_error` object with the given error message.
+     *
+     * @param msg The error message describing the parsing error.
+     */
+    explicit network_snapshot_parsing_error(const std::string_view& msg) noexcept : std::runtime_error(msg.data()) {}
+};
+
+namespace detail
+{
+
+/**
+ * Reads the object representation of a trivially copyable value from the given stream.
+ *
+ * @tparam T Value type.
+ * @param is Input stream.
+ * @return The value read.
+ * @throws network_snapshot_parsing_error if the stream ends prematurely.
+ */
+template <typename T>
+[[nodiscard]] T read_snapshot_value(std::istream& is)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    T value{};
+
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T)))  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    {
+        throw network_snapshot_parsing_error("Error parsing network snapshot: unexpected end of file");
+    }
+
+    return value;
+}
+/**
+ * Maximum number of characters of a string that are read at once. Reading in chunks ensures that a corrupted length
+ * cannot cause allocations beyond the actual length of the stream.
+ */
+inline constexpr std::size_t NETWORK_SNAPSHOT_STRING_CHUNK_SIZE = 1ul << 16ul;
+/**
+ * Reads a length-prefixed string from the given stream.
+ *
+ * @param is Input stream.
+ * @return The string read.
+ * @throws network_snapshot_parsing_error if the stream ends prematurely.
+ */
+[[nodiscard]] inline std::string read_snapshot_string(std::istream& is)
+{
+    const auto size = read_snapshot_value<uint32_t>(is);
+
+    std::string str{};
+
+    while (str.size() < size)
+    {
+        const auto num_read = str.size();
+        const auto chunk    = std::min(static_cast<std::size_t>(size) - num_read, NETWORK_SNAPSHOT_STRING_CHUNK_SIZE);
+
+        str.resize(num_read + chunk);
+
+        if (!is.read(str.data() + num_read, static_cast<std::streamsize>(chunk)))
+        {
+            throw network_snapshot_parsing_error("Error parsing network snapshot: unexpected end of file");
+        }
+    }
+
+    return str;
+}
+/**
+ * Determines the number of bytes between the current position of the given stream and its end.
+ *
+ * @param is Input stream.
+ * @return The number of remaining bytes or `std::nullopt` if `is` does not support seeking.
+ */
+[[nodiscard]] inline std::optional<uint64_t> remaining_snapshot_size(std::istream& is)
+{
+    const auto current = is.tellg();
+
+    if (current == std::istream::pos_type(-1))
+    {
+        is.clear();
+
+        return std::nullopt;
+    }
+
+    is.seekg(0, std::istream::end);
+    const auto end = is.tellg();
+
+    is.clear();
+    is.seekg(current);
+
+    if (end == std::istream::pos_type(-1) || end < current)
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<uint64_t>(end - current);
+}
+
+template <typename Ntk>
+class read_network_snapshot_impl
+{
+  public:
+    explicit read_network_snapshot_impl(std::istream& s) : is{s} {}
+
+    Ntk run()
+    {
+        std::array<char, NETWORK_SNAPSHOT_MAGIC.size()> magic{};
+
+        if (!is.read(magic.data(), magic.size()) || magic != NETWORK_SNAPSHOT_MAGIC)
+        {
+            throw network_snapshot_parsing_error("Error parsing network snapshot: invalid magic bytes");
+        }
+        if (const auto version = read_snapshot_value<uint16_t>(is); version != NETWORK_SNAPSHOT_VERSION)
+        {
+            throw network_snapshot_parsing_error(
+                fmt::format("Error parsing network snapshot: unsupported version {}", version));
+        }
+
+        static_cast<void>(read_snapshot_value<uint16_t>(is));  // reserved
+
+        if (read_snapshot_value<uint32_t>(is) != NETWORK_SNAPSHOT_BYTE_ORDER_MARK)
+        {
+            throw network_snapshot_parsing_error("Error parsing network snapshot: unsupported byte order");
+        }
+
+        const auto num_pis   = read_snapshot_value<uint32_t>(is);
+        const auto num_gates = read_snapshot_value<uint32_t>(is);
+        const auto num_pos   = read_snapshot_value<uint32_t>(is);
+
+        // each PI and PO stores at least the length of its name and each gate at least its kind and arity
+        const auto min_size = uint64_t{num_pis} * sizeof(uint32_t) + uint64_t{num_gates} * 2 * sizeof(uint8_t) +
+                              uint64_t{num_pos} * 2 * sizeof(uint32_t);
+
+        const auto remaining_size = remaining_snapshot_size(is);
+
+        if (remaining_size.has_value() && *remaining_size < min_size)
+        {
+            throw network_snapshot_parsing_error(
+                "Error parsing network snapshot: the number of nodes exceeds the size of the file");
+        }
+
+        [[maybe_unused]] const auto network_name = read_snapshot_string(is);
+
+        if constexpr (mockturtle::has_set_network_name_v<Ntk>)
+        {
+            ntk.set_network_name(network_name);
+        }
+
+        // only trust the number of nodes if it has been validated against the size of the file
+        if (remaining_size.has_value())
+        {
+            signals.reserve(static_cast<std::size_t>(uint64_t{num_pis} + uint64_t{num_gates} + 1));
+        }
+
+        signals.push_back(ntk.get_constant(false));
+
+        for (uint32_t i = 0; i < num_pis; ++i)
+        {
+            const auto pi = ntk.create_pi();
+
+            if constexpr (mockturtle::has_set_name_v<Ntk>)
+            {
+                if (const auto name = read_snapshot_string(is); !name.empty())
+                {
+                    ntk.set_name(pi, name);
+                }
+            }
+            else
+            {
+                static_cast<void>(read_snapshot_string(is));
+            }
+
+            signals.push_back(pi);
+        }
+
+        for (uint32_t i = 0; i < num_gates; ++i)
+        {
+            signals.push_back(read_gate());
+        }
+
+        for (uint32_t i = 0; i < num_pos; ++i)
+        {
+            ntk.create_po(signal_of(read_snapshot_value<uint32_t>(is)));
+
+            if constexpr (mockturtle::has_set_output_name_v<Ntk>)
+            {
+                if (const auto name = read_snapshot_string(is); !name.empty())
+                {
+                    ntk.set_output_name(i, name);
+                }
+            }
+            else
+            {
+                static_cast<void>(read_snapshot_string(is));
+            }
+        }
+
+        return ntk;
+    }
+
+  private:
+    /**
+     * Maximum arity of gate functions, which prevents a corrupted snapshot from requesting huge truth tables.
+     */
+    static constexpr const uint8_t MAX_FUNCTION_ARITY = 16u;
+    /**
+     * The input stream to read from.
+     */
+    std::istream& is;
+    /**
+     * The network to construct.
+     */
+    Ntk ntk{};
+    /**
+     * Non-complemented signal of each node in the snapshot, indexed by snapshot index.
+     */
+    std::vector<mockturtle::signal<Ntk>> signals{};
+
+    /**
+     * Determines the signal that corresponds to the given literal.
+     *
+     * @param lit Literal of a node that has already been read.
+     * @return Signal corresponding to `lit`.
+     * @throws network_snapshot_parsing_error if `lit` refers to a node that has not been read yet.
+     */
+    [[nodiscard]] mockturtle::signal<Ntk> signal_of(const uint32_t lit)
+    {
+        if (lit <= 1)
+        {
+            return ntk.get_constant(lit == 1);
+        }
+
+        const auto index = lit >> 1u;
+
+        if (index >= signals.size())
+        {
+            throw network_snapshot_parsing_error(
+                fmt::format("Error parsing network snapshot: literal {} refers to an unknown node", lit));
+        }
+
+        return (lit & 1u) != 0 ? ntk.create_not(signals[index]) : signals[index];
+    }
+    /**
+     * Reads a gate and constructs it in the network.
+     *
+     * @return Signal pointing to the constructed gate.
+     * @throws network_snapshot_parsing_error if the gate is malformed or cannot be constructed in `Ntk`.
+     */
+    [[nodiscard]] mockturtle::signal<Ntk> read_gate()
+    {
+        const auto kind        = static_cast<network_snapshot_gate_kind>(read_snapshot_value<uint8_t>(is));
+        const auto num_fanins  = read_snapshot_value<uint8_t>(is);
+        const auto check_arity = [num_fanins](const uint8_t arity)
+        {
+            if (num_fanins != arity)
+            {
+                throw network_snapshot_parsing_error(
+                    fmt::format("Error parsing network snapshot: gate with an invalid number of fanins ({})",
+                                static_cast<uint32_t>(num_fanins)));
+            }
+        };
+
+        std::vector<mockturtle::signal<Ntk>> children{};
+        children.reserve(num_fanins);
+
+        for (uint8_t i = 0; i < num_fanins; ++i)
+        {
+            children.push_back(signal_of(read_snapshot_value<uint32_t>(is)));
+        }
+
+        switch (kind)
+        {
+            case network_snapshot_gate_kind::AND:
+            {
+                check_arity(2);
+                return ntk.create_and(children[0], children[1]);
+            }
+            case network_snapshot_gate_kind::OR:
+            {
+                check_arity(2);
+                return ntk.create_or(children[0], children[1]);
+            }
+            case network_snapshot_gate_kind::XOR:
+            {
+                check_arity(2);
+                return ntk.create_xor(children[0], children[1]);
+            }
+            case network_snapshot_gate_kind::MAJ:
+            {
+                check_arity(3);
+                return ntk.create_maj(children[0], children[1], children[2]);
+            }
+            case network_snapshot_gate_kind::BUF:
+            {
+                check_arity(1);
+
+                if constexpr (mockturtle::has_create_buf_v<Ntk>)
+                {
+                    return ntk.create_buf(children[0]);
+                }
+                else
+                {
+                    return children[0];
+                }
+            }
+            case network_snapshot_gate_kind::FUNCTION:
+            {
+                if (num_fanins > MAX_FUNCTION_ARITY)
+                {
+                    throw network_snapshot_parsing_error(
+                        fmt::format("Error parsing network snapshot: gate function with too many variables ({})",
+                                    static_cast<uint32_t>(num_fanins)));
+                }
+
+                kitty::dynamic_truth_table function{num_fanins};
+
+                std::for_each(function.begin(), function.end(),
+                              [this](auto& block) { block = read_snapshot_value<uint64_t>(is); });
+
+                if constexpr (mockturtle::has_create_node_v<Ntk>)
+                {
+                    return ntk.create_node(children, function);
+                }
+                else
+                {
+                    throw network_snapshot_parsing_error(
+                        "Error parsing network snapshot: the network type does not support arbitrary gate functions");
+                }
+            }
+            default:
+            {
+                throw network_snapshot_parsing_error(fmt::format(
+                    "Error parsing network snapshot: unknown gate kind {}", static_cast<uint32_t>(kind)));
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Reads a combinational logic network from a snapshot that was written by `write_network_snapshot`. Since the snapshot
+ * stores the gates in topological order, no parsing or name resolution is required.
+ *
+ * This overload uses an input stream to read from.
+ *
+ * @tparam Ntk Logic network type to construct.
+ * @param is The input stream to read from. Should be opened in binary mode.
+ * @return The network stored in the snapshot.
+ * @throws network_snapshot_parsing_error if the snapshot is malformed or contains gates that cannot be constructed in
+ * `Ntk`.
+ */
+template <typename Ntk>
+[[nodiscard]] Ntk read_network_snapshot(std::istream& is)
+{
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+    static_assert(mockturtle::has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function");
+    static_assert(mockturtle::has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function");
+    static_assert(mockturtle::has_create_po_v<Ntk>, "Ntk does not implement the create_po function");
+    static_assert(mockturtle::has_create_not_v<Ntk>, "Ntk does not implement the create_not function");
+    static_assert(mockturtle::has_create_and_v<Ntk>, "Ntk does not implement the create_and function");
+    static_assert(mockturtle::has_create_or_v<Ntk>, "Ntk does not implement the create_or function");
+    static_assert(mockturtle::has_create_xor_v<Ntk>, "Ntk does not implement the create_xor function");
+    static_assert(mockturtle::has_create_maj_v<Ntk>, "Ntk does not implement the create_maj function");
+
+    detail::read_network_snapshot_impl<Ntk> p{is};
+
+    return p.run();
+}
+/**
+ * Reads a combinational logic network from a snapshot that was written by `write_network_snapshot`.
+ *
+ * This overload uses a file name to read from.
+ *
+ * @tparam Ntk Logic network type to construct.
+ * @param filename The file name to read from.
+ * @return The network stored in the snapshot.
+ * @throws std::ifstream::failure if the file could not be opened.
+ * @throws network_snapshot_parsing_error if the snapshot is malformed or contains gates that cannot be constructed in
+ * `Ntk`.
+ */
+template <typename Ntk>
+[[nodiscard]] Ntk read_network_snapshot(const std::string_view& filename)
+{
+    std::ifstream is{filename.data(), std::ifstream::in | std::ifstream::binary};
+
+    if (!is.is_open())
+    {
+        throw std::ifstream::failure("could not open file");
+    }
+
+    return read_network_snapshot<Ntk>(is);
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_READ_NETWORK_SNAPSHOT_HPP
@@ -0,0 +1,412 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_STREAM_CELL_LEVEL_LAYOUT_HPP
+#define FICTION_STREAM_CELL_LEVEL_LAYOUT_HPP
+
+#include "fiction/algorithms/physical_design/apply_gate_library.hpp"
+#include "fiction/io/write_qca_layout.hpp"
+#include "fiction/io/write_sqd_layout.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/traits.hpp"
+
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+namespace detail
+{
+
+/**
+ * Checks whether the tile rows of gate-level layouts of type `GateLyt` align with the cell rows of the corresponding
+ * cell-level layouts, i.e., whether tile row `y` spans exactly the cell rows `y * h` to `(y + 1) * h - 1` for tiles of
+ * height `h`.
+ *
+ * @tparam GateLyt Gate-level layout type.
+ * @return `true` iff tile rows and cell rows align.
+ */
+template <typename GateLyt>
+[[nodiscard]] constexpr bool has_aligned_tile_rows() noexcept
+{
+    if constexpr (is_cartesian_layout_v<GateLyt>)
+    {
+        return true;
+    }
+    else if constexpr (is_shifted_cartesian_layout_v<GateLyt>)
+    {
+        return has_horizontally_shifted_cartesian_orientation_v<GateLyt>;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename CellLyt, typename GateLibrary, typename GateLyt>
+class stream_cell_level_layout_impl
+{
+  public:
+    explicit stream_cell_level_layout_impl(const GateLyt& lyt) :
+            generator{lyt},
+            out{apply_gate_library_impl<CellLyt, GateLibrary, GateLyt>::create_cell_layout(lyt)}
+    {
+        // if available, recover layout name
+        if constexpr (has_get_layout_name_v<GateLyt> && has_set_layout_name_v<CellLyt>)
+        {
+            out.set_layout_name(lyt.get_layout_name());
+        }
+    }
+
+    void write_sqd(std::ostream& os)
+    {
+        write_sqd_layout_impl<CellLyt> writer{out, os};
+
+        writer.write_prologue();
+
+        foreach_tile_row(
+            [this, &writer](const uint64_t)
+            {
+                out.foreach_cell([&writer](const auto& c) { writer.write_db_block(c); });
+
+                clear_cells([](const auto&) { return false; });
+            });
+
+        writer.write_epilogue();
+    }
+
+    void write_qca(std::ostream& os, const write_qca_layout_params& ps)
+    {
+        write_qca_layout_impl<CellLyt> writer{out, os, ps};
+
+        writer.write_header();
+        writer.open_layer(0);
+
+        // the gate implementations are set up only once; cells of the crossing layers are set aside until their layer
+        std::vector<std::vector<buffered_cell>> crossing_layers(static_cast<std::size_t>(out.z()));
+
+        foreach_tile_row(
+            [this, &writer, &crossing_layers](const uint64_t y)
+            {
+                const auto first_row = y * GateLibrary::gate_y_size();
+                const auto last_row =
+                    std::min(first_row + GateLibrary::gate_y_size() - 1, static_cast<uint64_t>(out.y()));
+
+                for (auto r = first_row; r <= last_row; ++r)
+                {
+                    writer.write_row(static_cast<decltype(out.y())>(r), 0);
+                }
+
+                out.foreach_cell(
+                    [this, &crossing_layers](const auto& c)
+                    {
+                        if (c.z > 0)
+                        {
+                            crossing_layers[static_cast<std::size_t>(c.z) - 1].push_back(
+                                {c, out.get_cell_type(c), out.get_cell_mode(c), out.get_cell_name(c)});
+                        }
+                    });
+
+                // via cells have to be kept until the next layer is opened
+                clear_cells([this](const auto& c)
+                            { return c.z == 0 && qca_technology::is_vertical_cell_mode(out.get_cell_mode(c)); });
+            });
+
+        writer.close_layer();
+
+        for (decltype(out.z()) z = 1; z <= out.z(); ++z)
+        {
+            writer.open_layer(z);
+
+            // the via cells of the previous layer have been written
+            clear_cells([](const auto&) { return false; });
+
+            for (const auto& bc : crossing_layers[static_cast<std::size_t>(z) - 1])
+            {
+                out.assign_cell_type(bc.c, bc.type);
+                out.assign_cell_mode(bc.c, bc.mode);
+                out.assign_cell_name(bc.c, bc.name);
+            }
+
+            crossing_layers[static_cast<std::size_t>(z) - 1].clear();
+
+            for (decltype(out.y()) r = 0; r <= out.y(); ++r)
+            {
+                writer.write_row(r, z);
+            }
+
+            // via cells have to be kept until the next layer is opened
+            clear_cells([this](const auto& c) { return qca_technology::is_vertical_cell_mode(out.get_cell_mode(c)); });
+
+            writer.close_layer();
+        }
+
+        writer.write_footer();
+    }
+
+  private:
+    /**
+     * Generator of the gate implementations.
+     */
+    apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> generator;
+    /**
+     * Cell-level layout that holds the cells of the current tile row which are passed to the writers.
+     */
+    CellLyt out;
+    /**
+     * Cell of a crossing layer that is set aside until its layer is written.
+     */
+    struct buffered_cell
+    {
+        /**
+         * Cell position.
+         */
+        cell<CellLyt> c;
+        /**
+         * Cell type.
+         */
+        typename technology<CellLyt>::cell_type type;
+        /**
+         * Cell mode.
+         */
+        typename technology<CellLyt>::cell_mode mode;
+        /**
+         * Cell name.
+         */
+        std::string name;
+    };
+    /**
+     * Number of adjacent tile rows that are required to apply the gate library's post-layout optimization.
+     */
+    static constexpr const uint64_t CONTEXT_ROWS = has_post_layout_optimization_v<GateLibrary, CellLyt> ? 1ul : 0ul;
+    /**
+     * Sets up the gate implementations tile row by tile row and copies the cells of each tile row to `out` before
+     * `fn` is invoked with the index of the tile row.
+     *
+     * @tparam Fn Functor type that can be invoked as `fn(uint64_t)`.
+     * @param fn Functor to invoke for each tile row.
+     */
+    template <typename Fn>
+    void foreach_tile_row(Fn&& fn)
+    {
+        generator.foreach_tile_row(
+            CONTEXT_ROWS,
+            [this, &fn](const CellLyt& window, const uint64_t y)
+            {
+                window.foreach_cell(
+                    [this, &window, y](const auto& c)
+                    {
+                        if (is_in_tile_row(c, y))
+                        {
+                            out.assign_cell_type(c, window.get_cell_type(c));
+                            out.assign_cell_mode(c, window.get_cell_mode(c));
+                            out.assign_cell_name(c, window.get_cell_name(c));
+                        }
+                    });
+
+                std::invoke(fn, y);
+            });
+    }
+    /**
+     * Checks whether cell `c` belongs to tile row `y`. Without context rows, all cells belong to the current tile row.
+     *
+     * @param c Cell to check.
+     * @param y Tile row.
+     * @return `true` iff `c` was generated by a gate in tile row `y`.
+     */
+    [[nodiscard]] static bool is_in_tile_row(const cell<CellLyt>& c, const uint64_t y) noexcept
+    {
+        if constexpr (CONTEXT_ROWS == 0)
+        {
+            return true;
+        }
+        else
+        {
+            return static_cast<uint64_t>(c.y) / GateLibrary::gate_y_size() == y;
+        }
+    }
+    /**
+     * Removes all cells from `out` that are not to be kept.
+     *
+     * @tparam Pred Predicate type.
+     * @param keep Predicate that returns `true` for cells that are to be kept.
+     */
+    template <typename Pred>
+    void clear_cells(Pred&& keep)
+    {
+        std::vector<cell<CellLyt>> cells{};
+        cells.reserve(out.num_cells());
+
+        out.foreach_cell(
+            [&cells, &keep](const auto& c)
+            {
+                if (!keep(c))
+                {
+                    cells.push_back(c);
+                }
+            });
+
+        for (const auto& c : cells)
+        {
+            out.assign_cell_type(c, technology<CellLyt>::cell_type::EMPTY);
+            out.assign_cell_name(c, "");
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Applies a static gate library to a gate-level layout and writes the resulting cell-level layout to an sqd file that
+ * is used by SiQAD (https://github.com/siqad/siqad) without ever holding the entire cell-level layout in memory. The
+ * gate implementations are set up tile row by tile row and their cells are written to the output stream right away.
+ * Thereby, only the cells of a single tile row (or three if the gate library defines a post-layout optimization) are
+ * held in memory at any time.
+ *
+ * The written cells are identical to those written by `write_sqd_layout` when applied to the layout returned by
+ * `apply_gate_library`. Only their order may differ.
+ *
+ * May pass through, and thereby throw, an `unsupported_gate_type_exception` or an
+ * `unsupported_gate_orientation_exception`. In this case, the output stream contains an incomplete file.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @tparam CellLyt Cell-level SiDB or QCA layout type that would be returned by `apply_gate_library`.
+ * @tparam GateLibrary Type of the gate library to apply.
+ * @tparam GateLyt Type of the gate-level layout to apply the library to.
+ * @param lyt The gate-level layout.
+ * @param os The output stream to write into.
+ */
+template <typename CellLyt, typename GateLibrary, typename GateLyt>
+void stream_sqd_layout(const GateLyt& lyt, std::ostream& os)
+{
+    static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
+    static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
+    static_assert(!is_sidb_defect_surface_v<CellLyt>, "CellLyt cannot be an SiDB defect surface");
+    static_assert(is_gate_level_layout_v<GateLyt>, "GateLyt is not a gate-level layout");
+    static_assert(mockturtle::has_is_constant_v<GateLyt>, "GateLyt does not implement the is_constant function");
+    static_assert(mockturtle::has_foreach_node_v<GateLyt>, "GateLyt does not implement the foreach_node function");
+
+    static_assert(std::is_same_v<technology<CellLyt>, technology<GateLibrary>>,
+                  "CellLyt and GateLibrary must implement the same technology");
+    static_assert(has_qca_technology_v<CellLyt> || has_sidb_technology_v<CellLyt>,
+                  "CellLyt must be a QCA or SiDB layout");
+    // post-layout optimizations are applied to adjacent tile rows, which requires tile rows to align with cell rows
+    static_assert(!has_post_layout_optimization_v<GateLibrary, CellLyt> || detail::has_aligned_tile_rows<GateLyt>(),
+                  "GateLibrary's post-layout optimization requires the tile rows of GateLyt to align with cell rows");
+
+    detail::stream_cell_level_layout_impl<CellLyt, GateLibrary, GateLyt> p{lyt};
+
+    p.write_sqd(os);
+}
+/**
+ * Applies a static gate library to a gate-level layout and writes the resulting cell-level layout to an sqd file that
+ * is used by SiQAD (https://github.com/siqad/siqad) without ever holding the entire cell-level layout in memory.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam CellLyt Cell-level SiDB or QCA layout type that would be returned by `apply_gate_library`.
+ * @tparam GateLibrary Type of the gate library to apply.
+ * @tparam GateLyt Type of the gate-level layout to apply the library to.
+ * @param lyt The gate-level layout.
+ * @param filename The file name to create and write into. Should preferably use the `.sqd` extension.
+ */
+template <typename CellLyt, typename GateLibrary, typename GateLyt>
+void stream_sqd_layout(const GateLyt& lyt, const std::string_view& filename)
+{
+    std::ofstream os{std::string{filename}, std::ofstream::out};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    stream_sqd_layout<CellLyt, GateLibrary>(lyt, os);
+    os.close();
+}
+/**
+ * Applies a static gate library to a gate-level layout and writes the resulting cell-level layout to a qca file that is
+ * used by QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/) without ever holding the entire cell-level layout in
+ * memory. The gate implementations are set up tile row by tile row and the cells of the ground layer are written to the
+ * output stream right away. Since QCADesigner files list the cells layer by layer, the usually sparse cells of the
+ * crossing layers are set aside and written afterward. Thereby, only the cells of up to three tile rows, the crossing
+ * layers, and the pending via cells are held in memory at any time.
+ *
+ * The written file is identical to the one written by `write_qca_layout` when applied to the layout returned by
+ * `apply_gate_library`.
+ *
+ * May pass through, and thereby throw, an `unsupported_gate_type_exception` or an
+ * `unsupported_gate_orientation_exception`. In this case, the output stream contains an incomplete file.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @tparam CellLyt Cell-level QCA layout type that would be returned by `apply_gate_library`.
+ * @tparam GateLibrary Type of the gate library to apply.
+ * @tparam GateLyt Type of the gate-level layout to apply the library to.
+ * @param lyt The gate-level layout.
+ * @param os The output stream to write into.
+ * @param ps Parameters.
+ */
+template <typename CellLyt, typename GateLibrary, typename GateLyt>
+void stream_qca_layout(const GateLyt& lyt, std::ostream& os, write_qca_layout_params ps = {})
+{
+    static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
+    static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
+    static_assert(!is_sidb_defect_surface_v<CellLyt>, "CellLyt cannot be an SiDB defect surface");
+    static_assert(is_gate_level_layout_v<GateLyt>, "GateLyt is not a gate-level layout");
+    static_assert(mockturtle::has_is_constant_v<GateLyt>, "GateLyt does not implement the is_constant function");
+    static_assert(mockturtle::has_foreach_node_v<GateLyt>, "GateLyt does not implement the foreach_node function");
+
+    static_assert(std::is_same_v<technology<CellLyt>, technology<GateLibrary>>,
+                  "CellLyt and GateLibrary must implement the same technology");
+    static_assert(has_qca_technology_v<CellLyt>, "CellLyt must be a QCA layout");
+    // cells are written row by row, which requires tile rows to align with cell rows
+    static_assert(detail::has_aligned_tile_rows<GateLyt>(), "The tile rows of GateLyt must align with cell rows");
+
+    detail::stream_cell_level_layout_impl<CellLyt, GateLibrary, GateLyt> p{lyt};
+
+    p.write_qca(os, ps);
+}
+/**
+ * Applies a static gate library to a gate-level layout and writes the resulting cell-level layout to a qca file that is
+ * used by QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/) without ever holding the entire cell-level layout in
+ * memory.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam CellLyt Cell-level QCA layout type that would be returned by `apply_gate_library`.
+ * @tparam GateLibrary Type of the gate library to apply.
+ * @tparam GateLyt Type of the gate-level layout to apply the library to.
+ * @param lyt The gate-level layout.
+ * @param filename The file name to create and write into. Should preferably use the `.qca` extension.
+ * @param ps Parameters.
+ */
+template <typename CellLyt, typename GateLibrary, typename GateLyt>
+void stream_qca_layout(const GateLyt& lyt, const std::string_view& filename, write_qca_layout_params ps = {})
+{
+    std::ofstream os{std::string{filename}, std::ofstream::out};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    stream_qca_layout<CellLyt, GateLibrary>(lyt, os, ps);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_STREAM_CELL_LEVEL_LAYOUT_HPP
@@ -0,0 +1,342 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
+#define FICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
+
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain_types.hpp"
+#include "fiction/technology/constants.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Kind of domain stored in a binary operational domain file.
+ */
+enum class binary_operational_domain_kind : uint8_t
+{
+    /**
+     * An `operational_domain`, i.e., an operational status per sample.
+     */
+    OPERATIONAL_DOMAIN,
+    /**
+     * A `critical_temperature_domain`, i.e., an operational status and a critical temperature per sample.
+     */
+    CRITICAL_TEMPERATURE_DOMAIN
+};
+
+namespace detail
+{
+
+/**
+ * Magic bytes at the beginning of every binary operational domain file.
+ */
+inline constexpr std::array<char, 8> BINARY_OPDOM_MAGIC{{'F', 'C', 'N', 'O', 'P', 'D', 'O', 'M'}};
+/**
+ * Version of the binary operational domain format. Bump whenever the layout of the file changes.
+ */
+inline constexpr uint16_t BINARY_OPDOM_VERSION = 1;
+/**
+ * Written in native byte order to detect files that were created on a machine with a different endianness.
+ */
+inline constexpr uint32_t BINARY_OPDOM_BYTE_ORDER_MARK = 0x01020304;
+/**
+ * Size of the file header in bytes.
+ */
+inline constexpr std::size_t BINARY_OPDOM_HEADER_SIZE = 32;
+/**
+ * Size of a dimension descriptor in bytes.
+ */
+inline constexpr std::size_t BINARY_OPDOM_DIMENSION_SIZE = 32;
+/**
+ * Alignment of all sections in the file in bytes.
+ */
+inline constexpr std::size_t BINARY_OPDOM_ALIGNMENT = 8;
+/**
+ * Returns the number of padding bytes that are needed to align a section of the given size.
+ *
+ * @param size Size of the section in bytes.
+ * @return Number of padding bytes.
+ */
+[[nodiscard]] constexpr std::size_t binary_opdom_padding(const std::size_t size) noexcept
+{
+    return (BINARY_OPDOM_ALIGNMENT - size % BINARY_OPDOM_ALIGNMENT) % BINARY_OPDOM_ALIGNMENT;
+}
+/**
+ * Writes the object representation of a trivially copyable value to the given stream.
+ *
+ * @tparam T Value type.
+ * @param os Output stream.
+ * @param value Value to write.
+ */
+template <typename T>
+void write_binary_value(std::ostream& os, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+/**
+ * Writes a column, followed by padding bytes that align the subsequent section.
+ *
+ * @tparam T Element type of the column.
+ * @param os Output stream.
+ * @param column Column to write.
+ */
+template <typename T>
+void write_binary_column(std::ostream& os, const std::vector<T>& column)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    const auto num_bytes = column.size() * sizeof(T);
+
+    os.write(reinterpret_cast<const char*>(column.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+             static_cast<std::streamsize>(num_bytes));
+
+    static constexpr std::array<char, BINARY_OPDOM_ALIGNMENT> zeros{};
+    os.write(zeros.data(), static_cast<std::streamsize>(binary_opdom_padding(num_bytes)));
+}
+/**
+ * Determines the index of a parameter value on the step grid of a dimension sweep.
+ *
+ * @param values Parameter values of the dimension sweep in ascending order as returned by `sweep_dimension_values`.
+ * @param value Parameter value to locate.
+ * @return Index of `value` in `values`.
+ * @throws std::invalid_argument if `value` is not part of the step grid.
+ */
+[[nodiscard]] inline uint32_t sweep_grid_index(const std::vector<double>& values, const double value)
+{
+    const auto it = std::lower_bound(values.cbegin(), values.cend(), value - constants::ERROR_MARGIN);
+
+    if (it == values.cend() || std::fabs(*it - value) >= constants::ERROR_MARGIN)
+    {
+        throw std::invalid_argument(fmt::format("parameter value {} does not lie on the sweep's step grid", value));
+    }
+
+    return static_cast<uint32_t>(std::distance(values.cbegin(), it));
+}
+
+}  // namespace detail
+
+/**
+ * Writes an operational domain or a critical temperature domain to the specified output stream in a compact binary
+ * columnar format. In contrast to `write_operational_domain`, which formats each value as text, this format stores
+ * samples as step indices on the sweep grid and can be memory-mapped, e.g., via `numpy.memmap`, without any parsing.
+ * Binary files can be read back via `read_binary_operational_domain`, which enables resuming and merging partial
+ * sweeps.
+ *
+ * All values are stored in native byte order and every section starts at an offset that is a multiple of 8 bytes. The
+ * file consists of the following sections:
+ *
+ * - Header (32 bytes): 8 magic bytes `FCNOPDOM`, the byte order mark `0x01020304` (`uint32`), the format version
+ *   (`uint16`), the domain kind (`uint8`, see `binary_operational_domain_kind`), the number of dimensions \f$d\f$
+ *   (`uint8`), the number of samples \f$n\f$ (`uint64`), and 8 reserved bytes.
+ * - \f$d\f$ dimension descriptors (32 bytes each): the sweep parameter (`uint8`), 7 reserved bytes, and the minimum,
+ *   maximum, and step size of the sweep (`double` each).
+ * - \f$d\f$ index columns of \f$n\f$ `uint32` values each. The value of a sample in dimension \f$i\f$ is given by
+ *   \f$min_i + index \cdot step_i\f$.
+ * - A status column of \f$n\f$ `uint8` values, where 0 denotes an operational sample and 1 a non-operational one.
+ * - For critical temperature domains only, a temperature column of \f$n\f$ `double` values.
+ *
+ * Samples are sorted lexicographically by their step indices.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param opdom The domain to be written.
+ * @param sweep_dimensions The sweep dimensions that were used to compute `opdom`. They have to match the dimensions of
+ * `opdom` in number and order and define the step grid that all samples lie on.
+ * @param os The output stream where the binary representation of the domain is written to. It should be opened in
+ * binary mode.
+ * @throws std::invalid_argument if the sweep dimensions do not match the domain's dimensions or if a sample does not
+ * lie on the step grid.
+ */
+template <typename OpDomain>
+void write_binary_operational_domain(const OpDomain&                                    opdom,
+                                     const std::vector<operational_domain_value_range>& sweep_dimensions,
+                                     std::ostream&                                      os)
+{
+    static_assert(std::is_same_v<OpDomain, operational_domain> || std::is_same_v<OpDomain, critical_temperature_domain>,
+                  "OpDomain must be an operational_domain or a critical_temperature_domain");
+
+    static constexpr const bool has_temperature = std::is_same_v<OpDomain, critical_temperature_domain>;
+
+    const auto num_dimensions = opdom.get_number_of_dimensions();
+
+    if (num_dimensions == 0 || num_dimensions > std::numeric_limits<uint8_t>::max())
+    {
+        throw std::invalid_argument("unsupported number of dimensions in the given operational domain");
+    }
+
+    if (sweep_dimensions.size() != num_dimensions)
+    {
+        throw std::invalid_argument("the number of sweep dimensions does not match the operational domain");
+    }
+
+    std::vector<std::vector<double>> grid_values{};
+    grid_values.reserve(num_dimensions);
+
+    for (std::size_t d = 0; d < num_dimensions; ++d)
+    {
+        if (sweep_dimensions[d].dimension != opdom.get_dimension(d))
+        {
+            throw std::invalid_argument(
+                fmt::format("sweep dimension {} does not match the operational domain's dimension", d));
+        }
+
+        if (!(sweep_dimensions[d].step > 0.0))
+        {
+            throw std::invalid_argument(fmt::format("sweep dimension {} has a non-positive step size", d));
+        }
+
+        grid_values.push_back(sweep_dimension_values(sweep_dimensions[d]));
+    }
+
+    // gather all samples as rows of step indices
+    std::vector<uint32_t> indices{};
+    std::vector<uint8_t>  statuses{};
+    std::vector<double>   temperatures{};
+
+    indices.reserve(opdom.size() * num_dimensions);
+    statuses.reserve(opdom.size());
+
+    if constexpr (has_temperature)
+    {
+        temperatures.reserve(opdom.size());
+    }
+
+    opdom.for_each(
+        [&](const auto& pp, const auto& op_val)
+        {
+            const auto& parameters = pp.get_parameters();
+
+            if (parameters.size() != num_dimensions)
+            {
+                throw std::invalid_argument("parameter point dimension does not match the operational domain");
+            }
+
+            for (std::size_t d = 0; d < num_dimensions; ++d)
+            {
+                indices.push_back(detail::sweep_grid_index(grid_values[d], parameters[d]));
+            }
+
+            statuses.push_back(static_cast<uint8_t>(std::get<0>(op_val)));
+
+            if constexpr (has_temperature)
+            {
+                temperatures.push_back(std::get<1>(op_val));
+            }
+        });
+
+    const auto num_samples = statuses.size();
+
+    // sort the samples lexicographically by their step indices for deterministic output and locality
+    std::vector<std::size_t> order(num_samples);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+
+    std::sort(order.begin(), order.end(),
+              [&indices, num_dimensions](const auto a, const auto b)
+              {
+                  const auto width = static_cast<std::ptrdiff_t>(num_dimensions);
+                  const auto row_a = std::next(indices.cbegin(), static_cast<std::ptrdiff_t>(a) * width);
+                  const auto row_b = std::next(indices.cbegin(), static_cast<std::ptrdiff_t>(b) * width);
+
+                  return std::lexicographical_compare(row_a, std::next(row_a, width), row_b, std::next(row_b, width));
+              });
+
+    // header
+    detail::write_binary_value(os, detail::BINARY_OPDOM_MAGIC);
+    detail::write_binary_value(os, detail::BINARY_OPDOM_BYTE_ORDER_MARK);
+    detail::write_binary_value(os, detail::BINARY_OPDOM_VERSION);
+    detail::write_binary_value(os, has_temperature ? binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN :
+                                                     binary_operational_domain_kind::OPERATIONAL_DOMAIN);
+    detail::write_binary_value(os, static_cast<uint8_t>(num_dimensions));
+    detail::write_binary_value(os, static_cast<uint64_t>(num_samples));
+    detail::write_binary_value(os, uint64_t{0});
+
+    // dimension descriptors
+    for (const auto& range : sweep_dimensions)
+    {
+        detail::write_binary_value(os, range.dimension);
+        detail::write_binary_value(os, std::array<uint8_t, 7>{});
+        detail::write_binary_value(os, range.min);
+        detail::write_binary_value(os, range.max);
+        detail::write_binary_value(os, range.step);
+    }
+
+    // columns
+    std::vector<uint32_t> index_column(num_samples);
+
+    for (std::size_t d = 0; d < num_dimensions; ++d)
+    {
+        std::transform(order.cbegin(), order.cend(), index_column.begin(),
+                       [&indices, num_dimensions, d](const auto i) { return indices[i * num_dimensions + d]; });
+
+        detail::write_binary_column(os, index_column);
+    }
+
+    std::vector<uint8_t> status_column(num_samples);
+    std::transform(order.cbegin(), order.cend(), status_column.begin(),
+                   [&statuses](const auto i) { return statuses[i]; });
+
+    detail::write_binary_column(os, status_column);
+
+    if constexpr (has_temperature)
+    {
+        std::vector<double> temperature_column(num_samples);
+        std::transform(order.cbegin(), order.cend(), temperature_column.begin(),
+                       [&temperatures](const auto i) { return temperatures[i]; });
+
+        detail::write_binary_column(os, temperature_column);
+    }
+}
+/**
+ * Writes an operational domain or a critical temperature domain to the specified file in a compact binary columnar
+ * format. See the stream overload for a description of the format.
+ *
+ * @tparam OpDomain The type of the domain, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param opdom The domain to be written.
+ * @param sweep_dimensions The sweep dimensions that were used to compute `opdom`. They have to match the dimensions of
+ * `opdom` in number and order and define the step grid that all samples lie on.
+ * @param filename The filename where the binary representation of the domain is written to.
+ * @throws std::ofstream::failure if the file could not be opened.
+ * @throws std::invalid_argument if the sweep dimensions do not match the domain's dimensions or if a sample does not
+ * lie on the step grid.
+ */
+template <typename OpDomain>
+void write_binary_operational_domain(const OpDomain&                                    opdom,
+                                     const std::vector<operational_domain_value_range>& sweep_dimensions,
+                                     const std::string_view&                            filename)
+{
+    std::ofstream os{filename.data(), std::ofstream::out | std::ofstream::binary};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_binary_operational_domain(opdom, sweep_dimensions, os);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WRITE_BINARY_OPERATIONAL_DOMAIN_HPP
@@ -0,0 +1,537 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_WRITE_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
+#define FICTION_WRITE_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
+
+#include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
+#include "fiction/utils/name_utils.hpp"
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Magic bytes that identify a gate-level layout snapshot file.
+ */
+inline constexpr std::array<char, 8> GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC{{'F', 'C', 'N', 'G', 'L', 'Y', 'T', 'S'}};
+/**
+ * Version of the gate-level layout snapshot format.
+ */
+inline constexpr uint16_t GATE_LEVEL_LAYOUT_SNAPSHOT_VERSION = 1;
+/**
+ * Value written in the native byte order to detect files that were written on a machine of different endianness.
+ */
+inline constexpr uint32_t GATE_LEVEL_LAYOUT_SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+/**
+ * Size of the fixed header of a gate-level layout snapshot in bytes, i.e., the magic bytes, the version, a reserved
+ * field, the byte order mark, the payload size, and the payload checksum.
+ */
+inline constexpr std::size_t GATE_LEVEL_LAYOUT_SNAPSHOT_HEADER_SIZE = 8 + 2 + 2 + 4 + 8 + 8;
+/**
+ * Kinds of tiles stored in a gate-level layout snapshot. They correspond to the node types distinguished by
+ * `gate_level_layout`.
+ */
+enum class gate_level_layout_snapshot_gate_kind : uint8_t
+{
+    /**
+     * Primary input.
+     */
+    PI = 0,
+    /**
+     * Primary output.
+     */
+    PO = 1,
+    /**
+     * Wire segment or fan-out.
+     */
+    BUF = 2,
+    /**
+     * Inverter.
+     */
+    INV = 3,
+    /**
+     * 2-input AND gate.
+     */
+    AND = 4,
+    /**
+     * 2-input NAND gate.
+     */
+    NAND = 5,
+    /**
+     * 2-input OR gate.
+     */
+    OR = 6,
+    /**
+     * 2-input NOR gate.
+     */
+    NOR = 7,
+    /**
+     * 2-input less-than gate.
+     */
+    LT = 8,
+    /**
+     * 2-input greater-or-equal gate.
+     */
+    GE = 9,
+    /**
+     * 2-input greater-than gate.
+     */
+    GT = 10,
+    /**
+     * 2-input less-or-equal gate.
+     */
+    LE = 11,
+    /**
+     * 2-input XOR gate.
+     */
+    XOR = 12,
+    /**
+     * 2-input XNOR gate.
+     */
+    XNOR = 13,
+    /**
+     * 3-input majority gate.
+     */
+    MAJ = 14,
+    /**
+     * Gate whose function is stored as a truth table over its fanins.
+     */
+    FUNCTION = 15
+};
+
+namespace detail
+{
+
+/**
+ * Returns the topology name of the given layout type as it is used in FGL files.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @return Topology name of `Lyt` or an empty string if `Lyt` has an unknown topology.
+ */
+template <typename Lyt>
+[[nodiscard]] constexpr std::string_view layout_topology_name() noexcept
+{
+    if constexpr (is_cartesian_layout_v<Lyt>)
+    {
+        return "cartesian";
+    }
+    else if constexpr (is_shifted_cartesian_layout_v<Lyt>)
+    {
+        if constexpr (has_odd_row_cartesian_arrangement_v<Lyt>)
+        {
+            return "odd_row_cartesian";
+        }
+        else if constexpr (has_even_row_cartesian_arrangement_v<Lyt>)
+        {
+            return "even_row_cartesian";
+        }
+        else if constexpr (has_odd_column_cartesian_arrangement_v<Lyt>)
+        {
+            return "odd_column_cartesian";
+        }
+        else if constexpr (has_even_column_cartesian_arrangement_v<Lyt>)
+        {
+            return "even_column_cartesian";
+        }
+    }
+    else if constexpr (is_hexagonal_layout_v<Lyt>)
+    {
+        if constexpr (has_odd_row_hex_arrangement_v<Lyt>)
+        {
+            return "odd_row_hex";
+        }
+        else if constexpr (has_even_row_hex_arrangement_v<Lyt>)
+        {
+            return "even_row_hex";
+        }
+        else if constexpr (has_odd_column_hex_arrangement_v<Lyt>)
+        {
+            return "odd_column_hex";
+        }
+        else if constexpr (has_even_column_hex_arrangement_v<Lyt>)
+        {
+            return "even_column_hex";
+        }
+    }
+
+    return "";
+}
+
+template <typename Lyt>
+class write_gate_level_layout_snapshot_impl
+{
+  public:
+    write_gate_level_layout_snapshot_impl(const Lyt& src, std::ostream& s) :
+            lyt{src},
+            os{s},
+            indices(lyt.size(), std::numeric_limits<uint32_t>::max())
+    {}
+
+    void run()
+    {
+        // the payload is assembled in memory first to determine its size and checksum
+        write_string(layout_topology_name<Lyt>());
+        write_string(get_name(lyt));
+
+        write_value(static_cast<int32_t>(lyt.x()));
+        write_value(static_cast<int32_t>(lyt.y()));
+        write_value(static_cast<int32_t>(lyt.z()));
+
+        const auto clocking_scheme = lyt.get_clocking_scheme();
+
+        write_string(clocking_scheme.name);
+        write_value(static_cast<uint8_t>(lyt.num_clocks()));
+        write_value(static_cast<uint8_t>(lyt.is_regularly_clocked()));
+
+        // if the clocking scheme is irregular, store all clock zones
+        if (!lyt.is_regularly_clocked())
+        {
+            for (uint64_t x = 0; x <= lyt.x(); ++x)
+            {
+                for (uint64_t y = 0; y <= lyt.y(); ++y)
+                {
+                    write_value(static_cast<uint8_t>(lyt.get_clock_number({x, y})));
+                }
+            }
+        }
+
+        const auto order = ordered_nodes();
+
+        write_value(static_cast<uint32_t>(order.size()));
+
+        for (uint32_t i = 0; i < order.size(); ++i)
+        {
+            write_node(order[i]);
+
+            indices[order[i]] = i;
+        }
+
+        const auto checksum = fnv1a_hash(payload);
+
+        os.write(GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.data(), GATE_LEVEL_LAYOUT_SNAPSHOT_MAGIC.size());
+        write_header_value(GATE_LEVEL_LAYOUT_SNAPSHOT_VERSION);
+        write_header_value(uint16_t{0});
+        write_header_value(GATE_LEVEL_LAYOUT_SNAPSHOT_BYTE_ORDER_MARK);
+        write_header_value(static_cast<uint64_t>(payload.size()));
+        write_header_value(checksum);
+
+        os.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    }
+
+  private:
+    /**
+     * The layout to write.
+     */
+    const Lyt& lyt;
+    /**
+     * The output stream to write into.
+     */
+    std::ostream& os;
+    /**
+     * Snapshot index of each node that has already been written.
+     */
+    std::vector<uint32_t> indices;
+    /**
+     * Payload that follows the header.
+     */
+    std::string payload{};
+
+    /**
+     * Writes the object representation of a trivially copyable value directly to the output stream.
+     *
+     * @tparam T Value type.
+     * @param value Value to write.
+     */
+    template <typename T>
+    void write_header_value(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(*-pro-type-reinterpret-cast)
+    }
+    /**
+     * Appends the object representation of a trivially copyable value to the payload.
+     *
+     * @tparam T Value type.
+     * @param value Value to append.
+     */
+    template <typename T>
+    void write_value(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        payload.append(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(*-pro-type-reinterpret-cast)
+    }
+    /**
+     * Appends a length-prefixed string to the payload.
+     *
+     * @param str String to append.
+     */
+    void write_string(const std::string_view& str)
+    {
+        write_value(static_cast<uint32_t>(str.size()));
+        payload.append(str.data(), str.size());
+    }
+    /**
+     * Determines the order in which nodes are written such that every node is preceded by its fanins. PIs and POs keep
+     * their relative order. Since dangling nodes are included as well, no tile is lost.
+     *
+     * @return Nodes in the order in which they are to be written.
+     */
+    [[nodiscard]] std::vector<mockturtle::node<Lyt>> ordered_nodes() const
+    {
+        std::vector<mockturtle::node<Lyt>> order{};
+        order.reserve(lyt.num_pis() + lyt.num_gates());
+
+        std::vector<bool> visited(lyt.size(), false);
+
+        lyt.foreach_pi(
+            [&order, &visited](const auto& pi)
+            {
+                visited[pi] = true;
+                order.push_back(pi);
+            });
+
+        // iterative depth-first search to avoid deep recursions along long wire segments
+        const auto visit = [this, &order, &visited](const mockturtle::node<Lyt>& root)
+        {
+            std::vector<std::pair<mockturtle::node<Lyt>, bool>> stack{{root, false}};
+
+            while (!stack.empty())
+            {
+                const auto [n, expanded] = stack.back();
+                stack.pop_back();
+
+                if (expanded)
+                {
+                    order.push_back(n);
+                    continue;
+                }
+                if (visited[n])
+                {
+                    continue;
+                }
+
+                visited[n] = true;
+                stack.emplace_back(n, true);
+
+                lyt.foreach_fanin(n,
+                                  [this, &stack, &visited](const auto& f)
+                                  {
+                                      if (const auto fn = lyt.get_node(f); !visited[fn])
+                                      {
+                                          stack.emplace_back(fn, false);
+                                      }
+                                  });
+            }
+        };
+
+        lyt.foreach_gate(
+            [this, &visit](const auto& g)
+            {
+                if (!lyt.is_po(g))
+                {
+                    visit(g);
+                }
+            });
+
+        lyt.foreach_po([this, &visit](const auto& po) { visit(lyt.get_node(po)); });
+
+        return order;
+    }
+    /**
+     * Determines the kind of the given node.
+     *
+     * @param n Node whose kind is desired.
+     * @return Kind of `n`.
+     */
+    [[nodiscard]] gate_level_layout_snapshot_gate_kind node_kind(const mockturtle::node<Lyt>& n) const noexcept
+    {
+        using kind = gate_level_layout_snapshot_gate_kind;
+
+        if (lyt.is_pi(n))
+        {
+            return kind::PI;
+        }
+        if (lyt.is_po(n))
+        {
+            return kind::PO;
+        }
+
+        if (lyt.is_wire(n))
+        {
+            return kind::BUF;
+        }
+        if (lyt.is_inv(n))
+        {
+            return kind::INV;
+        }
+        if (lyt.is_and(n))
+        {
+            return kind::AND;
+        }
+        if (lyt.is_nand(n))
+        {
+            return kind::NAND;
+        }
+        if (lyt.is_or(n))
+        {
+            return kind::OR;
+        }
+        if (lyt.is_nor(n))
+        {
+            return kind::NOR;
+        }
+        if (lyt.is_lt(n))
+        {
+            return kind::LT;
+        }
+        if (lyt.is_ge(n))
+        {
+            return kind::GE;
+        }
+        if (lyt.is_gt(n))
+        {
+            return kind::GT;
+        }
+        if (lyt.is_le(n))
+        {
+            return kind::LE;
+        }
+        if (lyt.is_xor(n))
+        {
+            return kind::XOR;
+        }
+        if (lyt.is_xnor(n))
+        {
+            return kind::XNOR;
+        }
+        if (lyt.is_maj(n))
+        {
+            return kind::MAJ;
+        }
+
+        return kind::FUNCTION;
+    }
+    /**
+     * Writes the given node, i.e., its kind, its tile, its fanins, its function if necessary, and its name if it is a
+     * PI or PO.
+     *
+     * @param n Node to write.
+     * @throws std::invalid_argument if a fanin of `n` has not been written yet.
+     */
+    void write_node(const mockturtle::node<Lyt>& n)
+    {
+        const auto kind = node_kind(n);
+        const auto t    = lyt.get_tile(n);
+
+        write_value(static_cast<uint8_t>(kind));
+        write_value(static_cast<int32_t>(t.x));
+        write_value(static_cast<int32_t>(t.y));
+        write_value(static_cast<int32_t>(t.z));
+
+        std::vector<uint32_t> fanins{};
+        lyt.foreach_fanin(n, [this, &fanins](const auto& f) { fanins.push_back(indices[lyt.get_node(f)]); });
+
+        write_value(static_cast<uint8_t>(fanins.size()));
+
+        for (const auto f : fanins)
+        {
+            if (f == std::numeric_limits<uint32_t>::max())
+            {
+                throw std::invalid_argument("layout contains a fanin that cannot be stored in a snapshot");
+            }
+
+            write_value(f);
+        }
+
+        if (kind == gate_level_layout_snapshot_gate_kind::FUNCTION)
+        {
+            const auto function = lyt.node_function(n);
+
+            for (const auto& block : function)
+            {
+                write_value(static_cast<uint64_t>(block));
+            }
+        }
+        else if (kind == gate_level_layout_snapshot_gate_kind::PI || kind == gate_level_layout_snapshot_gate_kind::PO)
+        {
+            write_string(lyt.get_name(n));
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Writes a compact binary snapshot of a gate-level layout that can be restored via `read_gate_level_layout_snapshot`
+ * considerably faster than an FGL file. It is intended for caching intermediate physical designs between the stages
+ * of a design flow, while FGL remains the format of choice for exchanging layouts.
+ *
+ * The snapshot stores the layout's topology, name, aspect ratio, and clocking, including all clock zones if the layout
+ * is irregularly clocked, as well as all tiles with their types, fanins, functions, and, in case of PIs and POs, names.
+ * A checksum over the payload allows detecting corrupted files on reading. The snapshot is written in the native byte
+ * order, which is recorded in the header.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt The layout to write.
+ * @param os The output stream to write into. Should be opened in binary mode.
+ * @throws std::invalid_argument if `lyt` contains a cycle.
+ */
+template <typename Lyt>
+void write_gate_level_layout_snapshot(const Lyt& lyt, std::ostream& os)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    detail::write_gate_level_layout_snapshot_impl<Lyt> p{lyt, os};
+
+    p.run();
+}
+/**
+ * Writes a compact binary snapshot of a gate-level layout that can be restored via `read_gate_level_layout_snapshot`
+ * considerably faster than an FGL file.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt The layout to write.
+ * @param filename The file name to create and write into.
+ * @throws std::invalid_argument if `lyt` contains a cycle.
+ */
+template <typename Lyt>
+void write_gate_level_layout_snapshot(const Lyt& lyt, const std::string_view& filename)
+{
+    std::ofstream os{std::string{filename}, std::ofstream::out | std::ofstream::binary};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_gate_level_layout_snapshot(lyt, os);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WRITE_GATE_LEVEL_LAYOUT_SNAPSHOT_HPP
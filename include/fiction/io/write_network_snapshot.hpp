@@ -0,0 +1,358 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_WRITE_NETWORK_SNAPSHOT_HPP
+#define FICTION_WRITE_NETWORK_SNAPSHOT_HPP
+
+#include "fiction/traits.hpp"
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/views/topo_view.hpp>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Magic bytes that identify a network snapshot file.
+ */
+inline constexpr std::array<char, 8> NETWORK_SNAPSHOT_MAGIC{{'F', 'C', 'N', 'N', 'T', 'K', 'S', 'N'}};
+/**
+ * Version of the network snapshot format.
+ */
+inline constexpr uint16_t NETWORK_SNAPSHOT_VERSION = 1;
+/**
+ * Value written in the native byte order to detect files that were written on a machine of different endianness.
+ */
+inline constexpr uint32_t NETWORK_SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+/**
+ * Kinds of gates stored in a network snapshot. They correspond to the gate types distinguished by `convert_network`.
+ */
+enum class network_snapshot_gate_kind : uint8_t
+{
+    /**
+     * 2-input AND gate.
+     */
+    AND = 0,
+    /**
+     * 2-input OR gate.
+     */
+    OR = 1,
+    /**
+     * 2-input XOR gate.
+     */
+    XOR = 2,
+    /**
+     * 3-input majority gate.
+     */
+    MAJ = 3,
+    /**
+     * Buffer, e.g., a fan-out or path balancing node.
+     */
+    BUF = 4,
+    /**
+     * Gate whose function is stored as a truth table over its fanins.
+     */
+    FUNCTION = 5
+};
+
+namespace detail
+{
+
+/**
+ * Writes the object representation of a trivially copyable value to the given stream.
+ *
+ * @tparam T Value type.
+ * @param os Output stream.
+ * @param value Value to write.
+ */
+template <typename T>
+void write_snapshot_value(std::ostream& os, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+/**
+ * Writes a length-prefixed string to the given stream.
+ *
+ * @param os Output stream.
+ * @param str String to write.
+ */
+inline void write_snapshot_string(std::ostream& os, const std::string_view& str)
+{
+    write_snapshot_value(os, static_cast<uint32_t>(str.size()));
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+template <typename Ntk>
+class write_network_snapshot_impl
+{
+  public:
+    write_network_snapshot_impl(const Ntk& src, std::ostream& s) :
+            ntk{src},
+            os{s},
+            literals(ntk.size(), std::numeric_limits<uint32_t>::max())
+    {}
+
+    void run()
+    {
+        os.write(NETWORK_SNAPSHOT_MAGIC.data(), NETWORK_SNAPSHOT_MAGIC.size());
+        write_snapshot_value(os, NETWORK_SNAPSHOT_VERSION);
+        write_snapshot_value(os, uint16_t{0});
+        write_snapshot_value(os, NETWORK_SNAPSHOT_BYTE_ORDER_MARK);
+
+        // gates in topological order; dangling gates are omitted
+        std::vector<mockturtle::node<Ntk>> gates{};
+        gates.reserve(ntk.num_gates());
+
+        mockturtle::topo_view<Ntk>{ntk}.foreach_gate([&gates](const auto& g) { gates.push_back(g); });
+
+        write_snapshot_value(os, static_cast<uint32_t>(ntk.num_pis()));
+        write_snapshot_value(os, static_cast<uint32_t>(gates.size()));
+        write_snapshot_value(os, static_cast<uint32_t>(ntk.num_pos()));
+
+        if constexpr (mockturtle::has_get_network_name_v<Ntk>)
+        {
+            write_snapshot_string(os, ntk.get_network_name());
+        }
+        else
+        {
+            write_snapshot_string(os, "");
+        }
+
+        // constants are referred to by index 0
+        ntk.foreach_node(
+            [this](const auto& n)
+            {
+                if (ntk.is_constant(n))
+                {
+                    literals[ntk.node_to_index(n)] = 0;
+                }
+            });
+
+        uint32_t index = 1;
+
+        ntk.foreach_pi(
+            [this, &index](const auto& pi)
+            {
+                literals[ntk.node_to_index(pi)] = 2 * index++;
+
+                if constexpr (mockturtle::has_has_name_v<Ntk> && mockturtle::has_get_name_v<Ntk>)
+                {
+                    if (const auto s = ntk.make_signal(pi); ntk.has_name(s))
+                    {
+                        write_snapshot_string(os, ntk.get_name(s));
+                        return;
+                    }
+                }
+
+                write_snapshot_string(os, "");
+            });
+
+        for (const auto& g : gates)
+        {
+            write_gate(g);
+
+            literals[ntk.node_to_index(g)] = 2 * index++;
+        }
+
+        ntk.foreach_po(
+            [this](const auto& po, const auto i)
+            {
+                write_snapshot_value(os, literal(po));
+
+                if constexpr (mockturtle::has_has_output_name_v<Ntk> && mockturtle::has_get_output_name_v<Ntk>)
+                {
+                    if (ntk.has_output_name(i))
+                    {
+                        write_snapshot_string(os, ntk.get_output_name(i));
+                        return;
+                    }
+                }
+
+                write_snapshot_string(os, "");
+            });
+    }
+
+  private:
+    /**
+     * The network to write.
+     */
+    const Ntk& ntk;
+    /**
+     * The output stream to write into.
+     */
+    std::ostream& os;
+    /**
+     * Non-complemented literal of each node in the snapshot, i.e., twice its snapshot index.
+     */
+    std::vector<uint32_t> literals;
+
+    /**
+     * Computes the literal of the given signal. Constants are stored as literals `0` (false) and `1` (true).
+     *
+     * @param s Signal whose literal is desired.
+     * @return Literal of `s`.
+     */
+    [[nodiscard]] uint32_t literal(const mockturtle::signal<Ntk>& s) const noexcept
+    {
+        const auto n = ntk.get_node(s);
+
+        if (ntk.is_constant(n))
+        {
+            return static_cast<uint32_t>(ntk.constant_value(n) != ntk.is_complemented(s));
+        }
+
+        return literals[ntk.node_to_index(n)] | static_cast<uint32_t>(ntk.is_complemented(s));
+    }
+    /**
+     * Determines the kind of the given gate in the same order as `convert_network` does.
+     *
+     * @param g Gate whose kind is desired.
+     * @return Kind of `g`.
+     */
+    [[nodiscard]] network_snapshot_gate_kind gate_kind(const mockturtle::node<Ntk>& g) const
+    {
+        if constexpr (mockturtle::has_is_and_v<Ntk>)
+        {
+            if (ntk.is_and(g))
+            {
+                return network_snapshot_gate_kind::AND;
+            }
+        }
+        if constexpr (mockturtle::has_is_or_v<Ntk>)
+        {
+            if (ntk.is_or(g))
+            {
+                return network_snapshot_gate_kind::OR;
+            }
+        }
+        if constexpr (mockturtle::has_is_xor_v<Ntk>)
+        {
+            if (ntk.is_xor(g))
+            {
+                return network_snapshot_gate_kind::XOR;
+            }
+        }
+        if constexpr (mockturtle::has_is_maj_v<Ntk>)
+        {
+            if (ntk.is_maj(g))
+            {
+                return network_snapshot_gate_kind::MAJ;
+            }
+        }
+        if constexpr (fiction::has_is_buf_v<Ntk>)
+        {
+            if (ntk.is_buf(g))
+            {
+                return network_snapshot_gate_kind::BUF;
+            }
+        }
+        if constexpr (mockturtle::has_node_function_v<Ntk>)
+        {
+            return network_snapshot_gate_kind::FUNCTION;
+        }
+
+        throw std::invalid_argument("network contains a gate that cannot be stored in a snapshot");
+    }
+    /**
+     * Writes the given gate, i.e., its kind, its fanin literals, and, if necessary, its function.
+     *
+     * @param g Gate to write.
+     */
+    void write_gate(const mockturtle::node<Ntk>& g)
+    {
+        const auto kind = gate_kind(g);
+
+        write_snapshot_value(os, static_cast<uint8_t>(kind));
+        write_snapshot_value(os, static_cast<uint8_t>(ntk.fanin_size(g)));
+
+        ntk.foreach_fanin(g, [this](const auto& f) { write_snapshot_value(os, literal(f)); });
+
+        if constexpr (mockturtle::has_node_function_v<Ntk>)
+        {
+            if (kind == network_snapshot_gate_kind::FUNCTION)
+            {
+                const auto function = ntk.node_function(g);
+
+                for (const auto& block : function)
+                {
+                    write_snapshot_value(os, static_cast<uint64_t>(block));
+                }
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Writes a compact binary snapshot of a combinational logic network that can be read back via `read_network_snapshot`
+ * considerably faster than parsing the file the network originated from. The snapshot stores the network's gates in
+ * topological order together with the network, PI, and PO names. Thereby, all gates are distinguished in the same way
+ * as `convert_network` does, i.e., gates that are neither AND, OR, XOR, MAJ, nor buffers are stored via their truth
+ * tables.
+ *
+ * The snapshot is written in the native byte order, which is recorded in the header.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @tparam Ntk Logic network type.
+ * @param ntk The network to write.
+ * @param os The output stream to write into. Should be opened in binary mode.
+ * @throws std::invalid_argument if `ntk` contains a gate that cannot be stored.
+ */
+template <typename Ntk>
+void write_network_snapshot(const Ntk& ntk, std::ostream& os)
+{
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+    static_assert(mockturtle::has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi function");
+    static_assert(mockturtle::has_foreach_gate_v<Ntk>, "Ntk does not implement the foreach_gate function");
+    static_assert(mockturtle::has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po function");
+    static_assert(mockturtle::has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin function");
+
+    detail::write_network_snapshot_impl<Ntk> p{ntk, os};
+
+    p.run();
+}
+/**
+ * Writes a compact binary snapshot of a combinational logic network that can be read back via `read_network_snapshot`
+ * considerably faster than parsing the file the network originated from.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam Ntk Logic network type.
+ * @param ntk The network to write.
+ * @param filename The file name to create and write into.
+ * @throws std::invalid_argument if `ntk` contains a gate that cannot be stored.
+ */
+template <typename Ntk>
+void write_network_snapshot(const Ntk& ntk, const std::string_view& filename)
+{
+    std::ofstream os{filename.data(), std::ofstream::out | std::ofstream::binary};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_network_snapshot(ntk, os);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WRITE_NETWORK_SNAPSHOT_HPP
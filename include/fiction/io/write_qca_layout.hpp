@@ -15,6 +15,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -167,26 +168,24 @@ class write_qca_layout_impl
 
     void run()
     {
-
         write_header();
 
-        write_cell_layers();
-
-        // close design block
-        os << qcad::CLOSE_DESIGN << std::flush;
-    }
-
-  private:
-    Lyt lyt;
-
-    std::ostream& os;
+        // for each layer
+        for (decltype(lyt.z()) z = 0; z <= lyt.z(); ++z)
+        {
+            open_layer(z);
 
-    const write_qca_layout_params ps;
+            // for each row
+            for (decltype(lyt.y()) y = 0; y <= lyt.y(); ++y)
+            {
+                write_row(y, z);
+            }
 
-    uint32_t via_counter{1ul};
+            close_layer();
+        }
 
-    // via cells
-    std::vector<cell<Lyt>> via_layer_cells{};
+        write_footer();
+    }
 
     void write_header()
     {
@@ -195,41 +194,76 @@ class write_qca_layout_impl
                           FICTION_VERSION, FICTION_REPO);
     }
 
-    void write_cell_layers()
+    void write_footer()
     {
-        // for each layer
-        for (decltype(lyt.z()) z = 0; z <= lyt.z(); ++z)
-        {
-            write_via_cells();
+        // close design block
+        os << qcad::CLOSE_DESIGN << std::flush;
+    }
+    /**
+     * Writes the via layer of the cells collected in the previous layer, if any, and opens the design layer `z`.
+     *
+     * @param z Layer to open.
+     */
+    void open_layer(const decltype(std::declval<Lyt>().z()) z)
+    {
+        write_via_cells();
 
-            // open design layer
-            os << qcad::OPEN_QCAD_LAYER;
+        // open design layer
+        os << qcad::OPEN_QCAD_LAYER;
 
-            os << qcad::TYPE << "1\n";
-            os << qcad::STATUS << "0\n";
-            os << qcad::PSZ_DESCRIPTION << ((z == 0) ? "Ground Layer" : ("Crossing Layer " + std::to_string(z)))
-               << '\n';
+        os << qcad::TYPE << "1\n";
+        os << qcad::STATUS << "0\n";
+        os << qcad::PSZ_DESCRIPTION << ((z == 0) ? "Ground Layer" : ("Crossing Layer " + std::to_string(z))) << '\n';
+    }
 
-            // for each row
-            for (decltype(lyt.y()) y = 0; y <= lyt.y(); ++y)
-            {
-                // for each cell
-                for (decltype(lyt.x()) x = 0; x <= lyt.x(); ++x)
-                {
-                    const cell<Lyt> c{x, y, z};
+    void close_layer()
+    {
+        // close design layer
+        os << qcad::CLOSE_QCAD_LAYER;
+    }
+    /**
+     * Writes all non-empty cells of row `y` in layer `z` from west to east. Must be called between `open_layer(z)` and
+     * `close_layer()`.
+     *
+     * @param y Row to write.
+     * @param z Layer of the row.
+     */
+    void write_row(const decltype(std::declval<Lyt>().y()) y, const decltype(std::declval<Lyt>().z()) z)
+    {
+        // for each cell
+        for (decltype(lyt.x()) x = 0; x <= lyt.x(); ++x)
+        {
+            const cell<Lyt> c{x, y, z};
 
-                    // skip empty cells
-                    if (!lyt.is_empty_cell(c))
-                    {
-                        write_cell(c, ps.create_inter_layer_via_cells);
-                    }
-                }
+            // skip empty cells
+            if (!lyt.is_empty_cell(c))
+            {
+                write_cell(c, ps.create_inter_layer_via_cells);
             }
-
-            // close design layer
-            os << qcad::CLOSE_QCAD_LAYER;
         }
     }
+    /**
+     * Returns the cells that have been collected in the current layer to be written to the next via layer. They have
+     * to remain in the layout until the next call to `open_layer`.
+     *
+     * @return Pending via cells.
+     */
+    [[nodiscard]] const std::vector<cell<Lyt>>& pending_via_cells() const noexcept
+    {
+        return via_layer_cells;
+    }
+
+  private:
+    Lyt lyt;
+
+    std::ostream& os;
+
+    const write_qca_layout_params ps;
+
+    uint32_t via_counter{1ul};
+
+    // via cells
+    std::vector<cell<Lyt>> via_layer_cells{};
 
     qcad::color write_cell_colors(const cell<Lyt>& c)
     {
@@ -19,7 +19,6 @@
 #include <ctime>
 #include <fstream>
 #include <ostream>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -189,14 +188,24 @@ class write_sqd_layout_impl
 
     void run()
     {
-        std::stringstream header{}, gui{}, design{};
+        write_prologue();
 
-        header << siqad::SQD_HEADER << siqad::OPEN_SIQAD;
+        lyt.foreach_cell([this](const auto& c) { write_db_block(c); });
+
+        write_epilogue();
+    }
+    /**
+     * Writes everything up to and including the opening of the DB layer, i.e., the header, the layer definitions, and
+     * the design layers preceding the DB layer.
+     */
+    void write_prologue()
+    {
+        os << siqad::SQD_HEADER << siqad::OPEN_SIQAD;
 
         const auto current_time = std::time(nullptr);
         const auto time_str     = fmt::format("{:%Y-%m-%d %H:%M:%S}", safe_localtime(current_time));
 
-        header << fmt::format(siqad::PROGRAM_BLOCK, "layout simulation", FICTION_VERSION, FICTION_REPO, time_str);
+        os << fmt::format(siqad::PROGRAM_BLOCK, "layout simulation", FICTION_VERSION, FICTION_REPO, time_str);
 
         std::vector<const char*> active_layers{};
 
@@ -217,145 +226,143 @@ class write_sqd_layout_impl
             active_layers.push_back(siqad::DEFECT_LAYER_DEFINITION);
         }
 
-        design << fmt::format(siqad::LAYERS_BLOCK, fmt::join(active_layers, "")) << siqad::OPEN_DESIGN
-               << siqad::LATTICE_LAYER << siqad::MISC_LAYER;
+        os << fmt::format(siqad::LAYERS_BLOCK, fmt::join(active_layers, "")) << siqad::OPEN_DESIGN
+           << siqad::LATTICE_LAYER << siqad::MISC_LAYER;
 
-        design << siqad::OPEN_DB_LAYER;
-        generate_db_blocks(design);
-        design << siqad::CLOSE_DB_LAYER;
+        os << siqad::OPEN_DB_LAYER;
+    }
+    /**
+     * Writes everything following the DB layer, i.e., its closing, the defect layer if `Lyt` implements the defect
+     * interface, and the remaining design layers.
+     */
+    void write_epilogue()
+    {
+        os << siqad::CLOSE_DB_LAYER;
 
         if constexpr (has_get_sidb_defect_v<Lyt>)
         {
-            design << siqad::OPEN_DEFECTS_LAYER;
-            generate_defect_blocks(design);
-            design << siqad::CLOSE_DEFECTS_LAYER;
+            os << siqad::OPEN_DEFECTS_LAYER;
+            write_defect_blocks();
+            os << siqad::CLOSE_DEFECTS_LAYER;
         }
 
-        design << siqad::ELECTRODE_LAYER;
-
-        design << siqad::CLOSE_DESIGN;
+        os << siqad::ELECTRODE_LAYER;
 
-        os << header.str();
-        os << gui.str();
-        os << design.str();
+        os << siqad::CLOSE_DESIGN;
 
         os << siqad::CLOSE_SIQAD;
     }
+    /**
+     * Writes the dot blocks of cell `c`. Must be called between `write_prologue` and `write_epilogue`.
+     *
+     * @param c Non-empty cell to write.
+     */
+    void write_db_block(const cell<Lyt>& c)
+    {
+        // generate SiDB cells
+        if constexpr (has_sidb_technology_v<Lyt>)
+        {
+            const auto type = lyt.get_cell_type(c);
 
-  private:
-    Lyt lyt;
-
-    std::ostream& os;
+            std::string type_str;
 
-    void generate_db_blocks(std::stringstream& design) noexcept
-    {
-        lyt.foreach_cell(
-            [this, &design](const auto& c)
+            switch (type)
             {
-                // generate SiDB cells
-                if constexpr (has_sidb_technology_v<Lyt>)
+                case (sidb_technology::cell_type::NORMAL):
                 {
-                    const auto type = this->lyt.get_cell_type(c);
+                    type_str = "";
+                    break;
+                }
+                case (sidb_technology::cell_type::INPUT):
+                {
+                    type_str = fmt::format(siqad::DOT_TYPE, "input");
+                    break;
+                }
+                case (sidb_technology::cell_type::OUTPUT):
+                {
+                    type_str = fmt::format(siqad::DOT_TYPE, "output");
+                    break;
+                }
+                case (sidb_technology::cell_type::LOGIC):
+                {
+                    type_str = fmt::format(siqad::DOT_TYPE, "logic");
+                    break;
+                }
+                    // LCOV_EXCL_START
+                case (sidb_technology::cell_type::EMPTY):
+                {
+                    // this case can never happen; it exists to comfort the compilers
+                    break;
+                }
+                    // LCOV_EXCL_STOP
+            }
 
-                    std::string type_str;
+            if constexpr (has_siqad_coord_v<Lyt>)
+            {
+                os << fmt::format(siqad::DBDOT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, c.x, c.y, c.z), type_str,
+                                  siqad::NORMAL_COLOR);
+            }
+            else
+            {
+                const auto siqad_coord = fiction::siqad::to_siqad_coord(c);
 
-                    switch (type)
-                    {
-                        case (sidb_technology::cell_type::NORMAL):
-                        {
-                            type_str = "";
-                            break;
-                        }
-                        case (sidb_technology::cell_type::INPUT):
-                        {
-                            type_str = fmt::format(siqad::DOT_TYPE, "input");
-                            break;
-                        }
-                        case (sidb_technology::cell_type::OUTPUT):
-                        {
-                            type_str = fmt::format(siqad::DOT_TYPE, "output");
-                            break;
-                        }
-                        case (sidb_technology::cell_type::LOGIC):
-                        {
-                            type_str = fmt::format(siqad::DOT_TYPE, "logic");
-                            break;
-                        }
-                            // LCOV_EXCL_START
-                        case (sidb_technology::cell_type::EMPTY):
-                        {
-                            // this case can never happen; it exists to comfort the compilers
-                            break;
-                        }
-                            // LCOV_EXCL_STOP
-                    }
+                os << fmt::format(siqad::DBDOT_BLOCK,
+                                  fmt::format(siqad::LATTICE_COORDINATE, siqad_coord.x, siqad_coord.y, siqad_coord.z),
+                                  type_str, siqad::NORMAL_COLOR);
+            }
+        }
+        // generate QCA cell blocks
+        else if constexpr (has_qca_technology_v<Lyt>)
+        {
+            const auto type = lyt.get_cell_type(c);
 
-                    if constexpr (has_siqad_coord_v<Lyt>)
-                    {
-                        design << fmt::format(siqad::DBDOT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, c.x, c.y, c.z),
-                                              type_str, siqad::NORMAL_COLOR);
-                    }
-                    else
-                    {
-                        const auto siqad_coord = fiction::siqad::to_siqad_coord(c);
+            const auto* color = siqad::NORMAL_COLOR;
 
-                        design << fmt::format(
-                            siqad::DBDOT_BLOCK,
-                            fmt::format(siqad::LATTICE_COORDINATE, siqad_coord.x, siqad_coord.y, siqad_coord.z),
-                            type_str, siqad::NORMAL_COLOR);
-                    }
+            switch (type)
+            {
+                case (qca_technology::cell_type::INPUT):
+                {
+                    color = siqad::INPUT_COLOR;
+                    break;
+                }
+                case (qca_technology::cell_type::OUTPUT):
+                {
+                    color = siqad::OUTPUT_COLOR;
+                    break;
                 }
-                // generate QCA cell blocks
-                else if constexpr (has_qca_technology_v<Lyt>)
+                case (qca_technology::cell_type::CONST_0):
+                case (qca_technology::cell_type::CONST_1):
                 {
-                    const auto type = this->lyt.get_cell_type(c);
+                    color = siqad::CONST_COLOR;
+                    break;
+                }
+            }
 
-                    const auto* color = siqad::NORMAL_COLOR;
+            if (!qca_technology::is_const_1_cell(type))
+            {
+                // top left
+                os << fmt::format(siqad::DBDOT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, c.y * 7, 0), "",
+                                  color);
+                // bottom right
+                os << fmt::format(siqad::DBDOT_BLOCK,
+                                  fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, (c.y * 7) + 3, 0), "", color);
+            }
+            if (!qca_technology::is_const_0_cell(type))
+            {
+                // top right
+                os << fmt::format(siqad::DBDOT_BLOCK,
+                                  fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, c.y * 7, 0), "", color);
+                // bottom left
+                os << fmt::format(siqad::DBDOT_BLOCK,
+                                  fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, (c.y * 7) + 3, 0), "", color);
+            }
+        }
+    }
 
-                    switch (type)
-                    {
-                        case (qca_technology::cell_type::INPUT):
-                        {
-                            color = siqad::INPUT_COLOR;
-                            break;
-                        }
-                        case (qca_technology::cell_type::OUTPUT):
-                        {
-                            color = siqad::OUTPUT_COLOR;
-                            break;
-                        }
-                        case (qca_technology::cell_type::CONST_0):
-                        case (qca_technology::cell_type::CONST_1):
-                        {
-                            color = siqad::CONST_COLOR;
-                            break;
-                        }
-                    }
+  private:
+    Lyt lyt;
 
-                    if (!qca_technology::is_const_1_cell(type))
-                    {
-                        // top left
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, c.y * 7, 0), "", color);
-                        // bottom right
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, (c.y * 7) + 3, 0),
-                                              "", color);
-                    }
-                    if (!qca_technology::is_const_0_cell(type))
-                    {
-                        // top right
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, c.y * 7, 0), "",
-                                              color);
-                        // bottom left
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, (c.y * 7) + 3, 0), "",
-                                              color);
-                    }
-                }
-            });
-    }
+    std::ostream& os;
 
     [[nodiscard]] static const char* get_defect_type_name(const sidb_defect_type& type) noexcept
     {
@@ -363,12 +370,12 @@ class write_sqd_layout_impl
         return it == siqad::defect_type_to_name.cend() ? "Unknown" : it->second;
     }
 
-    void generate_defect_blocks(std::stringstream& design) noexcept
+    void write_defect_blocks()
     {
         if constexpr (has_foreach_sidb_defect_v<Lyt>)
         {
             lyt.foreach_sidb_defect(
-                [&design](const auto& cd)
+                [this](const auto& cd)
                 {
                     const auto& defect = cd.second;
 
@@ -377,7 +384,7 @@ class write_sqd_layout_impl
                     {
                         const auto& cell = cd.first;
 
-                        design << fmt::format(
+                        os << fmt::format(
                             siqad::DEFECT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, cell.x, cell.y, cell.z),
                             is_charged_defect_type(defect) ?
                                 fmt::format(siqad::COULOMB, defect.charge, defect.epsilon_r, defect.lambda_tf) :
@@ -388,7 +395,7 @@ class write_sqd_layout_impl
                     {
                         const auto cell = fiction::siqad::to_siqad_coord(cd.first);
 
-                        design << fmt::format(
+                        os << fmt::format(
                             siqad::DEFECT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, cell.x, cell.y, cell.z),
                             is_charged_defect_type(defect) ?
                                 fmt::format(siqad::COULOMB, defect.charge, defect.epsilon_r, defect.lambda_tf) :
@@ -183,6 +183,22 @@ class cell_level_layout : public ClockedLayout
             strg->outputs.insert(c);
         }
     }
+    /**
+     * Assigns cell types to multiple cell positions at once. The storage is reserved only once for all given cells,
+     * which avoids repeated rehashing when large amounts of cells are placed, e.g., when applying a gate library. The
+     * semantics are equivalent to calling `assign_cell_type` for each pair in the given order.
+     *
+     * @param cells Pairs of cell positions and the cell types to assign to them.
+     */
+    void assign_cell_types(const std::vector<std::pair<cell, cell_type>>& cells) noexcept
+    {
+        strg->cell_type_map.reserve(strg->cell_type_map.size() + cells.size());
+
+        for (const auto& [c, ct] : cells)
+        {
+            assign_cell_type(c, ct);
+        }
+    }
     /**
      * Returns the cell type assigned to cell position `c`.
      *
@@ -16,6 +16,7 @@
 #include <iterator>
 #include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -30,9 +31,16 @@ namespace fiction
  *
  * In the context of this layout type, coordinates are renamed as clock zones.
  *
+ * By default, the clocking scheme is a runtime object that can be replaced and whose clock numbers can be overwritten.
+ * For the regular schemes, a `static_clocking_scheme` can be provided instead. It fixes the clocking at compile time
+ * such that clock number lookups become inlined table accesses, which speeds up clocking-aware algorithms like path
+ * finding considerably. Layouts clocked by a static scheme cannot be re-clocked.
+ *
  * @tparam CoordinateLayout The coordinate layout type whose coordinates should be clocked.
+ * @tparam ClockingScheme The clocking scheme type. Either `clocking_scheme` or a `static_clocking_scheme`.
  */
-template <typename CoordinateLayout>
+template <typename CoordinateLayout,
+          typename ClockingScheme = clocking_scheme<typename CoordinateLayout::coordinate>>
 class clocked_layout : public CoordinateLayout
 {
   public:
@@ -40,11 +48,14 @@ class clocked_layout : public CoordinateLayout
 
     using clock_zone = typename CoordinateLayout::coordinate;
 
-    using clocking_scheme_t = clocking_scheme<clock_zone>;
+    using clocking_scheme_t = ClockingScheme;
     using clock_number_t    = typename clocking_scheme_t::clock_number;
 
     using degree_t = uint8_t;
 
+    static_assert(std::is_same_v<typename clocking_scheme_t::clock_zone, clock_zone>,
+                  "ClockingScheme is not defined over the CoordinateLayout's coordinates");
+
     struct clocked_layout_storage
     {
         explicit clocked_layout_storage(const clocking_scheme_t& scheme) noexcept :
@@ -60,14 +71,14 @@ class clocked_layout : public CoordinateLayout
 
     /**
      * Standard constructor. Creates a clocked layout of the given aspect ratio and clocks it via the irregular 'open'
-     * clocking scheme. This scheme is intended to be used if all clock zones are to be manually assigned.
+     * clocking scheme. This scheme is intended to be used if all clock zones are to be manually assigned. If the layout
+     * is clocked by a static clocking scheme, that scheme is used instead.
      *
      * @param ar Highest possible position in the layout.
      */
     explicit clocked_layout(const typename CoordinateLayout::aspect_ratio& ar = {}) :
             CoordinateLayout(ar),
-            strg{std::make_shared<clocked_layout_storage>(
-                open_clocking<clocked_layout<CoordinateLayout>>(num_clks::FOUR))}
+            strg{std::make_shared<clocked_layout_storage>(default_clocking_scheme())}
     {
         static_assert(is_coordinate_layout_v<CoordinateLayout>, "CoordinateLayout is not a coordinate layout type");
     }
@@ -100,8 +111,7 @@ class clocked_layout : public CoordinateLayout
      */
     explicit clocked_layout(const CoordinateLayout& lyt) :
             CoordinateLayout(lyt),
-            strg{std::make_shared<clocked_layout_storage>(
-                open_clocking<clocked_layout<CoordinateLayout>>(num_clks::FOUR))}
+            strg{std::make_shared<clocked_layout_storage>(default_clocking_scheme())}
     {
         static_assert(is_coordinate_layout_v<CoordinateLayout>, "CoordinateLayout is not a coordinate layout type");
     }
@@ -128,6 +138,8 @@ class clocked_layout : public CoordinateLayout
      */
     void replace_clocking_scheme(const clocking_scheme_t& scheme) noexcept
     {
+        static_assert(!is_static_clocking_scheme_v<clocking_scheme_t>, "Static clocking schemes cannot be replaced");
+
         strg->clocking = std::make_shared<clocking_scheme_t>(scheme);
     }
     /**
@@ -138,6 +150,8 @@ class clocked_layout : public CoordinateLayout
      */
     void assign_clock_number(const clock_zone& cz, const clock_number_t cn) noexcept
     {
+        static_assert(!is_static_clocking_scheme_v<clocking_scheme_t>, "Static clocking schemes cannot be overridden");
+
         strg->clocking->override_clock_number(cz, cn);
     }
     /**
@@ -148,7 +162,14 @@ class clocked_layout : public CoordinateLayout
      */
     [[nodiscard]] clock_number_t get_clock_number(const clock_zone& cz) const noexcept
     {
-        return (*strg->clocking)(cz);
+        if constexpr (is_static_clocking_scheme_v<clocking_scheme_t>)
+        {
+            return clocking_scheme_t::clock_number_of(cz);
+        }
+        else
+        {
+            return (*strg->clocking)(cz);
+        }
     }
     /**
      * Returns the number of clock phases in the layout. Each clock cycle is divided into n phases. In QCA, the number
@@ -158,7 +179,14 @@ class clocked_layout : public CoordinateLayout
      */
     [[nodiscard]] clock_number_t num_clocks() const noexcept
     {
-        return strg->clocking->num_clocks;
+        if constexpr (is_static_clocking_scheme_v<clocking_scheme_t>)
+        {
+            return clocking_scheme_t::num_clocks;
+        }
+        else
+        {
+            return strg->clocking->num_clocks;
+        }
     }
     /**
      * Returns whether the layout is clocked by a regular clocking scheme with no overwritten zones.
@@ -189,6 +217,32 @@ class clocked_layout : public CoordinateLayout
     {
         return *strg->clocking;
     }
+    /**
+     * Returns the maximum number of incoming clock zones per clock zone in the stored clocking scheme. Static clocking
+     * schemes are capped at the layout's maximum fan-in size just like their runtime counterparts.
+     *
+     * @return Maximum in-degree of the stored clocking scheme.
+     */
+    [[nodiscard]] degree_t max_clocked_in_degree() const noexcept
+    {
+        if constexpr (is_static_clocking_scheme_v<clocking_scheme_t>)
+        {
+            return clocking_scheme_t::template max_in_degree_on<CoordinateLayout>();
+        }
+        else
+        {
+            return strg->clocking->max_in_degree;
+        }
+    }
+    /**
+     * Returns the maximum number of outgoing clock zones per clock zone in the stored clocking scheme.
+     *
+     * @return Maximum out-degree of the stored clocking scheme.
+     */
+    [[nodiscard]] degree_t max_clocked_out_degree() const noexcept
+    {
+        return strg->clocking->max_out_degree;
+    }
     /**
      * Evaluates whether clock zone `cz2` feeds information to clock zone `cz1`, i.e., whether `cz2` is clocked with a
      * clock number that is lower by 1 modulo `num_clocks()`.
@@ -239,7 +293,7 @@ class clocked_layout : public CoordinateLayout
     [[nodiscard]] auto incoming_clocked_zones(const clock_zone& cz) const noexcept
     {
         std::vector<clock_zone> incoming{};
-        incoming.reserve(strg->clocking->max_in_degree);  // reserve memory
+        incoming.reserve(max_clocked_in_degree());  // reserve memory
 
         foreach_incoming_clocked_zone(cz, [&incoming](const auto& ct) { incoming.push_back(ct); });
 
@@ -273,7 +327,7 @@ class clocked_layout : public CoordinateLayout
     [[nodiscard]] auto outgoing_clocked_zones(const clock_zone& cz) const noexcept
     {
         std::vector<clock_zone> outgoing{};
-        outgoing.reserve(strg->clocking->max_out_degree);  // reserve memory
+        outgoing.reserve(max_clocked_out_degree());  // reserve memory
 
         foreach_outgoing_clocked_zone(cz, [&outgoing](const auto& ct) { outgoing.push_back(ct); });
 
@@ -343,6 +397,22 @@ class clocked_layout : public CoordinateLayout
 
   private:
     storage strg;
+    /**
+     * Returns the clocking scheme that is applied if none is specified.
+     *
+     * @return The 'open' clocking scheme with four clocks or, if the layout is clocked statically, the static scheme.
+     */
+    [[nodiscard]] static clocking_scheme_t default_clocking_scheme() noexcept
+    {
+        if constexpr (is_static_clocking_scheme_v<clocking_scheme_t>)
+        {
+            return clocking_scheme_t{};
+        }
+        else
+        {
+            return open_clocking<clocked_layout<CoordinateLayout>>(num_clks::FOUR);
+        }
+    }
 };
 
 }  // namespace fiction
@@ -13,11 +13,15 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace fiction
@@ -172,6 +176,350 @@ inline constexpr const char* BANCS         = "BANCS";
 
 }  // namespace clock_name
 
+/**
+ * Cutouts of the regular clocking schemes, i.e., their repeating clock number patterns, as compile-time tables. They
+ * are shared by the runtime clocking scheme functions below and by `static_clocking_scheme`.
+ *
+ * Each cutout provides its scheme's `name`, the number of clocks `num_clocks`, the maximum in- and out-degrees
+ * `max_in_degree` and `max_out_degree`, and the clock number table `cutout`, which is indexed via `[y][x]`.
+ */
+namespace clock_cutout
+{
+
+// clang-format off
+
+struct columnar_3
+{
+    static constexpr const char*                             name{clock_name::COLUMNAR};
+    static constexpr uint8_t                                 num_clocks{3u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 3u>, 3u> cutout{{{{0, 1, 2}},
+                                                                     {{0, 1, 2}},
+                                                                     {{0, 1, 2}}}};
+};
+
+struct columnar_4
+{
+    static constexpr const char*                             name{clock_name::COLUMNAR};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 1, 2, 3}},
+                                                                     {{0, 1, 2, 3}},
+                                                                     {{0, 1, 2, 3}},
+                                                                     {{0, 1, 2, 3}}}};
+};
+
+struct row_3
+{
+    static constexpr const char*                             name{clock_name::ROW};
+    static constexpr uint8_t                                 num_clocks{3u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 3u>, 3u> cutout{{{{0, 0, 0}},
+                                                                     {{1, 1, 1}},
+                                                                     {{2, 2, 2}}}};
+};
+
+struct row_4
+{
+    static constexpr const char*                             name{clock_name::ROW};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 0, 0, 0}},
+                                                                     {{1, 1, 1, 1}},
+                                                                     {{2, 2, 2, 2}},
+                                                                     {{3, 3, 3, 3}}}};
+};
+
+struct twoddwave_3
+{
+    static constexpr const char*                             name{clock_name::TWODDWAVE};
+    static constexpr uint8_t                                 num_clocks{3u};
+    static constexpr uint8_t                                 max_in_degree{2u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 3u>, 3u> cutout{{{{0, 1, 2}},
+                                                                     {{1, 2, 0}},
+                                                                     {{2, 0, 1}}}};
+};
+
+struct twoddwave_4
+{
+    static constexpr const char*                             name{clock_name::TWODDWAVE};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{2u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 1, 2, 3}},
+                                                                     {{1, 2, 3, 0}},
+                                                                     {{2, 3, 0, 1}},
+                                                                     {{3, 0, 1, 2}}}};
+};
+
+struct use
+{
+    static constexpr const char*                             name{clock_name::USE};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{2u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 1, 2, 3}},
+                                                                     {{3, 2, 1, 0}},
+                                                                     {{2, 3, 0, 1}},
+                                                                     {{1, 0, 3, 2}}}};
+};
+
+struct res
+{
+    static constexpr const char*                             name{clock_name::RES};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{3u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{3, 0, 1, 2}},
+                                                                     {{0, 1, 0, 3}},
+                                                                     {{1, 2, 3, 0}},
+                                                                     {{0, 3, 2, 1}}}};
+};
+
+struct esr
+{
+    static constexpr const char*                             name{clock_name::ESR};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{3u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{3, 0, 1, 2}},
+                                                                     {{0, 1, 2, 3}},
+                                                                     {{1, 2, 3, 0}},
+                                                                     {{0, 3, 2, 1}}}};
+};
+
+struct cfe
+{
+    static constexpr const char*                             name{clock_name::CFE};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{3u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 1, 0, 1}},
+                                                                     {{3, 2, 3, 2}},
+                                                                     {{0, 1, 0, 1}},
+                                                                     {{3, 2, 3, 2}}}};
+};
+
+struct ripple
+{
+    static constexpr const char*                             name{clock_name::RIPPLE};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{3u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{0, 1, 2, 3}},
+                                                                     {{3, 2, 1, 0}},
+                                                                     {{0, 1, 2, 3}},
+                                                                     {{3, 2, 1, 0}}}};
+};
+
+struct srs
+{
+    static constexpr const char*                             name{clock_name::SRS};
+    static constexpr uint8_t                                 num_clocks{4u};
+    static constexpr uint8_t                                 max_in_degree{3u};
+    static constexpr uint8_t                                 max_out_degree{3u};
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{{{{1, 0, 3, 2}},
+                                                                     {{2, 3, 0, 1}},
+                                                                     {{3, 2, 3, 0}},
+                                                                     {{0, 1, 2, 1}}}};
+};
+
+struct bancs
+{
+    static constexpr const char*                             name{clock_name::BANCS};
+    static constexpr uint8_t                                 num_clocks{3u};
+    static constexpr uint8_t                                 max_in_degree{2u};
+    static constexpr uint8_t                                 max_out_degree{2u};
+    static constexpr std::array<std::array<uint8_t, 3u>, 6u> cutout{{{{0, 1, 2}},
+                                                                     {{2, 1, 0}},
+                                                                     {{2, 0, 1}},
+                                                                     {{1, 0, 2}},
+                                                                     {{1, 2, 0}},
+                                                                     {{0, 2, 1}}}};
+};
+
+// clang-format on
+
+}  // namespace clock_cutout
+
+/**
+ * A regular clocking scheme whose clock numbers are determined at compile time by the given cutout (see the
+ * `clock_cutout` namespace). In contrast to `clocking_scheme`, clock number lookups are statically dispatched table
+ * accesses that can be inlined into the calling code, which avoids the indirection of a `std::function` call and the
+ * regularity check on every access. Since its clock numbers are fixed, a static clocking scheme cannot be overridden or
+ * replaced.
+ *
+ * Static clocking schemes can be plugged into `clocked_layout` via its `ClockingScheme` template parameter, e.g.,
+ *
+ * @code{.cpp}
+ * using clk_lyt = clocked_layout<tile_based_layout<cartesian_layout<>>,
+ *                                static_twoddwave_clocking<offset::ucoord_t>>;
+ * @endcode
+ *
+ * @tparam ClockZone Clock zone type. Usually, a coordinate type in a layout.
+ * @tparam Cutout Cutout type providing the repeating clock number pattern of the scheme.
+ */
+template <typename ClockZone, typename Cutout>
+class static_clocking_scheme
+{
+  public:
+    using clock_zone   = ClockZone;
+    using clock_number = uint8_t;
+    using degree       = uint8_t;
+    using cutout_type  = Cutout;
+
+    /**
+     * Returns the clock number of the given clock zone.
+     *
+     * @param cz Clock zone whose clock number is desired.
+     * @return Clock number of cz.
+     */
+    [[nodiscard]] static constexpr clock_number clock_number_of(const clock_zone& cz) noexcept
+    {
+        return Cutout::cutout[static_cast<std::size_t>(cz.y) % NUM_ROWS][static_cast<std::size_t>(cz.x) % NUM_COLUMNS];
+    }
+    /**
+     * Returns the clock number of the given clock zone.
+     *
+     * @param cz Clock zone whose clock number is desired.
+     * @return Clock number of cz.
+     */
+    constexpr clock_number operator()(const clock_zone& cz) const noexcept
+    {
+        return clock_number_of(cz);
+    }
+    /**
+     * Compares the scheme's name against a given one.
+     *
+     * @param n Name to compare.
+     * @return `true` iff the scheme's name is equal to n.
+     */
+    bool operator==(const std::string& n) const noexcept
+    {
+        return name == n;
+    }
+    /**
+     * Static clocking schemes are always regular.
+     *
+     * @return `true`.
+     */
+    [[nodiscard]] static constexpr bool is_regular() noexcept
+    {
+        return true;
+    }
+    /**
+     * Converts this scheme into an equivalent runtime clocking scheme, e.g., to override some of its clock numbers.
+     *
+     * @return Runtime clocking scheme that assigns the same clock numbers as this scheme.
+     */
+    [[nodiscard]] static clocking_scheme<clock_zone> to_clocking_scheme() noexcept
+    {
+        return clocking_scheme<clock_zone>{name, &clock_number_of, max_in_degree, max_out_degree, num_clocks, true};
+    }
+    /**
+     * Name of the clocking scheme.
+     */
+    static constexpr std::string_view name{Cutout::name};
+    /**
+     * Returns the maximum number of inputs the clocking scheme supports per clock zone on layouts of type `Lyt`, i.e.,
+     * `max_in_degree` capped at the layout's maximum fan-in size. The runtime clocking schemes use the same bound.
+     *
+     * @tparam Lyt Layout type that provides `max_fanin_size`.
+     * @return Maximum in-degree of the scheme on `Lyt`.
+     */
+    template <typename Lyt>
+    [[nodiscard]] static constexpr degree max_in_degree_on() noexcept
+    {
+        return static_cast<degree>(std::min(Lyt::max_fanin_size, static_cast<uint32_t>(max_in_degree)));
+    }
+    /**
+     * Maximum number of inputs the clocking scheme supports per clock zone, independent of the layout's fan-in size.
+     */
+    static constexpr degree max_in_degree{Cutout::max_in_degree};
+    /**
+     * Maximum number of outputs the clocking scheme supports per clock zone.
+     */
+    static constexpr degree max_out_degree{Cutout::max_out_degree};
+    /**
+     * Number of different clocks in this scheme.
+     */
+    static constexpr clock_number num_clocks{Cutout::num_clocks};
+
+  private:
+    /**
+     * Number of rows in the cutout.
+     */
+    static constexpr std::size_t NUM_ROWS{std::tuple_size_v<std::decay_t<decltype(Cutout::cutout)>>};
+    /**
+     * Number of columns in the cutout.
+     */
+    static constexpr std::size_t NUM_COLUMNS{std::tuple_size_v<std::decay_t<decltype(Cutout::cutout.front())>>};
+};
+
+template <typename ClockZone>
+using static_columnar_clocking = static_clocking_scheme<ClockZone, clock_cutout::columnar_4>;
+template <typename ClockZone>
+using static_row_clocking = static_clocking_scheme<ClockZone, clock_cutout::row_4>;
+template <typename ClockZone>
+using static_twoddwave_clocking = static_clocking_scheme<ClockZone, clock_cutout::twoddwave_4>;
+template <typename ClockZone>
+using static_use_clocking = static_clocking_scheme<ClockZone, clock_cutout::use>;
+template <typename ClockZone>
+using static_res_clocking = static_clocking_scheme<ClockZone, clock_cutout::res>;
+template <typename ClockZone>
+using static_esr_clocking = static_clocking_scheme<ClockZone, clock_cutout::esr>;
+template <typename ClockZone>
+using static_cfe_clocking = static_clocking_scheme<ClockZone, clock_cutout::cfe>;
+template <typename ClockZone>
+using static_ripple_clocking = static_clocking_scheme<ClockZone, clock_cutout::ripple>;
+template <typename ClockZone>
+using static_srs_clocking = static_clocking_scheme<ClockZone, clock_cutout::srs>;
+template <typename ClockZone>
+using static_bancs_clocking = static_clocking_scheme<ClockZone, clock_cutout::bancs>;
+
+namespace detail
+{
+/**
+ * Creates the runtime counterpart of the static clocking scheme described by `Cutout`. Name, number of clocks, and
+ * degrees are taken from the cutout, so that runtime and static schemes cannot drift apart.
+ *
+ * @tparam Lyt Clocked layout type.
+ * @tparam Cutout Cutout type providing the repeating clock number pattern of the scheme.
+ * @param f Clock function that assigns the cutout's clock numbers.
+ * @return Runtime clocking scheme equivalent to `static_clocking_scheme<clock_zone<Lyt>, Cutout>` on `Lyt`.
+ */
+template <typename Lyt, typename Cutout>
+[[nodiscard]] clocking_scheme<clock_zone<Lyt>>
+cutout_clocking(const typename clocking_scheme<clock_zone<Lyt>>::clock_function& f) noexcept
+{
+    using static_scheme = static_clocking_scheme<clock_zone<Lyt>, Cutout>;
+
+    return clocking_scheme<clock_zone<Lyt>>{static_scheme::name, f, static_scheme::template max_in_degree_on<Lyt>(),
+                                            static_scheme::max_out_degree, static_scheme::num_clocks, true};
+}
+
+}  // namespace detail
+
+#pragma region is_static_clocking_scheme
+template <typename Scheme>
+struct is_static_clocking_scheme : std::false_type
+{};
+
+template <typename ClockZone, typename Cutout>
+struct is_static_clocking_scheme<static_clocking_scheme<ClockZone, Cutout>> : std::true_type
+{};
+/**
+ * Checks whether the given type is a `static_clocking_scheme`.
+ */
+template <typename Scheme>
+inline constexpr bool is_static_clocking_scheme_v = is_static_clocking_scheme<Scheme>::value;
+#pragma endregion
+
 enum class num_clks : uint8_t
 {
     /**
@@ -229,39 +577,26 @@ static auto columnar_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function columnar_3_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 1, 2}}, {{0, 1, 2}}, {{0, 1, 2}}}};
-
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::columnar_3>::clock_number_of(cz); };
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function columnar_4_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}}, {{0, 1, 2, 3}}, {{0, 1, 2, 3}}, {{0, 1, 2, 3}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::columnar_4>::clock_number_of(cz); };
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::COLUMNAR, columnar_3_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 3u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::columnar_3>(columnar_3_clock_function);
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::COLUMNAR, columnar_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::columnar_4>(columnar_4_clock_function);
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{
-        clock_name::COLUMNAR, columnar_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::columnar_4>(columnar_4_clock_function);
 }
 /**
  * Returns a 90° rotated linear 1D clocking based on the one originally introduced in \"A device architecture for
@@ -276,38 +611,26 @@ static auto row_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_3_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 0, 0}}, {{1, 1, 1}}, {{2, 2, 2}}}};
-
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::row_3>::clock_number_of(cz); };
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_4_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 0, 0, 0}}, {{1, 1, 1, 1}}, {{2, 2, 2, 2}}, {{3, 3, 3, 3}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::row_4>::clock_number_of(cz); };
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::ROW, row_3_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 3u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::row_3>(row_3_clock_function);
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::ROW, row_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::row_4>(row_4_clock_function);
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{clock_name::ROW, row_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::row_4>(row_4_clock_function);
 }
 /**
  * Returns the 2DDWave clocking as defined in \"Clocking and Cell Placement for QCA\" by V. Vankamamidi, M. Ottavi,
@@ -322,39 +645,26 @@ static auto twoddwave_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function twoddwave_3_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 1, 2}}, {{1, 2, 0}}, {{2, 0, 1}}}};
-
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::twoddwave_3>::clock_number_of(cz); };
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function twoddwave_4_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}}, {{1, 2, 3, 0}}, {{2, 3, 0, 1}}, {{3, 0, 1, 2}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::twoddwave_4>::clock_number_of(cz); };
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::TWODDWAVE, twoddwave_3_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 3u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::twoddwave_3>(twoddwave_3_clock_function);
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::TWODDWAVE, twoddwave_4_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
+            return detail::cutout_clocking<Lyt, clock_cutout::twoddwave_4>(twoddwave_4_clock_function);
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{
-        clock_name::TWODDWAVE, twoddwave_4_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::twoddwave_4>(twoddwave_4_clock_function);
 }
 /**
  * Returns a hexagonal variation of the 2DDWave clocking as originally defined in \"Clocking and Cell Placement for
@@ -552,17 +862,9 @@ static auto use_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function use_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}},
-             {{3, 2, 1, 0}},
-             {{2, 3, 0, 1}},
-             {{1, 0, 3, 2}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::use>::clock_number_of(cz); };
 
-    return clocking_scheme{clock_name::USE, use_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::use>(use_clock_function);
 
     // clang-format on
 }
@@ -581,17 +883,9 @@ static auto res_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function res_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{3, 0, 1, 2}},
-             {{0, 1, 0, 3}},
-             {{1, 2, 3, 0}},
-             {{0, 3, 2, 1}}}};
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::res>::clock_number_of(cz); };
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
-
-    return clocking_scheme{clock_name::RES, res_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::res>(res_clock_function);
 
     // clang-format on
 }
@@ -610,17 +904,9 @@ static auto esr_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function esr_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{3, 0, 1, 2}},
-             {{0, 1, 2, 3}},
-             {{1, 2, 3, 0}},
-             {{0, 3, 2, 1}}}};
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::esr>::clock_number_of(cz); };
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
-
-    return clocking_scheme{clock_name::ESR, esr_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::esr>(esr_clock_function);
 
     // clang-format on
 }
@@ -639,17 +925,9 @@ static auto cfe_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function cfe_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 0, 1}},
-             {{3, 2, 3, 2}},
-             {{0, 1, 0, 1}},
-             {{3, 2, 3, 2}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::cfe>::clock_number_of(cz); };
 
-    return clocking_scheme{clock_name::CFE, cfe_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::cfe>(cfe_clock_function);
 
     // clang-format on
 }
@@ -665,19 +943,11 @@ static auto ripple_clocking() noexcept
 {
     // clang-format off
 
-   static const typename clocking_scheme<clock_zone<Lyt>>::clock_function ripple_clock_function =
-       [](const clock_zone<Lyt>& cz) noexcept
-   {
-       static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-           {{{0, 1, 2, 3}},
-            {{3, 2, 1, 0}},
-            {{0, 1, 2, 3}},
-            {{3, 2, 1, 0}}}};
-
-       return cutout[cz.y % 4ul][cz.x % 4ul];
-   };
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function ripple_clock_function =
+        [](const clock_zone<Lyt>& cz) noexcept
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::ripple>::clock_number_of(cz); };
 
-   return clocking_scheme{clock_name::RIPPLE, ripple_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::ripple>(ripple_clock_function);
 
     // clang-format on
 }
@@ -696,17 +966,9 @@ static auto srs_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function srs_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{1, 0, 3, 2}},
-             {{2, 3, 0, 1}},
-             {{3, 2, 3, 0}},
-             {{0, 1, 2, 1}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::srs>::clock_number_of(cz); };
 
-    return clocking_scheme{clock_name::SRS, srs_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::srs>(srs_clock_function);
 
     // clang-format on
 }
@@ -724,19 +986,9 @@ static auto bancs_clocking() noexcept
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function bancs_clock_function =
         [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 6u> cutout{
-            {{{0, 1, 2}},
-             {{2, 1, 0}},
-             {{2, 0, 1}},
-             {{1, 0, 2}},
-             {{1, 2, 0}},
-             {{0, 2, 1}}}};
+    { return static_clocking_scheme<clock_zone<Lyt>, clock_cutout::bancs>::clock_number_of(cz); };
 
-        return cutout[cz.y % 6ul][cz.x % 3ul];
-    };
-
-    return clocking_scheme{clock_name::BANCS, bancs_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 3u, true};
+    return detail::cutout_clocking<Lyt, clock_cutout::bancs>(bancs_clock_function);
 
     // clang-format on
 }
@@ -762,11 +1014,12 @@ std::shared_ptr<clocking_scheme<clock_zone<Lyt>>> ptr(clocking_scheme<clock_zone
  * - 2DDWAVEHEX
  *
  * @tparam Lyt Layout type.
+ * @tparam Scheme Clocking scheme type. Either `clocking_scheme` or a `static_clocking_scheme`.
  * @param scheme Clocking scheme to check.
  * @return `true` iff `scheme` is listed as one of the linear clocking schemes.
  */
-template <typename Lyt>
-bool is_linear_scheme(const clocking_scheme<clock_zone<Lyt>>& scheme) noexcept
+template <typename Lyt, typename Scheme = clocking_scheme<clock_zone<Lyt>>>
+bool is_linear_scheme(const Scheme& scheme) noexcept
 {
     static constexpr const std::array<const char*, 4> linear_schemes{
         {clock_name::COLUMNAR, clock_name::ROW, clock_name::TWODDWAVE, clock_name::TWODDWAVE_HEX}};
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -699,7 +700,8 @@ class gate_level_layout : public ClockedLayout
         return static_cast<signal>(get_tile(n));
     }
     /**
-     * Moves a given node to a new position and also updates its children, i.e., incoming signals.
+     * Moves a given node to a new position and also updates its children, i.e., incoming signals. Triggers the
+     * layout's `on_modified` events.
      *
      * @param n Node to move.
      * @param t Tile to move `n` to.
@@ -712,6 +714,8 @@ class gate_level_layout : public ClockedLayout
         const auto old_t = get_tile(n);
         // n's children
         auto& children = strg->nodes[n].children;
+        // n's children before the move
+        const auto previous_children = evnts->on_modified.empty() ? std::vector<signal>{} : get_children(n);
         // decrease ref-count of children
         std::for_each(children.cbegin(), children.cend(),
                       [this](const auto& c) { strg->nodes[get_node(c.index)].data[0].h1--; });
@@ -742,12 +746,17 @@ class gate_level_layout : public ClockedLayout
         std::for_each(new_children.cbegin(), new_children.cend(),
                       [this](const auto& nc) { strg->nodes[get_node(nc)].data[0].h1++; });
 
+        for (const auto& fn : evnts->on_modified)
+        {
+            (*fn)(n, previous_children);
+        }
+
         return static_cast<signal>(t);
     }
     /**
      * Connects the given signal `s` to the given node `n` as a child. The new child `s` is appended at the end of `n`'s
      * list of children. Thus, if the order of children is important, `move_node()` should be used instead. Otherwise,
-     * this function has a smaller overhead and is to be preferred.
+     * this function has a smaller overhead and is to be preferred. Triggers the layout's `on_modified` events.
      *
      * @param s New incoming signal to `n`.
      * @param n Node that should add `s` as its child.
@@ -757,7 +766,14 @@ class gate_level_layout : public ClockedLayout
     {
         if (!is_constant(n))
         {
+            const auto previous_children = evnts->on_modified.empty() ? std::vector<signal>{} : get_children(n);
+
             strg->nodes[n].children.push_back(s);
+
+            for (const auto& fn : evnts->on_modified)
+            {
+                (*fn)(n, previous_children);
+            }
         }
 
         return make_signal(n);
@@ -770,6 +786,8 @@ class gate_level_layout : public ClockedLayout
      * reduced if the tile to clear is an output tile. While this seems counter-intuitive and inconsistent, it is in
      * line with mockturtle's understanding of nodes and primary outputs.
      *
+     * Triggers the layout's `on_delete` events for the removed node before its placement information is erased.
+     *
      * @param t Tile whose nodes are to be removed.
      */
     void clear_tile(const tile& t) noexcept
@@ -815,6 +833,11 @@ class gate_level_layout : public ClockedLayout
             // mark node as dead
             kill_node(n);
 
+            for (const auto& fn : evnts->on_delete)
+            {
+                (*fn)(n);
+            }
+
             // remove node-tile
             strg->data.node_tile_map.erase(n);
             // remove tile-node
@@ -1120,7 +1143,7 @@ class gate_level_layout : public ClockedLayout
     [[nodiscard]] auto incoming_data_flow(const tile& t) const noexcept
     {
         std::vector<tile> data_flow{};
-        data_flow.reserve(ClockedLayout::get_clocking_scheme().max_in_degree);  // reserve memory
+        data_flow.reserve(ClockedLayout::max_clocked_in_degree());  // reserve memory
 
         auto fanin_collector = [&data_flow](const auto& fin) { data_flow.push_back(static_cast<tile>(fin)); };
 
@@ -1205,7 +1228,7 @@ class gate_level_layout : public ClockedLayout
     [[nodiscard]] auto outgoing_data_flow(const tile& t) const noexcept
     {
         std::vector<tile> data_flow{};
-        data_flow.reserve(RespectClocking ? ClockedLayout::get_clocking_scheme().max_out_degree :
+        data_flow.reserve(RespectClocking ? ClockedLayout::max_clocked_out_degree() :
                                             ClockedLayout::max_fanin_size);  // reserve memory
 
         const auto fanout_collector = [this, &data_flow](const auto& fout) { data_flow.push_back(get_tile(fout)); };
@@ -1772,6 +1795,19 @@ class gate_level_layout : public ClockedLayout
         return static_cast<signal>(t);
     }
 
+    [[nodiscard]] std::vector<signal> get_children(const node n) const
+    {
+        const auto& node_children = strg->nodes[n].children;
+
+        std::vector<signal> children{};
+        children.reserve(node_children.size());
+
+        std::transform(node_children.cbegin(), node_children.cend(), std::back_inserter(children),
+                       [](const auto& c) -> signal { return c.index; });
+
+        return children;
+    }
+
     [[nodiscard]] bool is_child(const node n, const signal& s) const noexcept
     {
         const auto& node_data = strg->nodes[n];
@@ -13,6 +13,7 @@
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/tracing.hpp"
 
 #include <algorithm>
 #include <array>
@@ -202,9 +203,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          */
         using distance_matrix = std::vector<std::vector<double>>;
         /**
-         * The potential matrix is a vector of vectors storing the charge-less electrostatic potentials in Volt (V).
+         * The potential matrix stores the charge-less electrostatic potentials in Volt (V) between all pairs of SiDBs
+         * in a single contiguous row-major vector, i.e., the potential between SiDBs \f$i\f$ and \f$j\f$ is stored
+         * at index \f$i \cdot n + j\f$ for \f$n\f$ SiDBs.
          */
-        using potential_matrix = std::vector<std::vector<double>>;
+        using potential_matrix = std::vector<double>;
         /**
          * It is a vector that stores the local electrostatic potential in Volt (V).
          */
@@ -254,7 +257,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          */
         distance_matrix nm_dist_mat;
         /**
-         * Electrostatic potential between SiDBs are stored as matrix (here, still charge-independent, unit: V).
+         * Electrostatic potential between SiDBs are stored as row-major matrix (charge-independent, unit: V).
          */
         potential_matrix pot_mat;
         /**
@@ -395,7 +398,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             strg{std::make_shared<charge_distribution_storage>(*cds.strg)}
     {}
     /**
-     * Copy assignment operator.
+     * Copy assignment operator. Replaces the storage of this surface by a copy of the one of `other`. Hence, views
+     * obtained via, e.g., `get_charge_state_vector` before the assignment do not reflect any subsequent changes.
      *
      * @param other charge_distribution_surface.
      */
@@ -495,6 +499,17 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         Lyt::assign_cell_type(c, ct);
         initialize(sidb_charge_state::NEGATIVE);
     }
+    /**
+     * This function assigns cell types to multiple cells of the underlying cell-level layout at once. The charge
+     * distribution surface is initialized only once after all cells have been assigned.
+     *
+     * @param cells Pairs of cells and the cell types which are assigned to them.
+     */
+    void assign_cell_types(const std::vector<std::pair<typename Lyt::cell, typename Lyt::cell_type>>& cells) noexcept
+    {
+        Lyt::assign_cell_types(cells);
+        initialize(sidb_charge_state::NEGATIVE);
+    }
     /**
      * This function assigns the physical parameters for the simulation.
      *
@@ -757,6 +772,61 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         return strg->cell_charge;
     }
+    /**
+     * Returns the SiDBs' charge states without copying them. The charge state at index \f$i\f$ belongs to the SiDB at
+     * `index_to_cell(i)`.
+     *
+     * The returned pointer shares ownership of this surface's storage and thus always stays valid, even if this surface
+     * is destroyed. It reflects all subsequent changes that are made to the existing storage, i.e., charge state
+     * assignments, potential updates, and `assign_physical_parameters`. However, the following calls replace the
+     * storage, after which the pointer keeps referring to the previous charge states and a new one has to be obtained:
+     * - `assign_cell_type` and `assign_cell_types`, which re-initialize the surface,
+     * - the copy assignment operator.
+     *
+     * @return Shared pointer to the vector of SiDB charge states.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<sidb_charge_state>> get_charge_state_vector() const noexcept
+    {
+        return {strg, &strg->cell_charge};
+    }
+    /**
+     * Returns the local internal electrostatic potentials, i.e., the potentials generated by charged SiDBs and defects,
+     * at each SiDB position in Volt (unit: V) without copying them. The potential at index \f$i\f$ belongs to the SiDB
+     * at `index_to_cell(i)`.
+     *
+     * The same lifetime guarantees as for `get_charge_state_vector` apply.
+     *
+     * @return Shared pointer to the vector of local internal potentials.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<double>> get_local_internal_potential_vector() const noexcept
+    {
+        return {strg, &strg->local_int_pot};
+    }
+    /**
+     * Returns the local external electrostatic potentials at each SiDB position in Volt (unit: V) without copying them.
+     * The potential at index \f$i\f$ belongs to the SiDB at `index_to_cell(i)`.
+     *
+     * The same lifetime guarantees as for `get_charge_state_vector` apply.
+     *
+     * @return Shared pointer to the vector of local external potentials.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<double>> get_local_external_potential_vector() const noexcept
+    {
+        return {strg, &strg->local_ext_pot};
+    }
+    /**
+     * Returns the chargeless electrostatic potentials between all pairs of SiDBs in Volt (unit: V) without copying
+     * them. The matrix is stored in row-major order, i.e., the potential between the SiDBs at indices \f$i\f$ and
+     * \f$j\f$ is located at index \f$i \cdot n + j\f$, where \f$n\f$ is the number of cells.
+     *
+     * The same lifetime guarantees as for `get_charge_state_vector` apply.
+     *
+     * @return Shared pointer to the row-major potential matrix.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<double>> get_chargeless_potential_matrix() const noexcept
+    {
+        return {strg, &strg->pot_mat};
+    }
     /**
      * This function can be used to detect which SiDBs must be negatively charged due to their location. Important:
      * This function must be applied to a charge layout where all SiDBs are negatively initialized.
@@ -864,7 +934,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return strg->pot_mat[pot_mat_row(static_cast<uint64_t>(index1)) + static_cast<uint64_t>(index2)];
         }
 
         return 0.0;
@@ -879,7 +949,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] double get_chargeless_potential_by_indices(const uint64_t index1,
                                                              const uint64_t index2) const noexcept
     {
-        return strg->pot_mat[index1][index2];
+        return strg->pot_mat[pot_mat_row(index1) + index2];
     }
     /**
      * This function calculates and returns the electrostatic potential at one cell (`c1`) generated by another cell
@@ -897,7 +967,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)] *
+            return strg->pot_mat[pot_mat_row(static_cast<uint64_t>(index1)) + static_cast<uint64_t>(index2)] *
                    charge_state_to_sign(get_charge_state(c2));
         }
 
@@ -920,10 +990,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
             for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
             {
-                double collect = 0.0;
+                const auto row     = pot_mat_row(i);
+                double     collect = 0.0;
                 for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                 {
-                    collect += strg->pot_mat[i][j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
+                    collect += strg->pot_mat[row + j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
                 }
 
                 strg->local_int_pot[i] += collect;
@@ -938,10 +1009,10 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                     const auto cell_charge = charge_state_to_sign(
                         strg->cell_charge[static_cast<uint64_t>(strg->cell_history_gray_code.first)]);
                     const auto charge_diff = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
+                    const auto row         = pot_mat_row(static_cast<uint64_t>(strg->cell_history_gray_code.first));
                     for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                     {
-                        const double pot_diff =
-                            strg->pot_mat[static_cast<uint64_t>(strg->cell_history_gray_code.first)][j] * charge_diff;
+                        const double pot_diff = strg->pot_mat[row + j] * charge_diff;
                         strg->local_int_pot[j] += pot_diff;
                     }
                 }
@@ -950,10 +1021,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             {
                 for (const auto& [changed_cell, charge] : strg->cell_history)
                 {
+                    const auto row = pot_mat_row(changed_cell);
                     for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                     {
                         const double pot_diff =
-                            strg->pot_mat[changed_cell][j] *
+                            strg->pot_mat[row + j] *
                             (static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge);
                         strg->local_int_pot[j] += pot_diff;
                     }
@@ -967,7 +1039,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void update_local_external_potential() noexcept
     {
-        strg->local_ext_pot = std::vector<double>(this->num_cells(), 0.0);
+        strg->local_ext_pot.assign(this->num_cells(), 0.0);
         strg->local_ext_pot_at_defect.clear();
 
         for (const auto& [c, external_pot] : strg->local_external_potential_map)
@@ -1237,6 +1309,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         const energy_calculation          energy_calculation_mode = energy_calculation::UPDATE_ENERGY,
         const charge_distribution_history history_mode            = charge_distribution_history::NEGLECT) noexcept
     {
+        FICTION_TRACE_ZONE("charge_distribution_surface::update_after_charge_change");
+
         this->update_local_internal_potential(history_mode);
         if (dep_cell == dependent_cell_mode::VARIABLE)
         {
@@ -1260,7 +1334,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             [this](const uint64_t c1, const uint64_t c2)  // energy change when charge hops between two SiDBs.
         {
             return strg->local_ext_pot[c1] - strg->local_ext_pot[c2] +
-                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat[c1][c2]));
+                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat[pot_mat_row(c1) + c2]));
         };
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
@@ -1592,7 +1666,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         strg->system_energy += -strg->local_int_pot[random_element];
 
-        for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
+        for (uint64_t i = 0u; i < this->num_cells(); ++i)
         {
             strg->local_int_pot[i] += -this->get_chargeless_potential_by_indices(i, random_element);
         }
@@ -2188,7 +2262,9 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     storage strg;
 
     /**
-     * Initialization function used for the construction of the charge distribution surface.
+     * Initialization function used for the construction of the charge distribution surface. The storage is replaced by
+     * a new one such that views obtained via, e.g., `get_charge_state_vector` remain valid but do not reflect the
+     * re-initialized surface.
      *
      * @param cs Charge state to assign to all SiDBs.
      * @param configuration Specifies the configuration for charge distribution settings.
@@ -2222,6 +2298,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         this->initialize_nm_distance_matrix();
         this->initialize_potential_matrix();
         strg->local_pot_caused_by_defects.resize(this->num_cells(), 0);
+        strg->local_ext_pot.resize(this->num_cells(), 0);
         this->update_local_internal_potential();
         if constexpr (is_sidb_defect_surface_v<Lyt>)
         {
@@ -2286,17 +2363,29 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void initialize_potential_matrix() noexcept
     {
-        strg->pot_mat =
-            std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
+        // when called by assign_physical_parameters, the size does not change; hence, assigning instead of
+        // reallocating keeps the data of views obtained via get_chargeless_potential_matrix in place
+        strg->pot_mat.assign(this->num_cells() * this->num_cells(), 0.0);
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
         {
+            const auto row = pot_mat_row(i);
             for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
             {
-                strg->pot_mat[i][j] = calculate_chargeless_potential_between_sidbs_by_index(i, j);
+                strg->pot_mat[row + j] = calculate_chargeless_potential_between_sidbs_by_index(i, j);
             }
         }
     }
+    /**
+     * Returns the offset of the given SiDB's row in the row-major potential matrix.
+     *
+     * @param index The index of the SiDB.
+     * @return Index of the first entry of the row that belongs to the SiDB at `index`.
+     */
+    [[nodiscard]] uint64_t pot_mat_row(const uint64_t index) const noexcept
+    {
+        return index * this->num_cells();
+    }
 
     /**
      *  The stored unique index is converted to a charge distribution.
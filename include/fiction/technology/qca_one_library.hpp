@@ -15,6 +15,8 @@
 #include <mockturtle/traits.hpp>
 #include <phmap.h>
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace fiction
@@ -118,32 +120,38 @@ class qca_one_library : public fcn_gate_library<qca_technology, 5, 5>
     template <typename CellLyt>
     static void post_layout_optimization(CellLyt& lyt) noexcept
     {
-        lyt.foreach_cell_position(
-            [&lyt](const auto& c)
+        // gather all non-empty crossing cells first because via ground cells are added to the layout below; visiting
+        // only occupied cells keeps the optimization proportional to the number of cells instead of the layout area
+        std::vector<cell<CellLyt>> crossing_cells{};
+
+        lyt.foreach_cell(
+            [&lyt, &crossing_cells](const auto& c)
             {
                 if (lyt.is_crossing_layer(c))
                 {
-                    if (!lyt.is_empty_cell(c))
-                    {
-                        // gather adjacent cell positions
-                        auto adjacent_cells = lyt.adjacent_coordinates(c);
-                        // remove all empty cells
-                        adjacent_cells.erase(std::remove_if(adjacent_cells.begin(), adjacent_cells.end(),
-                                                            [&lyt](const auto& ac) { return lyt.is_empty_cell(ac); }),
-                                             adjacent_cells.end());
-                        // if there is at most one neighbor left
-                        if (std::distance(adjacent_cells.cbegin(), adjacent_cells.cend()) <= 1)
-                        {
-                            // change cell mode to via
-                            lyt.assign_cell_mode(c, qca_technology::cell_mode::VERTICAL);
-                            // create a corresponding via ground cell
-                            const cell<CellLyt> ground_via_cell{c.x, c.y, 0};
-                            lyt.assign_cell_type(ground_via_cell, qca_technology::cell_type::NORMAL);
-                            lyt.assign_cell_mode(ground_via_cell, qca_technology::cell_mode::VERTICAL);
-                        }
-                    }
+                    crossing_cells.push_back(c);
                 }
             });
+
+        for (const auto& c : crossing_cells)
+        {
+            // gather adjacent cell positions
+            auto adjacent_cells = lyt.adjacent_coordinates(c);
+            // remove all empty cells
+            adjacent_cells.erase(std::remove_if(adjacent_cells.begin(), adjacent_cells.end(),
+                                                [&lyt](const auto& ac) { return lyt.is_empty_cell(ac); }),
+                                 adjacent_cells.end());
+            // if there is at most one neighbor left
+            if (std::distance(adjacent_cells.cbegin(), adjacent_cells.cend()) <= 1)
+            {
+                // change cell mode to via
+                lyt.assign_cell_mode(c, qca_technology::cell_mode::VERTICAL);
+                // create a corresponding via ground cell
+                const cell<CellLyt> ground_via_cell{c.x, c.y, 0};
+                lyt.assign_cell_type(ground_via_cell, qca_technology::cell_type::NORMAL);
+                lyt.assign_cell_mode(ground_via_cell, qca_technology::cell_mode::VERTICAL);
+            }
+        }
     }
 
   private:
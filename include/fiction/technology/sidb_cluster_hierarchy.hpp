@@ -1030,13 +1030,17 @@ struct sidb_cluster
     partial_potential_bounds_store received_ext_pot_bounds{};
     /**
      * The bounds on the electrostatic potential that is projected from this cluster for the different multiset charge
-     * configurations in the charge space.
+     * configurations in the charge space. The potential projection orders are stored contiguously and are indexed by
+     * the receiving SiDB, such that the potential projections onto distinct SiDBs may also be modified concurrently.
+     */
+    std::vector<potential_projection_order> pot_projs;
+    /**
+     * The bounds on the electrostatic potential that is projected from this cluster onto each SiDB in the layout, for
+     * each multiset charge configuration in the (then fixed) charge space.
      */
 #ifdef DEBUG_SIDB_CLUSTER_HIERARCHY
-    std::map<sidb_ix, potential_projection_order>      pot_projs;
     std::map<sidb_ix, complete_potential_bounds_store> pot_projs_complete_store;
 #else
-    phmap::flat_hash_map<sidb_ix, potential_projection_order>      pot_projs;
     phmap::flat_hash_map<sidb_ix, complete_potential_bounds_store> pot_projs_complete_store;
 #endif
     /**
@@ -0,0 +1,394 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_SIDB_GATE_DESIGN_CACHE_HPP
+#define FICTION_SIDB_GATE_DESIGN_CACHE_HPP
+
+#include "fiction/algorithms/physical_design/design_sidb_gates.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/phmap_utils.hpp"
+
+#include <fmt/format.h>
+#include <kitty/print.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A thread-safe cache of SiDB gate designs that can be shared across tiles, layouts, and program runs.
+ *
+ * Designing an SiDB gate on-the-fly requires a costly search over canvas SiDB placements. However, many tiles of a
+ * layout share the same skeleton, Boolean function, and design parameters, and on defective surfaces, tiles frequently
+ * observe the same set of atomic defects relative to their own origin. Each design task is therefore identified by a
+ * canonical key (see `sidb_gate_design_cache::key`) that consists of the sorted skeleton cells, the sorted defects in
+ * tile-relative coordinates, the specification, and all parameters that influence the design outcome. Since the
+ * defects are cropped to an influence radius before the key is computed, any two tiles whose surroundings are
+ * indistinguishable to the design algorithm map to the same entry.
+ *
+ * Negative results, i.e., design tasks for which no gate exists, are cached as well such that impossible designs are
+ * not attempted repeatedly.
+ *
+ * The cache can be persisted to and restored from a plain text file to reuse designs across runs.
+ */
+class sidb_gate_design_cache
+{
+  public:
+    /**
+     * A cached design result. If `designable` is `false`, no gate exists for the associated design task.
+     */
+    struct entry
+    {
+        /**
+         * Flag that indicates whether a gate design was found.
+         */
+        bool designable{false};
+        /**
+         * The designed gate's cells in row-major order, represented by their cell type characters. Empty if
+         * `designable` is `false`.
+         */
+        std::string cells{};
+    };
+    /**
+     * Default constructor. Creates an empty cache.
+     */
+    sidb_gate_design_cache() = default;
+    /**
+     * Constructs an empty cache for gates that consist of the given number of cells.
+     *
+     * @param gate_cells Number of cells of each cached gate, e.g., `gate_x_size() * gate_y_size()` of the gate library
+     * that uses the cache. If 0, gates of any size are accepted.
+     */
+    explicit sidb_gate_design_cache(const std::size_t gate_cells) noexcept : num_gate_cells{gate_cells} {}
+    /**
+     * Constructs a cache and restores the entries stored in the given file, if it exists.
+     *
+     * @param filename Path to a file previously written via `save`.
+     * @param gate_cells Number of cells of each cached gate. If 0, gates of any size are accepted.
+     */
+    explicit sidb_gate_design_cache(const std::string& filename, const std::size_t gate_cells = 0) :
+            num_gate_cells{gate_cells}
+    {
+        load(filename);
+    }
+    /**
+     * Computes the canonical key that identifies a gate design task.
+     *
+     * @tparam Lyt SiDB cell-level layout type (possibly with atomic defects).
+     * @tparam TT Truth table type.
+     * @param skeleton Skeleton of the gate with defects in tile-relative coordinates, if any.
+     * @param spec Expected Boolean function of the gate given as a multi-output truth table.
+     * @param params Parameters used for the gate design.
+     * @return A string that is equal for two design tasks if and only if they yield the same design result.
+     */
+    template <typename Lyt, typename TT>
+    [[nodiscard]] static std::string key(const Lyt& skeleton, const std::vector<TT>& spec,
+                                         const design_sidb_gates_params<cell<Lyt>>& params)
+    {
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+        fmt::memory_buffer buffer{};
+
+        std::vector<std::tuple<int64_t, int64_t, int64_t, char>> cells{};
+        cells.reserve(skeleton.num_cells());
+
+        skeleton.foreach_cell(
+            [&skeleton, &cells](const auto& c)
+            {
+                cells.emplace_back(static_cast<int64_t>(c.x), static_cast<int64_t>(c.y), static_cast<int64_t>(c.z),
+                                   static_cast<char>(skeleton.get_cell_type(c)));
+            });
+
+        std::sort(cells.begin(), cells.end());
+
+        for (const auto& [x, y, z, type] : cells)
+        {
+            fmt::format_to(std::back_inserter(buffer), "{},{},{},{};", x, y, z, type);
+        }
+
+        buffer.push_back('|');
+
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            std::vector<std::string> defects{};
+
+            skeleton.foreach_sidb_defect(
+                [&defects](const auto& cd)
+                {
+                    const auto& [c, d] = cd;
+                    defects.emplace_back(fmt::format("{},{},{},{},{},{},{};", c.x, c.y, c.z,
+                                                     static_cast<uint16_t>(d.type), d.charge, d.epsilon_r,
+                                                     d.lambda_tf));
+                });
+
+            std::sort(defects.begin(), defects.end());
+
+            for (const auto& d : defects)
+            {
+                fmt::format_to(std::back_inserter(buffer), "{}", d);
+            }
+        }
+
+        buffer.push_back('|');
+
+        for (const auto& tt : spec)
+        {
+            fmt::format_to(std::back_inserter(buffer), "{}:{};", tt.num_vars(), kitty::to_hex(tt));
+        }
+
+        const auto& op  = params.operational_params;
+        const auto& sim = op.simulation_parameters;
+        const auto& bdl = op.input_bdl_iterator_params.bdl_wire_params;
+
+        fmt::format_to(std::back_inserter(buffer), "|{},{},{},{}|{}|{},{},{},{}|{}|{}|{}", sim.epsilon_r,
+                       sim.lambda_tf, sim.mu_minus, sim.base, static_cast<uint16_t>(op.sim_engine),
+                       bdl.threshold_bdl_interdistance, bdl.bdl_pairs_params.minimum_distance,
+                       bdl.bdl_pairs_params.maximum_distance,
+                       static_cast<uint16_t>(op.input_bdl_iterator_params.input_bdl_config),
+                       static_cast<uint16_t>(op.op_condition),
+                       static_cast<uint16_t>(op.strategy_to_analyze_operational_status),
+                       static_cast<uint16_t>(params.design_mode));
+
+        fmt::format_to(std::back_inserter(buffer), "|{},{},{},{},{},{}|{}|{}", params.canvas.first.x,
+                       params.canvas.first.y, params.canvas.first.z, params.canvas.second.x, params.canvas.second.y,
+                       params.canvas.second.z, params.number_of_canvas_sidbs,
+                       static_cast<uint16_t>(params.termination_cond));
+
+        return fmt::to_string(buffer);
+    }
+    /**
+     * Looks up the design result of the task identified by the given key and updates the hit/miss counters.
+     *
+     * @param k Canonical key of the design task.
+     * @return The cached result or `std::nullopt` if the task has not been cached yet.
+     */
+    [[nodiscard]] std::optional<entry> lookup(const std::string& k) const noexcept
+    {
+        std::optional<entry> result{};
+
+        cache.if_contains(k, [&result](const auto& kv) { result = kv.second; });
+
+        if (result.has_value())
+        {
+            ++num_hits;
+        }
+        else
+        {
+            ++num_misses;
+        }
+
+        return result;
+    }
+    /**
+     * Stores the design result of the task identified by the given key. Existing entries are kept.
+     *
+     * @param k Canonical key of the design task.
+     * @param e Design result.
+     */
+    void insert(const std::string& k, const entry& e) noexcept
+    {
+        cache.try_emplace_l(k, [](const auto&) {}, e);
+    }
+    /**
+     * Returns the number of cached design results.
+     *
+     * @return Number of cache entries.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return cache.size();
+    }
+    /**
+     * Returns the number of successful lookups.
+     *
+     * @return Number of cache hits.
+     */
+    [[nodiscard]] std::size_t hits() const noexcept
+    {
+        return num_hits.load();
+    }
+    /**
+     * Returns the number of unsuccessful lookups.
+     *
+     * @return Number of cache misses.
+     */
+    [[nodiscard]] std::size_t misses() const noexcept
+    {
+        return num_misses.load();
+    }
+    /**
+     * Removes all entries and resets the hit/miss and malformed line counters.
+     */
+    void clear() noexcept
+    {
+        cache.clear();
+        num_hits      = 0;
+        num_misses    = 0;
+        num_malformed = 0;
+    }
+    /**
+     * Writes all entries to the given file. Each entry is stored on a separate line consisting of its key, a tab
+     * character, and either the gate's cells or `-` if the design task is impossible.
+     *
+     * @param filename Path to the file to write.
+     * @return `true` iff the file could be written.
+     */
+    bool save(const std::string& filename) const
+    {
+        std::ofstream file{filename, std::ios::out | std::ios::trunc};
+
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file << FILE_HEADER << '\n';
+
+        cache.for_each([&file](const auto& kv)
+                       { file << kv.first << '\t' << (kv.second.designable ? kv.second.cells : "-") << '\n'; });
+
+        return file.good();
+    }
+    /**
+     * Restores entries from the given file that was previously written via `save`. Entries that already exist in the
+     * cache are kept. Malformed lines are skipped and counted (see `num_malformed_lines`). A line is malformed if it
+     * lacks a key or if its gate contains characters other than SiDB cell types or does not consist of the number of
+     * cells that was passed on construction.
+     *
+     * @param filename Path to the file to read.
+     * @return `true` iff the file exists and has the expected format.
+     */
+    bool load(const std::string& filename)
+    {
+        std::ifstream file{filename, std::ios::in};
+
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::string line{};
+
+        if (!std::getline(file, line) || line != FILE_HEADER)
+        {
+            return false;
+        }
+
+        while (std::getline(file, line))
+        {
+            const auto separator = line.find('\t');
+
+            if (separator == std::string::npos || separator == 0)
+            {
+                ++num_malformed;
+
+                continue;
+            }
+
+            auto value = line.substr(separator + 1);
+
+            if (value == "-")
+            {
+                insert(line.substr(0, separator), entry{false, {}});
+            }
+            else if (is_valid_gate(value))
+            {
+                insert(line.substr(0, separator), entry{true, std::move(value)});
+            }
+            else
+            {
+                ++num_malformed;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Returns the number of lines that were skipped by `load` because they were malformed.
+     *
+     * @return Number of malformed lines.
+     */
+    [[nodiscard]] std::size_t num_malformed_lines() const noexcept
+    {
+        return num_malformed;
+    }
+
+  private:
+    /**
+     * First line of every cache file. Bump the version whenever the key or value format changes.
+     */
+    static constexpr const char* FILE_HEADER = "fiction sidb gate design cache v1";
+    /**
+     * Number of cells of each cached gate. 0 accepts gates of any size.
+     */
+    std::size_t num_gate_cells{0};
+    /**
+     * Number of lines that were skipped by `load`.
+     */
+    std::size_t num_malformed{0};
+    /**
+     * Maps canonical design task keys to their design results.
+     */
+    locked_parallel_flat_hash_map<std::string, entry> cache{};
+    /**
+     * Number of successful lookups.
+     */
+    mutable std::atomic<std::size_t> num_hits{0};
+    /**
+     * Number of unsuccessful lookups.
+     */
+    mutable std::atomic<std::size_t> num_misses{0};
+    /**
+     * Checks whether the given cells represent a gate, i.e., whether they are non-empty, consist of the expected number
+     * of cells, and contain SiDB cell types only.
+     *
+     * @param cells Cells of a gate as stored in a cache file.
+     * @return `true` iff `cells` can be restored to a gate.
+     */
+    [[nodiscard]] bool is_valid_gate(const std::string& cells) const noexcept
+    {
+        if (cells.empty() || (num_gate_cells != 0 && cells.size() != num_gate_cells))
+        {
+            return false;
+        }
+
+        return std::all_of(cells.cbegin(), cells.cend(),
+                           [](const char c)
+                           {
+                               switch (static_cast<sidb_technology::cell_type>(c))
+                               {
+                                   case sidb_technology::cell_type::EMPTY:
+                                   case sidb_technology::cell_type::NORMAL:
+                                   case sidb_technology::cell_type::INPUT:
+                                   case sidb_technology::cell_type::OUTPUT:
+                                   case sidb_technology::cell_type::LOGIC:
+                                   {
+                                       return true;
+                                   }
+                                   default:
+                                   {
+                                       return false;
+                                   }
+                               }
+                           });
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_GATE_DESIGN_CACHE_HPP
@@ -12,6 +12,7 @@
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/fcn_gate_library.hpp"
 #include "fiction/technology/is_sidb_gate_design_impossible.hpp"
+#include "fiction/technology/sidb_gate_design_cache.hpp"
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
@@ -25,8 +26,10 @@
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -136,6 +139,14 @@ struct sidb_on_the_fly_gate_library_params
      * incorporated into the gate design.
      */
     double influence_radius_charged_defects = 15;  // (unit: nm)
+    /**
+     * Optional cache of gate designs. If set, each gate design task is looked up in the cache before it is attempted
+     * and its result, including the absence of a design, is stored afterward. Since the cache is held by a shared
+     * pointer, it is shared by all copies of these parameters and can thereby be reused across tiles, layouts, and,
+     * via `sidb_gate_design_cache::save` and `sidb_gate_design_cache::load`, program runs. Cached gates whose size does
+     * not match the library's tile size are ignored.
+     */
+    std::shared_ptr<sidb_gate_design_cache> gate_design_cache{};
 };
 
 /**
@@ -698,34 +709,49 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
         static_assert(has_sidb_technology_v<CellLyt>, "CellLyt is not an SiDB layout");
         static_assert(has_cube_coord_v<CellLyt>, "CellLyt is not based on cube coordinates");
 
-        const auto params = is_sidb_gate_design_impossible_params{
-            parameters.design_gate_params.operational_params.simulation_parameters};
+        // crossings and double wires are reported via the identity function
+        const auto error_tt =
+            spec == create_crossing_wire_tt() || spec == create_double_wire_tt() ? create_id_tt() : spec.front();
+
+        const auto& cache = parameters.gate_design_cache;
 
-        if (spec == create_crossing_wire_tt() || spec == create_double_wire_tt())
+        std::string cache_key{};
+
+        if (cache)
         {
-            if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
+            cache_key = sidb_gate_design_cache::key(skeleton, spec, parameters.design_gate_params);
+
+            // gates of a different size, e.g., from a cache that is shared with another library, are designed anew
+            if (const auto cached = cache->lookup(cache_key);
+                cached.has_value() && (!cached->designable || cached->cells.size() == gate_x_size() * gate_y_size()))
             {
-                if (is_sidb_gate_design_impossible(skeleton, spec, params))
+                if (!cached->designable)
                 {
-                    throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                    throw gate_design_exception<tt, GateLyt>(tile, error_tt, p);
                 }
-            }
 
-            const auto found_gate_layouts = design_sidb_gates(skeleton, spec, parameters.design_gate_params);
+                return string_to_gate(cached->cells);
+            }
+        }
 
-            if (found_gate_layouts.empty())
+        const auto design_failed = [&cache, &cache_key, &tile, &error_tt, &p]
+        {
+            if (cache)
             {
-                throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                cache->insert(cache_key, {false, {}});
             }
 
-            return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
-        }
+            throw gate_design_exception<tt, GateLyt>(tile, error_tt, p);
+        };
 
         if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
         {
-            if (is_sidb_gate_design_impossible(skeleton, spec, params))
+            if (is_sidb_gate_design_impossible(
+                    skeleton, spec,
+                    is_sidb_gate_design_impossible_params{
+                        parameters.design_gate_params.operational_params.simulation_parameters}))
             {
-                throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
+                design_failed();
             }
         }
 
@@ -733,10 +759,60 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
 
         if (found_gate_layouts.empty())
         {
-            throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
+            design_failed();
+        }
+
+        const auto gate = cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
+
+        if (cache)
+        {
+            cache->insert(cache_key, {true, gate_to_string(gate)});
+        }
+
+        return gate;
+    }
+    /**
+     * Serializes the cells of a gate in row-major order to a string of cell type characters.
+     *
+     * @param gate The gate to serialize.
+     * @return String of length `gate_x_size() * gate_y_size()`.
+     */
+    [[nodiscard]] static std::string gate_to_string(const fcn_gate& gate) noexcept
+    {
+        std::string cells{};
+        cells.reserve(gate_x_size() * gate_y_size());
+
+        for (const auto& row : gate)
+        {
+            for (const auto& c : row)
+            {
+                cells.push_back(static_cast<char>(c));
+            }
+        }
+
+        return cells;
+    }
+    /**
+     * Deserializes a gate from a string created by `gate_to_string`.
+     *
+     * @param cells String of cell type characters in row-major order.
+     * @return The gate represented by `cells`.
+     */
+    [[nodiscard]] static fcn_gate string_to_gate(const std::string& cells) noexcept
+    {
+        assert(cells.size() == gate_x_size() * gate_y_size() && "cached gate has an unexpected size");
+
+        fcn_gate gate{};
+
+        for (std::size_t i = 0; i < gate_y_size(); ++i)
+        {
+            for (std::size_t j = 0; j < gate_x_size(); ++j)
+            {
+                gate[i][j] = static_cast<sidb_technology::cell_type>(cells[i * gate_x_size() + j]);
+            }
         }
 
-        return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
+        return gate;
     }
     /**
      * The function generates a layout where each cell is assigned a specific
@@ -0,0 +1,305 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_CHECKPOINT_UTILS_HPP
+#define FICTION_CHECKPOINT_UTILS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace fiction
+{
+
+/**
+ * Replaces the contents of the given file such that it either holds its previous or its new contents, even if the
+ * process is terminated while writing. To this end, the contents are first written to a temporary file next to the
+ * target, which is subsequently renamed to the target.
+ *
+ * If several processes may write the same file concurrently, each of them has to pass a distinct `tmp_suffix`.
+ * Otherwise, they would interleave their writes to the same temporary file.
+ *
+ * @tparam WriteFn Functor type that writes the contents to a `std::ostream&`.
+ * @param filename Path of the file to replace.
+ * @param write Functor that writes the new contents.
+ * @param tmp_suffix Suffix that is appended to `filename` to obtain the name of the temporary file.
+ * @return `true` iff the file was written successfully.
+ */
+template <typename WriteFn>
+bool write_file_atomically(const std::string& filename, WriteFn&& write,
+                           const std::string& tmp_suffix = ".tmp") noexcept
+{
+    const auto tmp_filename = filename + tmp_suffix;
+
+    try
+    {
+        {
+            std::ofstream os{tmp_filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc};
+
+            if (!os.is_open())
+            {
+                return false;
+            }
+
+            std::forward<WriteFn>(write)(static_cast<std::ostream&>(os));
+
+            os.flush();
+
+            if (!os.good())
+            {
+                return false;
+            }
+        }
+
+        std::error_code ec{};
+        std::filesystem::rename(tmp_filename, filename, ec);
+
+        return !ec;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+/**
+ * Computes a fingerprint of the given description of a computation's inputs, e.g., of a layout and all parameters. The
+ * fingerprint is the 64-bit FNV-1a hash of the description, which, unlike `std::hash`, is identical across platforms
+ * and program runs. Hence, it can be compared to fingerprints that were persisted in checkpoint files.
+ *
+ * @param description Description of the inputs.
+ * @param fingerprint Initial value, e.g., the fingerprint of preceding inputs to continue from.
+ * @return Fingerprint of `description`.
+ */
+[[nodiscard]] constexpr uint64_t fingerprint_inputs(const std::string_view& description,
+                                                    uint64_t fingerprint = 0xcbf29ce484222325ull) noexcept
+{
+    for (const auto c : description)
+    {
+        fingerprint ^= static_cast<uint8_t>(c);
+        fingerprint *= 0x100000001b3ull;
+    }
+
+    return fingerprint;
+}
+/**
+ * Periodically persists the progress of a long-running computation, e.g., a parameter sweep, to a checkpoint file and
+ * restores it from there when the computation is restarted. All member functions are thread-safe.
+ *
+ * Each evaluated work item is reported via `record`. Every `interval` reported items, the checkpoint is written by
+ * the reporting thread. Since writes are atomic (see `write_file_atomically`), an interrupted computation always
+ * leaves the latest complete checkpoint behind. If another thread is currently writing, the reporting thread does not
+ * wait but continues with its work.
+ *
+ * Each checkpoint file starts with a line that holds a fingerprint of the computation's inputs, e.g., of the layout
+ * and all parameters (see `fingerprint_inputs`), followed by the contents written by the computation. A checkpoint is
+ * only restored if its fingerprint matches the one of the current computation. This prevents resuming a computation
+ * from the results of a different one.
+ */
+class periodic_checkpoint
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param file Path of the checkpoint file. If empty, checkpointing is disabled.
+     * @param interval Number of recorded work items after which the checkpoint is written.
+     * @param input_fingerprint Fingerprint of the computation's inputs.
+     */
+    periodic_checkpoint(std::string file, const std::size_t interval, const uint64_t input_fingerprint = 0) noexcept :
+            filename{std::move(file)},
+            write_interval{interval == 0 ? 1 : interval},
+            fingerprint{input_fingerprint}
+    {}
+    /**
+     * Checks whether checkpointing is enabled.
+     *
+     * @return `true` iff a checkpoint file was specified.
+     */
+    [[nodiscard]] bool enabled() const noexcept
+    {
+        return !filename.empty();
+    }
+    /**
+     * Restores the checkpoint by passing the checkpoint file, positioned after the fingerprint, to the given functor,
+     * if the file exists.
+     *
+     * @tparam ReadFn Functor type that reads a checkpoint from a `std::istream&`.
+     * @param read Functor that reads the checkpoint.
+     * @return `true` iff a checkpoint file existed and was read.
+     * @throws std::ifstream::failure if the checkpoint file could not be opened.
+     * @throws std::invalid_argument if the checkpoint file lacks a fingerprint or was created by a computation with a
+     * different fingerprint.
+     */
+    template <typename ReadFn>
+    bool restore(ReadFn&& read) const
+    {
+        if (!enabled() || !std::filesystem::exists(filename))
+        {
+            return false;
+        }
+
+        std::ifstream is{filename, std::ifstream::in | std::ifstream::binary};
+
+        if (!is.is_open())
+        {
+            throw std::ifstream::failure("could not open checkpoint file");
+        }
+
+        std::string line{};
+
+        if (!std::getline(is, line) || line.rfind(FINGERPRINT_PREFIX, 0) != 0)
+        {
+            throw std::invalid_argument("the checkpoint file lacks a fingerprint");
+        }
+
+        if (line != fingerprint_line())
+        {
+            throw std::invalid_argument("the checkpoint file was created by a different computation");
+        }
+
+        std::forward<ReadFn>(read)(static_cast<std::istream&>(is));
+
+        return true;
+    }
+    /**
+     * Reports a completed work item and writes the checkpoint via the given functor if it is due.
+     *
+     * @tparam WriteFn Functor type that writes the checkpoint to a `std::ostream&`.
+     * @param write Functor that writes the checkpoint.
+     */
+    template <typename WriteFn>
+    void record(WriteFn&& write) noexcept
+    {
+        if (!enabled() || ++num_pending < write_interval)
+        {
+            return;
+        }
+
+        const std::unique_lock lock{write_mutex, std::try_to_lock};
+
+        // another thread is already writing a checkpoint
+        if (!lock.owns_lock())
+        {
+            return;
+        }
+
+        num_pending = 0;
+
+        write_locked(std::forward<WriteFn>(write));
+    }
+    /**
+     * Writes the checkpoint via the given functor regardless of the number of recorded work items.
+     *
+     * @tparam WriteFn Functor type that writes the checkpoint to a `std::ostream&`.
+     * @param write Functor that writes the checkpoint.
+     * @return `true` iff the checkpoint was written successfully.
+     */
+    template <typename WriteFn>
+    bool save(WriteFn&& write) noexcept
+    {
+        if (!enabled())
+        {
+            return false;
+        }
+
+        const std::lock_guard lock{write_mutex};
+
+        num_pending = 0;
+
+        return write_locked(std::forward<WriteFn>(write));
+    }
+    /**
+     * Returns the number of checkpoints that were written successfully.
+     *
+     * @return Number of written checkpoints.
+     */
+    [[nodiscard]] std::size_t num_checkpoints() const noexcept
+    {
+        return num_written.load();
+    }
+
+  private:
+    /**
+     * Beginning of the first line of every checkpoint file.
+     */
+    static constexpr const char* FINGERPRINT_PREFIX = "fiction checkpoint ";
+    /**
+     * Path of the checkpoint file.
+     */
+    const std::string filename;
+    /**
+     * Number of recorded work items after which the checkpoint is written.
+     */
+    const std::size_t write_interval;
+    /**
+     * Fingerprint of the computation's inputs.
+     */
+    const uint64_t fingerprint;
+    /**
+     * Number of work items recorded since the last checkpoint.
+     */
+    std::atomic<std::size_t> num_pending{0};
+    /**
+     * Number of checkpoints written successfully.
+     */
+    std::atomic<std::size_t> num_written{0};
+    /**
+     * Serializes writes to the checkpoint file.
+     */
+    std::mutex write_mutex{};
+    /**
+     * Writes the checkpoint. Must be called while holding `write_mutex`.
+     *
+     * @tparam WriteFn Functor type that writes the checkpoint to a `std::ostream&`.
+     * @param write Functor that writes the checkpoint.
+     * @return `true` iff the checkpoint was written successfully.
+     */
+    template <typename WriteFn>
+    bool write_locked(WriteFn&& write) noexcept
+    {
+        const auto write_with_fingerprint = [this, &write](std::ostream& os)
+        {
+            os << fingerprint_line() << '\n';
+
+            std::forward<WriteFn>(write)(os);
+        };
+
+        if (write_file_atomically(filename, write_with_fingerprint))
+        {
+            ++num_written;
+
+            return true;
+        }
+
+        return false;
+    }
+    /**
+     * Returns the first line of the checkpoint file, which holds the fingerprint.
+     *
+     * @return The fingerprint line without its line break.
+     */
+    [[nodiscard]] std::string fingerprint_line() const
+    {
+        std::ostringstream oss{};
+        oss << FINGERPRINT_PREFIX << std::hex << std::setw(16) << std::setfill('0') << fingerprint;
+
+        return oss.str();
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_CHECKPOINT_UTILS_HPP
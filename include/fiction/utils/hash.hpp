@@ -7,8 +7,10 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <set>
+#include <string_view>
 #include <utility>
 
 namespace fiction
@@ -32,6 +34,25 @@ void hash_combine(std::size_t& seed, const T& v, const Rest&... rest)
     seed ^= std::hash<T>{}(v) + 0x9e3779b9 + (seed << 6u) + (seed >> 2u);
     (hash_combine(seed, rest), ...);
 }
+/**
+ * Computes the 64-bit FNV-1a hash of the given data. Unlike `std::hash`, the result is identical across platforms and
+ * program runs, which makes it suitable for checksums and cache keys that are persisted in files.
+ *
+ * @param data Data to hash.
+ * @param hash Initial hash value, e.g., the hash of preceding data to continue from.
+ * @return Hash of `data`.
+ */
+[[nodiscard]] constexpr uint64_t fnv1a_hash(const std::string_view& data,
+                                            uint64_t                hash = 0xcbf29ce484222325ull) noexcept
+{
+    for (const auto c : data)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
 
 }  // namespace fiction
 
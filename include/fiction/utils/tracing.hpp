@@ -0,0 +1,672 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_TRACING_HPP
+#define FICTION_TRACING_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Kinds of events that are recorded by the `trace_recorder`. The values correspond to the phase identifiers of the
+ * Chrome trace event format.
+ */
+enum class trace_event_type : char
+{
+    /**
+     * A zone, i.e., a named time interval on a thread.
+     */
+    ZONE = 'X',
+    /**
+     * A sample of a named counter.
+     */
+    COUNTER = 'C'
+};
+/**
+ * A single recorded event. Names are not copied and must therefore refer to strings with static storage duration,
+ * e.g., string literals.
+ */
+struct trace_event
+{
+    /**
+     * Name of the zone or counter.
+     */
+    const char* name;
+    /**
+     * Kind of the event.
+     */
+    trace_event_type type;
+    /**
+     * Start of the zone or time of the counter sample relative to the start of the recording.
+     */
+    std::chrono::nanoseconds timestamp;
+    /**
+     * Duration of the zone. Unused for counters.
+     */
+    std::chrono::nanoseconds duration;
+    /**
+     * Value of the counter sample. Unused for zones.
+     */
+    int64_t value;
+};
+/**
+ * Aggregated timing information of all zones that share a name.
+ */
+struct trace_zone_statistics
+{
+    /**
+     * Number of times the zone was entered.
+     */
+    std::size_t count{0};
+    /**
+     * Total time spent in the zone, summed over all threads.
+     */
+    std::chrono::nanoseconds total_duration{0};
+};
+/**
+ * Records zones and counters of instrumented code, aggregates them per name, and exports them in the Chrome trace
+ * event format, which can be inspected with `chrome://tracing` or Perfetto (https://ui.perfetto.dev).
+ *
+ * Each thread records into its own buffer to keep the overhead low in parallel code. When a thread terminates, its
+ * buffer including the recorded events is handed over to the next thread that starts recording, such that the number
+ * of buffers is bounded by the maximum number of simultaneously recording threads. Since instrumented hot paths may be
+ * executed billions of times during a long-running computation, the total number of individually stored events is
+ * limited. Once the limit is reached, further events are dropped but still accounted for in the aggregated zone
+ * statistics.
+ *
+ * The recorder is a process-wide singleton that is inactive until `start` is called. Instrumentation is added via
+ * the macros `FICTION_TRACE_ZONE` and `FICTION_TRACE_COUNTER`, which expand to nothing unless the code is compiled
+ * with `FICTION_TRACING` defined (CMake option `FICTION_ENABLE_TRACING`). Hence, tracing has no overhead at all in
+ * regular builds and costs a single atomic load per zone while compiled in but inactive.
+ */
+class trace_recorder
+{
+  public:
+    /**
+     * Returns the process-wide recorder.
+     *
+     * @return The trace recorder.
+     */
+    [[nodiscard]] static trace_recorder& instance() noexcept
+    {
+        static trace_recorder recorder{};
+
+        return recorder;
+    }
+    /**
+     * Copy constructor is deleted.
+     */
+    trace_recorder(const trace_recorder&) = delete;
+    /**
+     * Move constructor is deleted.
+     */
+    trace_recorder(trace_recorder&&) = delete;
+    /**
+     * Copy assignment operator is deleted.
+     */
+    trace_recorder& operator=(const trace_recorder&) = delete;
+    /**
+     * Move assignment operator is deleted.
+     */
+    trace_recorder& operator=(trace_recorder&&) = delete;
+    /**
+     * Default destructor.
+     */
+    ~trace_recorder() = default;
+    /**
+     * Discards all previously recorded data and starts recording. This function may also be called while recording,
+     * e.g., by another thread. Events that are recorded concurrently are either discarded or kept.
+     *
+     * @param max_num_events Maximum number of individually stored events over all threads.
+     */
+    void start(const std::size_t max_num_events = 1'000'000) noexcept
+    {
+        const std::lock_guard lock{buffers_mutex};
+
+        max_events.store(max_num_events, std::memory_order_relaxed);
+        epoch.store(now().time_since_epoch().count(), std::memory_order_relaxed);
+
+        for (const auto& buffer : buffers)
+        {
+            const std::lock_guard buffer_lock{buffer->mutex};
+
+            // release the memory of the events instead of only clearing them
+            std::vector<trace_event>{}.swap(buffer->events);
+            buffer->zones.clear();
+            buffer->num_dropped_events = 0;
+        }
+
+        num_stored_events.store(0, std::memory_order_relaxed);
+
+        enabled.store(true, std::memory_order_release);
+    }
+    /**
+     * Stops recording. Recorded data is kept until the next call to `start`.
+     */
+    void stop() noexcept
+    {
+        enabled.store(false, std::memory_order_release);
+    }
+    /**
+     * Checks whether the recorder is currently recording.
+     *
+     * @return `true` iff recording.
+     */
+    [[nodiscard]] bool is_enabled() const noexcept
+    {
+        return enabled.load(std::memory_order_acquire);
+    }
+    /**
+     * Returns the current time point of the clock that is used for recording.
+     *
+     * @return The current time point.
+     */
+    [[nodiscard]] static std::chrono::steady_clock::time_point now() noexcept
+    {
+        return std::chrono::steady_clock::now();
+    }
+    /**
+     * Records a zone that was entered and left at the given time points on the calling thread.
+     *
+     * @param name Name of the zone. Must have static storage duration.
+     * @param begin Time point at which the zone was entered.
+     * @param end Time point at which the zone was left.
+     */
+    void record_zone(const char* name, const std::chrono::steady_clock::time_point begin,
+                     const std::chrono::steady_clock::time_point end) noexcept
+    {
+        if (!is_enabled())
+        {
+            return;
+        }
+
+        auto& buffer = local_buffer();
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - recording_start());
+
+        const std::lock_guard lock{buffer.mutex};
+
+        auto& zone = buffer.zones[name];
+        ++zone.count;
+        zone.total_duration += duration;
+
+        store_event(buffer, {name, trace_event_type::ZONE, timestamp, duration, 0});
+    }
+    /**
+     * Records a sample of a counter on the calling thread.
+     *
+     * @param name Name of the counter. Must have static storage duration.
+     * @param value Value of the counter.
+     */
+    void record_counter(const char* name, const int64_t value) noexcept
+    {
+        if (!is_enabled())
+        {
+            return;
+        }
+
+        auto& buffer = local_buffer();
+
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now() - recording_start());
+
+        const std::lock_guard lock{buffer.mutex};
+
+        store_event(buffer, {name, trace_event_type::COUNTER, timestamp, std::chrono::nanoseconds{0}, value});
+    }
+    /**
+     * Returns the number of events that were not stored individually because the maximum number of stored events was
+     * reached.
+     *
+     * @return Number of dropped events.
+     */
+    [[nodiscard]] std::size_t num_dropped_events() const noexcept
+    {
+        std::size_t num_dropped = 0;
+
+        for_each_buffer([&num_dropped](const thread_buffer& buffer) { num_dropped += buffer.num_dropped_events; });
+
+        return num_dropped;
+    }
+    /**
+     * Returns the aggregated timing information of all recorded zones, including the ones whose individual events were
+     * dropped, merged over all threads.
+     *
+     * @return Map from zone names to their statistics.
+     */
+    [[nodiscard]] std::map<std::string, trace_zone_statistics> zone_statistics() const
+    {
+        std::map<std::string, trace_zone_statistics> statistics{};
+
+        for_each_buffer(
+            [&statistics](const thread_buffer& buffer)
+            {
+                for (const auto& [name, zone] : buffer.zones)
+                {
+                    auto& merged = statistics[name];
+                    merged.count += zone.count;
+                    merged.total_duration += zone.total_duration;
+                }
+            });
+
+        return statistics;
+    }
+    /**
+     * Writes all stored events in the Chrome trace event format (JSON object format).
+     *
+     * @param os Output stream to write to.
+     */
+    void write_chrome_trace(std::ostream& os) const
+    {
+        const auto flags     = os.flags();
+        const auto precision = os.precision();
+
+        os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+        bool first = true;
+
+        for_each_buffer(
+            [&os, &first](const thread_buffer& buffer)
+            {
+                for (const auto& event : buffer.events)
+                {
+                    os << (first ? "\n" : ",\n") << "{\"name\":";
+                    write_json_string(event.name, os);
+                    os << ",\"cat\":\"fiction\",\"ph\":\"" << static_cast<char>(event.type)
+                       << "\",\"ts\":" << to_microseconds(event.timestamp) << ",\"pid\":1,\"tid\":" << buffer.thread_id;
+
+                    if (event.type == trace_event_type::ZONE)
+                    {
+                        os << ",\"dur\":" << to_microseconds(event.duration);
+                    }
+                    else
+                    {
+                        os << ",\"args\":{\"value\":" << event.value << '}';
+                    }
+
+                    os << '}';
+
+                    first = false;
+                }
+            });
+
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+        os.flags(flags);
+        os.precision(precision);
+    }
+    /**
+     * Writes all stored events in the Chrome trace event format (JSON object format) to a file.
+     *
+     * @param filename Path of the file to write to.
+     * @throws std::ofstream::failure if the file could not be opened.
+     */
+    void write_chrome_trace(const std::string& filename) const
+    {
+        std::ofstream os{filename, std::ofstream::out};
+
+        if (!os.is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+
+        write_chrome_trace(os);
+        os.close();
+    }
+
+  private:
+    /**
+     * Events and zone statistics recorded by a single thread.
+     */
+    struct thread_buffer
+    {
+        /**
+         * Sequential identifier of the thread.
+         */
+        uint64_t thread_id{0};
+        /**
+         * Protects the buffer against concurrent export. Only the owning thread records into the buffer, so the mutex
+         * is uncontended during recording.
+         */
+        mutable std::mutex mutex{};
+        /**
+         * Individually stored events.
+         */
+        std::vector<trace_event> events{};
+        /**
+         * Aggregated zone statistics keyed by the address of the zone name.
+         */
+        std::unordered_map<const char*, trace_zone_statistics> zones{};
+        /**
+         * Number of events that were dropped because the maximum number of stored events was reached.
+         */
+        std::size_t num_dropped_events{0};
+        /**
+         * Flag that indicates whether the buffer is owned by a running thread. Protected by `buffers_mutex`.
+         */
+        bool in_use{true};
+    };
+    /**
+     * Hands the buffer of a thread over to the recorder when the thread terminates.
+     */
+    struct buffer_owner
+    {
+        /**
+         * Buffer owned by the thread, if it recorded an event.
+         */
+        thread_buffer* buffer{nullptr};
+        /**
+         * Destructor. Releases the buffer such that another thread can reuse it.
+         */
+        ~buffer_owner()
+        {
+            if (buffer != nullptr)
+            {
+                trace_recorder::instance().release_buffer(*buffer);
+            }
+        }
+    };
+    /**
+     * Flag that indicates whether recording is active.
+     */
+    std::atomic<bool> enabled{false};
+    /**
+     * Time point at which the recording was started, given as ticks since the epoch of the clock.
+     */
+    std::atomic<std::chrono::steady_clock::rep> epoch{now().time_since_epoch().count()};
+    /**
+     * Maximum number of individually stored events over all threads.
+     */
+    std::atomic<std::size_t> max_events{1'000'000};
+    /**
+     * Number of individually stored events over all threads.
+     */
+    std::atomic<std::size_t> num_stored_events{0};
+    /**
+     * Protects the list of buffers.
+     */
+    mutable std::mutex buffers_mutex{};
+    /**
+     * Buffers of all threads that ever recorded an event. Buffers are never destroyed before the recorder such that
+     * events of terminated threads are preserved. Buffers of terminated threads are reused by new threads.
+     */
+    std::vector<std::unique_ptr<thread_buffer>> buffers{};
+    /**
+     * Default constructor.
+     */
+    trace_recorder() = default;
+    /**
+     * Returns the time point at which the recording was started.
+     *
+     * @return The start of the recording.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point recording_start() const noexcept
+    {
+        return std::chrono::steady_clock::time_point{
+            std::chrono::steady_clock::duration{epoch.load(std::memory_order_relaxed)}};
+    }
+    /**
+     * Returns the buffer of the calling thread. Upon the thread's first event, a buffer of a terminated thread is
+     * reused or, if there is none, a new buffer is created.
+     *
+     * @return The calling thread's buffer.
+     */
+    [[nodiscard]] thread_buffer& local_buffer() noexcept
+    {
+        thread_local buffer_owner owner{};
+
+        if (owner.buffer == nullptr)
+        {
+            const std::lock_guard lock{buffers_mutex};
+
+            for (const auto& buffer : buffers)
+            {
+                if (!buffer->in_use)
+                {
+                    buffer->in_use = true;
+                    owner.buffer   = buffer.get();
+
+                    return *owner.buffer;
+                }
+            }
+
+            buffers.push_back(std::make_unique<thread_buffer>());
+            owner.buffer            = buffers.back().get();
+            owner.buffer->thread_id = buffers.size();
+        }
+
+        return *owner.buffer;
+    }
+    /**
+     * Marks the given buffer as unused such that the next thread that starts recording reuses it.
+     *
+     * @param buffer Buffer of a terminating thread.
+     */
+    void release_buffer(thread_buffer& buffer) noexcept
+    {
+        const std::lock_guard lock{buffers_mutex};
+
+        buffer.in_use = false;
+    }
+    /**
+     * Stores an event in the given buffer unless the maximum number of stored events is reached. Must be called while
+     * holding the buffer's mutex.
+     *
+     * @param buffer Buffer to store the event in.
+     * @param event Event to store.
+     */
+    void store_event(thread_buffer& buffer, const trace_event& event) noexcept
+    {
+        if (num_stored_events.fetch_add(1, std::memory_order_relaxed) >= max_events.load(std::memory_order_relaxed))
+        {
+            num_stored_events.fetch_sub(1, std::memory_order_relaxed);
+            ++buffer.num_dropped_events;
+
+            return;
+        }
+
+        try
+        {
+            buffer.events.push_back(event);
+        }
+        catch (...)
+        {
+            num_stored_events.fetch_sub(1, std::memory_order_relaxed);
+            ++buffer.num_dropped_events;
+        }
+    }
+    /**
+     * Applies the given function to all buffers while holding their mutexes.
+     *
+     * @tparam Fn Functor type that takes a `const thread_buffer&`.
+     * @param fn Functor to apply.
+     */
+    template <typename Fn>
+    void for_each_buffer(Fn&& fn) const
+    {
+        const std::lock_guard lock{buffers_mutex};
+
+        for (const auto& buffer : buffers)
+        {
+            const std::lock_guard buffer_lock{buffer->mutex};
+
+            fn(*buffer);
+        }
+    }
+    /**
+     * Converts a duration to fractional microseconds, the time unit of the Chrome trace event format.
+     *
+     * @param duration Duration to convert.
+     * @return The duration in microseconds.
+     */
+    [[nodiscard]] static double to_microseconds(const std::chrono::nanoseconds duration) noexcept
+    {
+        return static_cast<double>(duration.count()) / 1000.0;
+    }
+    /**
+     * Writes the given string as a JSON string literal.
+     *
+     * @param str String to write.
+     * @param os Output stream to write to.
+     */
+    static void write_json_string(const char* str, std::ostream& os)
+    {
+        os << '"';
+
+        for (const auto* c = str; *c != '\0'; ++c)
+        {
+            switch (*c)
+            {
+                case '"':
+                case '\\':
+                {
+                    os << '\\' << *c;
+                    break;
+                }
+                case '\n':
+                {
+                    os << "\\n";
+                    break;
+                }
+                case '\t':
+                {
+                    os << "\\t";
+                    break;
+                }
+                default:
+                {
+                    if (static_cast<unsigned char>(*c) < 0x20)
+                    {
+                        os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                           << static_cast<int>(static_cast<unsigned char>(*c)) << std::dec << std::setfill(' ');
+                    }
+                    else
+                    {
+                        os << *c;
+                    }
+                }
+            }
+        }
+
+        os << '"';
+    }
+};
+/**
+ * Records the lifetime of the object as a zone with the given name, if the `trace_recorder` is active at
+ * construction.
+ */
+class trace_zone
+{
+  public:
+    /**
+     * Standard constructor. Enters the zone.
+     *
+     * @param zone_name Name of the zone. Must have static storage duration.
+     */
+    explicit trace_zone(const char* zone_name) noexcept :
+            name{zone_name},
+            active{trace_recorder::instance().is_enabled()}
+    {
+        if (active)
+        {
+            begin = trace_recorder::now();
+        }
+    }
+    /**
+     * Copy constructor is deleted.
+     */
+    trace_zone(const trace_zone&) = delete;
+    /**
+     * Move constructor is deleted.
+     */
+    trace_zone(trace_zone&&) = delete;
+    /**
+     * Copy assignment operator is deleted.
+     */
+    trace_zone& operator=(const trace_zone&) = delete;
+    /**
+     * Move assignment operator is deleted.
+     */
+    trace_zone& operator=(trace_zone&&) = delete;
+    /**
+     * Destructor. Leaves the zone and records it.
+     */
+    ~trace_zone()
+    {
+        if (active)
+        {
+            trace_recorder::instance().record_zone(name, begin, trace_recorder::now());
+        }
+    }
+
+  private:
+    /**
+     * Name of the zone.
+     */
+    const char* name;
+    /**
+     * Flag that indicates whether the recorder was active when the zone was entered.
+     */
+    const bool active;
+    /**
+     * Time point at which the zone was entered.
+     */
+    std::chrono::steady_clock::time_point begin{};
+};
+
+}  // namespace fiction
+
+#if defined(FICTION_TRACING)
+
+#define FICTION_TRACE_CONCAT_IMPL(a, b) a##b
+#define FICTION_TRACE_CONCAT(a, b) FICTION_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * Records the remainder of the enclosing scope as a zone with the given name.
+ *
+ * @note This macro expands to nothing unless `FICTION_TRACING` is defined.
+ */
+#define FICTION_TRACE_ZONE(name) const ::fiction::trace_zone FICTION_TRACE_CONCAT(fiction_trace_zone_, __LINE__){name}
+/**
+ * Records a sample of the counter with the given name.
+ *
+ * @note This macro expands to nothing unless `FICTION_TRACING` is defined.
+ */
+#define FICTION_TRACE_COUNTER(name, value)                                                                            \
+    ::fiction::trace_recorder::instance().record_counter(name, static_cast<int64_t>(value))
+
+#else
+
+/**
+ * Records the remainder of the enclosing scope as a zone with the given name.
+ *
+ * @note This macro expands to nothing unless `FICTION_TRACING` is defined.
+ */
+#define FICTION_TRACE_ZONE(name) static_cast<void>(0)
+/**
+ * Records a sample of the counter with the given name.
+ *
+ * @note This macro expands to nothing unless `FICTION_TRACING` is defined.
+ */
+#define FICTION_TRACE_COUNTER(name, value) static_cast<void>(0)
+
+#endif
+
+#endif  // FICTION_TRACING_HPP
@@ -0,0 +1,1098 @@
+//
+// Created on 19.10.26.
+//
+
+#ifndef FICTION_Z3_CNF_TRANSLATION_HPP
+#define FICTION_Z3_CNF_TRANSLATION_HPP
+
+#if (FICTION_Z3_SOLVER)
+
+#include <bill/sat/interface/common.hpp>
+#include <bill/sat/interface/types.hpp>
+#include <bill/sat/solver.hpp>
+#include <z3++.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Run-time polymorphic wrapper around the SAT solvers provided by `bill`, which are selected via a template parameter.
+ * This allows for choosing a SAT engine via a parameter struct without having to template all surrounding code on it.
+ */
+class sat_solver_interface
+{
+  public:
+    /**
+     * Default destructor.
+     */
+    virtual ~sat_solver_interface() = default;
+    /**
+     * Creates a new variable.
+     *
+     * @return The new variable.
+     */
+    [[nodiscard]] virtual bill::var_type add_variable() = 0;
+    /**
+     * Adds a clause, i.e., a disjunction of literals.
+     *
+     * @param clause The literals of the clause.
+     */
+    virtual void add_clause(const std::vector<bill::lit_type>& clause) = 0;
+    /**
+     * Solves the instance under the given assumptions.
+     *
+     * @param assumptions Literals that are assumed to be true for this call only.
+     * @return The result state.
+     */
+    [[nodiscard]] virtual bill::result::states solve(const std::vector<bill::lit_type>& assumptions) = 0;
+    /**
+     * Returns the model of the last satisfiable call to `solve`.
+     *
+     * @return The model indexed by variables.
+     */
+    [[nodiscard]] virtual bill::result::model_type get_model() const = 0;
+};
+
+namespace detail
+{
+
+template <bill::solvers SolverType>
+class bill_sat_solver final : public sat_solver_interface
+{
+  public:
+    [[nodiscard]] bill::var_type add_variable() override
+    {
+        return solver.add_variable();
+    }
+
+    void add_clause(const std::vector<bill::lit_type>& clause) override
+    {
+        solver.add_clause(clause);
+    }
+
+    [[nodiscard]] bill::result::states solve(const std::vector<bill::lit_type>& assumptions) override
+    {
+        return solver.solve(assumptions);
+    }
+
+    [[nodiscard]] bill::result::model_type get_model() const override
+    {
+        return solver.get_model().model();
+    }
+
+  private:
+    bill::solver<SolverType> solver{};
+};
+
+}  // namespace detail
+
+/**
+ * Creates a SAT solver of the given engine.
+ *
+ * @param sat_engine The SAT solver to use.
+ * @return A pointer to the created solver.
+ */
+[[nodiscard]] inline std::unique_ptr<sat_solver_interface> make_sat_solver(const bill::solvers sat_engine)
+{
+    switch (sat_engine)
+    {
+        case bill::solvers::glucose_41:
+        {
+            return std::make_unique<detail::bill_sat_solver<bill::solvers::glucose_41>>();
+        }
+        case bill::solvers::bsat2:
+        {
+            return std::make_unique<detail::bill_sat_solver<bill::solvers::bsat2>>();
+        }
+#if !defined(BILL_WINDOWS_PLATFORM)
+        case bill::solvers::maple:
+        {
+            return std::make_unique<detail::bill_sat_solver<bill::solvers::maple>>();
+        }
+        case bill::solvers::bmcg:
+        {
+            return std::make_unique<detail::bill_sat_solver<bill::solvers::bmcg>>();
+        }
+#endif
+        default:
+        {
+            return std::make_unique<detail::bill_sat_solver<bill::solvers::ghack>>();
+        }
+    }
+}
+/**
+ * Translates Z3 formulas to CNF and solves them with a SAT solver from `bill`.
+ *
+ * The supported fragment comprises Boolean constants and connectives (`not`, `and`, `or`, `implies`, `xor`, `=`,
+ * `ite`), cardinality constraints (`atmost`, `atleast`), and (in-)equalities over linear integer or real terms that
+ * only consist of numerals and `ite` expressions with Boolean conditions, e.g., sums of `ite(x, 1, 0)` counters. In
+ * particular, arithmetic constants are not supported.
+ *
+ * Nested sub-formulas are Tseitin-encoded. Top-level cardinality constraints are encoded via sequential counters,
+ * which only need to enforce one direction, while cardinality constraints nested in other formulas are encoded via
+ * totalizers whose outputs are equivalent to the respective bounds on the sum. Implications at the top level are
+ * turned into guard literals that are added to all clauses of the consequent so that, e.g., `lit -> constraint`
+ * assertions that are used for incremental solving via assumptions do not need any auxiliary variable.
+ *
+ * Formulas can be added incrementally between calls to `solve`. Sub-formulas are cached by their AST ID, which is why
+ * all added formulas are kept alive.
+ */
+class z3_cnf_translator
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param c The context of all formulas to translate.
+     * @param sat_engine The SAT solver to use.
+     */
+    z3_cnf_translator(z3::context& c, const bill::solvers sat_engine) : ctx{c}, solver{make_sat_solver(sat_engine)}
+    {
+        true_lit = bill::lit_type{solver->add_variable(), bill::positive_polarity};
+        solver->add_clause({true_lit});
+    }
+    /**
+     * Adds the given Boolean formula as a constraint.
+     *
+     * If the formula lies outside the supported fragment, it is discarded, the translator is marked as unsupported,
+     * and all subsequent calls to this function are ignored. The clauses that have been generated up to this point
+     * are kept in the solver but the instance must not be solved anymore.
+     *
+     * @param formula Boolean formula to add.
+     * @return `true` iff the formula and all previously added ones could be translated.
+     */
+    bool add(const z3::expr& formula)
+    {
+        if (!supported)
+        {
+            return false;
+        }
+
+        formulas.push_back(formula);
+
+        try
+        {
+            std::vector<bill::lit_type> guard{};
+            assert_formula(formula, guard);
+        }
+        catch (const unsupported_term&)
+        {
+            supported = false;
+        }
+
+        return supported;
+    }
+    /**
+     * Checks whether all formulas added so far could be translated.
+     *
+     * @return `true` iff the instance can be solved.
+     */
+    [[nodiscard]] bool is_supported() const noexcept
+    {
+        return supported;
+    }
+    /**
+     * Solves the conjunction of all added formulas under the given assumptions. The translator must be supported.
+     *
+     * @param assumptions Boolean formulas from the supported fragment that are assumed to hold for this call only.
+     * They are usually constants. Assumptions are not added to the formulas, and repeated calls with the same
+     * assumptions do not require additional memory.
+     * @return The SAT solver's result state.
+     */
+    [[nodiscard]] bill::result::states solve(const z3::expr_vector& assumptions)
+    {
+        std::vector<bill::lit_type> assumption_lits{};
+        assumption_lits.reserve(assumptions.size());
+
+        for (const auto& a : assumptions)
+        {
+            // the literals of compound assumptions are cached by AST ID, which requires keeping them alive
+            assumption_formulas.emplace(a.id(), a);
+            assumption_lits.push_back(encode(a));
+        }
+
+        return solver->solve(assumption_lits);
+    }
+    /**
+     * Extracts a Z3 model over all Boolean constants that occurred in the added formulas from the model of the last
+     * satisfiable call to `solve`. Constants that did not occur in any formula are not part of the model.
+     *
+     * @return A Z3 model that can be evaluated like the ones obtained from `z3::solver::get_model`.
+     */
+    [[nodiscard]] z3::model get_model() const
+    {
+        const auto assignment = solver->get_model();
+
+        z3::model model{ctx};
+
+        for (const auto& [decl, var] : constants)
+        {
+            const auto value = ctx.bool_val(assignment.at(var) == bill::lbool_type::true_);
+
+            // the C API is used because z3::model::add_const is not available in all supported Z3 versions
+            Z3_add_const_interp(ctx, model, decl, value);
+        }
+
+        return model;
+    }
+    /**
+     * Returns the number of clauses that have been generated so far.
+     *
+     * @return Number of clauses.
+     */
+    [[nodiscard]] std::size_t num_clauses() const noexcept
+    {
+        return clause_counter;
+    }
+
+  private:
+    /**
+     * Thrown if a term outside the supported fragment is encountered.
+     */
+    struct unsupported_term
+    {};
+    /**
+     * A linear term of the form `constant + sum(lits)`.
+     */
+    struct linear_term
+    {
+        int64_t                     constant{0};
+        std::vector<bill::lit_type> lits{};
+    };
+    /**
+     * The context of all formulas.
+     */
+    z3::context& ctx;
+    /**
+     * The SAT solver.
+     */
+    std::unique_ptr<sat_solver_interface> solver;
+    /**
+     * A literal that is constantly true.
+     */
+    bill::lit_type true_lit{0, bill::positive_polarity};
+    /**
+     * All translated formulas to keep their AST IDs valid.
+     */
+    std::vector<z3::expr> formulas{};
+    /**
+     * All encoded assumptions by their AST IDs to keep these IDs valid. Assumptions are kept separately from the
+     * formulas such that each one is stored only once even if it is used in many calls to `solve`.
+     */
+    std::unordered_map<unsigned, z3::expr> assumption_formulas{};
+    /**
+     * Boolean constants and their variables in the SAT solver.
+     */
+    std::vector<std::pair<z3::func_decl, bill::var_type>> constants{};
+    /**
+     * Maps names of Boolean constants to their variables.
+     */
+    std::unordered_map<std::string, bill::var_type> constant_variables{};
+    /**
+     * Maps AST IDs of encoded sub-formulas to their literals.
+     */
+    std::unordered_map<unsigned, bill::lit_type> encoded{};
+    /**
+     * Flag to indicate that all formulas could be translated.
+     */
+    bool supported{true};
+    /**
+     * Number of generated clauses.
+     */
+    std::size_t clause_counter{0};
+    /**
+     * Creates a fresh auxiliary variable in the SAT solver.
+     *
+     * @return Positive literal of the new variable.
+     */
+    [[nodiscard]] bill::lit_type new_lit()
+    {
+        return bill::lit_type{solver->add_variable(), bill::positive_polarity};
+    }
+    /**
+     * Adds a clause to the SAT solver and counts it.
+     *
+     * @param clause Literals of the clause.
+     */
+    void add_clause(const std::vector<bill::lit_type>& clause)
+    {
+        solver->add_clause(clause);
+        ++clause_counter;
+    }
+    /**
+     * Adds a clause that only holds if all guard literals are true.
+     *
+     * @param guard Literals that imply the clause.
+     * @param lits Literals of the clause.
+     */
+    void add_guarded_clause(const std::vector<bill::lit_type>& guard, std::vector<bill::lit_type> lits)
+    {
+        for (const auto& g : guard)
+        {
+            lits.push_back(~g);
+        }
+
+        // use the false literal to avoid empty clauses
+        if (lits.empty())
+        {
+            lits.push_back(~true_lit);
+        }
+
+        add_clause(lits);
+    }
+    /**
+     * Returns the kind of the declaration of the given application, e.g., `Z3_OP_AND`.
+     *
+     * @param e Application term.
+     * @return Declaration kind of `e`.
+     */
+    [[nodiscard]] static Z3_decl_kind kind(const z3::expr& e)
+    {
+        return e.decl().decl_kind();
+    }
+    /**
+     * Returns the bound `k` of a cardinality constraint, i.e., of `atmost(..., k)` or `atleast(..., k)`.
+     *
+     * @param e Cardinality constraint.
+     * @return Bound of `e`.
+     */
+    [[nodiscard]] static int64_t cardinality_bound(const z3::expr& e)
+    {
+        return Z3_get_decl_int_parameter(e.ctx(), e.decl(), 0);
+    }
+    /**
+     * Encodes all arguments of the given application.
+     *
+     * @param e Application whose arguments are Boolean formulas.
+     * @return Literals equivalent to the arguments of `e` in order.
+     */
+    [[nodiscard]] std::vector<bill::lit_type> encode_args(const z3::expr& e)
+    {
+        std::vector<bill::lit_type> lits{};
+        lits.reserve(e.num_args());
+
+        for (auto i = 0u; i < e.num_args(); ++i)
+        {
+            lits.push_back(encode(e.arg(i)));
+        }
+
+        return lits;
+    }
+    /**
+     * Asserts the given formula under the given guard literals, i.e., adds clauses for `and(guard) -> formula`.
+     *
+     * @param e Boolean formula.
+     * @param guard Guard literals.
+     */
+    void assert_formula(const z3::expr& e, std::vector<bill::lit_type>& guard)
+    {
+        if (!e.is_bool() || !e.is_app())
+        {
+            throw unsupported_term{};
+        }
+
+        switch (kind(e))
+        {
+            case Z3_OP_TRUE:
+            {
+                return;
+            }
+            case Z3_OP_AND:
+            {
+                for (auto i = 0u; i < e.num_args(); ++i)
+                {
+                    assert_formula(e.arg(i), guard);
+                }
+
+                return;
+            }
+            case Z3_OP_OR:
+            {
+                add_guarded_clause(guard, encode_args(e));
+
+                return;
+            }
+            case Z3_OP_IMPLIES:
+            {
+                const auto guard_size = guard.size();
+
+                // flatten conjunctions in the antecedent
+                if (const auto antecedent = e.arg(0); kind(antecedent) == Z3_OP_AND)
+                {
+                    const auto lits = encode_args(antecedent);
+                    guard.insert(guard.end(), lits.cbegin(), lits.cend());
+                }
+                else
+                {
+                    guard.push_back(encode(antecedent));
+                }
+
+                assert_formula(e.arg(1), guard);
+                guard.erase(guard.begin() + static_cast<std::ptrdiff_t>(guard_size), guard.end());
+
+                return;
+            }
+            case Z3_OP_NOT:
+            {
+                // push negations into disjunctions
+                if (const auto arg = e.arg(0); kind(arg) == Z3_OP_OR)
+                {
+                    for (auto i = 0u; i < arg.num_args(); ++i)
+                    {
+                        add_guarded_clause(guard, {~encode(arg.arg(i))});
+                    }
+
+                    return;
+                }
+
+                break;
+            }
+            case Z3_OP_EQ:
+            {
+                if (e.arg(0).is_bool())
+                {
+                    const auto a = encode(e.arg(0));
+                    const auto b = encode(e.arg(1));
+
+                    add_guarded_clause(guard, {~a, b});
+                    add_guarded_clause(guard, {a, ~b});
+
+                    return;
+                }
+
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        // cardinality constraints do not need to be reified at the top level
+        if (auto card = as_cardinality(e); card.has_value())
+        {
+            assert_cardinality(card->lits, card->lower, card->upper, guard);
+
+            return;
+        }
+
+        add_guarded_clause(guard, {encode(e)});
+    }
+    /**
+     * A cardinality constraint of the form `lower <= sum(lits) <= upper`.
+     */
+    struct cardinality
+    {
+        std::vector<bill::lit_type> lits{};
+        int64_t                     lower{0};
+        int64_t                     upper{0};
+    };
+    /**
+     * Interprets the given formula as a cardinality constraint if it is one.
+     *
+     * @param e Boolean formula.
+     * @return The cardinality constraint represented by `e` or `std::nullopt` if `e` is no cardinality constraint.
+     */
+    [[nodiscard]] std::optional<cardinality> as_cardinality(const z3::expr& e)
+    {
+        switch (kind(e))
+        {
+            case Z3_OP_PB_AT_MOST:
+            {
+                auto lits = encode_args(e);
+                return cardinality{lits, 0, cardinality_bound(e)};
+            }
+            case Z3_OP_PB_AT_LEAST:
+            {
+                auto       lits = encode_args(e);
+                const auto n    = static_cast<int64_t>(lits.size());
+                return cardinality{std::move(lits), cardinality_bound(e), n};
+            }
+            case Z3_OP_EQ:
+            case Z3_OP_LE:
+            case Z3_OP_GE:
+            case Z3_OP_LT:
+            case Z3_OP_GT:
+            {
+                if (!e.arg(0).is_arith())
+                {
+                    return std::nullopt;
+                }
+
+                // lhs - rhs = constant + sum(lits)
+                auto difference = linearize(e.arg(0));
+                add_negated(difference, linearize(e.arg(1)));
+
+                const auto k = -difference.constant;
+                const auto n = static_cast<int64_t>(difference.lits.size());
+
+                switch (kind(e))
+                {
+                    case Z3_OP_EQ: return cardinality{std::move(difference.lits), k, k};
+                    case Z3_OP_LE: return cardinality{std::move(difference.lits), 0, k};
+                    case Z3_OP_LT: return cardinality{std::move(difference.lits), 0, k - 1};
+                    case Z3_OP_GE: return cardinality{std::move(difference.lits), k, n};
+                    default: return cardinality{std::move(difference.lits), k + 1, n};
+                }
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+    /**
+     * Returns a literal that is equivalent to the given Boolean formula. Auxiliary variables are defined via Tseitin
+     * transformation.
+     *
+     * @param e Boolean formula.
+     * @return Literal equivalent to `e`.
+     */
+    [[nodiscard]] bill::lit_type encode(const z3::expr& e)
+    {
+        if (!e.is_bool() || !e.is_app())
+        {
+            throw unsupported_term{};
+        }
+
+        if (kind(e) == Z3_OP_UNINTERPRETED && e.num_args() == 0)
+        {
+            auto name = e.decl().name().str();
+
+            if (const auto it = constant_variables.find(name); it != constant_variables.cend())
+            {
+                return bill::lit_type{it->second, bill::positive_polarity};
+            }
+
+            const auto var = solver->add_variable();
+            constant_variables.emplace(std::move(name), var);
+            constants.emplace_back(e.decl(), var);
+
+            return bill::lit_type{var, bill::positive_polarity};
+        }
+
+        if (const auto it = encoded.find(e.id()); it != encoded.cend())
+        {
+            return it->second;
+        }
+
+        const auto lit = encode_compound(e);
+        encoded.emplace(e.id(), lit);
+
+        return lit;
+    }
+    /**
+     * Defines a new literal that is equivalent to the given compound Boolean formula, i.e., one that is not a constant.
+     *
+     * @param e Compound Boolean formula.
+     * @return Literal equivalent to `e`.
+     */
+    [[nodiscard]] bill::lit_type encode_compound(const z3::expr& e)
+    {
+        switch (kind(e))
+        {
+            case Z3_OP_TRUE:
+            {
+                return true_lit;
+            }
+            case Z3_OP_FALSE:
+            {
+                return ~true_lit;
+            }
+            case Z3_OP_NOT:
+            {
+                return ~encode(e.arg(0));
+            }
+            case Z3_OP_AND:
+            {
+                return mk_and(encode_args(e));
+            }
+            case Z3_OP_OR:
+            {
+                return ~mk_and(negate(encode_args(e)));
+            }
+            case Z3_OP_IMPLIES:
+            {
+                return ~mk_and({encode(e.arg(0)), ~encode(e.arg(1))});
+            }
+            case Z3_OP_XOR:
+            {
+                return mk_xor(encode(e.arg(0)), encode(e.arg(1)));
+            }
+            case Z3_OP_ITE:
+            {
+                return mk_ite(encode(e.arg(0)), encode(e.arg(1)), encode(e.arg(2)));
+            }
+            case Z3_OP_EQ:
+            {
+                if (e.arg(0).is_bool())
+                {
+                    return ~mk_xor(encode(e.arg(0)), encode(e.arg(1)));
+                }
+
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        if (auto card = as_cardinality(e); card.has_value())
+        {
+            return encode_cardinality(card->lits, card->lower, card->upper);
+        }
+
+        throw unsupported_term{};
+    }
+    /**
+     * Negates all given literals.
+     *
+     * @param lits Literals to negate.
+     * @return The negated literals in order.
+     */
+    [[nodiscard]] static std::vector<bill::lit_type> negate(std::vector<bill::lit_type> lits)
+    {
+        std::transform(lits.cbegin(), lits.cend(), lits.begin(), [](const auto& l) { return ~l; });
+
+        return lits;
+    }
+    /**
+     * Returns a literal that is equivalent to the conjunction of the given literals.
+     *
+     * @param lits Literals to conjoin.
+     * @return Literal equivalent to `and(lits)`.
+     */
+    [[nodiscard]] bill::lit_type mk_and(const std::vector<bill::lit_type>& lits)
+    {
+        if (lits.empty())
+        {
+            return true_lit;
+        }
+        if (lits.size() == 1)
+        {
+            return lits.front();
+        }
+
+        const auto v = new_lit();
+
+        std::vector<bill::lit_type> clause{v};
+        for (const auto& l : lits)
+        {
+            add_clause({~v, l});
+            clause.push_back(~l);
+        }
+        add_clause(clause);
+
+        return v;
+    }
+    /**
+     * Returns a new literal that is equivalent to the exclusive disjunction of the given literals.
+     *
+     * @param a First literal.
+     * @param b Second literal.
+     * @return Literal equivalent to `a xor b`.
+     */
+    [[nodiscard]] bill::lit_type mk_xor(const bill::lit_type a, const bill::lit_type b)
+    {
+        const auto v = new_lit();
+
+        add_clause({~v, a, b});
+        add_clause({~v, ~a, ~b});
+        add_clause({v, ~a, b});
+        add_clause({v, a, ~b});
+
+        return v;
+    }
+    /**
+     * Returns a new literal that is equivalent to the if-then-else of the given literals.
+     *
+     * @param c Condition literal.
+     * @param t Literal that is selected if `c` is true.
+     * @param e Literal that is selected if `c` is false.
+     * @return Literal equivalent to `ite(c, t, e)`.
+     */
+    [[nodiscard]] bill::lit_type mk_ite(const bill::lit_type c, const bill::lit_type t, const bill::lit_type e)
+    {
+        const auto v = new_lit();
+
+        add_clause({~c, ~t, v});
+        add_clause({~c, t, ~v});
+        add_clause({c, ~e, v});
+        add_clause({c, e, ~v});
+
+        return v;
+    }
+    /**
+     * Translates the given arithmetic term to a linear term over literals.
+     *
+     * @param e Integer or real term.
+     * @return Linear term equivalent to `e`.
+     */
+    [[nodiscard]] linear_term linearize(const z3::expr& e)
+    {
+        if (!e.is_app())
+        {
+            throw unsupported_term{};
+        }
+
+        switch (kind(e))
+        {
+            case Z3_OP_ANUM:
+            {
+                int64_t num = 0, den = 1;
+                if (!Z3_get_numeral_small(e.ctx(), e, &num, &den) || den != 1)
+                {
+                    throw unsupported_term{};
+                }
+
+                return {num, {}};
+            }
+            case Z3_OP_TO_REAL:
+            case Z3_OP_TO_INT:
+            {
+                return linearize(e.arg(0));
+            }
+            case Z3_OP_ADD:
+            {
+                linear_term sum{};
+                for (auto i = 0u; i < e.num_args(); ++i)
+                {
+                    add(sum, linearize(e.arg(i)));
+                }
+
+                return sum;
+            }
+            case Z3_OP_SUB:
+            {
+                auto difference = linearize(e.arg(0));
+                for (auto i = 1u; i < e.num_args(); ++i)
+                {
+                    add_negated(difference, linearize(e.arg(i)));
+                }
+
+                return difference;
+            }
+            case Z3_OP_UMINUS:
+            {
+                linear_term negation{};
+                add_negated(negation, linearize(e.arg(0)));
+
+                return negation;
+            }
+            case Z3_OP_MUL:
+            {
+                // only multiplications with numerals are linear
+                int64_t                    factor = 1;
+                std::optional<linear_term> term{};
+
+                for (auto i = 0u; i < e.num_args(); ++i)
+                {
+                    auto arg = linearize(e.arg(i));
+
+                    if (arg.lits.empty())
+                    {
+                        factor *= arg.constant;
+                    }
+                    else if (!term.has_value())
+                    {
+                        term = std::move(arg);
+                    }
+                    else
+                    {
+                        throw unsupported_term{};
+                    }
+                }
+
+                return term.has_value() ? scale(*term, factor) : linear_term{factor, {}};
+            }
+            case Z3_OP_ITE:
+            {
+                // ite(c, a, b) = c * a + !c * b
+                const auto c = encode(e.arg(0));
+                const auto a = linearize(e.arg(1));
+                const auto b = linearize(e.arg(2));
+
+                linear_term result{std::min(a.constant, b.constant), {}};
+
+                result.lits.insert(result.lits.end(), static_cast<std::size_t>(a.constant - result.constant), c);
+                result.lits.insert(result.lits.end(), static_cast<std::size_t>(b.constant - result.constant), ~c);
+
+                for (const auto& l : a.lits)
+                {
+                    result.lits.push_back(mk_and({c, l}));
+                }
+                for (const auto& l : b.lits)
+                {
+                    result.lits.push_back(mk_and({~c, l}));
+                }
+
+                return result;
+            }
+            default:
+            {
+                throw unsupported_term{};
+            }
+        }
+    }
+    /**
+     * Adds `rhs` to `lhs`.
+     *
+     * @param lhs Linear term to add to.
+     * @param rhs Linear term to add.
+     */
+    static void add(linear_term& lhs, const linear_term& rhs)
+    {
+        lhs.constant += rhs.constant;
+        lhs.lits.insert(lhs.lits.end(), rhs.lits.cbegin(), rhs.lits.cend());
+    }
+    /**
+     * Subtracts `rhs` from `lhs` using `-l = !l - 1` for all literals `l`.
+     */
+    static void add_negated(linear_term& lhs, const linear_term& rhs)
+    {
+        lhs.constant -= rhs.constant + static_cast<int64_t>(rhs.lits.size());
+
+        for (const auto& l : rhs.lits)
+        {
+            lhs.lits.push_back(~l);
+        }
+    }
+    /**
+     * Multiplies a linear term by an integer factor. Each literal is repeated `|factor|` times, and negative factors
+     * are applied via `add_negated`.
+     *
+     * @param term Linear term to scale.
+     * @param factor Integer factor.
+     * @return Linear term equivalent to `factor * term`.
+     */
+    [[nodiscard]] static linear_term scale(const linear_term& term, const int64_t factor)
+    {
+        linear_term base{};
+
+        if (factor < 0)
+        {
+            add_negated(base, term);
+        }
+        else
+        {
+            base = term;
+        }
+
+        const auto abs_factor = static_cast<std::size_t>(factor < 0 ? -factor : factor);
+
+        linear_term scaled{base.constant * static_cast<int64_t>(abs_factor), {}};
+        scaled.lits.reserve(base.lits.size() * abs_factor);
+
+        for (const auto& l : base.lits)
+        {
+            scaled.lits.insert(scaled.lits.end(), abs_factor, l);
+        }
+
+        return scaled;
+    }
+    /**
+     * Asserts `lower <= sum(lits) <= upper` under the given guard literals. Both bounds are encoded via sequential
+     * counters, where the lower bound is expressed as an upper bound on the negated literals.
+     */
+    void assert_cardinality(const std::vector<bill::lit_type>& lits, const int64_t lower, const int64_t upper,
+                            const std::vector<bill::lit_type>& guard)
+    {
+        const auto n = static_cast<int64_t>(lits.size());
+
+        if (lower > upper || lower > n || upper < 0)
+        {
+            add_guarded_clause(guard, {});
+
+            return;
+        }
+        if (upper < n)
+        {
+            assert_at_most(lits, static_cast<std::size_t>(upper), guard);
+        }
+        if (lower == 1)
+        {
+            add_guarded_clause(guard, lits);
+        }
+        else if (lower > 1)
+        {
+            assert_at_most(negate(lits), static_cast<std::size_t>(n - lower), guard);
+        }
+    }
+    /**
+     * Sinz' sequential counter for `sum(lits) <= k` under the given guard literals. Register `s[i][j]` is implied by
+     * the first `i + 1` literals containing at least `j + 1` true ones. Only the overflow clauses are guarded.
+     */
+    void assert_at_most(const std::vector<bill::lit_type>& lits, const std::size_t k,
+                        const std::vector<bill::lit_type>& guard)
+    {
+        if (k >= lits.size())
+        {
+            return;
+        }
+        if (k == 0)
+        {
+            for (const auto& l : lits)
+            {
+                add_guarded_clause(guard, {~l});
+            }
+
+            return;
+        }
+
+        std::vector<bill::lit_type> previous{};
+
+        for (std::size_t i = 0; i < lits.size(); ++i)
+        {
+            const auto& x = lits[i];
+
+            if (!previous.empty())
+            {
+                // overflow
+                add_guarded_clause(guard, {~x, ~previous[k - 1]});
+            }
+
+            if (i + 1 == lits.size())
+            {
+                break;
+            }
+
+            std::vector<bill::lit_type> current{};
+            current.reserve(k);
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                current.push_back(new_lit());
+            }
+
+            add_clause({~x, current[0]});
+
+            if (!previous.empty())
+            {
+                for (std::size_t j = 0; j < k; ++j)
+                {
+                    add_clause({~previous[j], current[j]});
+
+                    if (j > 0)
+                    {
+                        add_clause({~x, ~previous[j - 1], current[j]});
+                    }
+                }
+            }
+
+            previous = std::move(current);
+        }
+    }
+    /**
+     * Returns a literal equivalent to `lower <= sum(lits) <= upper` using a totalizer.
+     */
+    [[nodiscard]] bill::lit_type encode_cardinality(const std::vector<bill::lit_type>& lits, const int64_t lower,
+                                                    const int64_t upper)
+    {
+        const auto n = static_cast<int64_t>(lits.size());
+
+        if (lower > upper || lower > n || upper < 0)
+        {
+            return ~true_lit;
+        }
+        if (lower <= 0 && upper >= n)
+        {
+            return true_lit;
+        }
+
+        // outputs are only needed up to the largest relevant bound
+        const auto cap     = static_cast<std::size_t>(std::min(n, std::max(lower, upper + 1)));
+        const auto outputs = totalizer(lits, 0, lits.size(), cap);
+
+        std::vector<bill::lit_type> conjunction{};
+        if (lower > 0)
+        {
+            conjunction.push_back(outputs[static_cast<std::size_t>(lower - 1)]);
+        }
+        if (upper < n)
+        {
+            conjunction.push_back(~outputs[static_cast<std::size_t>(upper)]);
+        }
+
+        return mk_and(conjunction);
+    }
+    /**
+     * Builds a totalizer over `lits[begin, end)` whose `j`-th output is equivalent to at least `j + 1` of the
+     * literals being true. Outputs are capped at `cap`, i.e., the last output is equivalent to at least `cap` literals
+     * being true.
+     */
+    [[nodiscard]] std::vector<bill::lit_type> totalizer(const std::vector<bill::lit_type>& lits,
+                                                        const std::size_t begin, const std::size_t end,
+                                                        const std::size_t cap)
+    {
+        if (end - begin == 1)
+        {
+            return {lits[begin]};
+        }
+
+        const auto mid   = begin + (end - begin) / 2;
+        const auto left  = totalizer(lits, begin, mid, cap);
+        const auto right = totalizer(lits, mid, end, cap);
+
+        const auto num_outputs = std::min(left.size() + right.size(), cap);
+
+        std::vector<bill::lit_type> outputs{};
+        outputs.reserve(num_outputs);
+        for (std::size_t i = 0; i < num_outputs; ++i)
+        {
+            outputs.push_back(new_lit());
+        }
+
+        for (std::size_t i = 0; i <= left.size(); ++i)
+        {
+            for (std::size_t j = 0; j <= right.size(); ++j)
+            {
+                // at least i + j true inputs imply the respective output
+                if (i + j > 0)
+                {
+                    std::vector<bill::lit_type> clause{outputs[std::min(i + j, num_outputs) - 1]};
+                    if (i > 0)
+                    {
+                        clause.push_back(~left[i - 1]);
+                    }
+                    if (j > 0)
+                    {
+                        clause.push_back(~right[j - 1]);
+                    }
+                    add_clause(clause);
+                }
+                // at most i + j true inputs exclude the next output
+                if (i + j < num_outputs)
+                {
+                    std::vector<bill::lit_type> clause{~outputs[i + j]};
+                    if (i < left.size())
+                    {
+                        clause.push_back(left[i]);
+                    }
+                    if (j < right.size())
+                    {
+                        clause.push_back(right[j]);
+                    }
+                    add_clause(clause);
+                }
+            }
+        }
+
+        return outputs;
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_Z3_SOLVER
+
+#endif  // FICTION_Z3_CNF_TRANSLATION_HPP
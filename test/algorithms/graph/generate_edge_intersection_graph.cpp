@@ -205,6 +205,58 @@ TEST_CASE("EPG on 4x4 layouts", "[generate-edge-intersection-graph]")
     }
 }
 
+TEST_CASE("EPG on 4x4 layouts with multiple objectives", "[generate-edge-intersection-graph]")
+{
+    using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    generate_edge_intersection_graph_stats st{};
+
+    const gate_lyt layout{{3, 3}, twoddwave_clocking<gate_lyt>()};
+
+    SECTION("Identical objectives")
+    {
+        const std::vector<routing_objective<gate_lyt>> objectives{{{0, 0}, {3, 3}}, {{0, 0}, {3, 3}}};
+
+        const auto graph = generate_edge_intersection_graph(layout, objectives, {}, &st);
+
+        CHECK(st.number_of_unroutable_objectives == 0);
+        REQUIRE(st.cliques.size() == 2);
+        CHECK(st.cliques.front().size() == 20);
+        CHECK(st.cliques.back().size() == 20);
+
+        CHECK(graph.size_vertices() == 40);
+        // two complete graphs of 20 vertices each and all pairs of paths with identical source and target
+        CHECK(graph.size_edges() == 190 + 190 + 20 * 20);
+    }
+    SECTION("Identical objectives with path limit")
+    {
+        const std::vector<routing_objective<gate_lyt>> objectives{{{0, 0}, {3, 3}}, {{0, 0}, {3, 3}}};
+
+        generate_edge_intersection_graph_params ps{};
+        ps.path_limit = 2;
+
+        const auto graph = generate_edge_intersection_graph(layout, objectives, ps, &st);
+
+        CHECK(graph.size_vertices() == 4);
+        CHECK(graph.size_edges() == 1 + 1 + 2 * 2);
+    }
+    SECTION("Parallel objectives")
+    {
+        // (0,0) --> (0,3), (1,0) --> (1,3), (2,0) --> (2,3), each of which has only one path
+        const std::vector<routing_objective<gate_lyt>> objectives{
+            {{0, 0}, {0, 3}}, {{1, 0}, {1, 3}}, {{2, 0}, {2, 3}}};
+
+        const auto graph = generate_edge_intersection_graph(layout, objectives, {}, &st);
+
+        CHECK(st.cliques.size() == 3);
+        CHECK(graph.size_vertices() == 3);
+        CHECK(graph.size_edges() == 0);
+
+        CHECK(graph.at_vertex(0) == layout_coordinate_path<gate_lyt>{{{0, 0}, {0, 1}, {0, 2}, {0, 3}}});
+        CHECK(graph.at_vertex(1) == layout_coordinate_path<gate_lyt>{{{1, 0}, {1, 1}, {1, 2}, {1, 3}}});
+        CHECK(graph.at_vertex(2) == layout_coordinate_path<gate_lyt>{{{2, 0}, {2, 1}, {2, 2}, {2, 3}}});
+    }
+}
+
 TEST_CASE("EPG on 4x4 layouts with obstruction", "[generate-edge-intersection-graph]")
 {
     using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
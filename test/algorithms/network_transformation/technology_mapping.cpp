@@ -15,6 +15,10 @@
 #include <mockturtle/networks/xag.hpp>
 #include <mockturtle/networks/xmg.hpp>
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 using namespace fiction;
 
 template <typename Ntk>
@@ -283,3 +287,72 @@ TEMPLATE_TEST_CASE("Name conservation after technology mapping", "[technology-ma
     CHECK(mapped_maj.get_network_name() == "maj");
     map_and_check_all_standard_func(blueprints::maj4_network<TestType>());
 }
+
+TEST_CASE("Genlib description of technology mapping parameters", "[technology-mapping]")
+{
+    const auto aoi_genlib = technology_mapping_genlib(and_or_not());
+
+    CHECK(aoi_genlib.find("inv1") != std::string::npos);
+    CHECK(aoi_genlib.find("and2") != std::string::npos);
+    CHECK(aoi_genlib.find("or2") != std::string::npos);
+    CHECK(aoi_genlib.find("maj3") == std::string::npos);
+
+    CHECK(technology_mapping_genlib(and_or_not()) == aoi_genlib);
+    CHECK(technology_mapping_genlib(and_or_not_maj()) != aoi_genlib);
+
+    auto decay_params  = and_or_not_maj();
+    decay_params.decay = true;
+
+    CHECK(technology_mapping_genlib(decay_params) != technology_mapping_genlib(and_or_not_maj()));
+}
+
+TEMPLATE_TEST_CASE("Repeated technology mapping with cached library", "[technology-mapping]", mockturtle::aig_network,
+                   mockturtle::mig_network)
+{
+    const auto ntk = blueprints::maj4_network<TestType>();
+
+    technology_mapping_stats stats1{};
+    technology_mapping_stats stats2{};
+
+    const auto mapped1 = technology_mapping(ntk, all_supported_standard_functions(), &stats1);
+    const auto mapped2 = technology_mapping(ntk, all_supported_standard_functions(), &stats2);
+
+    REQUIRE(!stats1.mapper_stats.mapping_error);
+    REQUIRE(!stats2.mapper_stats.mapping_error);
+
+    CHECK(mapped1.num_gates() == mapped2.num_gates());
+
+    check_eq(ntk, mapped1);
+    check_eq(ntk, mapped2);
+}
+
+TEMPLATE_TEST_CASE("Parallel technology mapping", "[technology-mapping]", mockturtle::aig_network,
+                   mockturtle::xag_network, mockturtle::mig_network, mockturtle::xmg_network)
+{
+    const std::vector<TestType> ntks{blueprints::maj1_network<TestType>(), blueprints::and_or_network<TestType>(),
+                                     blueprints::inverter_network<TestType>(), blueprints::maj4_network<TestType>()};
+
+    for (const auto num_threads : {1ul, 2ul, 8ul})
+    {
+        auto params        = and_or_not_maj();
+        params.num_threads = num_threads;
+
+        std::vector<technology_mapping_stats> stats{};
+
+        const auto mapped_ntks = parallel_technology_mapping(ntks, params, &stats);
+
+        REQUIRE(mapped_ntks.size() == ntks.size());
+        REQUIRE(stats.size() == ntks.size());
+
+        for (std::size_t i = 0; i < ntks.size(); ++i)
+        {
+            REQUIRE(!stats[i].mapper_stats.mapping_error);
+
+            check_eq(ntks[i], mapped_ntks[i]);
+
+            CHECK(mapped_ntks[i].num_gates() == technology_mapping(ntks[i], params).num_gates());
+        }
+    }
+
+    CHECK(parallel_technology_mapping(std::vector<TestType>{}).empty());
+}
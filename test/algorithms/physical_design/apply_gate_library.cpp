@@ -17,11 +17,15 @@
 #include <fiction/technology/sidb_bestagon_library.hpp>
 #include <fiction/technology/sidb_defect_surface.hpp>
 #include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_gate_design_cache.hpp>
 #include <fiction/technology/sidb_on_the_fly_gate_library.hpp>
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <fmt/format.h>
+
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -131,6 +135,50 @@ TEST_CASE("Gate-level layout with AND gate", "[apply-gate-library]")
                 apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library, hex_even_row_gate_clk_lyt>(
                     layout, params));
         }
+        SECTION("Gate designs are reused via a cache")
+        {
+            design_gate_params.number_of_canvas_sidbs = 2;
+
+            params.design_gate_params = design_gate_params;
+            params.gate_design_cache  = std::make_shared<sidb_gate_design_cache>();
+
+            const auto first =
+                apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library, hex_even_row_gate_clk_lyt>(
+                    layout, params);
+
+            const auto num_designs = params.gate_design_cache->size();
+            const auto num_misses  = params.gate_design_cache->misses();
+
+            CHECK(num_designs > 0);
+
+            const auto second =
+                apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library, hex_even_row_gate_clk_lyt>(
+                    layout, params);
+
+            // no additional gate design has been attempted
+            CHECK(params.gate_design_cache->size() == num_designs);
+            CHECK(params.gate_design_cache->misses() == num_misses);
+            CHECK(params.gate_design_cache->hits() >= num_designs);
+
+            REQUIRE(first.num_cells() == second.num_cells());
+            first.foreach_cell([&first, &second](const auto& c)
+                               { CHECK(first.get_cell_type(c) == second.get_cell_type(c)); });
+
+            SECTION("Impossible designs are cached as well")
+            {
+                params.design_gate_params.number_of_canvas_sidbs = 1;
+
+                CHECK_THROWS(apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                              hex_even_row_gate_clk_lyt>(layout, params));
+
+                const auto num_misses_after_failure = params.gate_design_cache->misses();
+
+                CHECK_THROWS(apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                              hex_even_row_gate_clk_lyt>(layout, params));
+
+                CHECK(params.gate_design_cache->misses() == num_misses_after_failure);
+            }
+        }
     }
 }
 
@@ -592,3 +640,43 @@ TEST_CASE("Applying the QCA ONE gate library", "[apply-gate-library]")
         CHECK(layout.z() == 1);
     }
 }
+
+TEST_CASE("Multithreaded gate library application", "[apply-gate-library]")
+{
+    using GateLyt = cart_gate_clk_lyt;
+
+    // large enough to be split among multiple threads
+    auto gate_lyt = blueprints::straight_wire_rows_gate_layout<GateLyt>(39);
+
+    apply_gate_library_params sequential_params{};
+    sequential_params.num_threads = 1;
+
+    apply_gate_library_params parallel_params{};
+    parallel_params.num_threads = 4;
+
+    SECTION("Identical results")
+    {
+        const auto sequential =
+            apply_gate_library<qca_cell_clk_lyt, qca_one_library, GateLyt>(gate_lyt, sequential_params);
+        const auto parallel = apply_gate_library<qca_cell_clk_lyt, qca_one_library, GateLyt>(gate_lyt, parallel_params);
+
+        CHECK(parallel.num_cells() == sequential.num_cells());
+        CHECK(parallel.num_pis() == 39);
+        CHECK(parallel.num_pos() == 39);
+
+        sequential.foreach_cell(
+            [&parallel, &sequential](const auto& c)
+            {
+                CHECK(parallel.get_cell_type(c) == sequential.get_cell_type(c));
+                CHECK(parallel.get_cell_name(c) == sequential.get_cell_name(c));
+            });
+    }
+    SECTION("Exceptions are passed through")
+    {
+        const auto a = gate_lyt.create_pi("a", {0, 40});
+        const auto b = gate_lyt.create_pi("b", {1, 39});
+        gate_lyt.create_po(gate_lyt.create_xor(a, b, {1, 40}), "g", {2, 40});
+
+        CHECK_THROWS(apply_gate_library<qca_cell_clk_lyt, qca_one_library, GateLyt>(gate_lyt, parallel_params));
+    }
+}
@@ -24,6 +24,9 @@
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 using namespace fiction;
 
 template <typename Lyt>
@@ -65,6 +68,32 @@ void remove_assign_and_check_clocking(Lyt lyt)
     }
 }
 
+template <typename Lyt>
+void remove_assign_and_check_decomposed_clocking(Lyt lyt, const uint64_t region_size)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    const auto lyt_clone = lyt.clone();
+
+    for (const auto num_threads : {std::size_t{1}, std::size_t{4}})
+    {
+        remove_clocking(lyt);
+
+        determine_clocking_params params{};
+        params.region_size = region_size;
+        params.num_threads = num_threads;
+
+        determine_clocking_stats st{};
+
+        const auto result = determine_clocking(lyt, params, &st);
+
+        REQUIRE(result == true);
+        CHECK(st.num_regions > 1);
+
+        check_eq(lyt, lyt_clone);
+    }
+}
+
 TEST_CASE("Determine clock numbers for an empty layout", "[determine-clocking]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
@@ -145,3 +174,47 @@ TEST_CASE("Determine clock numbers for a non-clockable layout", "[determine-cloc
 
     CHECK(determine_clocking(lyt) == false);
 }
+
+TEST_CASE("Determine clock numbers via decomposition", "[determine-clocking]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    SECTION("simple layouts")
+    {
+        // crossing tiles must not be separated, even for regions of a single tile
+        remove_assign_and_check_decomposed_clocking(blueprints::crossing_layout<gate_layout>(), 1);
+        remove_assign_and_check_decomposed_clocking(blueprints::fanout_layout<gate_layout>(), 2);
+        remove_assign_and_check_decomposed_clocking(blueprints::unbalanced_and_layout<gate_layout>(), 3);
+    }
+    SECTION("complex layouts")
+    {
+        const auto lyt = orthogonal<gate_layout>(blueprints::maj4_network<mockturtle::aig_network>());
+
+        for (const auto region_size : {uint64_t{1}, uint64_t{5}, uint64_t{20}})
+        {
+            remove_assign_and_check_decomposed_clocking(lyt, region_size);
+        }
+
+        remove_assign_and_check_decomposed_clocking(
+            orthogonal<gate_layout>(blueprints::maj1_network<mockturtle::aig_network>(), {num_clks::THREE}), 4);
+    }
+    SECTION("hexagonal")
+    {
+        using hex_gate_layout =
+            gate_level_layout<clocked_layout<tile_based_layout<hexagonal_layout<offset::ucoord_t, even_row_hex>>>>;
+
+        remove_assign_and_check_decomposed_clocking(blueprints::row_clocked_and_xor_gate_layout<hex_gate_layout>(), 2);
+    }
+    SECTION("non-clockable layout")
+    {
+        auto lyt = blueprints::unclockable_gate_layout<gate_layout>();
+
+        determine_clocking_params params{};
+        params.region_size = 1;
+
+        determine_clocking_stats st{};
+
+        CHECK(determine_clocking(lyt, params, &st) == false);
+        CHECK(st.num_regions > 1);
+    }
+}
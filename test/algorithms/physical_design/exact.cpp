@@ -198,6 +198,13 @@ exact_physical_design_params&& minimize_crossings(exact_physical_design_params&&
     return std::move(ps);
 }
 
+exact_physical_design_params&& sat_backend(exact_physical_design_params&& ps) noexcept
+{
+    ps.backend = exact_physical_design_backend::SAT;
+
+    return std::move(ps);
+}
+
 void check_stats(const exact_physical_design_stats& st)
 {
     CHECK(std::chrono::duration_cast<std::chrono::milliseconds>(st.time_total).count() > 0);
@@ -228,7 +235,7 @@ void check_drvs(const Lyt& lyt)
 }
 
 template <typename Lyt, typename Ntk>
-Lyt generate_layout(const Ntk& ntk, const exact_physical_design_params& ps)
+Lyt generate_layout(const Ntk& ntk, const exact_physical_design_params& ps, exact_physical_design_stats* pst = nullptr)
 {
     exact_physical_design_stats stats{};
 
@@ -239,6 +246,11 @@ Lyt generate_layout(const Ntk& ntk, const exact_physical_design_params& ps)
     check_drvs(*layout);
     check_stats(stats);
 
+    if (pst != nullptr)
+    {
+        *pst = stats;
+    }
+
     return *layout;
 }
 template <typename Lyt, typename Ntk>
@@ -293,6 +305,31 @@ void check_with_gate_library(const Ntk& ntk, const exact_physical_design_params&
     check_io_names(ntk, layout);
 }
 
+template <typename Ntk>
+void check_sat_backend(const Ntk& ntk, const exact_physical_design_params& ps, const bool translatable = true)
+{
+    exact_physical_design_stats stats{};
+
+    const auto layout = generate_layout<cart_gate_clk_lyt>(ntk, ps, &stats);
+
+    check_eq(ntk, layout);
+    check_tp(layout, 1);
+    check_apply_lib<qca_cell_clk_lyt, qca_one_library>(layout);
+    check_io_names(ntk, layout);
+
+    if (translatable)
+    {
+        // the SAT solver must not silently be replaced by Z3
+        CHECK(stats.num_sat_checks > 0);
+        CHECK(stats.num_sat_fallbacks == 0);
+    }
+    else
+    {
+        CHECK(stats.num_sat_checks == 0);
+        CHECK(stats.num_sat_fallbacks > 0);
+    }
+}
+
 template <typename Lyt, typename Ntk>
 void check_without_gate_library(const Ntk& ntk, const exact_physical_design_params& ps)
 {
@@ -484,6 +521,67 @@ TEST_CASE("Exact Cartesian physical design", "[exact]")
     }
 }
 
+TEST_CASE("Exact physical design with the SAT backend", "[exact]")
+{
+    SECTION("Open clocking")
+    {
+        check_sat_backend(blueprints::and_or_network<mockturtle::mig_network>(),
+                          sat_backend(open(crossings(configuration()))));
+    }
+    SECTION("2DDWave clocking")
+    {
+        check_sat_backend(blueprints::and_or_network<mockturtle::mig_network>(),
+                          sat_backend(twoddwave(crossings(configuration()))));
+    }
+    SECTION("Border I/O")
+    {
+        check_sat_backend(blueprints::and_or_network<mockturtle::mig_network>(),
+                          sat_backend(twoddwave(crossings(border_io(configuration())))));
+    }
+    SECTION("Global synchronization")
+    {
+        exact_physical_design_stats stats{};
+
+        check_tp(generate_layout<cart_gate_clk_lyt>(
+                     blueprints::one_to_five_path_difference_network<technology_network>(),
+                     sat_backend(use(configuration())), &stats),
+                 1);
+
+        CHECK(stats.num_sat_checks > 0);
+        CHECK(stats.num_sat_fallbacks == 0);
+    }
+    SECTION("Same layout size as the SMT backend")
+    {
+        const auto ntk = blueprints::mux21_network<technology_network>();
+
+        exact_physical_design_stats smt_stats{};
+        exact_physical_design_stats sat_stats{};
+
+        const auto smt_layout = generate_layout<cart_gate_clk_lyt>(ntk, res(crossings(configuration())), &smt_stats);
+        const auto sat_layout =
+            generate_layout<cart_gate_clk_lyt>(ntk, sat_backend(res(crossings(configuration()))), &sat_stats);
+
+        check_eq(ntk, sat_layout);
+        CHECK(smt_layout.area() == sat_layout.area());
+
+        // the SMT backend never involves the SAT solver
+        CHECK(smt_stats.num_sat_checks == 0);
+        CHECK(smt_stats.num_sat_fallbacks == 0);
+        CHECK(sat_stats.num_sat_checks > 0);
+        CHECK(sat_stats.num_sat_fallbacks == 0);
+    }
+    SECTION("Minimize wires")
+    {
+        check_sat_backend(blueprints::one_to_five_path_difference_network<mockturtle::aig_network>(),
+                          sat_backend(res(crossings(minimize_wires(configuration())))));
+    }
+    SECTION("Synchronization elements fall back to Z3")
+    {
+        check_sat_backend(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>(),
+                          sat_backend(use(border_io(sync_elems(configuration())))), false);
+    }
+}
+
 TEST_CASE("Exact shifted Cartesian physical design", "[exact]")
 {
     SECTION("odd col")
@@ -25,6 +25,7 @@
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <stdexcept>
 
 using namespace fiction;
@@ -297,6 +298,75 @@ TEST_CASE("Multithreading", "[graph-oriented-layout-design]")
         REQUIRE(layout.has_value());
         check_eq(ntk, *layout);
     }
+
+    SECTION("More search space graphs than threads")
+    {
+        params.mode        = graph_oriented_layout_design_params::effort_mode::HIGHEST_EFFORT;
+        params.num_threads = 2;
+        const auto layout  = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+        REQUIRE(layout.has_value());
+        check_eq(ntk, *layout);
+    }
+
+    SECTION("Single worker thread")
+    {
+        params.mode        = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+        params.num_threads = 1;
+        const auto layout  = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+        REQUIRE(layout.has_value());
+        check_eq(ntk, *layout);
+    }
+}
+
+TEST_CASE("Shared cost bounds in single- and multithreaded mode", "[graph-oriented-layout-design]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+    const auto ntk    = blueprints::full_adder_network<technology_network>();
+
+    graph_oriented_layout_design_params params{};
+    params.mode         = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+    params.return_first = true;
+
+    graph_oriented_layout_design_stats first_stats{};
+    REQUIRE(graph_oriented_layout_design<gate_layout>(ntk, params, &first_stats).has_value());
+
+    const auto reference_area = first_stats.x_size * first_stats.y_size;
+
+    params.return_first = false;
+    params.seed         = 42;
+
+    std::optional<uint64_t> sequential_area{};
+
+    for (const auto multithreading : {false, true})
+    {
+        params.enable_multithreading = multithreading;
+
+        graph_oriented_layout_design_stats stats{};
+
+        const auto layout = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+        REQUIRE(layout.has_value());
+        check_eq(ntk, *layout);
+
+        // the shared cost bounds discard vertices that cannot lead to a better layout
+        CHECK(stats.num_pruned_vertices > 0);
+
+        const auto area = stats.x_size * stats.y_size;
+
+        if (!multithreading)
+        {
+            // a full sequential search can only improve upon the first layout it finds
+            CHECK(area <= reference_area);
+
+            sequential_area = area;
+        }
+        else
+        {
+            // pruning only discards vertices that cannot improve upon the best layout, so both searches find the same
+            // cost
+            REQUIRE(sequential_area.has_value());
+            CHECK(area == *sequential_area);
+        }
+    }
 }
 
 TEST_CASE("Different cost objectives", "[graph-oriented-layout-design]")
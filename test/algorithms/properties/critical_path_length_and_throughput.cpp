@@ -63,3 +63,66 @@ TEST_CASE("Unbalanced layout", "[throughput]")
 
     check(blueprints::unbalanced_and_layout<gate_layout>(), 2);
 }
+
+TEST_CASE("Incremental critical path length and throughput", "[throughput]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    auto layout = blueprints::unbalanced_and_layout<gate_layout>();
+
+    // clock the tiles that are going to be occupied
+    layout.assign_clock_number({1, 1}, static_cast<typename gate_layout::clock_number_t>(3));
+    layout.assign_clock_number({3, 1}, static_cast<typename gate_layout::clock_number_t>(3));
+    layout.assign_clock_number({3, 2}, static_cast<typename gate_layout::clock_number_t>(0));
+
+    incremental_critical_path_length_and_throughput analysis{layout};
+
+    const auto check_against_full_analysis = [&analysis, &layout]
+    {
+        const auto incremental_cp_tp = analysis.update();
+        const auto full_cp_tp        = critical_path_length_and_throughput(layout);
+
+        CHECK(incremental_cp_tp.critical_path_length == full_cp_tp.critical_path_length);
+        CHECK(incremental_cp_tp.throughput == full_cp_tp.throughput);
+
+        return incremental_cp_tp;
+    };
+
+    const auto initial_cp_tp = analysis.update();
+
+    CHECK(initial_cp_tp.critical_path_length == 6);
+    CHECK(initial_cp_tp.throughput == 2);
+    CHECK(analysis.num_reevaluated_tiles() == layout.num_gates() + layout.num_wires());
+
+    SECTION("No modifications")
+    {
+        check_against_full_analysis();
+        CHECK(analysis.num_reevaluated_tiles() == 0);
+    }
+    SECTION("Extending the critical path")
+    {
+        const auto w = layout.create_buf(layout.make_signal(layout.get_node({3, 0})), {3, 1});
+        check_against_full_analysis();
+        CHECK(analysis.num_reevaluated_tiles() == 1);
+
+        layout.create_po(w, "f2", {3, 2});
+        CHECK(check_against_full_analysis().critical_path_length == 8);
+        CHECK(analysis.num_reevaluated_tiles() == 1);
+    }
+    SECTION("Shortening the critical path")
+    {
+        layout.clear_tile({1, 2});
+        layout.clear_tile({2, 2});
+        check_against_full_analysis();
+
+        layout.move_node(layout.get_node({0, 2}), {1, 1});
+        layout.move_node(layout.get_node({2, 1}), {2, 1}, {layout.make_signal(layout.get_node({1, 1}))});
+        CHECK(check_against_full_analysis().critical_path_length == 4);
+    }
+    SECTION("Invalidation")
+    {
+        analysis.invalidate();
+        check_against_full_analysis();
+        CHECK(analysis.num_reevaluated_tiles() == layout.num_gates() + layout.num_wires());
+    }
+}
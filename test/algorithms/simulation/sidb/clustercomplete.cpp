@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <any>
 #include <cstdint>
+#include <limits>
 #include <set>
 #include <vector>
 
@@ -196,6 +197,50 @@ TEST_CASE("Exact Cluster Simulation of 2 Bestagon NAND gates", "[clustercomplete
                    Catch::Matchers::WithinAbs(1.3192717848, constants::ERROR_MARGIN));
     }
 
+    SECTION("Base 3, multiple threads, work is shared at every level")
+    {
+        params.simulation_parameters.base = 3;
+        params.available_threads          = 4;
+        params.work_splitting_threshold   = 0;
+
+        const sidb_simulation_result<sidb_cell_clk_lyt>& res = clustercomplete(cell_lyt, params);
+
+        CHECK(res.charge_distributions.size() == 81);
+        CHECK_THAT(minimum_energy(res.charge_distributions.cbegin(), res.charge_distributions.cend()),
+                   Catch::Matchers::WithinAbs(1.3192717848, constants::ERROR_MARGIN));
+    }
+
+    SECTION("Base 3, multiple threads, work is only shared at the top level")
+    {
+        params.simulation_parameters.base = 3;
+        params.available_threads          = 4;
+        params.work_splitting_threshold   = std::numeric_limits<uint64_t>::max();
+
+        const sidb_simulation_result<sidb_cell_clk_lyt>& res = clustercomplete(cell_lyt, params);
+
+        CHECK(res.charge_distributions.size() == 81);
+        CHECK_THAT(minimum_energy(res.charge_distributions.cbegin(), res.charge_distributions.cend()),
+                   Catch::Matchers::WithinAbs(1.3192717848, constants::ERROR_MARGIN));
+    }
+
+    SECTION("Base 3, multiple threads, statistics")
+    {
+        params.simulation_parameters.base = 3;
+        params.available_threads          = 4;
+
+        clustercomplete_stats st{};
+
+        const sidb_simulation_result<sidb_cell_clk_lyt>& res = clustercomplete(cell_lyt, params, &st);
+
+        CHECK(res.charge_distributions.size() == 81);
+
+        CHECK(st.time_ground_state_space.count() > 0.0);
+        CHECK(st.time_unfolding.count() > 0.0);
+        CHECK_THAT(st.time_total.count(),
+                   Catch::Matchers::WithinAbs((st.time_ground_state_space + st.time_unfolding).count(), 1e-9));
+        CHECK_THAT(res.simulation_runtime.count(), Catch::Matchers::WithinAbs(st.time_total.count(), 1e-9));
+    }
+
     // from now on, we use only one thread
     params.available_threads = 1;
 
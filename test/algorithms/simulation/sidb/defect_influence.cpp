@@ -19,6 +19,10 @@
 #include <fiction/utils/layout_utils.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
 #include <vector>
 
 using namespace fiction;
@@ -357,3 +361,66 @@ TEMPLATE_TEST_CASE("Defect influence when considering the change of the ground s
                    Catch::Matchers::WithinAbs(2.8999201713, constants::ERROR_MARGIN));
     }
 }
+
+TEST_CASE("Checkpoint and resume defect influence computation", "[defect-influence]")
+{
+    const auto checkpoint_file =
+        (std::filesystem::temp_directory_path() / "fiction_defect_influence_checkpoint.txt").string();
+
+    static_cast<void>(std::remove(checkpoint_file.c_str()));
+
+    auto params = defect_influence_params<cell<sidb_cell_clk_lyt_cube>>{
+        sidb_defect{sidb_defect_type::UNKNOWN, -1, sidb_simulation_parameters{}.epsilon_r,
+                    sidb_simulation_parameters{}.lambda_tf},
+        is_operational_params{sidb_simulation_parameters{2, -0.32}},
+        {2, 2},
+        defect_influence_params<cell<sidb_cell_clk_lyt_cube>>::influence_definition::GROUND_STATE_CHANGE};
+
+    params.checkpoint_file     = checkpoint_file;
+    params.checkpoint_interval = 3;
+
+    sidb_cell_clk_lyt_cube lyt{};
+    lyt.assign_cell_type({0, 0, 0}, sidb_cell_clk_lyt_cube::cell_type::NORMAL);
+
+    defect_influence_stats first_stats{};
+
+    const auto first_domain = defect_influence_grid_search(lyt, params, 1, &first_stats);
+
+    CHECK(first_stats.num_restored_defect_positions == 0);
+    CHECK(first_stats.num_checkpoints >= 1);
+    CHECK(std::filesystem::exists(checkpoint_file));
+
+    SECTION("resume from checkpoint")
+    {
+        defect_influence_stats second_stats{};
+
+        const auto second_domain = defect_influence_grid_search(lyt, params, 1, &second_stats);
+
+        CHECK(second_stats.num_restored_defect_positions == first_domain.size());
+        CHECK(second_stats.num_simulator_invocations == 0);
+        CHECK(second_domain.size() == first_domain.size());
+
+        first_domain.for_each([&second_domain](const auto& defect_pos, const auto& status)
+                              { CHECK(second_domain.contains(defect_pos) == std::optional{status}); });
+    }
+    SECTION("different defect")
+    {
+        params.defect.charge = 1;
+
+        CHECK_THROWS_AS(defect_influence_grid_search(lyt, params), std::invalid_argument);
+    }
+    SECTION("different simulation parameters")
+    {
+        params.operational_params.simulation_parameters.mu_minus = -0.28;
+
+        CHECK_THROWS_AS(defect_influence_grid_search(lyt, params), std::invalid_argument);
+    }
+    SECTION("different layout")
+    {
+        lyt.assign_cell_type({2, 0, 0}, sidb_cell_clk_lyt_cube::cell_type::NORMAL);
+
+        CHECK_THROWS_AS(defect_influence_grid_search(lyt, params), std::invalid_argument);
+    }
+
+    static_cast<void>(std::remove(checkpoint_file.c_str()));
+}
@@ -0,0 +1,194 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/iter/bdl_input_iterator.hpp>
+#include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
+#include <fiction/algorithms/simulation/sidb/defect_clearance.hpp>
+#include <fiction/algorithms/simulation/sidb/defect_influence.hpp>
+#include <fiction/algorithms/simulation/sidb/figures_of_merit.hpp>
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/physical_population_stability.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/technology/constants.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/layout_utils.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Figures of merit of the Bestagon AND gate", "[figures-of-merit]")
+{
+    const auto lyt  = blueprints::bestagon_and_gate<sidb_cell_clk_lyt_siqad>();
+    const auto spec = std::vector<tt>{create_and_tt()};
+
+    figures_of_merit_params<cell<sidb_cell_clk_lyt_siqad>> params{};
+    params.operational_params = is_operational_params{sidb_simulation_parameters{2, -0.32}};
+
+    SECTION("Critical temperature and band bending resilience")
+    {
+        figures_of_merit_stats stats{};
+        const auto             fom = evaluate_figures_of_merit(lyt, spec, params, &stats);
+
+        // each input combination is simulated only once
+        CHECK(stats.num_simulations == 4);
+
+        critical_temperature_params ct_params{};
+        ct_params.operational_params = params.operational_params;
+
+        REQUIRE(fom.critical_temperature.has_value());
+        CHECK_THAT(*fom.critical_temperature,
+                   Catch::Matchers::WithinAbs(critical_temperature_gate_based(lyt, spec, ct_params),
+                                              constants::ERROR_MARGIN));
+
+        const physical_population_stability_params pps_params{params.operational_params.simulation_parameters};
+
+        auto min_potential = std::numeric_limits<double>::infinity();
+
+        REQUIRE(fom.ground_state_population_stability.size() == 4);
+
+        bdl_input_iterator<sidb_cell_clk_lyt_siqad> bii{lyt, params.operational_params.input_bdl_iterator_params};
+
+        for (auto i = 0u; i < 4; ++i, ++bii)
+        {
+            const auto pop_stability = physical_population_stability(*bii, pps_params);
+
+            REQUIRE(!pop_stability.empty());
+            REQUIRE(fom.ground_state_population_stability[i].has_value());
+
+            const auto& ground_state = *fom.ground_state_population_stability[i];
+
+            CHECK(ground_state.critical_cell == pop_stability.front().critical_cell);
+            CHECK(ground_state.system_energy == pop_stability.front().system_energy);
+
+            for (const auto& transition : pop_stability.front().transition_potentials)
+            {
+                min_potential = std::min(min_potential, transition.second.second);
+            }
+        }
+
+        REQUIRE(fom.band_bending_resilience.has_value());
+        CHECK_THAT(*fom.band_bending_resilience, Catch::Matchers::WithinAbs(min_potential, constants::ERROR_MARGIN));
+
+        CHECK(!fom.operational_domain_ratio.has_value());
+        CHECK(fom.defect_clearances.empty());
+    }
+    SECTION("Single-threaded evaluation")
+    {
+        const auto fom = evaluate_figures_of_merit(lyt, spec, params);
+
+        params.num_threads = 1;
+
+        const auto fom_single_threaded = evaluate_figures_of_merit(lyt, spec, params);
+
+        REQUIRE(fom.critical_temperature.has_value());
+        REQUIRE(fom_single_threaded.critical_temperature.has_value());
+        CHECK_THAT(*fom.critical_temperature,
+                   Catch::Matchers::WithinAbs(*fom_single_threaded.critical_temperature, constants::ERROR_MARGIN));
+
+        REQUIRE(fom.band_bending_resilience.has_value());
+        REQUIRE(fom_single_threaded.band_bending_resilience.has_value());
+        CHECK_THAT(*fom.band_bending_resilience,
+                   Catch::Matchers::WithinAbs(*fom_single_threaded.band_bending_resilience, constants::ERROR_MARGIN));
+    }
+    SECTION("Band bending resilience with a heuristic simulation engine")
+    {
+        const auto fom_exact = evaluate_figures_of_merit(lyt, spec, params);
+
+        params.operational_params.sim_engine = sidb_simulation_engine::QUICKSIM;
+
+        const auto fom_heuristic = evaluate_figures_of_merit(lyt, spec, params);
+
+        // the ground states are determined exactly regardless of the simulation engine
+        REQUIRE(fom_exact.band_bending_resilience.has_value());
+        REQUIRE(fom_heuristic.band_bending_resilience.has_value());
+        CHECK_THAT(*fom_heuristic.band_bending_resilience,
+                   Catch::Matchers::WithinAbs(*fom_exact.band_bending_resilience, constants::ERROR_MARGIN));
+    }
+    SECTION("Defect clearance requires cube coordinates")
+    {
+        params.defects = {sidb_defect{sidb_defect_type::DB, -1, 5.6, 5}};
+
+        CHECK_THROWS_AS(evaluate_figures_of_merit(lyt, spec, params), std::invalid_argument);
+    }
+    SECTION("Operational domain")
+    {
+        params.evaluate_critical_temperature    = false;
+        params.evaluate_band_bending_resilience = false;
+        params.evaluate_operational_domain      = true;
+
+        params.op_domain_params.operational_params = params.operational_params;
+        params.op_domain_params.sweep_dimensions   = {{sweep_parameter::EPSILON_R, 5.0, 6.0, 0.5},
+                                                      {sweep_parameter::LAMBDA_TF, 4.5, 5.5, 0.5}};
+
+        figures_of_merit_stats stats{};
+        const auto             fom = evaluate_figures_of_merit(lyt, spec, params, &stats);
+
+        CHECK(stats.num_simulations == 0);
+        CHECK(!fom.critical_temperature.has_value());
+        CHECK(!fom.band_bending_resilience.has_value());
+        CHECK(fom.ground_state_population_stability.empty());
+
+        operational_domain_stats op_stats{};
+        [[maybe_unused]] const auto op_domain =
+            operational_domain_grid_search(lyt, spec, params.op_domain_params, &op_stats);
+
+        REQUIRE(op_stats.num_total_parameter_points == 9);
+
+        REQUIRE(fom.operational_domain_ratio.has_value());
+        CHECK_THAT(*fom.operational_domain_ratio,
+                   Catch::Matchers::WithinAbs(static_cast<double>(op_stats.num_operational_parameter_combinations) /
+                                                  static_cast<double>(op_stats.num_total_parameter_points),
+                                              constants::ERROR_MARGIN));
+    }
+}
+
+TEST_CASE("Defect clearance as figure of merit", "[figures-of-merit]")
+{
+    const auto lyt = convert_layout_to_fiction_coordinates<sidb_cell_clk_lyt_cube>(
+        blueprints::bestagon_and_gate<sidb_cell_clk_lyt_siqad>());
+    const auto spec = std::vector<tt>{create_and_tt()};
+
+    figures_of_merit_params<cell<sidb_cell_clk_lyt_cube>> params{};
+    params.operational_params = is_operational_params{sidb_simulation_parameters{2, -0.32}};
+
+    params.evaluate_critical_temperature    = false;
+    params.evaluate_band_bending_resilience = false;
+
+    params.defects = {sidb_defect{sidb_defect_type::SI_VACANCY, -1, 10.6, 5.9},
+                      sidb_defect{sidb_defect_type::DB, -1, 5.6, 5}};
+
+    params.defect_params.operational_params       = params.operational_params;
+    params.defect_params.additional_scanning_area = {6, 6};
+    params.defect_step_size                       = 4;
+
+    const auto fom = evaluate_figures_of_merit(lyt, spec, params);
+
+    REQUIRE(fom.defect_clearances.size() == 2);
+
+    for (auto i = 0u; i < params.defects.size(); ++i)
+    {
+        auto defect_params   = params.defect_params;
+        defect_params.defect = params.defects[i];
+
+        const auto clearance = calculate_defect_clearance(
+            lyt, defect_influence_grid_search(lyt, spec, defect_params, params.defect_step_size));
+
+        CHECK(fom.defect_clearances[i].defect_position == clearance.defect_position);
+        CHECK_THAT(fom.defect_clearances[i].defect_clearance_distance,
+                   Catch::Matchers::WithinAbs(clearance.defect_clearance_distance, constants::ERROR_MARGIN));
+    }
+}
@@ -373,6 +373,26 @@ TEMPLATE_TEST_CASE("Ground state space construction of a 28 DB layout", "[ground
         CHECK_THAT(gss_res.top_cluster->received_ext_pot_bounds.get<bound_direction::UPPER>(i),
                    Catch::Matchers::WithinAbs(0, constants::ERROR_MARGIN));
     }
+
+    SECTION("Multiple threads")
+    {
+        ground_state_space_params params{};
+        params.num_threads = 4;
+
+        const ground_state_space_results& gss_res_mt = ground_state_space(lyt, params);
+
+        CHECK(gss_res_mt.top_cluster->sidbs.size() == 28);
+        CHECK(gss_res_mt.top_cluster->charge_space.size() == gss_res.top_cluster->charge_space.size());
+        CHECK(gss_res_mt.projector_state_count == gss_res.projector_state_count);
+
+        for (uint64_t i = 0; i < 28; ++i)
+        {
+            CHECK_THAT(gss_res_mt.top_cluster->received_ext_pot_bounds.get<bound_direction::LOWER>(i),
+                       Catch::Matchers::WithinAbs(0, constants::ERROR_MARGIN));
+            CHECK_THAT(gss_res_mt.top_cluster->received_ext_pot_bounds.get<bound_direction::UPPER>(i),
+                       Catch::Matchers::WithinAbs(0, constants::ERROR_MARGIN));
+        }
+    }
 }
 
 template <typename Lyt>
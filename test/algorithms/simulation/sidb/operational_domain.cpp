@@ -18,8 +18,11 @@
 
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <cstdio>
+#include <filesystem>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 using namespace fiction;
@@ -144,6 +147,20 @@ TEST_CASE("operational_domain class member functions", "[operational-domain]")
     CHECK(opdom.get_dimension(1) == sweep_parameter::MU_MINUS);
 }
 
+TEST_CASE("Sweep dimension values", "[operational-domain]")
+{
+    const auto values = sweep_dimension_values({sweep_parameter::EPSILON_R, 1.0, 2.0, 0.25});
+
+    REQUIRE(values.size() == 5);
+    CHECK_THAT(values.front(), Catch::Matchers::WithinAbs(1.0, constants::ERROR_MARGIN));
+    CHECK_THAT(values.back(), Catch::Matchers::WithinAbs(2.0, constants::ERROR_MARGIN));
+
+    // the last step would exceed the maximum
+    CHECK(sweep_dimension_values({sweep_parameter::LAMBDA_TF, 1.0, 2.0, 0.4}).size() == 3);
+
+    CHECK(sweep_dimension_values({sweep_parameter::MU_MINUS, -0.3, -0.3, 0.1}).size() == 1);
+}
+
 TEST_CASE("Error handling of operational domain algorithms", "[operational-domain]")
 {
     const sidb_100_cell_clk_lyt_siqad lat{sidb_cell_clk_lyt_siqad{}};  // empty layout
@@ -191,6 +208,21 @@ TEST_CASE("Error handling of operational domain algorithms", "[operational-domai
                                 std::invalid_argument);
             }
         }
+        SECTION("adaptive_refinement")
+        {
+            // adaptive refinement operates on 2-dimensional and 3-dimensional parameter spaces
+            for (const auto& params : {zero_dimensional_params, one_dimensional_params, four_dimensional_params})
+            {
+                CHECK_THROWS_AS(
+                    operational_domain_adaptive_refinement(lat, std::vector<tt>{create_id_tt()}, 1, params),
+                    std::invalid_argument);
+            }
+
+            // the initial cell size must be positive
+            CHECK_THROWS_AS(operational_domain_adaptive_refinement(lat, std::vector<tt>{create_id_tt()}, 0,
+                                                                   three_dimensional_params),
+                            std::invalid_argument);
+        }
     }
 
     SECTION("invalid sweep dimensions")
@@ -777,6 +809,47 @@ TEST_CASE("BDL wire operational domain computation", "[operational-domain]")
             CHECK(op_domain_stats.num_operational_parameter_combinations <= 50);
             CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
         }
+        SECTION("adaptive_refinement")
+        {
+            const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector<tt>{create_id_tt()}, 4,
+                                                                          op_domain_params, &op_domain_stats);
+
+            // the whole area is operational, hence, only the corners of the initial cells (x: 0, 4, 8, 9; y: 0, 4)
+            // are evaluated
+            CHECK(op_domain.size() == 8);
+
+            // for the selected range, all samples should be within the parameters and operational
+            check_op_domain_params_and_operational_status(op_domain, op_domain_params, operational_status::OPERATIONAL);
+
+            CHECK(mockturtle::to_seconds(op_domain_stats.time_total) > 0.0);
+            CHECK(op_domain_stats.num_simulator_invocations == 16);
+            CHECK(op_domain_stats.num_evaluated_parameter_combinations == 8);
+            CHECK(op_domain_stats.num_operational_parameter_combinations == 8);
+            CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
+
+            SECTION("3-dimensional")
+            {
+                const auto z_dimension = operational_domain_value_range{sweep_parameter::MU_MINUS, -0.35, -0.29, 0.01};
+
+                op_domain_params.sweep_dimensions.push_back(z_dimension);
+
+                const auto op_domain_3d = operational_domain_adaptive_refinement(
+                    lat, std::vector<tt>{create_id_tt()}, 4, op_domain_params, &op_domain_stats);
+
+                // corners of the initial cells (x: 0, 4, 8, 9; y: 0, 4; z: 0, 4, 6)
+                CHECK(op_domain_3d.size() == 24);
+
+                // for the selected range, all samples should be within the parameters and operational
+                check_op_domain_params_and_operational_status(op_domain_3d, op_domain_params,
+                                                              operational_status::OPERATIONAL);
+
+                CHECK(mockturtle::to_seconds(op_domain_stats.time_total) > 0.0);
+                CHECK(op_domain_stats.num_simulator_invocations == 48);
+                CHECK(op_domain_stats.num_evaluated_parameter_combinations == 24);
+                CHECK(op_domain_stats.num_operational_parameter_combinations == 24);
+                CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
+            }
+        }
     }
 
     SECTION("non-operational area")
@@ -1042,6 +1115,31 @@ TEST_CASE("BDL wire operational domain computation", "[operational-domain]")
             CHECK(op_domain_stats.num_operational_parameter_combinations <= 80);
             CHECK(op_domain_stats.num_non_operational_parameter_combinations <= 176);
         }
+        SECTION("adaptive_refinement")
+        {
+            const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector<tt>{create_id_tt()}, 4,
+                                                                          op_domain_params, &op_domain_stats);
+
+            // only the border between the operational and the non-operational area is sampled at full resolution
+            CHECK(op_domain.size() < 256);
+
+            // for the selected range, all samples should be within the parameters
+            check_op_domain_params_and_operational_status(op_domain, op_domain_params, std::nullopt);
+
+            CHECK(mockturtle::to_seconds(op_domain_stats.time_total) > 0.0);
+            CHECK(op_domain_stats.num_evaluated_parameter_combinations == op_domain.size());
+            CHECK(op_domain_stats.num_operational_parameter_combinations > 0);
+            CHECK(op_domain_stats.num_operational_parameter_combinations <= 80);
+            CHECK(op_domain_stats.num_non_operational_parameter_combinations > 0);
+            CHECK(op_domain_stats.num_non_operational_parameter_combinations <= 176);
+
+            // all evaluated points agree with the grid search
+            const auto grid_domain =
+                operational_domain_grid_search(lat, std::vector<tt>{create_id_tt()}, op_domain_params);
+
+            op_domain.for_each([&grid_domain](const auto& pp, const auto& op_value)
+                               { CHECK(grid_domain.contains(pp) == std::optional{op_value}); });
+        }
     }
 }
 
@@ -1561,6 +1659,23 @@ TEST_CASE("Bestagon AND gate operational domain and temperature computation, usi
         CHECK(op_domain_stats.num_operational_parameter_combinations <= 9);
         CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
     }
+    SECTION("adaptive_refinement")
+    {
+        const auto op_domain = critical_temperature_domain_adaptive_refinement(
+            lyt, std::vector<tt>{create_and_tt()}, 2, op_domain_params, &op_domain_stats);
+
+        // the whole area is operational, hence, only the four corners of the single initial cell are evaluated
+        CHECK(op_domain.size() == 4);
+
+        // for the selected range, all samples should be within the parameters and operational
+        check_op_domain_params_and_operational_status(op_domain, op_domain_params, operational_status::OPERATIONAL);
+
+        CHECK(mockturtle::to_seconds(op_domain_stats.time_total) > 0.0);
+        CHECK(op_domain_stats.num_simulator_invocations == 16);
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations == 4);
+        CHECK(op_domain_stats.num_operational_parameter_combinations == 4);
+        CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
+    }
 }
 
 TEST_CASE("Two BDL pair wire with degeneracy for input 1", "[operational-domain]")
@@ -1622,3 +1737,72 @@ TEST_CASE("Two BDL pair wire with degeneracy for input 1", "[operational-domain]
         CHECK(op_domain_stats.num_non_operational_parameter_combinations == 8281);
     }
 }
+
+TEST_CASE("Checkpoint and resume operational domain computation", "[operational-domain]")
+{
+    const auto lyt = blueprints::bdl_wire<sidb_cell_clk_lyt_siqad>();
+
+    sidb_simulation_parameters sim_params{};
+    sim_params.base = 2;
+
+    const auto checkpoint_file =
+        (std::filesystem::temp_directory_path() / "fiction_operational_domain_checkpoint.bin").string();
+
+    static_cast<void>(std::remove(checkpoint_file.c_str()));
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sim_params;
+    op_domain_params.sweep_dimensions    = {{sweep_parameter::EPSILON_R, 5.0, 5.5, 0.1},
+                                            {sweep_parameter::LAMBDA_TF, 5.0, 5.2, 0.1}};
+    op_domain_params.checkpoint_file     = checkpoint_file;
+    op_domain_params.checkpoint_interval = 4;
+
+    operational_domain_stats first_stats{};
+
+    const auto first_op_domain =
+        operational_domain_grid_search(lyt, std::vector<tt>{create_id_tt()}, op_domain_params, &first_stats);
+
+    CHECK(first_op_domain.size() == 18);
+    CHECK(first_stats.num_evaluated_parameter_combinations == 18);
+    CHECK(first_stats.num_restored_parameter_points == 0);
+    // periodic checkpoints may be skipped while another thread is writing, but the final one is always written
+    CHECK(first_stats.num_checkpoints >= 1);
+    CHECK(std::filesystem::exists(checkpoint_file));
+
+    SECTION("resume from checkpoint")
+    {
+        operational_domain_stats second_stats{};
+
+        const auto second_op_domain =
+            operational_domain_grid_search(lyt, std::vector<tt>{create_id_tt()}, op_domain_params, &second_stats);
+
+        CHECK(second_stats.num_restored_parameter_points == 18);
+        CHECK(second_stats.num_evaluated_parameter_combinations == 0);
+        CHECK(second_stats.num_simulator_invocations == 0);
+        CHECK(second_op_domain.size() == 18);
+
+        first_op_domain.for_each([&second_op_domain](const auto& pp, const auto& op_value)
+                                 { CHECK(second_op_domain.contains(pp) == std::optional{op_value}); });
+    }
+    SECTION("extend the sweep range")
+    {
+        op_domain_params.sweep_dimensions[0].max = 6.0;
+
+        CHECK_THROWS_AS(operational_domain_grid_search(lyt, std::vector<tt>{create_id_tt()}, op_domain_params),
+                        std::invalid_argument);
+    }
+    SECTION("different simulation parameters")
+    {
+        op_domain_params.operational_params.simulation_parameters.mu_minus = -0.28;
+
+        CHECK_THROWS_AS(operational_domain_grid_search(lyt, std::vector<tt>{create_id_tt()}, op_domain_params),
+                        std::invalid_argument);
+    }
+    SECTION("different specification")
+    {
+        CHECK_THROWS_AS(operational_domain_grid_search(lyt, std::vector<tt>{create_not_tt()}, op_domain_params),
+                        std::invalid_argument);
+    }
+
+    static_cast<void>(std::remove(checkpoint_file.c_str()));
+}
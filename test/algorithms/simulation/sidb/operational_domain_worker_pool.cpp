@@ -0,0 +1,299 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain_worker_pool.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/checkpoint_utils.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+operational_domain_params bdl_wire_sweep_params()
+{
+    sidb_simulation_parameters sim_params{};
+    sim_params.base = 2;
+
+    operational_domain_params params{};
+    params.operational_params.simulation_parameters = sim_params;
+    params.sweep_dimensions                         = {{sweep_parameter::EPSILON_R, 1.0, 9.0, 1.0},
+                                                       {sweep_parameter::LAMBDA_TF, 1.0, 9.0, 1.0}};
+
+    return params;
+}
+
+// every point of the distributed result must have the status determined by grid search
+void check_consistency(const operational_domain& distributed, const operational_domain& reference)
+{
+    distributed.for_each([&reference](const auto& pp, const auto& op_value)
+                         { CHECK(reference.contains(pp) == std::optional{op_value}); });
+}
+
+}  // namespace
+
+TEST_CASE("Operational domain batch serialization", "[operational-domain-worker-pool]")
+{
+    const operational_domain_batch batch{42, {{0, 1}, {2, 3}, {4, 5}}};
+
+    std::stringstream batch_ss{};
+    detail::write_operational_domain_batch(batch, batch_ss);
+
+    const auto read_batch = detail::read_operational_domain_batch(batch_ss);
+
+    REQUIRE(read_batch.has_value());
+    CHECK(read_batch->id == 42);
+    CHECK(read_batch->step_points == batch.step_points);
+
+    const operational_domain_batch_result result{
+        42, {operational_status::OPERATIONAL, operational_status::NON_OPERATIONAL, operational_status::OPERATIONAL}, 7};
+
+    std::stringstream result_ss{};
+    detail::write_operational_domain_batch_result(result, result_ss);
+
+    const auto read_result = detail::read_operational_domain_batch_result(result_ss);
+
+    REQUIRE(read_result.has_value());
+    CHECK(read_result->id == 42);
+    CHECK(read_result->statuses == result.statuses);
+    CHECK(read_result->num_simulator_invocations == 7);
+
+    std::stringstream malformed{"fiction operational domain result v1\n42 2 0\n0\n"};
+    CHECK(!detail::read_operational_domain_batch_result(malformed).has_value());
+
+    CHECK(detail::operational_domain_file_id("batch_17.txt", "batch_", ".txt") == std::optional<uint64_t>{17});
+    CHECK(!detail::operational_domain_file_id("batch_17.txt.tmp", "batch_", ".txt").has_value());
+    CHECK(!detail::operational_domain_file_id("batch_x.txt", "batch_", ".txt").has_value());
+}
+
+TEST_CASE("Distributed operational domain computation with local workers", "[operational-domain-worker-pool]")
+{
+    const auto lyt  = blueprints::bdl_wire<sidb_cell_clk_lyt_siqad>();
+    const auto spec = std::vector<tt>{create_id_tt()};
+
+    distributed_operational_domain_params params{};
+    params.domain_params = bdl_wire_sweep_params();
+    params.batch_size    = 4;
+
+    const auto reference = operational_domain_grid_search(lyt, spec, params.domain_params);
+
+    local_operational_domain_worker_pool<sidb_cell_clk_lyt_siqad, tt> pool{lyt, spec, params.domain_params, 3};
+
+    CHECK(pool.capacity() == 6);
+
+    operational_domain_stats stats{};
+
+    SECTION("grid search")
+    {
+        params.algorithm = distributed_sweep_algorithm::GRID_SEARCH;
+
+        const auto op_domain = operational_domain_distributed(lyt, spec, pool, params, &stats);
+
+        CHECK(op_domain.size() == reference.size());
+        CHECK(stats.num_evaluated_parameter_combinations == 81);
+        CHECK(stats.num_simulator_invocations > 0);
+
+        check_consistency(op_domain, reference);
+    }
+    SECTION("random sampling")
+    {
+        params.algorithm = distributed_sweep_algorithm::RANDOM_SAMPLING;
+        params.samples   = 20;
+
+        const auto op_domain = operational_domain_distributed(lyt, spec, pool, params, &stats);
+
+        CHECK(op_domain.size() <= 20);
+        CHECK(stats.num_evaluated_parameter_combinations == op_domain.size());
+
+        check_consistency(op_domain, reference);
+    }
+    SECTION("flood fill")
+    {
+        params.algorithm = distributed_sweep_algorithm::FLOOD_FILL;
+        params.samples   = 10;
+
+        const auto op_domain = operational_domain_distributed(lyt, spec, pool, params, &stats);
+
+        check_consistency(op_domain, reference);
+
+        // the neighborhood of every operational point has been explored
+        const auto values_x = sweep_dimension_values(params.domain_params.sweep_dimensions[0]);
+        const auto values_y = sweep_dimension_values(params.domain_params.sweep_dimensions[1]);
+
+        for (std::size_t x = 0; x < values_x.size(); ++x)
+        {
+            for (std::size_t y = 0; y < values_y.size(); ++y)
+            {
+                const auto status = op_domain.contains(parameter_point{{values_x[x], values_y[y]}});
+
+                if (!status.has_value() || std::get<0>(*status) != operational_status::OPERATIONAL)
+                {
+                    continue;
+                }
+
+                for (std::size_t nx = x == 0 ? 0 : x - 1; nx <= std::min(x + 1, values_x.size() - 1); ++nx)
+                {
+                    for (std::size_t ny = y == 0 ? 0 : y - 1; ny <= std::min(y + 1, values_y.size() - 1); ++ny)
+                    {
+                        CHECK(op_domain.contains(parameter_point{{values_x[nx], values_y[ny]}}).has_value());
+                    }
+                }
+            }
+        }
+    }
+    SECTION("contour tracing")
+    {
+        params.algorithm = distributed_sweep_algorithm::CONTOUR_TRACING;
+        params.samples   = 10;
+
+        const auto op_domain = operational_domain_distributed(lyt, spec, pool, params, &stats);
+
+        CHECK(op_domain.size() <= reference.size());
+
+        check_consistency(op_domain, reference);
+    }
+    SECTION("invalid parameters")
+    {
+        params.batch_size = 0;
+
+        CHECK_THROWS_AS(operational_domain_distributed(lyt, spec, pool, params), std::invalid_argument);
+
+        params.batch_size = 4;
+        params.algorithm  = distributed_sweep_algorithm::FLOOD_FILL;
+        params.domain_params.sweep_dimensions.pop_back();
+
+        CHECK_THROWS_AS(operational_domain_distributed(lyt, spec, pool, params), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Distributed operational domain computation via a shared directory", "[operational-domain-worker-pool]")
+{
+    const auto lyt  = blueprints::bdl_wire<sidb_cell_clk_lyt_siqad>();
+    const auto spec = std::vector<tt>{create_id_tt()};
+
+    const auto directory = std::filesystem::temp_directory_path() / "fiction_operational_domain_workers";
+
+    distributed_operational_domain_params params{};
+    params.domain_params = bdl_wire_sweep_params();
+    params.batch_size    = 8;
+
+    const auto reference = operational_domain_grid_search(lyt, spec, params.domain_params);
+
+    operational_domain_stats stats{};
+
+    std::size_t num_worker_batches = 0;
+
+    {
+        shared_directory_operational_domain_worker_pool pool{directory, {4, std::chrono::milliseconds{1}}};
+
+        // stand-ins for worker processes on other machines
+        std::vector<std::size_t> batches_per_worker(2, 0);
+        std::vector<std::thread> workers{};
+
+        for (std::size_t i = 0; i < batches_per_worker.size(); ++i)
+        {
+            workers.emplace_back(
+                [&, i]
+                {
+                    batches_per_worker[i] = operational_domain_worker(lyt, spec, params.domain_params, directory,
+                                                                      {std::chrono::milliseconds{1}});
+                });
+        }
+
+        const auto op_domain = operational_domain_distributed(lyt, spec, pool, params, &stats);
+
+        pool.finish();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (const auto num_batches : batches_per_worker)
+        {
+            num_worker_batches += num_batches;
+        }
+
+        CHECK(op_domain.size() == reference.size());
+        check_consistency(op_domain, reference);
+    }
+
+    // 81 parameter points in batches of 8
+    CHECK(num_worker_batches == 11);
+    CHECK(stats.num_evaluated_parameter_combinations == 81);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Shared directory worker pool resubmits batches with malformed results", "[operational-domain-worker-pool]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "fiction_operational_domain_malformed_result";
+
+    {
+        shared_directory_operational_domain_worker_pool pool{directory, {1, std::chrono::milliseconds{1}}};
+
+        const operational_domain_batch batch{0, {{0, 0}, {1, 1}}};
+        pool.submit(batch);
+
+        const auto batch_file  = directory / detail::operational_domain_batch_file(0);
+        const auto result_file = directory / detail::operational_domain_result_file(0);
+
+        // a worker claimed the batch and left behind a result that lacks a status
+        std::filesystem::remove(batch_file);
+
+        {
+            std::ofstream os{result_file};
+            detail::write_operational_domain_batch_result({0, {operational_status::OPERATIONAL}, 1}, os);
+        }
+
+        // stand-in for a worker that evaluates the batch once it is handed out again
+        std::thread worker{[&]
+                           {
+                               while (std::filesystem::exists(result_file) || !std::filesystem::exists(batch_file))
+                               {
+                                   std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                               }
+
+                               std::filesystem::remove(batch_file);
+
+                               const operational_domain_batch_result result{
+                                   0, {operational_status::OPERATIONAL, operational_status::NON_OPERATIONAL}, 2};
+
+                               write_file_atomically(result_file.string(), [&result](std::ostream& os)
+                                                     { detail::write_operational_domain_batch_result(result, os); });
+                           }};
+
+        const auto result = pool.collect();
+
+        worker.join();
+
+        CHECK(result.id == 0);
+        CHECK(result.statuses ==
+              std::vector<operational_status>{operational_status::OPERATIONAL, operational_status::NON_OPERATIONAL});
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -7,9 +7,12 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/verification/design_rule_violations.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
 #include <fiction/types.hpp>
 
+#include <cstddef>
 #include <sstream>
+#include <string>
 
 using namespace fiction;
 
@@ -66,3 +69,153 @@ TEST_CASE("DRVs", "[drv]")
 {
     check_for_drvs(blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>(), 50, 1);
 }
+
+TEST_CASE("DRVs without report generation", "[drv]")
+{
+    const auto layout = blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>();
+
+    gate_level_drv_params ps{};
+    gate_level_drv_stats  st{};
+
+    ps.generate_report = false;
+    ps.out             = nullptr;
+
+    gate_level_drvs(layout, ps, &st);
+
+    CHECK(st.drvs == 50);
+    CHECK(st.warnings == 1);
+
+    CHECK(st.report["DRVs"] == 50);
+    CHECK(st.report["Warnings"] == 1);
+    CHECK(!st.report.contains("Non adjacent connections"));
+    CHECK(!st.report.contains("Improperly clocked tiles"));
+
+    // the report is identical in the remaining entries when generated
+    const auto full_st = get_drvs(layout);
+
+    CHECK(full_st.report.contains("Non adjacent connections"));
+    CHECK(full_st.report["DRVs"] == st.report["DRVs"]);
+    CHECK(full_st.report["Warnings"] == st.report["Warnings"]);
+}
+
+TEST_CASE("Multithreaded DRV checking", "[drv]")
+{
+    // enough occupied tiles for the tile-local checks to be split among 3 threads
+    cart_gate_clk_lyt layout{{129, 95}, twoddwave_clocking<cart_gate_clk_lyt>()};
+
+    for (auto y = 0u; y < 96; ++y)
+    {
+        auto s = layout.create_pi("x" + std::to_string(y), {0, y});
+
+        for (auto x = 1u; x < 129; ++x)
+        {
+            // every 16th row skips a tile, which leads to a non-adjacent connection
+            if (y % 16 == 0 && x == 64)
+            {
+                continue;
+            }
+
+            s = layout.create_buf(s, {x, y});
+        }
+
+        layout.create_po(s, "f" + std::to_string(y), {129, y});
+    }
+
+    const auto check_with_threads = [&layout](const std::size_t num_threads)
+    {
+        gate_level_drv_params ps{};
+        gate_level_drv_stats  st{};
+
+        ps.num_threads = num_threads;
+        ps.out         = nullptr;
+
+        gate_level_drvs(layout, ps, &st);
+
+        return st;
+    };
+
+    const auto sequential_st = check_with_threads(1);
+    const auto parallel_st   = check_with_threads(4);
+
+    CHECK(sequential_st.drvs > 0);
+    CHECK(parallel_st.drvs == sequential_st.drvs);
+    CHECK(parallel_st.warnings == sequential_st.warnings);
+    CHECK(parallel_st.report == sequential_st.report);
+}
+
+TEST_CASE("Incremental DRV checking", "[drv]")
+{
+    auto layout = blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>();
+
+    gate_level_drv_params ps{};
+
+    // suppress standard output
+    std::stringstream ss{};
+    ps.out = &ss;
+
+    incremental_gate_level_drvs checker{layout, ps};
+
+    const auto check_against_full_drvs = [&checker, &layout]
+    {
+        const auto incremental_st = checker.check();
+        const auto full_st        = get_drvs(layout);
+
+        CHECK(incremental_st.drvs == full_st.drvs);
+        CHECK(incremental_st.warnings == full_st.warnings);
+        CHECK(incremental_st.report == full_st.report);
+    };
+
+    const auto initial_st = checker.check();
+
+    CHECK(initial_st.drvs == 50);
+    CHECK(initial_st.warnings == 1);
+    CHECK(checker.num_rechecked_tiles() == layout.num_gates() + layout.num_wires());
+
+    SECTION("No modifications")
+    {
+        check_against_full_drvs();
+        CHECK(checker.num_rechecked_tiles() == 0);
+    }
+    SECTION("Moving a node")
+    {
+        layout.move_node(layout.get_node({1, 5}), {3, 4});
+        check_against_full_drvs();
+        CHECK(checker.num_rechecked_tiles() > 0);
+
+        layout.move_node(layout.get_node({3, 4}), {1, 5},
+                         {layout.make_signal(layout.get_node({0, 0})), layout.make_signal(layout.get_node({1, 0}))});
+        check_against_full_drvs();
+    }
+    SECTION("Reconnecting to non-adjacent tiles")
+    {
+        // the fanouts of x1 and x2 shrink while the one of x3 grows, none of which is adjacent to the modified node
+        layout.move_node(layout.get_node({3, 5}), {3, 5}, {layout.make_signal(layout.get_node({2, 0}))});
+        check_against_full_drvs();
+
+        layout.move_node(layout.get_node({3, 5}), {3, 5},
+                         {layout.make_signal(layout.get_node({0, 0})), layout.make_signal(layout.get_node({1, 0}))});
+        check_against_full_drvs();
+    }
+    SECTION("Clearing tiles")
+    {
+        layout.clear_tile({1, 2});
+        check_against_full_drvs();
+
+        layout.clear_tile({0, 0});
+        check_against_full_drvs();
+    }
+    SECTION("Creating and connecting nodes")
+    {
+        const auto w = layout.create_buf(layout.make_signal(layout.get_node({2, 3})), {3, 3});
+        check_against_full_drvs();
+
+        layout.connect(w, layout.get_node({3, 5}));
+        check_against_full_drvs();
+    }
+    SECTION("Invalidation")
+    {
+        checker.invalidate();
+        check_against_full_drvs();
+        CHECK(checker.num_rechecked_tiles() == layout.num_gates() + layout.num_wires());
+    }
+}
@@ -12,11 +12,17 @@
 #include <fiction/networks/technology_network.hpp>
 #include <fiction/types.hpp>
 
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 using namespace fiction;
 
 template <typename Spec, typename Impl>
@@ -182,3 +188,121 @@ TEST_CASE("No equivalence", "[equiv]")
     check_for_no_equiv(blueprints::and_not_gate_layout<hex_odd_row_gate_clk_lyt>(),
                        blueprints::and_or_gate_layout<hex_even_col_gate_clk_lyt>());
 }
+
+template <typename Ntk>
+Ntk ripple_carry_adder(const uint32_t bitwidth, const bool flip_carry)
+{
+    Ntk ntk{};
+
+    std::vector<typename Ntk::signal> a(bitwidth);
+    std::vector<typename Ntk::signal> b(bitwidth);
+
+    std::generate(a.begin(), a.end(), [&ntk] { return ntk.create_pi(); });
+    std::generate(b.begin(), b.end(), [&ntk] { return ntk.create_pi(); });
+
+    auto carry = ntk.get_constant(flip_carry);
+
+    mockturtle::carry_ripple_adder_inplace(ntk, a, b, carry);
+
+    std::for_each(a.cbegin(), a.cend(), [&ntk](const auto& f) { ntk.create_po(f); });
+    ntk.create_po(carry);
+
+    return ntk;
+}
+
+template <typename Spec, typename Impl>
+void check_counter_example(const Spec& spec, const Impl& impl, const std::vector<bool>& counter_example)
+{
+    REQUIRE(counter_example.size() == spec.num_pis());
+
+    const mockturtle::default_simulator<bool> sim{counter_example};
+
+    CHECK(mockturtle::simulate<bool>(spec, sim) != mockturtle::simulate<bool>(impl, sim));
+}
+
+TEST_CASE("Equivalence checking stages", "[equiv]")
+{
+    const auto aig_adder = ripple_carry_adder<mockturtle::aig_network>(10, false);
+    const auto xag_adder = ripple_carry_adder<mockturtle::xag_network>(10, false);
+    const auto xag_inc   = ripple_carry_adder<mockturtle::xag_network>(10, true);
+
+    SECTION("Structural hashing")
+    {
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, aig_adder, &st) == eq_type::STRONG);
+        CHECK(st.num_sat_calls == 0);
+        CHECK(!st.decided_by_simulation);
+    }
+    SECTION("Exhaustive simulation")
+    {
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_inputs = 20;
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, xag_adder, ps, &st) == eq_type::STRONG);
+        CHECK(st.num_sat_calls == 0);
+        CHECK(st.decided_by_simulation);
+
+        CHECK(equivalence_checking(aig_adder, xag_inc, ps, &st) == eq_type::NO);
+        CHECK(st.num_sat_calls == 0);
+        check_counter_example(aig_adder, xag_inc, st.counter_example);
+    }
+    SECTION("Random simulation")
+    {
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, xag_inc, &st) == eq_type::NO);
+        CHECK(st.num_sat_calls == 0);
+        CHECK(st.decided_by_simulation);
+        check_counter_example(aig_adder, xag_inc, st.counter_example);
+    }
+    SECTION("SAT sweeping")
+    {
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_inputs = 0;
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, xag_adder, ps, &st) == eq_type::STRONG);
+        CHECK(st.num_sat_calls > 0);
+        CHECK(st.num_merged_nodes > 0);
+        CHECK(!st.decided_by_simulation);
+
+        ps.sat_sweeping = false;
+
+        CHECK(equivalence_checking(aig_adder, xag_adder, ps, &st) == eq_type::STRONG);
+        CHECK(st.num_merged_nodes == 0);
+    }
+    SECTION("SAT without simulation")
+    {
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_inputs = 0;
+        ps.num_random_simulation_words      = 0;
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, xag_adder, ps, &st) == eq_type::STRONG);
+
+        CHECK(equivalence_checking(aig_adder, xag_inc, ps, &st) == eq_type::NO);
+        CHECK(st.num_sat_calls > 0);
+        CHECK(!st.decided_by_simulation);
+        check_counter_example(aig_adder, xag_inc, st.counter_example);
+    }
+    SECTION("Multiple threads")
+    {
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_inputs = 0;
+        ps.num_threads                      = 4;
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(aig_adder, xag_adder, ps, &st) == eq_type::STRONG);
+
+        ps.num_random_simulation_words = 0;
+
+        CHECK(equivalence_checking(aig_adder, xag_inc, ps, &st) == eq_type::NO);
+        check_counter_example(aig_adder, xag_inc, st.counter_example);
+    }
+}
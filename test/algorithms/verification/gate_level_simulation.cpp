@@ -0,0 +1,182 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/verification/gate_level_simulation.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/types.hpp>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/networks/aig.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_truth_tables(const Lyt& lyt)
+{
+    const auto expected = mockturtle::simulate<kitty::dynamic_truth_table>(
+        lyt, mockturtle::default_simulator<kitty::dynamic_truth_table>(static_cast<unsigned>(lyt.num_pis())));
+
+    CHECK(gate_level_truth_tables<Lyt, 64>(lyt) == expected);
+    CHECK(gate_level_truth_tables<Lyt, 256>(lyt) == expected);
+}
+
+mockturtle::aig_network adder_network(const uint32_t bitwidth)
+{
+    mockturtle::aig_network aig{};
+
+    std::vector<mockturtle::aig_network::signal> a(bitwidth);
+    std::vector<mockturtle::aig_network::signal> b(bitwidth);
+
+    std::generate(a.begin(), a.end(), [&aig] { return aig.create_pi(); });
+    std::generate(b.begin(), b.end(), [&aig] { return aig.create_pi(); });
+
+    auto carry = aig.get_constant(false);
+
+    mockturtle::carry_ripple_adder_inplace(aig, a, b, carry);
+
+    std::for_each(a.cbegin(), a.cend(), [&aig](const auto& f) { aig.create_po(f); });
+    aig.create_po(carry);
+
+    return aig;
+}
+
+TEMPLATE_TEST_CASE("Bit-parallel truth table simulation", "[gate-level-simulation]", cart_gate_clk_lyt,
+                   hex_even_row_gate_clk_lyt)
+{
+    check_truth_tables(blueprints::and_or_gate_layout<TestType>());
+    check_truth_tables(blueprints::xor_maj_gate_layout<TestType>());
+    check_truth_tables(blueprints::unbalanced_and_layout<TestType>());
+}
+
+TEST_CASE("Bit-parallel truth table simulation of special structures", "[gate-level-simulation]")
+{
+    check_truth_tables(blueprints::crossing_layout<cart_gate_clk_lyt>());
+    check_truth_tables(blueprints::fanout_layout<cart_gate_clk_lyt>());
+    check_truth_tables(blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>());
+}
+
+TEST_CASE("Multi-word truth table simulation", "[gate-level-simulation]")
+{
+    // 10 primary inputs require multiple words of both 64 and 256 bits
+    check_truth_tables(orthogonal<cart_gate_clk_lyt>(adder_network(5)));
+}
+
+TEST_CASE("Schedule reuse and partial simulation", "[gate-level-simulation]")
+{
+    using simulator = gate_level_simulator<cart_gate_clk_lyt, 256>;
+
+    auto layout = orthogonal<cart_gate_clk_lyt>(adder_network(4));
+
+    std::mt19937_64 generator{42};
+
+    const auto random_patterns = [&generator, &layout](const std::size_t num_words)
+    {
+        std::vector<simulator::pattern_type> patterns(layout.num_pis(), simulator::pattern_type(num_words));
+
+        for (auto& pattern : patterns)
+        {
+            for (auto& word : pattern)
+            {
+                std::generate(word.begin(), word.end(), [&generator] { return generator(); });
+            }
+        }
+
+        return patterns;
+    };
+
+    simulator sim{layout};
+
+    SECTION("Repeated simulation")
+    {
+        for (const auto num_words : {1ul, 3ul})
+        {
+            const auto patterns = random_patterns(num_words);
+
+            sim.simulate(patterns);
+
+            simulator fresh{layout};
+            fresh.simulate(patterns);
+
+            CHECK(sim.output_patterns() == fresh.output_patterns());
+        }
+    }
+    SECTION("Changed input pattern")
+    {
+        auto patterns = random_patterns(2);
+
+        sim.simulate(patterns);
+
+        patterns[0] = random_patterns(2)[0];
+
+        sim.set_input_pattern(0, patterns[0]);
+        sim.resimulate({layout.pi_at(0)});
+
+        CHECK(sim.num_reevaluated_nodes() > 0);
+        CHECK(sim.num_reevaluated_nodes() < sim.schedule_size());
+
+        simulator fresh{layout};
+        fresh.simulate(patterns);
+
+        CHECK(sim.output_patterns() == fresh.output_patterns());
+    }
+}
+
+TEST_CASE("Partial simulation after layout modification", "[gate-level-simulation]")
+{
+    using simulator = gate_level_simulator<cart_gate_clk_lyt>;
+
+    auto layout = blueprints::and_or_gate_layout<cart_gate_clk_lyt>();
+
+    const simulator::word_type x1{0xaaaaaaaaaaaaaaaaull};
+    const simulator::word_type x2{0xccccccccccccccccull};
+
+    simulator sim{layout};
+    sim.simulate({simulator::pattern_type{x1}, simulator::pattern_type{x2}});
+
+    const simulator::word_type and_word{0x8888888888888888ull};
+    const simulator::word_type or_word{0xeeeeeeeeeeeeeeeeull};
+    const simulator::word_type nand_word{0x7777777777777777ull};
+
+    CHECK(sim.output_pattern(0) == simulator::pattern_type{and_word});
+    CHECK(sim.output_pattern(1) == simulator::pattern_type{or_word});
+
+    // replace the OR gate by a NAND gate
+    layout.clear_tile({2, 1});
+    const auto nand = layout.create_nand(layout.make_signal(layout.get_node({1, 1})),
+                                         layout.make_signal(layout.get_node({2, 0})), {2, 1});
+
+    sim.resimulate({layout.get_node(nand)});
+
+    CHECK(sim.output_pattern(0) == simulator::pattern_type{and_word});
+    CHECK(sim.output_pattern(1) == simulator::pattern_type{nand_word});
+    CHECK(sim.num_reevaluated_nodes() == 2);
+}
+
+TEST_CASE("Simulation of nodes whose fanins do not respect the clocking", "[gate-level-simulation]")
+{
+    cart_gate_clk_lyt layout{{1, 1, 0}, twoddwave_clocking<cart_gate_clk_lyt>()};
+
+    const auto x1 = layout.create_pi("x1", {1, 0});
+    const auto x2 = layout.create_pi("x2", {0, 1});
+
+    // the AND gate is clocked before its inputs, i.e., it has no fanins
+    layout.create_and(x1, x2, {0, 0});
+
+    CHECK_THROWS_AS(gate_level_simulator<cart_gate_clk_lyt>{layout}, std::invalid_argument);
+    CHECK_THROWS_AS(gate_level_truth_tables(layout), std::invalid_argument);
+}
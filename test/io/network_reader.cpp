@@ -10,8 +10,15 @@
 #include <fiction/io/network_reader.hpp>
 #include <fiction/types.hpp>
 
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace fiction;
 
@@ -64,3 +71,98 @@ TEST_CASE("Read Verilog", "[network-reader]")
         CHECK(mux21.get_output_name(0) == "out");
     }
 }
+
+TEST_CASE("Read directory in parallel", "[network-reader]")
+{
+    constexpr const char* toy_directory = "../../benchmarks/TOY/";
+
+    std::ostringstream sequential_os{};
+
+    network_reader<tec_ptr> sequential_reader{toy_directory, sequential_os, network_reader_params{1, {}}};
+
+    const auto sequential_nets = sequential_reader.get_networks();
+
+    REQUIRE(!sequential_nets.empty());
+
+    const auto check_nets = [&sequential_nets](const std::vector<tec_ptr>& nets)
+    {
+        REQUIRE(nets.size() == sequential_nets.size());
+
+        for (auto i = 0u; i < nets.size(); ++i)
+        {
+            CHECK(nets[i]->get_network_name() == sequential_nets[i]->get_network_name());
+            check_eq(*nets[i], *sequential_nets[i]);
+        }
+    };
+
+    SECTION("Multiple threads")
+    {
+        std::ostringstream os{};
+
+        network_reader<tec_ptr> reader{toy_directory, os, network_reader_params{4, {}}};
+
+        CHECK(os.str() == sequential_os.str());
+        check_nets(reader.get_networks());
+        CHECK(reader.num_cache_hits() == 0);
+    }
+    SECTION("Snapshot cache")
+    {
+        const auto cache_directory = std::filesystem::temp_directory_path() / "fiction_network_reader_cache";
+        std::filesystem::remove_all(cache_directory);
+
+        const network_reader_params params{4, cache_directory.string()};
+
+        std::ostringstream first_os{};
+
+        network_reader<tec_ptr> first_reader{toy_directory, first_os, params};
+
+        CHECK(first_os.str() == sequential_os.str());
+        CHECK(first_reader.num_cache_hits() == 0);
+        check_nets(first_reader.get_networks());
+
+        std::ostringstream second_os{};
+
+        network_reader<tec_ptr> second_reader{toy_directory, second_os, params};
+
+        CHECK(second_os.str() == sequential_os.str());
+        CHECK(second_reader.num_cache_hits() == sequential_nets.size());
+        check_nets(second_reader.get_networks());
+
+        std::filesystem::remove_all(cache_directory);
+    }
+}
+
+TEST_CASE("Report parser diagnostics of parallel reads in order", "[network-reader]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "fiction_network_reader_diagnostics";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    for (auto i = 0u; i < 16u; ++i)
+    {
+        std::ofstream{(directory / fmt::format("broken_{:02}.v", i)).string()}
+            << fmt::format("module broken_{}(a, b);\ninput a;\noutput b;\nassign b = a & ;\nendmodule\n", i);
+    }
+
+    // the parser writes its diagnostics to the standard error stream
+    const auto read_diagnostics = [&directory](const std::size_t num_threads)
+    {
+        std::ostringstream os{}, diagnostics{};
+
+        auto* const cerr_buffer = std::cerr.rdbuf(diagnostics.rdbuf());
+
+        const network_reader<tec_ptr> reader{directory.string(), os, network_reader_params{num_threads, {}}};
+
+        std::cerr.rdbuf(cerr_buffer);
+
+        CHECK(!is_stream_empty(os));
+
+        return diagnostics.str();
+    };
+
+    const auto sequential = read_diagnostics(1);
+
+    CHECK(read_diagnostics(4) == sequential);
+
+    std::filesystem::remove_all(directory);
+}
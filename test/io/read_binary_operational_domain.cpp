@@ -0,0 +1,207 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/read_binary_operational_domain.hpp>
+#include <fiction/io/write_binary_operational_domain.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Read binary operational domain header", "[read-binary-operational-domain]")
+{
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::LAMBDA_TF, 1.0, 10.0, 0.5},
+                                                                       {sweep_parameter::MU_MINUS, -0.5, -0.1, 0.05}};
+
+    critical_temperature_domain ct_domain{{sweep_parameter::LAMBDA_TF, sweep_parameter::MU_MINUS}};
+    ct_domain.add_value(parameter_point{{1.0, -0.5}}, std::make_tuple(operational_status::OPERATIONAL, 12.5));
+
+    std::stringstream ss{};
+    write_binary_operational_domain(ct_domain, sweep_dimensions, ss);
+
+    const auto header = read_binary_operational_domain_header(ss);
+
+    CHECK(header.kind == binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN);
+    CHECK(header.num_samples == 1);
+
+    REQUIRE(header.sweep_dimensions.size() == 2);
+
+    for (std::size_t d = 0; d < 2; ++d)
+    {
+        CHECK(header.sweep_dimensions[d].dimension == sweep_dimensions[d].dimension);
+        CHECK(header.sweep_dimensions[d].min == sweep_dimensions[d].min);
+        CHECK(header.sweep_dimensions[d].max == sweep_dimensions[d].max);
+        CHECK(header.sweep_dimensions[d].step == sweep_dimensions[d].step);
+    }
+}
+
+TEST_CASE("Merge partial operational domain sweeps", "[read-binary-operational-domain]")
+{
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::EPSILON_R, 1.0, 2.0, 0.25}};
+
+    const auto x = sweep_dimension_values(sweep_dimensions[0]);
+
+    // two partial sweeps that overlap in x[2]
+    operational_domain first{{sweep_parameter::EPSILON_R}};
+    operational_domain second{{sweep_parameter::EPSILON_R}};
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        first.add_value(parameter_point{{x[i]}}, std::make_tuple(operational_status::OPERATIONAL));
+    }
+    for (std::size_t i = 2; i < x.size(); ++i)
+    {
+        second.add_value(parameter_point{{x[i]}}, std::make_tuple(operational_status::NON_OPERATIONAL));
+    }
+
+    std::stringstream first_ss{};
+    std::stringstream second_ss{};
+
+    write_binary_operational_domain(first, sweep_dimensions, first_ss);
+    write_binary_operational_domain(second, sweep_dimensions, second_ss);
+
+    operational_domain merged{};
+
+    const auto header = read_binary_operational_domain(merged, first_ss);
+    static_cast<void>(read_binary_operational_domain(merged, second_ss));
+
+    CHECK(header.num_samples == 3);
+
+    REQUIRE(merged.get_number_of_dimensions() == 1);
+    CHECK(merged.get_dimension(0) == sweep_parameter::EPSILON_R);
+    CHECK(merged.size() == x.size());
+
+    // samples that were already present take precedence
+    CHECK(merged.contains(parameter_point{{x[2]}}) == std::optional{std::make_tuple(operational_status::OPERATIONAL)});
+    CHECK(merged.contains(parameter_point{{x[4]}}) ==
+          std::optional{std::make_tuple(operational_status::NON_OPERATIONAL)});
+}
+
+TEST_CASE("Read binary critical temperature domain into operational domain", "[read-binary-operational-domain]")
+{
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::EPSILON_R, 1.0, 2.0, 0.5}};
+
+    const auto x = sweep_dimension_values(sweep_dimensions[0]);
+
+    critical_temperature_domain ct_domain{{sweep_parameter::EPSILON_R}};
+    ct_domain.add_value(parameter_point{{x[1]}}, std::make_tuple(operational_status::OPERATIONAL, 42.0));
+
+    std::stringstream ct_ss{};
+    write_binary_operational_domain(ct_domain, sweep_dimensions, ct_ss);
+
+    const auto opdom = read_binary_operational_domain<operational_domain>(ct_ss);
+
+    CHECK(opdom.contains(parameter_point{{x[1]}}) == std::optional{std::make_tuple(operational_status::OPERATIONAL)});
+
+    // operational domains do not contain critical temperatures
+    std::stringstream op_ss{};
+    write_binary_operational_domain(opdom, sweep_dimensions, op_ss);
+
+    CHECK_THROWS_AS(read_binary_operational_domain<critical_temperature_domain>(op_ss), std::invalid_argument);
+}
+
+TEST_CASE("Read malformed binary operational domains", "[read-binary-operational-domain]")
+{
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::EPSILON_R, 1.0, 2.0, 0.5}};
+
+    operational_domain opdom{{sweep_parameter::EPSILON_R}};
+    opdom.add_value(parameter_point{{1.0}}, std::make_tuple(operational_status::OPERATIONAL));
+
+    std::ostringstream os{};
+    write_binary_operational_domain(opdom, sweep_dimensions, os);
+
+    const auto bytes = os.str();
+
+    const auto read = [](const std::string& data)
+    {
+        std::istringstream is{data};
+        return read_binary_operational_domain<operational_domain>(is);
+    };
+
+    SECTION("Empty file")
+    {
+        CHECK_THROWS_AS(read(""), binary_operational_domain_parsing_error);
+    }
+    SECTION("Wrong magic bytes")
+    {
+        auto data = bytes;
+        data[0]   = 'X';
+
+        CHECK_THROWS_AS(read(data), binary_operational_domain_parsing_error);
+    }
+    SECTION("Unsupported version")
+    {
+        auto data = bytes;
+        data[12]  = 42;
+
+        CHECK_THROWS_AS(read(data), binary_operational_domain_parsing_error);
+    }
+    SECTION("Truncated columns")
+    {
+        CHECK_THROWS_AS(read(bytes.substr(0, bytes.size() - 1)), binary_operational_domain_parsing_error);
+    }
+    SECTION("Step index out of range")
+    {
+        auto data = bytes;
+        data[64]  = 3;  // the sweep consists of 3 values only
+
+        CHECK_THROWS_AS(read(data), binary_operational_domain_parsing_error);
+
+        // the domain remains unchanged if the file is malformed
+        operational_domain empty{};
+        std::istringstream is{data};
+
+        CHECK_THROWS_AS(read_binary_operational_domain(empty, is), binary_operational_domain_parsing_error);
+        CHECK(empty.get_number_of_dimensions() == 0);
+    }
+    SECTION("Excessive number of samples")
+    {
+        auto           data        = bytes;
+        const uint64_t num_samples = (uint64_t{1} << 62u) + 1;
+        std::memcpy(&data[16], &num_samples, sizeof(num_samples));
+
+        CHECK_THROWS_AS(read(data), binary_operational_domain_parsing_error);
+    }
+    SECTION("Mismatching step grid")
+    {
+        // 1.25 is not part of the file's step grid
+        operational_domain other{{sweep_parameter::EPSILON_R}};
+        other.add_value(parameter_point{{1.25}}, std::make_tuple(operational_status::NON_OPERATIONAL));
+
+        std::istringstream is{bytes};
+
+        CHECK_THROWS_AS(read_binary_operational_domain(other, is), std::invalid_argument);
+        CHECK(other.size() == 1);
+
+        // 2.5 exceeds the file's maximum
+        operational_domain exceeding{{sweep_parameter::EPSILON_R}};
+        exceeding.add_value(parameter_point{{2.5}}, std::make_tuple(operational_status::NON_OPERATIONAL));
+
+        is.clear();
+        is.seekg(0);
+
+        CHECK_THROWS_AS(read_binary_operational_domain(exceeding, is), std::invalid_argument);
+        CHECK(exceeding.size() == 1);
+    }
+    SECTION("Mismatching dimensions")
+    {
+        operational_domain other{{sweep_parameter::LAMBDA_TF}};
+
+        std::istringstream is{bytes};
+
+        CHECK_THROWS_AS(read_binary_operational_domain(other, is), std::invalid_argument);
+    }
+}
@@ -0,0 +1,183 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/io/read_gate_level_layout_snapshot.hpp>
+#include <fiction/io/write_gate_level_layout_snapshot.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/hash.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_snapshot_roundtrip(const Lyt& lyt)
+{
+    std::stringstream ss{};
+    write_gate_level_layout_snapshot(lyt, ss);
+
+    const auto read_lyt = read_gate_level_layout_snapshot<Lyt>(ss);
+
+    CHECK(read_lyt.get_layout_name() == lyt.get_layout_name());
+    CHECK(read_lyt.x() == lyt.x());
+    CHECK(read_lyt.y() == lyt.y());
+    CHECK(read_lyt.z() == lyt.z());
+
+    CHECK(read_lyt.get_clocking_scheme().name == lyt.get_clocking_scheme().name);
+    CHECK(read_lyt.num_clocks() == lyt.num_clocks());
+    CHECK(read_lyt.is_regularly_clocked() == lyt.is_regularly_clocked());
+
+    lyt.foreach_coordinate([&lyt, &read_lyt](const auto& c)
+                           { CHECK(read_lyt.get_clock_number(c) == lyt.get_clock_number(c)); });
+
+    CHECK(read_lyt.num_pis() == lyt.num_pis());
+    CHECK(read_lyt.num_pos() == lyt.num_pos());
+    CHECK(read_lyt.num_gates() == lyt.num_gates());
+    CHECK(read_lyt.num_wires() == lyt.num_wires());
+    CHECK(read_lyt.num_crossings() == lyt.num_crossings());
+
+    lyt.foreach_node(
+        [&lyt, &read_lyt](const auto& n)
+        {
+            if (lyt.is_constant(n))
+            {
+                return;
+            }
+
+            const auto t = lyt.get_tile(n);
+            const auto m = read_lyt.get_node(t);
+
+            CHECK(read_lyt.is_pi(m) == lyt.is_pi(n));
+            CHECK(read_lyt.is_po(m) == lyt.is_po(n));
+            CHECK(read_lyt.incoming_data_flow(t) == lyt.incoming_data_flow(t));
+
+            if (lyt.is_pi(n) || lyt.is_po(n))
+            {
+                CHECK(read_lyt.get_name(m) == lyt.get_name(n));
+            }
+            else
+            {
+                CHECK(read_lyt.node_function(m) == lyt.node_function(n));
+            }
+        });
+
+    check_eq(lyt, read_lyt);
+}
+
+TEST_CASE("Gate-level layout snapshot roundtrip", "[read-gate-level-layout-snapshot]")
+{
+    SECTION("Blueprints")
+    {
+        check_snapshot_roundtrip(blueprints::straight_wire_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::and_not_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::use_and_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::res_maj_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::crossing_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::fanout_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::ge_gt_le_lt_layout<cart_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::shifted_cart_and_or_inv_gate_layout<cart_odd_col_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::row_clocked_and_xor_gate_layout<cart_even_row_gate_clk_lyt>());
+        check_snapshot_roundtrip(blueprints::and_or_gate_layout<hex_even_row_gate_clk_lyt>());
+    }
+    SECTION("Irregular clocking")
+    {
+        check_snapshot_roundtrip(blueprints::open_tautology_gate_layout<hex_even_row_gate_clk_lyt>());
+    }
+    SECTION("Physical designs")
+    {
+        check_snapshot_roundtrip(orthogonal<cart_gate_clk_lyt>(blueprints::full_adder_network<technology_network>()));
+        check_snapshot_roundtrip(orthogonal<cart_gate_clk_lyt>(blueprints::clpl<technology_network>()));
+        check_snapshot_roundtrip(
+            orthogonal<cart_gate_clk_lyt>(blueprints::nary_operation_network<technology_network>()));
+    }
+}
+
+TEST_CASE("Malformed gate-level layout snapshots", "[read-gate-level-layout-snapshot]")
+{
+    std::stringstream ss{};
+    write_gate_level_layout_snapshot(blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>(), ss);
+
+    const auto snapshot = ss.str();
+
+    SECTION("Invalid magic bytes")
+    {
+        std::stringstream invalid{"FCNGLYXX" + snapshot.substr(8)};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<cart_gate_clk_lyt>(invalid),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+    SECTION("Truncated file")
+    {
+        std::stringstream truncated{snapshot.substr(0, snapshot.size() - 1)};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<cart_gate_clk_lyt>(truncated),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+    SECTION("Corrupted payload")
+    {
+        auto corrupted = snapshot;
+        corrupted[GATE_LEVEL_LAYOUT_SNAPSHOT_HEADER_SIZE + 4] ^= 0x01;
+
+        std::stringstream invalid{corrupted};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<cart_gate_clk_lyt>(invalid),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+    SECTION("Mismatching topology")
+    {
+        std::stringstream valid{snapshot};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<hex_even_row_gate_clk_lyt>(valid),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+    SECTION("Excessive payload size")
+    {
+        // the header claims a payload that is far larger than the file
+        auto corrupted = snapshot;
+
+        const auto payload_size = uint64_t{1} << 60u;
+        std::memcpy(corrupted.data() + 16, &payload_size, sizeof(payload_size));
+
+        std::stringstream invalid{corrupted};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<cart_gate_clk_lyt>(invalid),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+    SECTION("Negative aspect ratio")
+    {
+        auto payload = snapshot.substr(GATE_LEVEL_LAYOUT_SNAPSHOT_HEADER_SIZE);
+
+        // the aspect ratio follows the length-prefixed topology and layout names
+        const auto topology_size = detail::layout_topology_name<cart_gate_clk_lyt>().size();
+        const auto name_size     = blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>().get_layout_name().size();
+
+        const int32_t x = -1;
+        std::memcpy(payload.data() + 4 + topology_size + 4 + name_size, &x, sizeof(x));
+
+        // recompute the checksum such that the aspect ratio itself is rejected
+        auto corrupted = snapshot.substr(0, GATE_LEVEL_LAYOUT_SNAPSHOT_HEADER_SIZE) + payload;
+
+        const auto checksum = fnv1a_hash(payload);
+        std::memcpy(corrupted.data() + 24, &checksum, sizeof(checksum));
+
+        std::stringstream invalid{corrupted};
+
+        CHECK_THROWS_AS(read_gate_level_layout_snapshot<cart_gate_clk_lyt>(invalid),
+                        gate_level_layout_snapshot_parsing_error);
+    }
+}
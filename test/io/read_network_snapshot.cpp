@@ -0,0 +1,129 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/io/read_network_snapshot.hpp>
+#include <fiction/io/write_network_snapshot.hpp>
+#include <fiction/networks/technology_network.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Network snapshot roundtrip", "[read-network-snapshot]", mockturtle::aig_network,
+                   mockturtle::xag_network, mockturtle::mig_network, fiction::technology_network)
+{
+    using ntk_t = mockturtle::names_view<TestType>;
+
+    const auto roundtrip = [](const ntk_t& ntk)
+    {
+        std::stringstream ss{};
+        write_network_snapshot(ntk, ss);
+
+        const auto read_ntk = read_network_snapshot<ntk_t>(ss);
+
+        CHECK(read_ntk.num_pis() == ntk.num_pis());
+        CHECK(read_ntk.num_pos() == ntk.num_pos());
+        CHECK(read_ntk.get_network_name() == ntk.get_network_name());
+
+        check_eq(read_ntk, ntk);
+
+        return read_ntk;
+    };
+
+    SECTION("Names")
+    {
+        auto ntk = blueprints::full_adder_network<TestType>();
+        ntk.set_network_name("full_adder");
+
+        const auto read_ntk = roundtrip(ntk);
+
+        CHECK(read_ntk.get_name(read_ntk.make_signal(read_ntk.pi_at(0))) == "a");
+        CHECK(read_ntk.get_name(read_ntk.make_signal(read_ntk.pi_at(1))) == "b");
+        CHECK(read_ntk.get_name(read_ntk.make_signal(read_ntk.pi_at(2))) == "cin");
+        CHECK(read_ntk.get_output_name(0) == "sum");
+        CHECK(read_ntk.get_output_name(1) == "carry");
+    }
+    SECTION("Inverters and constants")
+    {
+        roundtrip(blueprints::mux21_network<TestType>());
+        roundtrip(blueprints::constant_gate_input_maj_network<TestType>());
+        roundtrip(blueprints::inverter_network<TestType>());
+    }
+    SECTION("Multi-input operations")
+    {
+        roundtrip(blueprints::nary_operation_network<TestType>());
+    }
+}
+
+TEST_CASE("Malformed network snapshots", "[read-network-snapshot]")
+{
+    using ntk_t = mockturtle::names_view<mockturtle::aig_network>;
+
+    std::stringstream ss{};
+    write_network_snapshot(blueprints::full_adder_network<mockturtle::aig_network>(), ss);
+
+    const auto snapshot = ss.str();
+
+    SECTION("Invalid magic bytes")
+    {
+        std::stringstream invalid{"FCNNTKXX" + snapshot.substr(8)};
+
+        CHECK_THROWS_AS(read_network_snapshot<ntk_t>(invalid), network_snapshot_parsing_error);
+    }
+    SECTION("Truncated file")
+    {
+        std::stringstream truncated{snapshot.substr(0, snapshot.size() - 3)};
+
+        CHECK_THROWS_AS(read_network_snapshot<ntk_t>(truncated), network_snapshot_parsing_error);
+    }
+    SECTION("Unknown gate kind")
+    {
+        // header (16 bytes), counts (12 bytes), empty network name (4 bytes), and PI names 'a', 'b', 'cin' (17 bytes)
+        auto invalid_gate = snapshot;
+        invalid_gate[49]  = static_cast<char>(0x7f);
+
+        std::stringstream invalid{invalid_gate};
+
+        CHECK_THROWS_AS(read_network_snapshot<ntk_t>(invalid), network_snapshot_parsing_error);
+    }
+    SECTION("Excessive number of nodes")
+    {
+        // the number of gates follows the header (16 bytes) and the number of PIs (4 bytes)
+        auto invalid_count = snapshot;
+
+        const auto num_gates = std::numeric_limits<uint32_t>::max();
+        std::memcpy(invalid_count.data() + 20, &num_gates, sizeof(num_gates));
+
+        std::stringstream invalid{invalid_count};
+
+        CHECK_THROWS_AS(read_network_snapshot<ntk_t>(invalid), network_snapshot_parsing_error);
+    }
+    SECTION("Excessive string length")
+    {
+        // the network name's length follows the header (16 bytes) and the counts (12 bytes)
+        auto invalid_length = snapshot;
+
+        const auto length = std::numeric_limits<uint32_t>::max();
+        std::memcpy(invalid_length.data() + 28, &length, sizeof(length));
+
+        std::stringstream invalid{invalid_length};
+
+        CHECK_THROWS_AS(read_network_snapshot<ntk_t>(invalid), network_snapshot_parsing_error);
+    }
+}
@@ -0,0 +1,100 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/io/stream_cell_level_layout.hpp>
+#include <fiction/io/write_qca_layout.hpp>
+#include <fiction/io/write_sqd_layout.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+#include <fiction/types.hpp>
+
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Stream QCA ONE layouts to QCADesigner files", "[stream-cell-level-layout]", cart_gate_clk_lyt,
+                   cart_even_row_gate_clk_lyt)
+{
+    const auto check = [](const TestType& gate_lyt, const write_qca_layout_params& ps)
+    {
+        std::stringstream expected{}, streamed{};
+
+        write_qca_layout(apply_gate_library<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt), expected, ps);
+        stream_qca_layout<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt, streamed, ps);
+
+        CHECK(streamed.str() == expected.str());
+    };
+
+    SECTION("without crossings")
+    {
+        check(blueprints::straight_wire_gate_layout<TestType>(), {});
+    }
+    SECTION("with crossings")
+    {
+        const auto gate_lyt = blueprints::optimization_layout_corner_case_outputs_2<TestType>();
+
+        check(gate_lyt, {});
+        check(gate_lyt, write_qca_layout_params{false});
+    }
+}
+
+TEST_CASE("Stream large QCA ONE layout to a QCADesigner file", "[stream-cell-level-layout]")
+{
+    using gate_lyt = cart_gate_clk_lyt;
+
+    auto layout = blueprints::straight_wire_rows_gate_layout<gate_lyt>(19);
+    layout.set_layout_name("wires");
+
+    std::stringstream expected{}, streamed{};
+
+    write_qca_layout(apply_gate_library<qca_cell_clk_lyt, qca_one_library>(layout), expected);
+    stream_qca_layout<qca_cell_clk_lyt, qca_one_library>(layout, streamed);
+
+    CHECK(streamed.str() == expected.str());
+}
+
+TEST_CASE("Stream Bestagon layout to an SQD file", "[stream-cell-level-layout]")
+{
+    auto gate_lyt = blueprints::row_clocked_and_xor_gate_layout<hex_even_row_gate_clk_lyt>();
+    gate_lyt.set_layout_name("Bestagon");
+
+    const auto cell_lyt = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(gate_lyt);
+
+    std::stringstream streamed{};
+    stream_sqd_layout<sidb_100_cell_clk_lyt, sidb_bestagon_library>(gate_lyt, streamed);
+
+    const auto read_lyt = read_sqd_layout<sidb_100_cell_clk_lyt>(streamed, "Bestagon");
+
+    CHECK(read_lyt.num_cells() == cell_lyt.num_cells());
+
+    cell_lyt.foreach_cell([&cell_lyt, &read_lyt](const auto& c)
+                          { CHECK(read_lyt.get_cell_type(c) == cell_lyt.get_cell_type(c)); });
+}
+
+TEST_CASE("Stream QCA ONE layout to an SQD file", "[stream-cell-level-layout]")
+{
+    const auto gate_lyt = blueprints::optimization_layout_corner_case_outputs_2<cart_gate_clk_lyt>();
+
+    std::stringstream expected{}, streamed{};
+
+    write_sqd_layout(apply_gate_library<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt), expected);
+    stream_sqd_layout<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt, streamed);
+
+    // the order of dots differs, but both files describe the same dots
+    const auto expected_lyt = read_sqd_layout<sidb_cell_clk_lyt_siqad>(expected);
+    const auto streamed_lyt = read_sqd_layout<sidb_cell_clk_lyt_siqad>(streamed);
+
+    CHECK(streamed_lyt.num_cells() == expected_lyt.num_cells());
+
+    expected_lyt.foreach_cell([&expected_lyt, &streamed_lyt](const auto& c)
+                              { CHECK(streamed_lyt.get_cell_type(c) == expected_lyt.get_cell_type(c)); });
+}
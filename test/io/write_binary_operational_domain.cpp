@@ -0,0 +1,159 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/read_binary_operational_domain.hpp>
+#include <fiction/io/write_binary_operational_domain.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+template <typename T>
+T value_at(const std::string& bytes, const std::size_t offset)
+{
+    T value{};
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+
+    return value;
+}
+
+}  // namespace
+
+TEST_CASE("Write binary operational domain", "[write-binary-operational-domain]")
+{
+    operational_domain opdom{};
+
+    opdom.add_dimension(sweep_parameter::EPSILON_R);
+    opdom.add_dimension(sweep_parameter::LAMBDA_TF);
+
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::EPSILON_R, 5.0, 5.2, 0.1},
+                                                                       {sweep_parameter::LAMBDA_TF, 5.0, 5.1, 0.1}};
+
+    // use the sampled values to obtain the exact keys that the operational domain algorithms would produce
+    const auto x = sweep_dimension_values(sweep_dimensions[0]);
+    const auto y = sweep_dimension_values(sweep_dimensions[1]);
+
+    opdom.add_value(parameter_point{{x[1], y[1]}}, std::make_tuple(operational_status::NON_OPERATIONAL));
+    opdom.add_value(parameter_point{{x[0], y[0]}}, std::make_tuple(operational_status::OPERATIONAL));
+    opdom.add_value(parameter_point{{x[2], y[0]}}, std::make_tuple(operational_status::OPERATIONAL));
+
+    std::ostringstream os{};
+
+    write_binary_operational_domain(opdom, sweep_dimensions, os);
+
+    const auto bytes = os.str();
+
+    SECTION("Layout")
+    {
+        // header + 2 dimension descriptors + 2 index columns + status column, each padded to 8 bytes
+        CHECK(bytes.size() == 32 + 2 * 32 + 2 * 16 + 8);
+
+        CHECK(bytes.substr(0, 8) == "FCNOPDOM");
+        CHECK(value_at<uint32_t>(bytes, 8) == 0x01020304);
+        CHECK(value_at<uint16_t>(bytes, 12) == 1);
+        CHECK(value_at<uint8_t>(bytes, 14) == static_cast<uint8_t>(binary_operational_domain_kind::OPERATIONAL_DOMAIN));
+        CHECK(value_at<uint8_t>(bytes, 15) == 2);
+        CHECK(value_at<uint64_t>(bytes, 16) == 3);
+
+        CHECK(value_at<uint8_t>(bytes, 32) == static_cast<uint8_t>(sweep_parameter::EPSILON_R));
+        CHECK(value_at<double>(bytes, 40) == 5.0);
+        CHECK(value_at<double>(bytes, 48) == 5.2);
+        CHECK(value_at<double>(bytes, 56) == 0.1);
+        CHECK(value_at<uint8_t>(bytes, 64) == static_cast<uint8_t>(sweep_parameter::LAMBDA_TF));
+
+        // samples are sorted by their step indices
+        CHECK(value_at<uint32_t>(bytes, 96) == 0);
+        CHECK(value_at<uint32_t>(bytes, 100) == 1);
+        CHECK(value_at<uint32_t>(bytes, 104) == 2);
+        CHECK(value_at<uint32_t>(bytes, 112) == 0);
+        CHECK(value_at<uint32_t>(bytes, 116) == 1);
+        CHECK(value_at<uint32_t>(bytes, 120) == 0);
+
+        CHECK(value_at<uint8_t>(bytes, 128) == static_cast<uint8_t>(operational_status::OPERATIONAL));
+        CHECK(value_at<uint8_t>(bytes, 129) == static_cast<uint8_t>(operational_status::NON_OPERATIONAL));
+        CHECK(value_at<uint8_t>(bytes, 130) == static_cast<uint8_t>(operational_status::OPERATIONAL));
+    }
+    SECTION("Round trip")
+    {
+        std::istringstream is{bytes};
+
+        const auto read_opdom = read_binary_operational_domain<operational_domain>(is);
+
+        REQUIRE(read_opdom.get_number_of_dimensions() == 2);
+        CHECK(read_opdom.get_dimension(0) == sweep_parameter::EPSILON_R);
+        CHECK(read_opdom.get_dimension(1) == sweep_parameter::LAMBDA_TF);
+        CHECK(read_opdom.size() == 3);
+
+        opdom.for_each([&read_opdom](const auto& pp, const auto& op_val)
+                       { CHECK(read_opdom.contains(pp) == std::optional{op_val}); });
+    }
+    SECTION("Mismatching sweep dimensions")
+    {
+        std::ostringstream other{};
+
+        CHECK_THROWS_AS(write_binary_operational_domain(opdom, {sweep_dimensions[0]}, other), std::invalid_argument);
+        CHECK_THROWS_AS(write_binary_operational_domain(opdom, {sweep_dimensions[1], sweep_dimensions[0]}, other),
+                        std::invalid_argument);
+    }
+    SECTION("Sample off the step grid")
+    {
+        opdom.add_value(parameter_point{{5.05, y[0]}}, std::make_tuple(operational_status::OPERATIONAL));
+
+        std::ostringstream other{};
+
+        CHECK_THROWS_AS(write_binary_operational_domain(opdom, sweep_dimensions, other), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Write binary critical temperature domain", "[write-binary-operational-domain]")
+{
+    critical_temperature_domain ct_domain{};
+
+    ct_domain.add_dimension(sweep_parameter::MU_MINUS);
+
+    const std::vector<operational_domain_value_range> sweep_dimensions{{sweep_parameter::MU_MINUS, -0.35, -0.3, 0.01}};
+
+    const auto x = sweep_dimension_values(sweep_dimensions[0]);
+
+    ct_domain.add_value(parameter_point{{x[3]}}, std::make_tuple(operational_status::OPERATIONAL, 56.7));
+    ct_domain.add_value(parameter_point{{x[0]}}, std::make_tuple(operational_status::NON_OPERATIONAL, 0.0));
+
+    std::ostringstream os{};
+
+    write_binary_operational_domain(ct_domain, sweep_dimensions, os);
+
+    const auto bytes = os.str();
+
+    // header + 1 dimension descriptor + index column + status column + temperature column
+    CHECK(bytes.size() == 32 + 32 + 8 + 8 + 16);
+    CHECK(value_at<uint8_t>(bytes, 14) ==
+          static_cast<uint8_t>(binary_operational_domain_kind::CRITICAL_TEMPERATURE_DOMAIN));
+    CHECK(value_at<double>(bytes, 80) == 0.0);
+    CHECK(value_at<double>(bytes, 88) == 56.7);
+
+    std::istringstream is{bytes};
+
+    const auto read_ct_domain = read_binary_operational_domain<critical_temperature_domain>(is);
+
+    REQUIRE(read_ct_domain.size() == 2);
+    CHECK(read_ct_domain.contains(parameter_point{{x[3]}}) ==
+          std::optional{std::make_tuple(operational_status::OPERATIONAL, 56.7)});
+    CHECK(read_ct_domain.contains(parameter_point{{x[0]}}) ==
+          std::optional{std::make_tuple(operational_status::NON_OPERATIONAL, 0.0)});
+}
@@ -249,6 +249,47 @@ TEST_CASE("Cell type assignment", "[cell-level-layout]")
     CHECK(layout.get_cell_name({2, 4}).empty());
 }
 
+TEST_CASE("Bulk cell type assignment", "[cell-level-layout]")
+{
+    using cell_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    cell_layout layout{cell_layout::aspect_ratio{4, 4}, "AND"};
+
+    layout.assign_cell_types({{{0, 2}, qca_technology::cell_type::INPUT},
+                              {{2, 4}, qca_technology::cell_type::INPUT},
+                              {{2, 0}, qca_technology::cell_type::CONST_0},
+                              {{2, 1}, qca_technology::cell_type::NORMAL},
+                              {{2, 2}, qca_technology::cell_type::NORMAL},
+                              {{4, 2}, qca_technology::cell_type::OUTPUT}});
+
+    CHECK(layout.num_cells() == 6);
+    CHECK(layout.num_pis() == 2);
+    CHECK(layout.num_pos() == 1);
+
+    CHECK(layout.get_cell_type({2, 0}) == qca_technology::cell_type::CONST_0);
+    CHECK(layout.get_cell_type({2, 2}) == qca_technology::cell_type::NORMAL);
+    CHECK(layout.is_po({4, 2}));
+
+    // later assignments take precedence, empty cells remove previously assigned types
+    layout.assign_cell_types({{{0, 2}, qca_technology::cell_type::NORMAL},
+                              {{2, 0}, qca_technology::cell_type::EMPTY},
+                              {{4, 2}, qca_technology::cell_type::EMPTY},
+                              {{4, 2}, qca_technology::cell_type::OUTPUT}});
+
+    CHECK(layout.num_cells() == 5);
+    CHECK(layout.num_pis() == 1);
+    CHECK(layout.num_pos() == 1);
+
+    CHECK(layout.get_cell_type({0, 2}) == qca_technology::cell_type::NORMAL);
+    CHECK(layout.is_empty_cell({2, 0}));
+    CHECK(layout.is_po({4, 2}));
+
+    // an empty assignment leaves the layout untouched
+    layout.assign_cell_types({});
+
+    CHECK(layout.num_cells() == 5);
+}
+
 TEST_CASE("Cell mode assignment", "[cell-level-layout]")
 {
     using cell_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
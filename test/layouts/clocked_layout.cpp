@@ -214,3 +214,40 @@ TEST_CASE("Clocked layout properties", "[clocked-layout]")
         CHECK(layout.degree({2, 2}) == static_cast<clk_lyt::degree_t>(2));
     }
 }
+
+TEST_CASE("Statically clocked layout", "[clocked-layout]")
+{
+    using clk_lyt        = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using static_clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>, static_use_clocking<offset::ucoord_t>>;
+
+    CHECK(is_clocked_layout_v<static_clk_lyt>);
+    CHECK(has_is_incoming_clocked_v<static_clk_lyt>);
+    CHECK(has_foreach_outgoing_clocked_zone_v<static_clk_lyt>);
+
+    const clk_lyt        layout{clk_lyt::aspect_ratio{5, 5, 0}, use_clocking<clk_lyt>()};
+    const static_clk_lyt static_layout{static_clk_lyt::aspect_ratio{5, 5, 0}};
+
+    CHECK(static_layout.is_clocking_scheme(clock_name::USE));
+    CHECK(static_layout.is_regularly_clocked());
+    CHECK(static_layout.num_clocks() == layout.num_clocks());
+    CHECK(static_layout.max_clocked_in_degree() == layout.max_clocked_in_degree());
+    CHECK(static_layout.max_clocked_out_degree() == layout.max_clocked_out_degree());
+
+    const auto copy = static_layout.clone();
+
+    CHECK(copy.is_clocking_scheme(clock_name::USE));
+
+    layout.foreach_coordinate(
+        [&layout, &static_layout](const auto& cz)
+        {
+            CHECK(static_layout.get_clock_number(cz) == layout.get_clock_number(cz));
+            CHECK(static_layout.in_degree(cz) == layout.in_degree(cz));
+            CHECK(static_layout.out_degree(cz) == layout.out_degree(cz));
+
+            const auto incoming        = layout.incoming_clocked_zones(cz);
+            const auto static_incoming = static_layout.incoming_clocked_zones(cz);
+
+            CHECK(std::set<clk_lyt::coordinate>{incoming.cbegin(), incoming.cend()} ==
+                  std::set<clk_lyt::coordinate>{static_incoming.cbegin(), static_incoming.cend()});
+        });
+}
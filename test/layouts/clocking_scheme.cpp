@@ -2133,3 +2133,59 @@ TEST_CASE("Linear schemes", "[clocking-scheme]")
     check_linear_scheme(clock_name::SRS, false);
     check_linear_scheme(clock_name::BANCS, false);
 }
+
+TEST_CASE("Static clocking schemes", "[clocking-scheme]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord   = offset::ucoord_t;
+
+    static_assert(is_static_clocking_scheme_v<static_twoddwave_clocking<coord>>);
+    static_assert(!is_static_clocking_scheme_v<clocking_scheme<coord>>);
+
+    // clock numbers are available at compile time
+    static_assert(static_twoddwave_clocking<coord>::clock_number_of({3, 2}) == 1);
+    static_assert(static_use_clocking<coord>::clock_number_of({1, 1}) == 2);
+
+    const auto check_equivalence = [](const auto& static_scheme, const auto& runtime_scheme)
+    {
+        CHECK(static_scheme == std::string{runtime_scheme.name});
+        CHECK(static_scheme.num_clocks == runtime_scheme.num_clocks);
+        CHECK(static_scheme.template max_in_degree_on<clk_lyt>() == runtime_scheme.max_in_degree);
+        CHECK(static_scheme.max_out_degree == runtime_scheme.max_out_degree);
+        CHECK(static_scheme.is_regular());
+
+        const auto converted = static_scheme.to_clocking_scheme();
+
+        CHECK(converted.name == runtime_scheme.name);
+        CHECK(converted.num_clocks == runtime_scheme.num_clocks);
+
+        for (uint64_t y = 0; y < 12; ++y)
+        {
+            for (uint64_t x = 0; x < 12; ++x)
+            {
+                CHECK(static_scheme({x, y}) == runtime_scheme({x, y}));
+                CHECK(converted({x, y}) == runtime_scheme({x, y}));
+            }
+        }
+    };
+
+    check_equivalence(static_clocking_scheme<coord, clock_cutout::columnar_3>{},
+                      columnar_clocking<clk_lyt>(num_clks::THREE));
+    check_equivalence(static_columnar_clocking<coord>{}, columnar_clocking<clk_lyt>(num_clks::FOUR));
+    check_equivalence(static_clocking_scheme<coord, clock_cutout::row_3>{}, row_clocking<clk_lyt>(num_clks::THREE));
+    check_equivalence(static_row_clocking<coord>{}, row_clocking<clk_lyt>(num_clks::FOUR));
+    check_equivalence(static_clocking_scheme<coord, clock_cutout::twoddwave_3>{},
+                      twoddwave_clocking<clk_lyt>(num_clks::THREE));
+    check_equivalence(static_twoddwave_clocking<coord>{}, twoddwave_clocking<clk_lyt>(num_clks::FOUR));
+    check_equivalence(static_use_clocking<coord>{}, use_clocking<clk_lyt>());
+    check_equivalence(static_res_clocking<coord>{}, res_clocking<clk_lyt>());
+    check_equivalence(static_esr_clocking<coord>{}, esr_clocking<clk_lyt>());
+    check_equivalence(static_cfe_clocking<coord>{}, cfe_clocking<clk_lyt>());
+    check_equivalence(static_ripple_clocking<coord>{}, ripple_clocking<clk_lyt>());
+    check_equivalence(static_srs_clocking<coord>{}, srs_clocking<clk_lyt>());
+    check_equivalence(static_bancs_clocking<coord>{}, bancs_clocking<clk_lyt>());
+
+    CHECK(is_linear_scheme<clk_lyt>(static_twoddwave_clocking<coord>{}));
+    CHECK(is_linear_scheme<clk_lyt>(static_row_clocking<coord>{}));
+    CHECK(!is_linear_scheme<clk_lyt>(static_use_clocking<coord>{}));
+}
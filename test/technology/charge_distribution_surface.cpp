@@ -2331,3 +2331,81 @@ TEST_CASE("Tests for Si-111 lattice orientation", "[charge-distribution-surface]
                    Catch::Matchers::WithinAbs(0.14818, constants::ERROR_MARGIN));
     }
 }
+
+TEST_CASE("Shared views of charge states and potentials", "[charge-distribution-surface]")
+{
+    sidb_100_cell_clk_lyt_siqad lyt{};
+
+    lyt.assign_cell_type({0, 0, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 1, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+
+    charge_distribution_surface charge_layout{lyt, sidb_simulation_parameters{}};
+
+    const auto charges      = charge_layout.get_charge_state_vector();
+    const auto internal_pot = charge_layout.get_local_internal_potential_vector();
+    const auto external_pot = charge_layout.get_local_external_potential_vector();
+    const auto pot_mat      = charge_layout.get_chargeless_potential_matrix();
+
+    REQUIRE(charges->size() == 3);
+    REQUIRE(internal_pot->size() == 3);
+    REQUIRE(pot_mat->size() == 9);
+
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        CHECK((*charges)[i] == charge_layout.get_charge_state_by_index(i));
+        CHECK_THAT((*internal_pot)[i], Catch::Matchers::WithinAbs(
+                                           charge_layout.get_local_internal_potential_by_index(i).value(), 1e-12));
+
+        for (uint64_t j = 0; j < 3; ++j)
+        {
+            CHECK_THAT((*pot_mat)[i * 3 + j],
+                       Catch::Matchers::WithinAbs(charge_layout.get_chargeless_potential_by_indices(i, j), 1e-12));
+        }
+    }
+
+    SECTION("Views reflect updates")
+    {
+        charge_layout.assign_charge_state_by_index(1, sidb_charge_state::NEUTRAL);
+        charge_layout.update_local_internal_potential();
+        charge_layout.assign_global_external_potential(-0.1);
+
+        CHECK((*charges)[1] == sidb_charge_state::NEUTRAL);
+        CHECK_THAT((*internal_pot)[0], Catch::Matchers::WithinAbs(
+                                           charge_layout.get_local_internal_potential_by_index(0).value(), 1e-12));
+        REQUIRE(external_pot->size() == 3);
+        CHECK_THAT((*external_pot)[2], Catch::Matchers::WithinAbs(-0.1, 1e-12));
+    }
+    SECTION("Views outlive the surface's storage")
+    {
+        const auto old_pot = (*pot_mat)[1];
+
+        charge_layout.assign_cell_type({9, 1, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+
+        CHECK(charge_layout.get_chargeless_potential_matrix()->size() == 16);
+        CHECK(pot_mat->size() == 9);
+        CHECK_THAT((*pot_mat)[1], Catch::Matchers::WithinAbs(old_pot, 1e-12));
+    }
+    SECTION("Views reflect changed physical parameters")
+    {
+        const auto* data = pot_mat->data();
+
+        charge_layout.assign_physical_parameters(sidb_simulation_parameters{2, -0.32, 5.0});
+
+        // the matrix is updated in place
+        CHECK(pot_mat->data() == data);
+        CHECK_THAT((*pot_mat)[1],
+                   Catch::Matchers::WithinAbs(charge_layout.get_chargeless_potential_by_indices(0, 1), 1e-12));
+    }
+    SECTION("Copy assignments replace the storage")
+    {
+        auto other = charge_layout.clone();
+        other.assign_charge_state_by_index(0, sidb_charge_state::NEUTRAL);
+
+        charge_layout = other;
+
+        CHECK(charge_layout.get_charge_state_by_index(0) == sidb_charge_state::NEUTRAL);
+        CHECK((*charges)[0] == sidb_charge_state::NEGATIVE);
+        CHECK((*charge_layout.get_charge_state_vector())[0] == sidb_charge_state::NEUTRAL);
+    }
+}
@@ -0,0 +1,189 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
+#include <fiction/technology/sidb_defect_surface.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_gate_design_cache.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace fiction;
+
+using cell_lyt = sidb_defect_surface<sidb_100_cell_clk_lyt_cube>;
+
+namespace
+{
+
+cell_lyt wire_skeleton()
+{
+    cell_lyt skeleton{};
+
+    skeleton.assign_cell_type({0, 0, 0}, cell_lyt::cell_type::INPUT);
+    skeleton.assign_cell_type({2, 1, 0}, cell_lyt::cell_type::INPUT);
+    skeleton.assign_cell_type({6, 2, 0}, cell_lyt::cell_type::NORMAL);
+    skeleton.assign_cell_type({8, 3, 0}, cell_lyt::cell_type::NORMAL);
+    skeleton.assign_cell_type({12, 4, 0}, cell_lyt::cell_type::OUTPUT);
+    skeleton.assign_cell_type({14, 5, 0}, cell_lyt::cell_type::OUTPUT);
+
+    return skeleton;
+}
+
+}  // namespace
+
+TEST_CASE("Canonical gate design keys", "[sidb-gate-design-cache]")
+{
+    const design_sidb_gates_params<cell<cell_lyt>> params{};
+
+    const auto skeleton = wire_skeleton();
+    const auto key      = sidb_gate_design_cache::key(skeleton, std::vector<tt>{create_id_tt()}, params);
+
+    SECTION("Insertion order does not matter")
+    {
+        cell_lyt reversed{};
+
+        reversed.assign_cell_type({14, 5, 0}, cell_lyt::cell_type::OUTPUT);
+        reversed.assign_cell_type({12, 4, 0}, cell_lyt::cell_type::OUTPUT);
+        reversed.assign_cell_type({8, 3, 0}, cell_lyt::cell_type::NORMAL);
+        reversed.assign_cell_type({6, 2, 0}, cell_lyt::cell_type::NORMAL);
+        reversed.assign_cell_type({2, 1, 0}, cell_lyt::cell_type::INPUT);
+        reversed.assign_cell_type({0, 0, 0}, cell_lyt::cell_type::INPUT);
+
+        CHECK(sidb_gate_design_cache::key(reversed, std::vector<tt>{create_id_tt()}, params) == key);
+    }
+    SECTION("Specification")
+    {
+        CHECK(sidb_gate_design_cache::key(skeleton, std::vector<tt>{create_not_tt()}, params) != key);
+    }
+    SECTION("Parameters")
+    {
+        auto other_params                   = params;
+        other_params.number_of_canvas_sidbs = params.number_of_canvas_sidbs + 1;
+
+        CHECK(sidb_gate_design_cache::key(skeleton, std::vector<tt>{create_id_tt()}, other_params) != key);
+
+        other_params                                                   = params;
+        other_params.operational_params.simulation_parameters.mu_minus = -0.28;
+
+        CHECK(sidb_gate_design_cache::key(skeleton, std::vector<tt>{create_id_tt()}, other_params) != key);
+    }
+    SECTION("Defects")
+    {
+        auto first  = skeleton;
+        auto second = skeleton;
+
+        first.assign_sidb_defect({20, 10, 0}, sidb_defect{sidb_defect_type::DB, -1, 4.1, 1.8});
+        first.assign_sidb_defect({3, 7, 1}, sidb_defect{sidb_defect_type::SI_VACANCY, -1, 10.6, 5.9});
+
+        second.assign_sidb_defect({3, 7, 1}, sidb_defect{sidb_defect_type::SI_VACANCY, -1, 10.6, 5.9});
+        second.assign_sidb_defect({20, 10, 0}, sidb_defect{sidb_defect_type::DB, -1, 4.1, 1.8});
+
+        const auto first_key = sidb_gate_design_cache::key(first, std::vector<tt>{create_id_tt()}, params);
+
+        CHECK(first_key != key);
+        CHECK(sidb_gate_design_cache::key(second, std::vector<tt>{create_id_tt()}, params) == first_key);
+
+        second.assign_sidb_defect({20, 10, 0}, sidb_defect{sidb_defect_type::DB, -1, 5.6, 5.0});
+
+        CHECK(sidb_gate_design_cache::key(second, std::vector<tt>{create_id_tt()}, params) != first_key);
+    }
+}
+
+TEST_CASE("Gate design cache lookup and persistence", "[sidb-gate-design-cache]")
+{
+    sidb_gate_design_cache cache{};
+
+    CHECK(cache.size() == 0);
+    CHECK(!cache.lookup("a").has_value());
+    CHECK(cache.misses() == 1);
+
+    cache.insert("a", {true, "xx io l"});
+    cache.insert("b", {false, {}});
+
+    // existing entries are not overwritten
+    cache.insert("a", {false, {}});
+
+    CHECK(cache.size() == 2);
+
+    const auto a = cache.lookup("a");
+    REQUIRE(a.has_value());
+    CHECK(a->designable);
+    CHECK(a->cells == "xx io l");
+
+    const auto b = cache.lookup("b");
+    REQUIRE(b.has_value());
+    CHECK(!b->designable);
+
+    CHECK(cache.hits() == 2);
+    CHECK(cache.misses() == 1);
+
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_sidb_gate_design_cache.txt").string();
+
+    REQUIRE(cache.save(filename));
+
+    const sidb_gate_design_cache restored{filename};
+
+    CHECK(restored.size() == 2);
+
+    const auto restored_a = restored.lookup("a");
+    REQUIRE(restored_a.has_value());
+    CHECK(restored_a->designable);
+    CHECK(restored_a->cells == "xx io l");
+
+    const auto restored_b = restored.lookup("b");
+    REQUIRE(restored_b.has_value());
+    CHECK(!restored_b->designable);
+
+    std::remove(filename.c_str());
+
+    sidb_gate_design_cache missing{};
+    CHECK(!missing.load(filename));
+    CHECK(missing.size() == 0);
+
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK(cache.hits() == 0);
+}
+
+TEST_CASE("Gate design cache rejects malformed lines", "[sidb-gate-design-cache]")
+{
+    const auto filename =
+        (std::filesystem::temp_directory_path() / "fiction_sidb_gate_design_cache_malformed.txt").string();
+
+    {
+        std::ofstream file{filename};
+
+        file << "fiction sidb gate design cache v1\n"
+             << "valid\txx io l\n"
+             << "impossible\t-\n"
+             << "no separator\n"
+             << "\tno key\n"
+             << "empty\t\n"
+             << "too short\txx\n"
+             << "invalid cell types\txx?? l\n";
+    }
+
+    const sidb_gate_design_cache cache{filename, 7};
+
+    CHECK(cache.size() == 2);
+    CHECK(cache.num_malformed_lines() == 5);
+
+    const auto valid = cache.lookup("valid");
+    REQUIRE(valid.has_value());
+    CHECK(valid->cells == "xx io l");
+
+    CHECK(cache.lookup("impossible").has_value());
+    CHECK(!cache.lookup("too short").has_value());
+    CHECK(!cache.lookup("invalid cell types").has_value());
+
+    std::remove(filename.c_str());
+}
@@ -11,6 +11,7 @@
 #include <fiction/technology/cell_technologies.hpp>
 #include <fiction/traits.hpp>
 
+#include <fmt/format.h>
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
 #include <mockturtle/traits.hpp>
@@ -29,6 +30,29 @@ GateLyt straight_wire_gate_layout() noexcept
 
     return layout;
 }
+/**
+ * Creates a layout of `n` parallel straight wires, one per row, each leading from a PI at the western border to a PO
+ * at the eastern border. The layout has two empty rows at its southern border.
+ */
+template <typename GateLyt>
+GateLyt straight_wire_rows_gate_layout(const uint16_t n) noexcept
+{
+    GateLyt layout{{n, n + 1u}, fiction::twoddwave_clocking<GateLyt>()};
+
+    for (auto y = 0u; y < n; ++y)
+    {
+        auto s = layout.create_pi(fmt::format("x{}", y), {0, y});
+
+        for (auto x = 1u; x < n; ++x)
+        {
+            s = layout.create_buf(s, {x, y});
+        }
+
+        layout.create_po(s, fmt::format("f{}", y), {n, y});
+    }
+
+    return layout;
+}
 
 template <typename GateLyt>
 GateLyt three_wire_paths_gate_layout() noexcept
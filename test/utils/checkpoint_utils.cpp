@@ -0,0 +1,155 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/checkpoint_utils.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+using namespace fiction;
+
+namespace
+{
+
+std::string checkpoint_path(const std::string& name)
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+
+    static_cast<void>(std::remove(path.c_str()));
+
+    return path;
+}
+
+std::string read_contents(std::istream& is)
+{
+    std::string contents{};
+    std::getline(is, contents);
+
+    return contents;
+}
+
+}  // namespace
+
+TEST_CASE("Write file atomically", "[checkpoint-utils]")
+{
+    const auto filename = checkpoint_path("fiction_write_file_atomically.txt");
+
+    CHECK(write_file_atomically(filename, [](std::ostream& os) { os << "first"; }));
+
+    SECTION("Replace contents")
+    {
+        CHECK(write_file_atomically(filename, [](std::ostream& os) { os << "second"; }));
+
+        std::ifstream is{filename};
+        CHECK(read_contents(is) == "second");
+    }
+    SECTION("Throwing writer leaves the previous contents intact")
+    {
+        CHECK(!write_file_atomically(filename,
+                                     [](std::ostream& os)
+                                     {
+                                         os << "partial";
+                                         throw std::runtime_error("interrupted");
+                                     }));
+
+        std::ifstream is{filename};
+        CHECK(read_contents(is) == "first");
+    }
+    SECTION("Invalid path")
+    {
+        CHECK(!write_file_atomically((std::filesystem::path{filename} / "invalid").string(),
+                                     [](std::ostream& os) { os << "invalid"; }));
+    }
+
+    static_cast<void>(std::remove(filename.c_str()));
+    static_cast<void>(std::remove((filename + ".tmp").c_str()));
+}
+
+TEST_CASE("Fingerprint inputs", "[checkpoint-utils]")
+{
+    // reference values of the 64-bit FNV-1a hash
+    static_assert(fingerprint_inputs("") == 0xcbf29ce484222325ull);
+    static_assert(fingerprint_inputs("a") == 0xaf63dc4c8601ec8cull);
+
+    // fingerprints can be continued
+    CHECK(fingerprint_inputs("layout|params") == fingerprint_inputs("params", fingerprint_inputs("layout|")));
+    CHECK(fingerprint_inputs("layout|params") != fingerprint_inputs("layout|other params"));
+}
+
+TEST_CASE("Periodic checkpoint", "[checkpoint-utils]")
+{
+    SECTION("Disabled")
+    {
+        periodic_checkpoint checkpoint{"", 1};
+
+        CHECK(!checkpoint.enabled());
+        CHECK(!checkpoint.save([](std::ostream& os) { os << "unused"; }));
+        CHECK(!checkpoint.restore([](std::istream& is) { static_cast<void>(is); }));
+        CHECK(checkpoint.num_checkpoints() == 0);
+    }
+    SECTION("Write every n records and restore")
+    {
+        const auto filename = checkpoint_path("fiction_periodic_checkpoint.txt");
+
+        periodic_checkpoint checkpoint{filename, 3};
+
+        CHECK(checkpoint.enabled());
+        CHECK(!checkpoint.restore([](std::istream& is) { static_cast<void>(is); }));
+
+        std::size_t counter = 0;
+
+        for (auto i = 0u; i < 7; ++i)
+        {
+            ++counter;
+            checkpoint.record([&counter](std::ostream& os) { os << counter; });
+        }
+
+        CHECK(checkpoint.num_checkpoints() == 2);
+
+        std::string restored{};
+        CHECK(checkpoint.restore([&restored](std::istream& is) { restored = read_contents(is); }));
+        CHECK(restored == "6");
+
+        CHECK(checkpoint.save([&counter](std::ostream& os) { os << counter; }));
+        CHECK(checkpoint.num_checkpoints() == 3);
+
+        const periodic_checkpoint resumed{filename, 3};
+
+        CHECK(resumed.restore([&restored](std::istream& is) { restored = read_contents(is); }));
+        CHECK(restored == "7");
+
+        static_cast<void>(std::remove(filename.c_str()));
+    }
+    SECTION("Reject checkpoints of different computations")
+    {
+        const auto filename = checkpoint_path("fiction_periodic_checkpoint_fingerprint.txt");
+
+        periodic_checkpoint checkpoint{filename, 1, 42};
+        CHECK(checkpoint.save([](std::ostream& os) { os << "result"; }));
+
+        std::string restored{};
+        CHECK(checkpoint.restore([&restored](std::istream& is) { restored = read_contents(is); }));
+        CHECK(restored == "result");
+
+        const periodic_checkpoint different{filename, 1, 43};
+        CHECK_THROWS_AS(different.restore([](std::istream& is) { static_cast<void>(is); }), std::invalid_argument);
+
+        {
+            std::ofstream os{filename};
+            os << "result\n";
+        }
+
+        CHECK_THROWS_AS(checkpoint.restore([](std::istream& is) { static_cast<void>(is); }), std::invalid_argument);
+
+        static_cast<void>(std::remove(filename.c_str()));
+    }
+}
@@ -0,0 +1,184 @@
+//
+// Created on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+// instrumentation macros are only active if tracing is enabled at compile time
+#ifndef FICTION_TRACING
+#define FICTION_TRACING
+#endif
+
+#include <fiction/utils/tracing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+void traced_function()
+{
+    FICTION_TRACE_ZONE("traced_function");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+}
+
+std::size_t count_occurrences(const std::string& str, const std::string& pattern)
+{
+    std::size_t count = 0;
+
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size()))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+}  // namespace
+
+TEST_CASE("Trace recorder is inactive until started", "[tracing]")
+{
+    auto& recorder = trace_recorder::instance();
+
+    recorder.start();
+    recorder.stop();
+
+    CHECK(!recorder.is_enabled());
+
+    traced_function();
+    FICTION_TRACE_COUNTER("inactive counter", 42);
+
+    CHECK(recorder.zone_statistics().empty());
+
+    std::stringstream ss{};
+    recorder.write_chrome_trace(ss);
+
+    CHECK(count_occurrences(ss.str(), "\"name\"") == 0);
+}
+
+TEST_CASE("Record zones and counters", "[tracing]")
+{
+    auto& recorder = trace_recorder::instance();
+
+    recorder.start();
+
+    CHECK(recorder.is_enabled());
+
+    traced_function();
+    traced_function();
+
+    FICTION_TRACE_COUNTER("evaluated points", 7);
+
+    recorder.stop();
+
+    const auto statistics = recorder.zone_statistics();
+
+    REQUIRE(statistics.count("traced_function") == 1);
+    CHECK(statistics.at("traced_function").count == 2);
+    CHECK(statistics.at("traced_function").total_duration >= std::chrono::milliseconds{2});
+    CHECK(recorder.num_dropped_events() == 0);
+
+    std::stringstream ss{};
+    recorder.write_chrome_trace(ss);
+
+    const auto trace = ss.str();
+
+    CHECK(trace.rfind("{\"traceEvents\":[", 0) == 0);
+    CHECK(count_occurrences(trace, "\"name\":\"traced_function\"") == 2);
+    CHECK(count_occurrences(trace, "\"ph\":\"X\"") == 2);
+    CHECK(count_occurrences(trace, "\"ph\":\"C\"") == 1);
+    CHECK(count_occurrences(trace, "\"args\":{\"value\":7}") == 1);
+}
+
+TEST_CASE("Record zones on multiple threads", "[tracing]")
+{
+    auto& recorder = trace_recorder::instance();
+
+    // only store four events in total
+    recorder.start(4);
+
+    std::vector<std::thread> threads{};
+
+    for (auto i = 0u; i < 4; ++i)
+    {
+        threads.emplace_back(
+            []
+            {
+                traced_function();
+                traced_function();
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    recorder.stop();
+
+    // dropped events are still accounted for in the statistics
+    CHECK(recorder.zone_statistics().at("traced_function").count == 8);
+    CHECK(recorder.num_dropped_events() == 4);
+
+    std::stringstream ss{};
+    recorder.write_chrome_trace(ss);
+
+    CHECK(count_occurrences(ss.str(), "\"name\":\"traced_function\"") == 4);
+}
+
+TEST_CASE("Escape zone names in Chrome traces", "[tracing]")
+{
+    auto& recorder = trace_recorder::instance();
+
+    recorder.start();
+
+    {
+        const trace_zone zone{"quoted \"zone\""};
+    }
+
+    recorder.stop();
+
+    std::stringstream ss{};
+    recorder.write_chrome_trace(ss);
+
+    CHECK(count_occurrences(ss.str(), "\"name\":\"quoted \\\"zone\\\"\"") == 1);
+}
+
+TEST_CASE("Reuse buffers of terminated threads", "[tracing]")
+{
+    auto& recorder = trace_recorder::instance();
+
+    recorder.start();
+
+    for (auto i = 0u; i < 4; ++i)
+    {
+        std::thread{[] { traced_function(); }}.join();
+    }
+
+    recorder.stop();
+
+    CHECK(recorder.zone_statistics().at("traced_function").count == 4);
+
+    std::stringstream ss{};
+    recorder.write_chrome_trace(ss);
+
+    const auto trace = ss.str();
+
+    // the events of terminated threads are kept
+    CHECK(count_occurrences(trace, "\"name\":\"traced_function\"") == 4);
+
+    // all threads recorded into the same buffer since they did not run simultaneously
+    const auto tid_pos = trace.find("\"tid\":");
+    REQUIRE(tid_pos != std::string::npos);
+
+    const auto tid = trace.substr(tid_pos, trace.find(',', tid_pos) - tid_pos + 1);
+    CHECK(count_occurrences(trace, tid) == 4);
+}